@@ -3,12 +3,16 @@
  *********************/
 #include "aes_str.h"
 #include <mbedtls/aes.h>
+#include <mbedtls/gcm.h>
 #include <errno.h>
 #include <esp_log.h>
 
 #ifndef MBEDTLS_AES_C
 #error "not implemented"
 #endif
+#ifndef MBEDTLS_GCM_C
+#error "not implemented"
+#endif
 
 /*********************
  *      DEFINES
@@ -18,56 +22,59 @@ static const char *TAG = "aes_str";
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static inline int aes_set_key(mbedtls_aes_context *ctx, const uint8_t *key);
-static int aes_crypt_block(mbedtls_aes_context *ctx, int mode,
-						   const uint8_t *input, uint8_t *output);
+static inline int aes_set_key(mbedtls_aes_context *ctx, const uint8_t *key, int mode);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
+int aes_ctx_init(aes_ctx_t *ctx, const uint8_t key[32], int mode);
+int aes_ctx_crypt_ecb(aes_ctx_t *ctx, const uint8_t *input,
+					  size_t len, uint8_t *output);
+void aes_ctx_free(aes_ctx_t *ctx);
 int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
 				size_t len, uint8_t *ciphertext);
 int aes_decrypt(const uint8_t key[32], const uint8_t *ciphertext,
 				size_t len, uint8_t *plaintext);
+int aes_gcm_encrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+					const uint8_t *aad, size_t aad_len,
+					const uint8_t *plaintext, size_t len,
+					uint8_t *ciphertext, uint8_t tag[AES_GCM_TAG_SIZE]);
+int aes_gcm_decrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+					const uint8_t *aad, size_t aad_len,
+					const uint8_t *ciphertext, size_t len,
+					const uint8_t tag[AES_GCM_TAG_SIZE], uint8_t *plaintext);
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-static inline int aes_set_key(mbedtls_aes_context *ctx, const uint8_t *key)
+static inline int aes_set_key(mbedtls_aes_context *ctx, const uint8_t *key, int mode)
 {
+	if (mode == MBEDTLS_AES_DECRYPT)
+		return mbedtls_aes_setkey_dec(ctx, key, 256);
 	return mbedtls_aes_setkey_enc(ctx, key, 256);
 }
 
-static int aes_crypt_block(mbedtls_aes_context *ctx, int mode,
-						   const uint8_t *input, uint8_t *output)
-{
-	return mbedtls_aes_crypt_ecb(ctx, mode, input, output);
-}
-
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-int aes_crypt_ecb(const uint8_t *key, int mode,
-				  const uint8_t input[16], uint8_t output[16])
+int aes_ctx_init(aes_ctx_t *ctx, const uint8_t key[32], int mode)
 {
-	mbedtls_aes_context ctx;
 	int ret;
 
-	mbedtls_aes_init(&ctx);
+	mbedtls_aes_init(&ctx->aes);
+	ctx->mode = mode;
 
-	ret = aes_set_key(&ctx, key);
+	ret = aes_set_key(&ctx->aes, key, mode);
 	if (ret)
-		goto error;
-
-	ret = aes_crypt_block(&ctx, mode, input, output);
-error:
-	mbedtls_aes_free(&ctx);
-
+	{
+		ESP_LOGE(TAG, "setkey failed: %d", ret);
+		mbedtls_aes_free(&ctx->aes);
+	}
 	return ret;
 }
 
-int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
-				size_t len, uint8_t *ciphertext)
+int aes_ctx_crypt_ecb(aes_ctx_t *ctx, const uint8_t *input,
+					  size_t len, uint8_t *output)
 {
 	size_t i;
 	int ret;
@@ -77,8 +84,8 @@ int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
 
 	for (i = 0; i < len; i += AES_BLOCK_SIZE)
 	{
-		ret = aes_crypt_ecb(key, MBEDTLS_AES_ENCRYPT,
-							plaintext + i, ciphertext + i);
+		ret = mbedtls_aes_crypt_ecb(&ctx->aes, ctx->mode,
+									input + i, output + i);
 		if (ret)
 			return ret;
 	}
@@ -86,22 +93,92 @@ int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
 	return 0;
 }
 
+void aes_ctx_free(aes_ctx_t *ctx)
+{
+	mbedtls_aes_free(&ctx->aes);
+}
+
+int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
+				size_t len, uint8_t *ciphertext)
+{
+	aes_ctx_t ctx;
+	int ret;
+
+	if (len % AES_BLOCK_SIZE)
+		return -EINVAL;
+
+	ret = aes_ctx_init(&ctx, key, MBEDTLS_AES_ENCRYPT);
+	if (ret)
+		return ret;
+
+	ret = aes_ctx_crypt_ecb(&ctx, plaintext, len, ciphertext);
+	aes_ctx_free(&ctx);
+
+	return ret;
+}
+
 int aes_decrypt(const uint8_t key[32], const uint8_t *ciphertext,
 				size_t len, uint8_t *plaintext)
 {
-	size_t i;
+	aes_ctx_t ctx;
 	int ret;
 
 	if (len % AES_BLOCK_SIZE)
 		return -EINVAL;
 
-	for (i = 0; i < len; i += AES_BLOCK_SIZE)
-	{
-		ret = aes_crypt_ecb(key, MBEDTLS_AES_DECRYPT,
-							ciphertext + i, plaintext + i);
-		if (ret)
-			return ret;
-	}
+	ret = aes_ctx_init(&ctx, key, MBEDTLS_AES_DECRYPT);
+	if (ret)
+		return ret;
 
-	return 0;
-}
\ No newline at end of file
+	ret = aes_ctx_crypt_ecb(&ctx, ciphertext, len, plaintext);
+	aes_ctx_free(&ctx);
+
+	return ret;
+}
+
+int aes_gcm_encrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+					const uint8_t *aad, size_t aad_len,
+					const uint8_t *plaintext, size_t len,
+					uint8_t *ciphertext, uint8_t tag[AES_GCM_TAG_SIZE])
+{
+	mbedtls_gcm_context ctx;
+	int ret;
+
+	mbedtls_gcm_init(&ctx);
+
+	ret = mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key, 256);
+	if (ret)
+		goto error;
+
+	ret = mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT, len,
+									iv, AES_GCM_IV_SIZE, aad, aad_len,
+									plaintext, ciphertext,
+									AES_GCM_TAG_SIZE, tag);
+error:
+	mbedtls_gcm_free(&ctx);
+
+	return ret;
+}
+
+int aes_gcm_decrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+					const uint8_t *aad, size_t aad_len,
+					const uint8_t *ciphertext, size_t len,
+					const uint8_t tag[AES_GCM_TAG_SIZE], uint8_t *plaintext)
+{
+	mbedtls_gcm_context ctx;
+	int ret;
+
+	mbedtls_gcm_init(&ctx);
+
+	ret = mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key, 256);
+	if (ret)
+		goto error;
+
+	ret = mbedtls_gcm_auth_decrypt(&ctx, len, iv, AES_GCM_IV_SIZE,
+								   aad, aad_len, tag, AES_GCM_TAG_SIZE,
+								   ciphertext, plaintext);
+error:
+	mbedtls_gcm_free(&ctx);
+
+	return ret;
+}
@@ -6,25 +6,53 @@
  *********************/
 #include <stdint.h>
 #include <stddef.h>
+#include <mbedtls/aes.h>
 
 /*********************
  *      DEFINES
  *********************/
 #define AES_BLOCK_SIZE 16
+#define AES_GCM_IV_SIZE 12
+#define AES_GCM_TAG_SIZE 16
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+    /**********************
+     *      TYPEDEFS
+     **********************/
+    typedef struct
+    {
+        mbedtls_aes_context aes;
+        int mode;
+    } aes_ctx_t;
+
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
+    /* expands the key once, mode is MBEDTLS_AES_ENCRYPT or MBEDTLS_AES_DECRYPT */
+    int aes_ctx_init(aes_ctx_t *ctx, const uint8_t key[32], int mode);
+    int aes_ctx_crypt_ecb(aes_ctx_t *ctx, const uint8_t *input,
+                          size_t len, uint8_t *output);
+    void aes_ctx_free(aes_ctx_t *ctx);
+
     int aes_encrypt(const uint8_t key[32], const uint8_t *plaintext,
                     size_t len, uint8_t *ciphertext);
     int aes_decrypt(const uint8_t key[32], const uint8_t *ciphertext,
                     size_t len, uint8_t *plaintext);
 
+    /* AES-256-GCM, returns 0 on success, decrypt fails if the tag does not match */
+    int aes_gcm_encrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+                        const uint8_t *aad, size_t aad_len,
+                        const uint8_t *plaintext, size_t len,
+                        uint8_t *ciphertext, uint8_t tag[AES_GCM_TAG_SIZE]);
+    int aes_gcm_decrypt(const uint8_t key[32], const uint8_t iv[AES_GCM_IV_SIZE],
+                        const uint8_t *aad, size_t aad_len,
+                        const uint8_t *ciphertext, size_t len,
+                        const uint8_t tag[AES_GCM_TAG_SIZE], uint8_t *plaintext);
+
 #ifdef __cplusplus
 }
 #endif
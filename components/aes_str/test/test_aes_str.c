@@ -0,0 +1,225 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "aes_str.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* same size as PRIVATE_KEY_SIZE of the wallet record */
+#define TEST_RECORD_SIZE (AES_BLOCK_SIZE * 8)
+#define TEST_BENCH_ROUNDS 500
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* BIP32 test vector 1 master key, sealed the way v1 and v2 wallet records are */
+static const char *record_xprv = "xprv9s21ZrQH143K3GJpoapnV8SFfukcVBSfeCficPSGfubmSFDxo1kuHnLisriDvSnRRuL2Qrg5ggqHKNVpxR86QEC8w35uxmGoggxtQTPvfUu";
+static const char *record_iv = "cafebabefacedbaddecaf888";
+static const char *record_ecb =
+	"46af6940c3a8c6cf7dc6af6929b361a17b9464e45da4d2695ed55b96ef58027c"
+	"cbac7081dafe6c267b2825ae10ecfad4509743b2775db14433e1f496d829e076"
+	"acf61dc3534731060a363b2d7de21ab1e8e3950850fb1e135b7841bfbc18c8b3"
+	"8e11b28a19a9f3c112cea60cc51c3e50f29000b62a499fd0a9f39a6add2e7780";
+static const char *record_gcm =
+	"f2d3d25093097d2a1c790c954a29ba743e678a21b0781a1a18e75737d8fc0e9c"
+	"fb129220a4972f0b450b7b2f54f642080a12ed29ccbbe3a56bfc3d55cd96de06"
+	"17d130201d3111ed01a8412bcf79817353fe500f2277f939fbe8374863aaa99f"
+	"b91a8c92eadad08f5b3a5e7adefd7cc1daaa1f0d9aca98c52012493a3c47e195";
+static const char *record_tag = "2841650f732496b9687d3294558be8ed";
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void unhex(const char *hex, uint8_t *out, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+	{
+		unsigned int byte = 0;
+		sscanf(hex + 2 * i, "%2x", &byte);
+		out[i] = (uint8_t)byte;
+	}
+}
+
+static void fill_counter(uint8_t *data, size_t len, uint8_t start)
+{
+	for (size_t i = 0; i < len; i++)
+	{
+		data[i] = (uint8_t)(start + i);
+	}
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("aes-256 ecb FIPS-197 known answer", "[aes_str]")
+{
+	uint8_t key[32];
+	uint8_t plaintext[AES_BLOCK_SIZE];
+	uint8_t expected[AES_BLOCK_SIZE];
+	uint8_t out[AES_BLOCK_SIZE];
+
+	fill_counter(key, sizeof(key), 0);
+	unhex("00112233445566778899aabbccddeeff", plaintext, sizeof(plaintext));
+	unhex("8ea2b7ca516745bfeafc49904b496089", expected, sizeof(expected));
+
+	TEST_ASSERT_EQUAL_INT(0, aes_encrypt(key, plaintext, sizeof(plaintext), out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, out, sizeof(out));
+	TEST_ASSERT_EQUAL_INT(0, aes_decrypt(key, expected, sizeof(expected), out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, out, sizeof(out));
+	TEST_ASSERT_NOT_EQUAL(0, aes_encrypt(key, plaintext, sizeof(plaintext) - 1, out));
+}
+
+TEST_CASE("aes-256 gcm known answer", "[aes_str]")
+{
+	/* GCM spec test case 14: zero key, iv and plaintext */
+	uint8_t key[32] = {0};
+	uint8_t iv[AES_GCM_IV_SIZE] = {0};
+	uint8_t plaintext[AES_BLOCK_SIZE] = {0};
+	uint8_t expected[AES_BLOCK_SIZE];
+	uint8_t expected_tag[AES_GCM_TAG_SIZE];
+	uint8_t out[AES_BLOCK_SIZE];
+	uint8_t tag[AES_GCM_TAG_SIZE];
+
+	unhex("cea7403d4d606b6e074ec5d3baf39d18", expected, sizeof(expected));
+	unhex("d0d1c8a799996bf0265b98b5d48ab919", expected_tag, sizeof(expected_tag));
+
+	TEST_ASSERT_EQUAL_INT(0, aes_gcm_encrypt(key, iv, NULL, 0, plaintext, sizeof(plaintext), out, tag));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, out, sizeof(out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tag, tag, sizeof(tag));
+	TEST_ASSERT_EQUAL_INT(0, aes_gcm_decrypt(key, iv, NULL, 0, expected, sizeof(expected), expected_tag, out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, out, sizeof(out));
+}
+
+TEST_CASE("v1 ecb record re-seals as v2 gcm", "[aes_str]")
+{
+	uint8_t key[32];
+	uint8_t padding[32];
+	uint8_t iv[AES_GCM_IV_SIZE];
+	uint8_t plaintext[TEST_RECORD_SIZE] = {0};
+	uint8_t sealed[TEST_RECORD_SIZE];
+	uint8_t expected[TEST_RECORD_SIZE];
+	uint8_t expected_tag[AES_GCM_TAG_SIZE];
+	uint8_t out[TEST_RECORD_SIZE];
+	uint8_t tag[AES_GCM_TAG_SIZE];
+
+	fill_counter(key, sizeof(key), 0);
+	fill_counter(padding, sizeof(padding), 0x50);
+	unhex(record_iv, iv, sizeof(iv));
+	strncpy((char *)plaintext, record_xprv, sizeof(plaintext));
+
+	/* v1: unauthenticated ecb */
+	unhex(record_ecb, sealed, sizeof(sealed));
+	TEST_ASSERT_EQUAL_INT(0, aes_decrypt(key, sealed, sizeof(sealed), out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, out, sizeof(out));
+
+	/* v2: gcm with the pin padding as associated data */
+	unhex(record_gcm, expected, sizeof(expected));
+	unhex(record_tag, expected_tag, sizeof(expected_tag));
+	TEST_ASSERT_EQUAL_INT(0, aes_gcm_encrypt(key, iv, padding, sizeof(padding), out, sizeof(out), sealed, tag));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, sealed, sizeof(sealed));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tag, tag, sizeof(tag));
+
+	memset(out, 0, sizeof(out));
+	TEST_ASSERT_EQUAL_INT(0, aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, out, sizeof(out));
+}
+
+TEST_CASE("aes-256 gcm rejects a modified record", "[aes_str]")
+{
+	uint8_t key[32];
+	uint8_t padding[32];
+	uint8_t iv[AES_GCM_IV_SIZE];
+	uint8_t sealed[TEST_RECORD_SIZE];
+	uint8_t tag[AES_GCM_TAG_SIZE];
+	uint8_t out[TEST_RECORD_SIZE];
+
+	fill_counter(key, sizeof(key), 0);
+	fill_counter(padding, sizeof(padding), 0x50);
+	unhex(record_iv, iv, sizeof(iv));
+	unhex(record_gcm, sealed, sizeof(sealed));
+	unhex(record_tag, tag, sizeof(tag));
+
+	tag[0] ^= 0x01;
+	TEST_ASSERT_NOT_EQUAL(0, aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out));
+	tag[0] ^= 0x01;
+
+	padding[31] ^= 0x01;
+	TEST_ASSERT_NOT_EQUAL(0, aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out));
+	padding[31] ^= 0x01;
+
+	sealed[TEST_RECORD_SIZE - 1] ^= 0x01;
+	TEST_ASSERT_NOT_EQUAL(0, aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out));
+	sealed[TEST_RECORD_SIZE - 1] ^= 0x01;
+
+	key[0] ^= 0x01;
+	TEST_ASSERT_NOT_EQUAL(0, aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out));
+}
+
+/* the key schedule used to run for every block, aes_ctx_t expands it once per buffer */
+TEST_CASE("aes-256 record benchmark", "[aes_str][benchmark]")
+{
+	uint8_t key[32];
+	uint8_t padding[32];
+	uint8_t iv[AES_GCM_IV_SIZE];
+	uint8_t plaintext[TEST_RECORD_SIZE] = {0};
+	uint8_t expected[TEST_RECORD_SIZE];
+	uint8_t sealed[TEST_RECORD_SIZE];
+	uint8_t out[TEST_RECORD_SIZE];
+	uint8_t tag[AES_GCM_TAG_SIZE];
+	aes_ctx_t ctx;
+
+	fill_counter(key, sizeof(key), 0);
+	fill_counter(padding, sizeof(padding), 0x50);
+	unhex(record_iv, iv, sizeof(iv));
+	strncpy((char *)plaintext, record_xprv, sizeof(plaintext));
+	unhex(record_ecb, expected, sizeof(expected));
+
+	int64_t start = esp_timer_get_time();
+	for (int i = 0; i < TEST_BENCH_ROUNDS; i++)
+	{
+		for (size_t j = 0; j < sizeof(plaintext); j += AES_BLOCK_SIZE)
+		{
+			aes_ctx_init(&ctx, key, MBEDTLS_AES_ENCRYPT);
+			aes_ctx_crypt_ecb(&ctx, plaintext + j, AES_BLOCK_SIZE, sealed + j);
+			aes_ctx_free(&ctx);
+		}
+	}
+	int64_t per_block_us = esp_timer_get_time() - start;
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, sealed, sizeof(sealed));
+
+	start = esp_timer_get_time();
+	for (int i = 0; i < TEST_BENCH_ROUNDS; i++)
+	{
+		aes_ctx_init(&ctx, key, MBEDTLS_AES_ENCRYPT);
+		aes_ctx_crypt_ecb(&ctx, plaintext, sizeof(plaintext), sealed);
+		aes_ctx_free(&ctx);
+	}
+	int64_t once_us = esp_timer_get_time() - start;
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, sealed, sizeof(sealed));
+
+	start = esp_timer_get_time();
+	for (int i = 0; i < TEST_BENCH_ROUNDS; i++)
+	{
+		aes_gcm_encrypt(key, iv, padding, sizeof(padding), plaintext, sizeof(plaintext), sealed, tag);
+	}
+	int64_t seal_us = esp_timer_get_time() - start;
+
+	start = esp_timer_get_time();
+	int failures = 0;
+	for (int i = 0; i < TEST_BENCH_ROUNDS; i++)
+	{
+		failures += aes_gcm_decrypt(key, iv, padding, sizeof(padding), sealed, sizeof(sealed), tag, out) != 0;
+	}
+	int64_t open_us = esp_timer_get_time() - start;
+	TEST_ASSERT_EQUAL_INT(0, failures);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(plaintext, out, sizeof(out));
+
+	printf("%d byte record, us per record: ecb key per block %lld, ecb key once %lld, gcm seal %lld, gcm open %lld\n",
+		   TEST_RECORD_SIZE, (long long)(per_block_us / TEST_BENCH_ROUNDS), (long long)(once_us / TEST_BENCH_ROUNDS),
+		   (long long)(seal_us / TEST_BENCH_ROUNDS), (long long)(open_us / TEST_BENCH_ROUNDS));
+}
@@ -0,0 +1,242 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include "amount.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AMOUNT_LIMBS (AMOUNT_MAX_BYTES / 4)
+/* decimal digits are produced 9 at a time, 10^9 fits in a 32-bit limb */
+#define AMOUNT_CHUNK 1000000000UL
+#define AMOUNT_CHUNK_DIGITS 9
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool amount_read(const uint8_t *value, size_t value_len, uint32_t limbs[AMOUNT_LIMBS]);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+size_t amount_format(const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit, char *out, size_t out_len);
+bool amount_mul(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t product[AMOUNT_MAX_BYTES]);
+bool amount_add(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t sum[AMOUNT_MAX_BYTES]);
+void amount_writer_printf(amount_writer_t *writer, const char *format, ...);
+void amount_writer_format(amount_writer_t *writer, const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+/* big-endian bytes to little-endian limbs, leading zero bytes are allowed */
+static bool amount_read(const uint8_t *value, size_t value_len, uint32_t limbs[AMOUNT_LIMBS])
+{
+    memset(limbs, 0, AMOUNT_LIMBS * sizeof(uint32_t));
+    while (value_len > AMOUNT_MAX_BYTES)
+    {
+        if (*value != 0)
+        {
+            return false;
+        }
+        value++;
+        value_len--;
+    }
+    for (size_t i = 0; i < value_len; i++)
+    {
+        limbs[i / 4] |= (uint32_t)value[value_len - 1 - i] << (8 * (i % 4));
+    }
+    return true;
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+size_t amount_format(const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit, char *out, size_t out_len)
+{
+    uint32_t limbs[AMOUNT_LIMBS];
+    char digits[AMOUNT_MAX_DIGITS + AMOUNT_CHUNK_DIGITS];
+    size_t digits_len = 0;
+
+    if (out == NULL || out_len == 0)
+    {
+        return 0;
+    }
+    out[0] = '\0';
+    if (decimals > AMOUNT_MAX_DIGITS || !amount_read(value, value_len, limbs))
+    {
+        return 0;
+    }
+
+    // least significant digits first, 9 per division
+    size_t top = AMOUNT_LIMBS;
+    while (top > 0 && limbs[top - 1] == 0)
+    {
+        top--;
+    }
+    while (top > 0)
+    {
+        uint64_t rem = 0;
+        for (size_t i = top; i-- > 0;)
+        {
+            uint64_t cur = (rem << 32) | limbs[i];
+            limbs[i] = (uint32_t)(cur / AMOUNT_CHUNK);
+            rem = cur % AMOUNT_CHUNK;
+        }
+        while (top > 0 && limbs[top - 1] == 0)
+        {
+            top--;
+        }
+        for (int k = 0; k < AMOUNT_CHUNK_DIGITS; k++)
+        {
+            digits[digits_len++] = '0' + rem % 10;
+            rem /= 10;
+        }
+    }
+    // no leading zeros, but enough digits for "0.000x"
+    while (digits_len > 0 && digits[digits_len - 1] == '0')
+    {
+        digits_len--;
+    }
+    while (digits_len < decimals + 1)
+    {
+        digits[digits_len++] = '0';
+    }
+    // trailing fractional zeros are not shown
+    size_t skip = 0;
+    while (skip < decimals && digits[skip] == '0')
+    {
+        skip++;
+    }
+
+    size_t int_len = digits_len - decimals;
+    size_t frac_len = decimals - skip;
+    size_t unit_len = (unit != NULL) ? strlen(unit) + 1 : 0;
+    size_t len = int_len + (frac_len > 0 ? 1 + frac_len : 0) + unit_len;
+    if (len + 1 > out_len)
+    {
+        return 0;
+    }
+
+    char *p = out;
+    for (size_t i = digits_len; i-- > decimals;)
+    {
+        *p++ = digits[i];
+    }
+    if (frac_len > 0)
+    {
+        *p++ = '.';
+        for (size_t i = decimals; i-- > skip;)
+        {
+            *p++ = digits[i];
+        }
+    }
+    if (unit != NULL)
+    {
+        *p++ = ' ';
+        memcpy(p, unit, unit_len - 1);
+        p += unit_len - 1;
+    }
+    *p = '\0';
+    return len;
+}
+
+bool amount_mul(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t product[AMOUNT_MAX_BYTES])
+{
+    uint32_t x[AMOUNT_LIMBS];
+    uint32_t y[AMOUNT_LIMBS];
+    uint32_t r[AMOUNT_LIMBS] = {0};
+    if (!amount_read(a, a_len, x) || !amount_read(b, b_len, y))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < AMOUNT_LIMBS; i++)
+    {
+        if (x[i] == 0)
+        {
+            continue;
+        }
+        uint64_t carry = 0;
+        for (size_t j = 0; j < AMOUNT_LIMBS; j++)
+        {
+            if (i + j >= AMOUNT_LIMBS)
+            {
+                // anything left above 256 bits is an overflow
+                if (y[j] != 0 || carry != 0)
+                {
+                    return false;
+                }
+                continue;
+            }
+            uint64_t cur = (uint64_t)x[i] * y[j] + r[i + j] + carry;
+            r[i + j] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        if (carry != 0)
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < AMOUNT_MAX_BYTES; i++)
+    {
+        product[AMOUNT_MAX_BYTES - 1 - i] = (uint8_t)(r[i / 4] >> (8 * (i % 4)));
+    }
+    return true;
+}
+
+bool amount_add(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t sum[AMOUNT_MAX_BYTES])
+{
+    uint32_t x[AMOUNT_LIMBS];
+    uint32_t y[AMOUNT_LIMBS];
+    if (!amount_read(a, a_len, x) || !amount_read(b, b_len, y))
+    {
+        return false;
+    }
+    uint64_t carry = 0;
+    for (size_t i = 0; i < AMOUNT_LIMBS; i++)
+    {
+        uint64_t cur = (uint64_t)x[i] + y[i] + carry;
+        x[i] = (uint32_t)cur;
+        carry = cur >> 32;
+    }
+    if (carry != 0)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < AMOUNT_MAX_BYTES; i++)
+    {
+        sum[AMOUNT_MAX_BYTES - 1 - i] = (uint8_t)(x[i / 4] >> (8 * (i % 4)));
+    }
+    return true;
+}
+
+void amount_writer_printf(amount_writer_t *writer, const char *format, ...)
+{
+    if (writer->pos + 1 >= writer->len)
+    {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(writer->out + writer->pos, writer->len - writer->pos, format, args);
+    va_end(args);
+    if (written > 0)
+    {
+        writer->pos += (size_t)written;
+        if (writer->pos >= writer->len)
+        {
+            writer->pos = writer->len - 1; // truncated
+        }
+    }
+}
+
+void amount_writer_format(amount_writer_t *writer, const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit)
+{
+    if (writer->pos + 1 < writer->len)
+    {
+        writer->pos += amount_format(value, value_len, decimals, unit, writer->out + writer->pos, writer->len - writer->pos);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef AMOUNT_H
+#define AMOUNT_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AMOUNT_MAX_BYTES 32
+/* 2^256 - 1 has 78 decimal digits */
+#define AMOUNT_MAX_DIGITS 78
+
+#define AMOUNT_DECIMALS_ETH 18
+#define AMOUNT_DECIMALS_GWEI 9
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* text built up in a fixed buffer, whatever doesn't fit is cut off */
+typedef struct
+{
+    char *out;
+    size_t len;
+    size_t pos;
+} amount_writer_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    /**********************
+     * GLOBAL PROTOTYPES
+     **********************/
+    /*
+        Formats a big-endian unsigned integer of up to 32 bytes (e.g. an RLP field)
+        as a decimal with `decimals` fractional digits, trailing zeros trimmed,
+        followed by " unit" if unit is not NULL: 1500000000 with 9 decimals and "Gwei" -> "1.5 Gwei".
+        Returns the length written, 0 if the number is too long or doesn't fit in out.
+     */
+    size_t amount_format(const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit, char *out, size_t out_len);
+    /* product = a * b in 256 bits, returns false on overflow */
+    bool amount_mul(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t product[AMOUNT_MAX_BYTES]);
+    /* sum = a + b in 256 bits, returns false on overflow, sum may be one of the inputs */
+    bool amount_add(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len, uint8_t sum[AMOUNT_MAX_BYTES]);
+    /* printf at the end of the writer's text, the text stays NUL terminated */
+    void amount_writer_printf(amount_writer_t *writer, const char *format, ...);
+    /* amount_format() at the end of the writer's text, nothing is written if the number doesn't fit */
+    void amount_writer_format(amount_writer_t *writer, const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AMOUNT_H
@@ -0,0 +1,560 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include "calldata.h"
+#include "erc20.h"
+#include "amount.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CALLDATA_ACTION_GENERIC 0
+#define CALLDATA_ACTION_TRANSFER 1
+#define CALLDATA_ACTION_TRANSFER_FROM 2
+#define CALLDATA_ACTION_APPROVE 3
+#define CALLDATA_ACTION_PERMIT 4
+/* bytes[] of calls to the same contract in the last argument */
+#define CALLDATA_ACTION_MULTICALL 5
+/* (address target, uint256 value, bytes call) */
+#define CALLDATA_ACTION_EXECUTE 6
+/* (address[] targets, [uint256[] values,] bytes[] calls) */
+#define CALLDATA_ACTION_EXECUTE_BATCH 7
+
+/**********************
+ *      MACROS
+ **********************/
+#define METHOD(selector, signature, action, ...) \
+    {selector, signature, action, sizeof((uint8_t[]){__VA_ARGS__}) / sizeof(uint8_t), {__VA_ARGS__}}
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    amount_writer_t text;
+    int depth;
+    /* nested calls visited so far, bounds the work on aliased batches */
+    size_t calls;
+    bool too_complex;
+    /* a nested call or batch couldn't be decoded, the description doesn't show everything */
+    bool incomplete;
+} calldata_writer_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* sorted by selector for calldata_find_method(), selector = keccak256(signature)[0:4] */
+static const calldata_method_t calldata_methods[] = {
+    METHOD(0x095ea7b3, "approve(address,uint256)", CALLDATA_ACTION_APPROVE, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0x18dfb3c7, "executeBatch(address[],bytes[])", CALLDATA_ACTION_EXECUTE_BATCH, ABI_TYPE_ADDRESS_ARRAY, ABI_TYPE_BYTES_ARRAY),
+    METHOD(0x1f0464d1, "multicall(bytes32,bytes[])", CALLDATA_ACTION_MULTICALL, ABI_TYPE_BYTES32, ABI_TYPE_BYTES_ARRAY),
+    METHOD(0x23b872dd, "transferFrom(address,address,uint256)", CALLDATA_ACTION_TRANSFER_FROM, ABI_TYPE_ADDRESS, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0x2e1a7d4d, "withdraw(uint256)", CALLDATA_ACTION_GENERIC, ABI_TYPE_UINT256),
+    METHOD(0x39509351, "increaseAllowance(address,uint256)", CALLDATA_ACTION_GENERIC, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0x42842e0e, "safeTransferFrom(address,address,uint256)", CALLDATA_ACTION_GENERIC, ABI_TYPE_ADDRESS, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0x47e1da2a, "executeBatch(address[],uint256[],bytes[])", CALLDATA_ACTION_EXECUTE_BATCH, ABI_TYPE_ADDRESS_ARRAY, ABI_TYPE_UINT256_ARRAY, ABI_TYPE_BYTES_ARRAY),
+    METHOD(0x5ae401dc, "multicall(uint256,bytes[])", CALLDATA_ACTION_MULTICALL, ABI_TYPE_UINT256, ABI_TYPE_BYTES_ARRAY),
+    METHOD(0xa22cb465, "setApprovalForAll(address,bool)", CALLDATA_ACTION_GENERIC, ABI_TYPE_ADDRESS, ABI_TYPE_BOOL),
+    METHOD(0xa457c2d7, "decreaseAllowance(address,uint256)", CALLDATA_ACTION_GENERIC, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0xa9059cbb, "transfer(address,uint256)", CALLDATA_ACTION_TRANSFER, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256),
+    METHOD(0xac9650d8, "multicall(bytes[])", CALLDATA_ACTION_MULTICALL, ABI_TYPE_BYTES_ARRAY),
+    METHOD(0xb61d27f6, "execute(address,uint256,bytes)", CALLDATA_ACTION_EXECUTE, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256, ABI_TYPE_BYTES),
+    METHOD(0xb88d4fde, "safeTransferFrom(address,address,uint256,bytes)", CALLDATA_ACTION_GENERIC, ABI_TYPE_ADDRESS, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256, ABI_TYPE_BYTES),
+    {0xd0e30db0, "deposit()", CALLDATA_ACTION_GENERIC, 0, {0}},
+    METHOD(0xd505accf, "permit(address,address,uint256,uint256,uint8,bytes32,bytes32)", CALLDATA_ACTION_PERMIT, ABI_TYPE_ADDRESS, ABI_TYPE_ADDRESS, ABI_TYPE_UINT256, ABI_TYPE_UINT256, ABI_TYPE_UINT8, ABI_TYPE_BYTES32, ABI_TYPE_BYTES32),
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const calldata_method_t *calldata_find_method(uint32_t selector);
+static bool abi_read_size(const uint8_t *word, size_t *value);
+static bool abi_leading_zeros(const uint8_t *word, size_t count);
+static int abi_decode_arg(uint8_t type, const uint8_t *base, size_t base_len, size_t index, calldata_arg_t *arg);
+static bool writer_full(const calldata_writer_t *writer);
+static bool writer_enter_call(calldata_writer_t *writer);
+static void writer_newline(calldata_writer_t *writer);
+static void writer_address(calldata_writer_t *writer, const uint8_t *word);
+static void writer_uint(calldata_writer_t *writer, const uint8_t *word);
+static void writer_amount(calldata_writer_t *writer, const uint8_t *token, long long chain_id, const uint8_t *word);
+static void writer_arg(calldata_writer_t *writer, const calldata_arg_t *arg);
+static void describe_call(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const uint8_t *data, size_t data_len);
+static void describe_decoded(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const uint8_t *data, size_t data_len, const calldata_call_t *call, int err);
+static void describe_batch(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const calldata_call_t *call);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+int calldata_decode(const uint8_t *data, size_t data_len, calldata_call_t *call);
+int calldata_array_word(const calldata_arg_t *array, size_t index, const uint8_t **word);
+int calldata_array_bytes(const calldata_arg_t *array, size_t index, const uint8_t **data, size_t *len);
+size_t calldata_describe(const uint8_t to[20], long long chain_id, const uint8_t *data, size_t data_len, char *out, size_t out_len, int *result);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static const calldata_method_t *calldata_find_method(uint32_t selector)
+{
+    size_t lo = 0;
+    size_t hi = sizeof(calldata_methods) / sizeof(calldata_methods[0]);
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (calldata_methods[mid].selector == selector)
+        {
+            return &calldata_methods[mid];
+        }
+        if (calldata_methods[mid].selector < selector)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+static bool abi_leading_zeros(const uint8_t *word, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (word[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* offsets and lengths, anything above 32 bits can't fit in the calldata anyway */
+static bool abi_read_size(const uint8_t *word, size_t *value)
+{
+    if (!abi_leading_zeros(word, CALLDATA_WORD_LEN - 4))
+    {
+        return false;
+    }
+    *value = ((size_t)word[28] << 24) | ((size_t)word[29] << 16) | ((size_t)word[30] << 8) | word[31];
+    return true;
+}
+
+/* decodes argument `index` of the tuple at base, all content has to be inside base_len */
+static int abi_decode_arg(uint8_t type, const uint8_t *base, size_t base_len, size_t index, calldata_arg_t *arg)
+{
+    const uint8_t *head = base + index * CALLDATA_WORD_LEN;
+    arg->type = type;
+    arg->data = head;
+    arg->len = CALLDATA_WORD_LEN;
+    arg->end = base + base_len;
+
+    switch (type)
+    {
+    case ABI_TYPE_ADDRESS:
+        return abi_leading_zeros(head, 12) ? CALLDATA_OK : CALLDATA_ERR_INVALID;
+    case ABI_TYPE_UINT8:
+        return abi_leading_zeros(head, 31) ? CALLDATA_OK : CALLDATA_ERR_INVALID;
+    case ABI_TYPE_BOOL:
+        return (abi_leading_zeros(head, 31) && head[31] <= 1) ? CALLDATA_OK : CALLDATA_ERR_INVALID;
+    case ABI_TYPE_UINT256:
+    case ABI_TYPE_BYTES32:
+        return CALLDATA_OK;
+    default:
+        break;
+    }
+
+    // dynamic types: offset from the tuple start to the length word
+    size_t offset;
+    size_t len;
+    if (!abi_read_size(head, &offset) || offset > base_len - CALLDATA_WORD_LEN || !abi_read_size(base + offset, &len))
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    size_t available = base_len - offset - CALLDATA_WORD_LEN;
+    arg->data = base + offset + CALLDATA_WORD_LEN;
+    arg->len = len;
+    if (type == ABI_TYPE_BYTES)
+    {
+        return (len <= available) ? CALLDATA_OK : CALLDATA_ERR_INVALID;
+    }
+    // arrays: the element heads have to fit
+    return (len <= available / CALLDATA_WORD_LEN) ? CALLDATA_OK : CALLDATA_ERR_INVALID;
+}
+
+static bool writer_full(const calldata_writer_t *writer)
+{
+    return writer->text.pos + 1 >= writer->text.len;
+}
+
+/* counts a nested call, false once the batch is too large or too deep to describe */
+static bool writer_enter_call(calldata_writer_t *writer)
+{
+    writer->calls++;
+    if (writer->calls > CALLDATA_MAX_CALLS || writer->depth > CALLDATA_MAX_DEPTH)
+    {
+        writer->too_complex = true;
+    }
+    return !writer->too_complex;
+}
+
+static void writer_newline(calldata_writer_t *writer)
+{
+    amount_writer_printf(&writer->text, "\n%*s", writer->depth * 2, "");
+}
+
+static void writer_address(calldata_writer_t *writer, const uint8_t *word)
+{
+    amount_writer_printf(&writer->text, "0x");
+    for (size_t i = 12; i < CALLDATA_WORD_LEN; i++)
+    {
+        amount_writer_printf(&writer->text, "%02x", word[i]);
+    }
+}
+
+static void writer_uint(calldata_writer_t *writer, const uint8_t *word)
+{
+    char temp[AMOUNT_MAX_DIGITS + 1];
+    amount_format(word, CALLDATA_WORD_LEN, 0, NULL, temp, sizeof(temp));
+    amount_writer_printf(&writer->text, "%s", temp);
+}
+
+/* token amount with the symbol if the token is known, raw units otherwise */
+static void writer_amount(calldata_writer_t *writer, const uint8_t *token, long long chain_id, const uint8_t *word)
+{
+    uint8_t unlimited[CALLDATA_WORD_LEN];
+    memset(unlimited, 0xff, sizeof(unlimited));
+    const erc20_info_t *info = (token != NULL) ? get_erc20_info(token, chain_id) : NULL;
+    if (memcmp(word, unlimited, CALLDATA_WORD_LEN) == 0)
+    {
+        amount_writer_printf(&writer->text, "unlimited %s", info != NULL ? info->symbol : "tokens");
+        return;
+    }
+    if (info == NULL)
+    {
+        writer_uint(writer, word);
+        amount_writer_printf(&writer->text, " units");
+        return;
+    }
+    char temp[AMOUNT_MAX_DIGITS + 16];
+    amount_format(word, CALLDATA_WORD_LEN, info->decimal, info->symbol, temp, sizeof(temp));
+    amount_writer_printf(&writer->text, "%s", temp);
+}
+
+static void writer_arg(calldata_writer_t *writer, const calldata_arg_t *arg)
+{
+    switch (arg->type)
+    {
+    case ABI_TYPE_ADDRESS:
+        writer_address(writer, arg->data);
+        break;
+    case ABI_TYPE_UINT256:
+    case ABI_TYPE_UINT8:
+        writer_uint(writer, arg->data);
+        break;
+    case ABI_TYPE_BOOL:
+        amount_writer_printf(&writer->text, arg->data[31] ? "true" : "false");
+        break;
+    case ABI_TYPE_BYTES32:
+        amount_writer_printf(&writer->text, "0x");
+        for (size_t i = 0; i < CALLDATA_WORD_LEN; i++)
+        {
+            amount_writer_printf(&writer->text, "%02x", arg->data[i]);
+        }
+        break;
+    case ABI_TYPE_BYTES:
+        amount_writer_printf(&writer->text, "%zu bytes", arg->len);
+        break;
+    default:
+        amount_writer_printf(&writer->text, "%zu items", arg->len);
+        break;
+    }
+}
+
+/* multicall and execute batches, each call is described one level deeper */
+static void describe_batch(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const calldata_call_t *call)
+{
+    const calldata_arg_t *calls = &call->args[call->args_len - 1];
+    const calldata_arg_t *targets = NULL;
+    const calldata_arg_t *values = NULL;
+    if (call->method->action == CALLDATA_ACTION_EXECUTE_BATCH)
+    {
+        targets = &call->args[0];
+        values = (call->args_len == 3) ? &call->args[1] : NULL;
+        if (targets->len != calls->len || (values != NULL && values->len != calls->len))
+        {
+            amount_writer_printf(&writer->text, "Invalid batch: %zu targets for %zu calls", targets->len, calls->len);
+            writer->incomplete = true;
+            return;
+        }
+    }
+    amount_writer_printf(&writer->text, "Batch of %zu calls:", calls->len);
+    writer->depth++;
+    for (size_t i = 0; i < calls->len && !writer_full(writer); i++)
+    {
+        const uint8_t *target = to;
+        if (!writer_enter_call(writer))
+        {
+            break;
+        }
+        const uint8_t *data;
+        size_t len;
+        writer_newline(writer);
+        amount_writer_printf(&writer->text, "%zu. ", i + 1);
+        const uint8_t *word;
+        if (calldata_array_bytes(calls, i, &data, &len) != CALLDATA_OK ||
+            (targets != NULL && calldata_array_word(targets, i, &word) != CALLDATA_OK))
+        {
+            amount_writer_printf(&writer->text, "Invalid call");
+            writer->incomplete = true;
+            continue;
+        }
+        if (targets != NULL)
+        {
+            target = word + 12;
+            amount_writer_printf(&writer->text, "Call ");
+            writer_address(writer, word);
+            if (values != NULL)
+            {
+                calldata_array_word(values, i, &word);
+                if (!abi_leading_zeros(word, CALLDATA_WORD_LEN))
+                {
+                    amount_writer_printf(&writer->text, " with value ");
+                    writer_uint(writer, word);
+                }
+            }
+            amount_writer_printf(&writer->text, ": ");
+        }
+        describe_call(writer, target, chain_id, data, len);
+    }
+    writer->depth--;
+}
+
+static void describe_call(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const uint8_t *data, size_t data_len)
+{
+    calldata_call_t call;
+    if (writer_full(writer))
+    {
+        return;
+    }
+    int err = calldata_decode(data, data_len, &call);
+    describe_decoded(writer, to, chain_id, data, data_len, &call, err);
+}
+
+static void describe_decoded(calldata_writer_t *writer, const uint8_t *to, long long chain_id, const uint8_t *data, size_t data_len, const calldata_call_t *call, int err)
+{
+    if (data_len == 0)
+    {
+        amount_writer_printf(&writer->text, "Plain transfer");
+        return;
+    }
+    if (err != CALLDATA_OK)
+    {
+        writer->incomplete = true;
+    }
+    if (err == CALLDATA_ERR_UNKNOWN)
+    {
+        amount_writer_printf(&writer->text, "Unknown call 0x%02x%02x%02x%02x, %zu bytes", data[0], data[1], data[2], data[3], data_len);
+        return;
+    }
+    if (err != CALLDATA_OK)
+    {
+        if (call->method != NULL)
+        {
+            amount_writer_printf(&writer->text, "Invalid %s call", call->method->signature);
+        }
+        else
+        {
+            amount_writer_printf(&writer->text, "Invalid call data, %zu bytes", data_len);
+        }
+        return;
+    }
+
+    const calldata_arg_t *args = call->args;
+    switch (call->method->action)
+    {
+    case CALLDATA_ACTION_TRANSFER:
+        amount_writer_printf(&writer->text, "Transfer ");
+        writer_amount(writer, to, chain_id, args[1].data);
+        amount_writer_printf(&writer->text, " to ");
+        writer_address(writer, args[0].data);
+        break;
+    case CALLDATA_ACTION_TRANSFER_FROM:
+        amount_writer_printf(&writer->text, "Transfer ");
+        writer_amount(writer, to, chain_id, args[2].data);
+        amount_writer_printf(&writer->text, " from ");
+        writer_address(writer, args[0].data);
+        amount_writer_printf(&writer->text, " to ");
+        writer_address(writer, args[1].data);
+        break;
+    case CALLDATA_ACTION_APPROVE:
+        amount_writer_printf(&writer->text, "Approve ");
+        writer_address(writer, args[0].data);
+        amount_writer_printf(&writer->text, " to spend ");
+        writer_amount(writer, to, chain_id, args[1].data);
+        break;
+    case CALLDATA_ACTION_PERMIT:
+        amount_writer_printf(&writer->text, "Permit ");
+        writer_address(writer, args[1].data);
+        amount_writer_printf(&writer->text, " to spend ");
+        writer_amount(writer, to, chain_id, args[2].data);
+        amount_writer_printf(&writer->text, " of ");
+        writer_address(writer, args[0].data);
+        amount_writer_printf(&writer->text, " until ");
+        writer_uint(writer, args[3].data);
+        break;
+    case CALLDATA_ACTION_EXECUTE:
+        amount_writer_printf(&writer->text, "Call ");
+        writer_address(writer, args[0].data);
+        if (!abi_leading_zeros(args[1].data, CALLDATA_WORD_LEN))
+        {
+            amount_writer_printf(&writer->text, " with value ");
+            writer_uint(writer, args[1].data);
+        }
+        amount_writer_printf(&writer->text, ": ");
+        writer->depth++;
+        if (writer_enter_call(writer))
+        {
+            describe_call(writer, args[0].data + 12, chain_id, args[2].data, args[2].len);
+        }
+        writer->depth--;
+        break;
+    case CALLDATA_ACTION_MULTICALL:
+    case CALLDATA_ACTION_EXECUTE_BATCH:
+        describe_batch(writer, to, chain_id, call);
+        break;
+    default:
+        amount_writer_printf(&writer->text, "%s", call->method->signature);
+        writer->depth++;
+        for (size_t i = 0; i < call->args_len; i++)
+        {
+            writer_newline(writer);
+            amount_writer_printf(&writer->text, "%zu: ", i);
+            writer_arg(writer, &args[i]);
+        }
+        writer->depth--;
+        break;
+    }
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int calldata_decode(const uint8_t *data, size_t data_len, calldata_call_t *call)
+{
+    call->method = NULL;
+    call->args_len = 0;
+    if (data == NULL || data_len < CALLDATA_SELECTOR_LEN)
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    uint32_t selector = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+    call->method = calldata_find_method(selector);
+    if (call->method == NULL)
+    {
+        return CALLDATA_ERR_UNKNOWN;
+    }
+    const uint8_t *base = data + CALLDATA_SELECTOR_LEN;
+    size_t base_len = data_len - CALLDATA_SELECTOR_LEN;
+    if (base_len < (size_t)call->method->args_len * CALLDATA_WORD_LEN)
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    for (size_t i = 0; i < call->method->args_len; i++)
+    {
+        int err = abi_decode_arg(call->method->args[i], base, base_len, i, &call->args[i]);
+        if (err != CALLDATA_OK)
+        {
+            return err;
+        }
+    }
+    call->args_len = call->method->args_len;
+    return CALLDATA_OK;
+}
+
+int calldata_array_word(const calldata_arg_t *array, size_t index, const uint8_t **word)
+{
+    if ((array->type != ABI_TYPE_ADDRESS_ARRAY && array->type != ABI_TYPE_UINT256_ARRAY) || index >= array->len)
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    *word = array->data + index * CALLDATA_WORD_LEN;
+    if (array->type == ABI_TYPE_ADDRESS_ARRAY && !abi_leading_zeros(*word, 12))
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    return CALLDATA_OK;
+}
+
+int calldata_array_bytes(const calldata_arg_t *array, size_t index, const uint8_t **data, size_t *len)
+{
+    if (array->type != ABI_TYPE_BYTES_ARRAY || index >= array->len)
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    // element offsets are relative to the first element head
+    size_t available = array->end - array->data;
+    size_t offset;
+    if (!abi_read_size(array->data + index * CALLDATA_WORD_LEN, &offset) ||
+        offset > available - CALLDATA_WORD_LEN ||
+        !abi_read_size(array->data + offset, len) ||
+        *len > available - offset - CALLDATA_WORD_LEN)
+    {
+        return CALLDATA_ERR_INVALID;
+    }
+    *data = array->data + offset + CALLDATA_WORD_LEN;
+    return CALLDATA_OK;
+}
+
+size_t calldata_describe(const uint8_t to[20], long long chain_id, const uint8_t *data, size_t data_len, char *out, size_t out_len, int *result)
+{
+    calldata_call_t call;
+    int err = CALLDATA_ERR_UNKNOWN;
+    if (to != NULL)
+    {
+        err = calldata_decode(data, data_len, &call);
+    }
+    if (result != NULL)
+    {
+        *result = err;
+    }
+    if (out == NULL || out_len == 0)
+    {
+        return 0;
+    }
+    calldata_writer_t writer = {{out, out_len, 0}, 0, 0, false, false};
+    out[0] = '\0';
+    if (to == NULL)
+    {
+        amount_writer_printf(&writer.text, "Deploy contract, %zu bytes", data_len);
+        return writer.text.pos;
+    }
+    describe_decoded(&writer, to, chain_id, data, data_len, &call, err);
+    if (err != CALLDATA_OK)
+    {
+        return writer.text.pos;
+    }
+    if (writer.too_complex || writer_full(&writer))
+    {
+        // a partial description of a batch could hide calls, show none of it
+        writer.text.pos = 0;
+        out[0] = '\0';
+        if (writer.too_complex)
+        {
+            amount_writer_printf(&writer.text, "%s: too complex to describe, more than %d nested calls or %d levels, %zu bytes",
+                                 call.method->signature, CALLDATA_MAX_CALLS, CALLDATA_MAX_DEPTH, data_len);
+        }
+        else
+        {
+            amount_writer_printf(&writer.text, "%s: too long to describe, %zu bytes", call.method->signature, data_len);
+        }
+        writer.incomplete = true;
+    }
+    if (writer.incomplete && result != NULL)
+    {
+        *result = CALLDATA_ERR_INCOMPLETE;
+    }
+    return writer.text.pos;
+}
@@ -0,0 +1,102 @@
+#ifndef CALLDATA_H
+#define CALLDATA_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CALLDATA_SELECTOR_LEN 4
+#define CALLDATA_WORD_LEN 32
+#define CALLDATA_MAX_ARGS 8
+/* calls nested deeper than this (multicall, execute), or more nested calls in total,
+   make the whole call too complex to describe */
+#define CALLDATA_MAX_DEPTH 3
+#define CALLDATA_MAX_CALLS 32
+
+#define CALLDATA_OK 0
+#define CALLDATA_ERR_UNKNOWN -1
+#define CALLDATA_ERR_INVALID -2
+/* the call decodes, but a nested call doesn't or the description had to be replaced by a summary */
+#define CALLDATA_ERR_INCOMPLETE -3
+
+/* ABI types the known methods use */
+#define ABI_TYPE_ADDRESS 0
+#define ABI_TYPE_UINT256 1
+#define ABI_TYPE_UINT8 2
+#define ABI_TYPE_BOOL 3
+#define ABI_TYPE_BYTES32 4
+#define ABI_TYPE_BYTES 5
+#define ABI_TYPE_BYTES_ARRAY 6
+#define ABI_TYPE_ADDRESS_ARRAY 7
+#define ABI_TYPE_UINT256_ARRAY 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    uint32_t selector;
+    const char *signature;
+    /* CALLDATA_ACTION_* in calldata.c, how the call is described */
+    uint8_t action;
+    uint8_t args_len;
+    uint8_t args[CALLDATA_MAX_ARGS];
+} calldata_method_t;
+
+/*
+    Argument of a decoded call, a view over the calldata buffer.
+    static types: data is the 32-byte word
+    bytes: data and len are the content
+    arrays: data points to the element heads, len is the number of elements,
+            read them with calldata_array_word() / calldata_array_bytes()
+ */
+typedef struct
+{
+    uint8_t type;
+    const uint8_t *data;
+    size_t len;
+    /* end of the tuple the argument belongs to, bounds the dynamic content */
+    const uint8_t *end;
+} calldata_arg_t;
+
+typedef struct
+{
+    const calldata_method_t *method;
+    size_t args_len;
+    calldata_arg_t args[CALLDATA_MAX_ARGS];
+} calldata_call_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    /**********************
+     * GLOBAL PROTOTYPES
+     **********************/
+    /* looks up the method by selector and checks all arguments, returns CALLDATA_OK or CALLDATA_ERR_* */
+    int calldata_decode(const uint8_t *data, size_t data_len, calldata_call_t *call);
+    /* element of an address[] or uint256[] argument */
+    int calldata_array_word(const calldata_arg_t *array, size_t index, const uint8_t **word);
+    /* element of a bytes[] argument */
+    int calldata_array_bytes(const calldata_arg_t *array, size_t index, const uint8_t **data, size_t *len);
+    /*
+        Writes a human readable description of the call to `to` into `out`,
+        e.g. "Transfer 12.5 USDC to 0x...", nested batches are described call by call.
+        Never allocates. A batch that doesn't fit in out_len, or is nested too deep, is replaced
+        by a one-line summary. Returns the length written.
+        The calldata_decode() result of the call is stored in `result` if it is not NULL,
+        CALLDATA_ERR_UNKNOWN for contract deployment and CALLDATA_ERR_INCOMPLETE if the
+        description doesn't show every nested call, the caller should show the raw data then.
+     */
+    size_t calldata_describe(const uint8_t to[20], long long chain_id, const uint8_t *data, size_t data_len, char *out, size_t out_len, int *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CALLDATA_H
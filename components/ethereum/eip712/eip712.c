@@ -19,41 +19,52 @@
  * along with this library.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 /*
-    Produces hashes based on the metamask v4 rules. This is different from the EIP-712 spec
-    in how arrays of structs are hashed but is compatable with metamask.
-    See https://github.com/MetaMask/eth-sig-util/pull/107
+    Produces hashes as eth_signTypedData_v4 does, arrays of structs included,
+    see https://github.com/MetaMask/eth-sig-util/pull/107
 
     eip712 data rules:
-    Parser wants to see C strings, not javascript strings:
-        requires all complete json message strings to be enclosed by braces, i.e., { ... }
-        Cannot have entire json string quoted, i.e., "{ ... }" will not work.
-        Remove all quote escape chars, e.g., {"types":  not  {\"types\":
-    ints: Strings representing ints must fit into a long size (64-bits).
-        Note: Do not prefix ints or uints with 0x
+    The input is the whole typed data document as sent by the wallet:
+        {"types": {...}, "primaryType": "...", "domain": {...}, "message": {...}}
+    ints: decimal or 0x prefixed hex strings or numbers, within the range of the type.
+        Decimals may have an exponent as long as the value is an integer: 1e18, 1.5e3.
+    bools: true, false, 0 or 1.
     All hex and byte strings must be big-endian
     Byte strings and address should be prefixed by 0x
+
+    The document is tokenized once, in place: strings are unescaped where
+    they are and every value becomes a 12-byte token pointing into the
+    buffer. Hashing walks the tokens, so besides the document a request
+    needs the token array, the type table and O(depth) stack.
+
+    All state lives in an eip712_ctx_t, one per request. The "types" object is
+    indexed once: every struct type gets its dependency set, and its typeHash
+    is computed the first time a value of that type is hashed, so arrays of
+    structs don't rebuild and rehash encodeType for every element.
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "eip712.h"
-#include "tiny-json.h"
-#include "utility/trezor/sha3.h"
-#include "utility/trezor/memzero.h"
-#include "tiny-json.h"
+#include "keccak.h"
+#include "amount.h"
 #include <esp_log.h>
 
 #define TAG "eip712"
 
-#define USE_KECCAK 1
 #define ADDRESS_SIZE 42
-#define JSON_OBJ_POOL_SIZE 100
-#define STRBUFSIZE 511
-#define MAX_USERDEF_TYPES 10 // This is max number of user defined type allowed
-#define MAX_TYPESTRING 33    // maximum size for a type string
-#define MAX_ENCBYTEN_SIZE 66
+/* nested struct values deeper than this are rejected */
+#define EIP712_MAX_DEPTH 16
+/* JSON nesting, the struct depth plus the document's own levels and arrays */
+#define EIP712_MAX_JSON_DEPTH 40
+/* struct types per request, dependencies are kept in a 32-bit mask */
+#define EIP712_MAX_TYPES 32
+/* token lengths are 24 bits */
+#define EIP712_MAX_DOCUMENT_LEN 0xFFFFFF
+/* larger exponents only fit a zero */
+#define EIP712_MAX_EXPONENT 999
 
 typedef enum
 {
@@ -65,1090 +76,1312 @@ typedef enum
     BYTES,
     BYTES_N,
     BOOL,
-    UDEF_TYPE,
-    PREV_USERDEF,
-    TOO_MANY_UDEFS
+    UDEF_TYPE
 } basicType;
 
 typedef enum
 {
-    DOMAIN = 1,
-    MESSAGE
-} dm;
+    TOKEN_OBJ = 0,
+    TOKEN_ARRAY,
+    TOKEN_STRING,
+    TOKEN_NUMBER,
+    TOKEN_BOOL,
+    TOKEN_NULL
+} tokenType;
 
 // error list status
 #define SUCCESS 1
-#define NULL_MSG_HASH 2 // this is legal, not an error
-#define GENERAL_ERROR 3
 #define UDEF_NAME_ERROR 4
 #define UDEFS_OVERFLOW 5
 #define UDEF_ARRAY_NAME_ERR 6
 #define ADDR_STRING_VFLOW 7
 #define BYTESN_STRING_ERROR 8
 #define BYTESN_SIZE_ERROR 9
-#define INT_ARRAY_ERROR 10
-#define BYTESN_ARRAY_ERROR 11
-#define BOOL_ARRAY_ERROR 12
-// #define STACK_TOO_SMALL     13        // reserved - defined in memory.h
+#define INT_VALUE_ERROR 10
+#define BOOL_VALUE_ERROR 11
+#define STACK_TOO_SMALL 13
 
 #define JSON_PTYPENAMEERR 14
 #define JSON_PTYPEVALERR 15
 #define JSON_TYPESPROPERR 16
-#define JSON_TYPE_SPROPERR 17
 #define JSON_DPROPERR 18
-#define MSG_NO_DS 19
 #define JSON_MPROPERR 20
-#define JSON_PTYPESOBJERR 21
 #define JSON_TYPE_S_ERR 22
 #define JSON_TYPE_S_NAMEERR 23
-#define UNUSED_ERR_2 24 // available for re-use
-#define JSON_NO_PAIRS 25
-#define JSON_PAIRS_NOTEXT 26
-#define JSON_NO_PAIRS_SIB 27
 #define TYPE_NOT_ENCODABLE 28
-#define JSON_NOPAIRVAL 29
 #define JSON_NOPAIRNAME 30
 #define JSON_TYPE_T_NOVAL 31
-#define ADDR_STRING_NULL 32
 #define JSON_TYPE_WNOVAL 33
 
-#define LAST_ERROR JSON_TYPE_WNOVAL
-
-typedef struct _TokenType
+/*
+    A value of the document. Objects are followed by their key and value
+    tokens, arrays by their elements, next skips the value with everything
+    inside it. Token 0 is the root object, so 0 also means "not found".
+*/
+typedef struct
 {
-    const char *const address;
-    const char *const ticker;
-    uint8_t chain_id;
-    uint8_t decimals;
-} TokenType;
+    uint32_t offset;   // strings: first character after the quote
+    uint32_t len : 24; // bytes, unescaped for strings; entries for objects and arrays
+    uint32_t type : 8;
+    uint32_t next;
+} eip712_token_t;
 
 typedef struct
 {
-    char *eip712types;
-    char *eip712primetype;
-    char *eip712data;
-    int eip712typevals;
-} Ethereum712TypesValues;
+    uint32_t name;    // key token of the type in "types"
+    uint32_t members; // [{"name": ..., "type": ...}, ...]
+    /* struct types referenced directly or through other structs, bit n is types[n] */
+    uint32_t deps;
+    bool has_type_hash;
+    uint8_t type_hash[32];
+} eip712_type_t;
 
+/*
+    Per request state, the types are sorted by name so iterating a deps mask
+    yields the dependencies in encodeType order.
+*/
 typedef struct
 {
-    uint8_t domain_separator_hash[32];
-    bool has_domain_separator_hash;
-    bool has_msg_hash;
-    bool has_message_hash;
-    uint8_t message_hash[32];
-} EthereumTypedDataSignature;
+    const char *json;
+    const eip712_token_t *tokens;
+    eip712_type_t types[EIP712_MAX_TYPES];
+    uint8_t types_len;
+    uint8_t depth;
+} eip712_ctx_t;
+
+/* one allocation per request */
+typedef struct
+{
+    eip712_ctx_t ctx;
+    eip712_token_t tokens[];
+} eip712_request_t;
 
-static const char *udefList[MAX_USERDEF_TYPES] = {0};
-static dm confirmProp;
+typedef struct
+{
+    char *json;
+    size_t len;
+    size_t pos;
+    eip712_token_t *tokens;
+    uint32_t tokens_len;
+    uint32_t count;
+} eip712_tokenizer_t;
 
-static const char *nameForValue;
+static int encodeValue(eip712_ctx_t *ctx, const char *typeStr, size_t typeLen, uint32_t value, uint8_t *encoded);
 
-void failMessage(int err)
+static void failMessage(int err)
 {
     ESP_LOGE(TAG, "EIP-712 error: %d\n", err);
 }
 
-int encodableType(const char *typeStr)
+/*
+    Number of tokens for the document: the root, a key per colon, and one
+    value per comma and per non-empty container. Characters inside strings
+    don't count. Exact for valid JSON, the tokenizer checks the bound anyway.
+*/
+static uint32_t tokenCount(const char *json_str, size_t json_len)
 {
-    int ctr;
+    uint32_t count = 1;
+    bool inString = false;
 
-    if (0 == strncmp(typeStr, "address", sizeof("address") - 1))
-    {
-        return ADDRESS;
-    }
-    if (0 == strncmp(typeStr, "string", sizeof("string") - 1))
+    for (size_t ctr = 0; ctr < json_len; ctr++)
     {
-        return STRING;
-    }
-    if (0 == strncmp(typeStr, "int", sizeof("int") - 1))
-    {
-        // This could be 'int8', 'int16', ..., 'int256'
-        return INT;
-    }
-    if (0 == strncmp(typeStr, "uint", sizeof("uint") - 1))
-    {
-        // This could be 'uint8', 'uint16', ..., 'uint256'
-        return UINT;
-    }
-    if (0 == strncmp(typeStr, "bytes", sizeof("bytes") - 1))
-    {
-        // This could be 'bytes', 'bytes1', ..., 'bytes32'
-        if (0 == strcmp(typeStr, "bytes"))
+        char ch = json_str[ctr];
+        if (inString)
+        {
+            if (ch == '\\')
+            {
+                ctr++;
+            }
+            else if (ch == '"')
+            {
+                inString = false;
+            }
+        }
+        else if (ch == '"')
         {
-            return BYTES;
+            inString = true;
         }
-        else
+        else if (ch == ',' || ch == ':')
+        {
+            count++;
+        }
+        else if (ch == '{' || ch == '[')
         {
-            // parse out the length val
-            uint8_t byteTypeSize = (uint8_t)(strtol((typeStr + 5), NULL, 10));
-            if (byteTypeSize > 32)
+            size_t next = ctr + 1;
+            while (next < json_len && (json_str[next] == ' ' || json_str[next] == '\t' || json_str[next] == '\n' || json_str[next] == '\r'))
             {
-                return NOT_ENCODABLE;
+                next++;
             }
-            else
+            if (next < json_len && json_str[next] != '}' && json_str[next] != ']')
             {
-                return BYTES_N;
+                count++;
             }
         }
     }
-    if (0 == strcmp(typeStr, "bool"))
+    return count;
+}
+
+static int hexValue(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+    {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f')
     {
-        return BOOL;
+        return ch - 'a' + 10;
     }
+    if (ch >= 'A' && ch <= 'F')
+    {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
 
-    // See if type already defined. If so, skip, otherwise add it to list
-    for (ctr = 0; ctr < MAX_USERDEF_TYPES; ctr++)
+static void skipBlank(eip712_tokenizer_t *t)
+{
+    while (t->pos < t->len && (t->json[t->pos] == ' ' || t->json[t->pos] == '\t' || t->json[t->pos] == '\n' || t->json[t->pos] == '\r'))
     {
-        char typeNoArrTok[MAX_TYPESTRING] = {0};
+        t->pos++;
+    }
+}
+
+static eip712_token_t *newToken(eip712_tokenizer_t *t, tokenType type)
+{
+    if (t->count == t->tokens_len)
+    {
+        return NULL;
+    }
+    eip712_token_t *token = &t->tokens[t->count++];
+    token->offset = t->pos;
+    token->len = 0;
+    token->type = type;
+    return token;
+}
+
+/* \uXXXX, returns the code unit or -1 */
+static long parseUnicode(eip712_tokenizer_t *t, size_t at)
+{
+    long code = 0;
+    if (at + 4 > t->len)
+    {
+        return -1;
+    }
+    for (size_t ctr = at; ctr < at + 4; ctr++)
+    {
+        int digit = hexValue(t->json[ctr]);
+        if (digit < 0)
+        {
+            return -1;
+        }
+        code = (code << 4) | digit;
+    }
+    return code;
+}
 
-        strncpy(typeNoArrTok, typeStr, sizeof(typeNoArrTok) - 1);
-        strtok(typeNoArrTok, "["); // eliminate the array tokens if there
+/* at the opening quote, the unescaped string is written over the escaped one */
+static bool parseString(eip712_tokenizer_t *t, eip712_token_t *token)
+{
+    size_t in = ++t->pos;
+    size_t out = in;
 
-        if (udefList[ctr] != 0)
+    token->type = TOKEN_STRING;
+    token->offset = in;
+    while (in < t->len && t->json[in] != '"')
+    {
+        unsigned char ch = t->json[in++];
+        if (ch < 0x20)
+        {
+            return false;
+        }
+        if (ch != '\\')
+        {
+            t->json[out++] = ch;
+            continue;
+        }
+        if (in == t->len)
+        {
+            return false;
+        }
+        ch = t->json[in++];
+        switch (ch)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            t->json[out++] = ch;
+            break;
+        case 'b':
+            t->json[out++] = '\b';
+            break;
+        case 'f':
+            t->json[out++] = '\f';
+            break;
+        case 'n':
+            t->json[out++] = '\n';
+            break;
+        case 'r':
+            t->json[out++] = '\r';
+            break;
+        case 't':
+            t->json[out++] = '\t';
+            break;
+        case 'u':
         {
-            if (0 == strncmp(udefList[ctr], typeNoArrTok, strlen(udefList[ctr]) - strlen(typeNoArrTok)))
+            long code = parseUnicode(t, in);
+            if (code < 0 || (code >= 0xDC00 && code <= 0xDFFF))
+            {
+                return false;
+            }
+            in += 4;
+            if (code >= 0xD800 && code <= 0xDBFF)
+            {
+                // surrogate pair
+                long low = (in + 1 < t->len && t->json[in] == '\\' && t->json[in + 1] == 'u') ? parseUnicode(t, in + 2) : -1;
+                if (low < 0xDC00 || low > 0xDFFF)
+                {
+                    return false;
+                }
+                in += 6;
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            }
+            // UTF-8 is never longer than the escape sequence
+            if (code < 0x80)
             {
-                return PREV_USERDEF;
+                t->json[out++] = (char)code;
+            }
+            else if (code < 0x800)
+            {
+                t->json[out++] = (char)(0xC0 | (code >> 6));
+                t->json[out++] = (char)(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                t->json[out++] = (char)(0xE0 | (code >> 12));
+                t->json[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+                t->json[out++] = (char)(0x80 | (code & 0x3F));
             }
             else
             {
+                t->json[out++] = (char)(0xF0 | (code >> 18));
+                t->json[out++] = (char)(0x80 | ((code >> 12) & 0x3F));
+                t->json[out++] = (char)(0x80 | ((code >> 6) & 0x3F));
+                t->json[out++] = (char)(0x80 | (code & 0x3F));
             }
+            break;
         }
-        else
-        {
-            udefList[ctr] = typeStr;
-            return UDEF_TYPE;
+        default:
+            return false;
         }
     }
-    if (ctr == MAX_USERDEF_TYPES)
+    if (in == t->len)
     {
-        return TOO_MANY_UDEFS;
+        return false;
     }
+    token->len = out - token->offset;
+    t->pos = in + 1;
+    return true;
+}
 
-    return NOT_ENCODABLE; // not encodable
+static bool parseLiteral(eip712_tokenizer_t *t, eip712_token_t *token, const char *literal, tokenType type)
+{
+    size_t len = strlen(literal);
+    if (t->pos + len > t->len || 0 != memcmp(t->json + t->pos, literal, len))
+    {
+        return false;
+    }
+    token->type = type;
+    token->len = len;
+    t->pos += len;
+    return true;
 }
 
-/*
-    Entry:
-            eip712Types points to eip712 json type structure to parse
-            typeS points to the type to parse from jType
-            typeStr points to caller allocated, zeroized string buffer of size STRBUFSIZE+1
-    Exit:
-            typeStr points to hashable type string
-            returns error list status
-
-    NOTE: reentrant!
-*/
-int parseType(const json_t *eip712Types, const char *typeS, char *typeStr)
+/* any length, ints beyond 64 bits are common in typed data */
+static bool parseNumber(eip712_tokenizer_t *t, eip712_token_t *token)
 {
-    json_t const *tarray, *pairs;
-    const json_t *jType;
-    char append[STRBUFSIZE + 1] = {0};
-    int encTest;
-    const char *typeType = NULL;
-    int errRet = SUCCESS;
-    const json_t *obTest;
-    const char *nameTest;
-    const char *pVal;
+    size_t start = t->pos;
+    const char *json = t->json;
 
-    if (NULL == (jType = json_getProperty(eip712Types, typeS)))
+    if (t->pos < t->len && json[t->pos] == '-')
     {
-        errRet = JSON_TYPE_S_ERR;
-        return errRet;
+        t->pos++;
     }
-
-    if (NULL == (nameTest = json_getName(jType)))
+    if (t->pos == t->len || json[t->pos] < '0' || json[t->pos] > '9')
     {
-        errRet = JSON_TYPE_S_NAMEERR;
-        return errRet;
+        return false;
+    }
+    while (t->pos < t->len && ((json[t->pos] >= '0' && json[t->pos] <= '9') || json[t->pos] == '.' ||
+                               json[t->pos] == 'e' || json[t->pos] == 'E' || json[t->pos] == '+' || json[t->pos] == '-'))
+    {
+        t->pos++;
     }
+    token->type = TOKEN_NUMBER;
+    token->len = t->pos - start;
+    return true;
+}
 
-    strncat(typeStr, nameTest, STRBUFSIZE - strlen((const char *)typeStr));
-    strncat(typeStr, "(", STRBUFSIZE - strlen((const char *)typeStr));
+static bool parseValue(eip712_tokenizer_t *t, unsigned depth)
+{
+    skipBlank(t);
+    eip712_token_t *token = newToken(t, TOKEN_NULL);
+    if (token == NULL || t->pos == t->len)
+    {
+        return false;
+    }
 
-    tarray = json_getChild(jType);
-    while (tarray != 0)
+    char ch = t->json[t->pos];
+    if (ch == '{' || ch == '[')
     {
-        if (NULL == (pairs = json_getChild(tarray)))
+        bool isObject = (ch == '{');
+        char close = isObject ? '}' : ']';
+        uint32_t entries = 0;
+        if (depth == EIP712_MAX_JSON_DEPTH)
         {
-            errRet = JSON_NO_PAIRS;
-            return errRet;
+            return false;
         }
-        // should be type JSON_TEXT
-        if (pairs->type != JSON_TEXT)
+        token->type = isObject ? TOKEN_OBJ : TOKEN_ARRAY;
+        t->pos++;
+        skipBlank(t);
+        if (t->pos < t->len && t->json[t->pos] == close)
         {
-            errRet = JSON_PAIRS_NOTEXT;
-            return errRet;
+            t->pos++;
         }
         else
         {
-            if (NULL == (obTest = json_getSibling(pairs)))
+            while (true)
             {
-                errRet = JSON_NO_PAIRS_SIB;
-                return errRet;
-            }
-            typeType = json_getValue(obTest);
-            encTest = encodableType(typeType);
-            if (encTest == UDEF_TYPE)
-            {
-                // This is a user-defined type, parse it and append later
-                if (']' == typeType[strlen(typeType) - 1])
+                if (isObject)
                 {
-                    // array of structs. To parse name, remove array tokens.
-                    char typeNoArrTok[MAX_TYPESTRING] = {0};
-                    strncpy(typeNoArrTok, typeType, sizeof(typeNoArrTok) - 1);
-                    if (strlen(typeNoArrTok) < strlen(typeType))
+                    skipBlank(t);
+                    eip712_token_t *key = newToken(t, TOKEN_STRING);
+                    if (key == NULL || t->pos == t->len || t->json[t->pos] != '"' || !parseString(t, key))
                     {
-                        return UDEF_NAME_ERROR;
+                        return false;
                     }
-
-                    strtok(typeNoArrTok, "[");
-                    // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                    // {
-                    //     return errRet;
-                    // }
-                    if (SUCCESS != (errRet = parseType(eip712Types, typeNoArrTok, append)))
+                    key->next = t->count;
+                    skipBlank(t);
+                    if (t->pos == t->len || t->json[t->pos] != ':')
                     {
-                        return errRet;
+                        return false;
                     }
+                    t->pos++;
                 }
-                else
+                if (!parseValue(t, depth + 1))
                 {
-                    // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                    // {
-                    //     return errRet;
-                    // }
-                    if (SUCCESS != (errRet = parseType(eip712Types, typeType, append)))
-                    {
-                        return errRet;
-                    }
+                    return false;
                 }
+                entries++;
+                skipBlank(t);
+                if (t->pos < t->len && t->json[t->pos] == ',')
+                {
+                    t->pos++;
+                    continue;
+                }
+                if (t->pos < t->len && t->json[t->pos] == close)
+                {
+                    t->pos++;
+                    break;
+                }
+                return false;
             }
-            else if (encTest == TOO_MANY_UDEFS)
-            {
-                return UDEFS_OVERFLOW;
-            }
-            else if (encTest == NOT_ENCODABLE)
-            {
-                return TYPE_NOT_ENCODABLE;
-            }
-
-            if (NULL == (pVal = json_getValue(pairs)))
-            {
-                errRet = JSON_NOPAIRVAL;
-                return errRet;
-            }
-            strncat(typeStr, typeType, STRBUFSIZE - strlen((const char *)typeStr));
-            strncat(typeStr, " ", STRBUFSIZE - strlen((const char *)typeStr));
-            strncat(typeStr, pVal, STRBUFSIZE - strlen((const char *)typeStr));
-            strncat(typeStr, ",", STRBUFSIZE - strlen((const char *)typeStr));
         }
-        tarray = json_getSibling(tarray);
+        token->len = entries;
+    }
+    else if (ch == '"')
+    {
+        if (!parseString(t, token))
+        {
+            return false;
+        }
     }
-    // typeStr ends with a ',' unless there are no parameters to the type.
-    if (typeStr[strlen(typeStr) - 1] == ',')
+    else if (ch == 't' || ch == 'f')
     {
-        // replace last comma with a paren
-        typeStr[strlen(typeStr) - 1] = ')';
+        if (!parseLiteral(t, token, ch == 't' ? "true" : "false", TOKEN_BOOL))
+        {
+            return false;
+        }
     }
-    else
+    else if (ch == 'n')
     {
-        // append paren, there are no parameters
-        strncat(typeStr, ")", STRBUFSIZE - 1);
+        if (!parseLiteral(t, token, "null", TOKEN_NULL))
+        {
+            return false;
+        }
     }
-    if (strlen(append) > 0)
+    else if (!parseNumber(t, token))
     {
-        strncat(typeStr, append, STRBUFSIZE - strlen((const char *)append));
+        return false;
     }
-
-    return SUCCESS;
+    token->next = t->count;
+    return true;
 }
 
-int encAddress(const char *string, uint8_t *encoded)
+static bool tokenize(eip712_tokenizer_t *t)
 {
-    unsigned ctr;
-    char byteStrBuf[3] = {0};
-
-    if (string == NULL)
-    {
-        return ADDR_STRING_NULL;
-    }
-    if (ADDRESS_SIZE < strlen(string))
+    skipBlank(t);
+    if (t->pos == t->len || t->json[t->pos] != '{' || !parseValue(t, 0))
     {
-        return ADDR_STRING_VFLOW;
+        return false;
     }
+    skipBlank(t);
+    return t->pos == t->len;
+}
 
-    for (ctr = 0; ctr < 12; ctr++)
+static const char *tokenStr(const eip712_ctx_t *ctx, uint32_t token)
+{
+    return ctx->json + ctx->tokens[token].offset;
+}
+
+/* value token of key in the object, 0 if there is none */
+static uint32_t objectGet(const eip712_ctx_t *ctx, uint32_t object, const char *key)
+{
+    size_t keyLen = strlen(key);
+    uint32_t entry = object + 1;
+
+    if (ctx->tokens[object].type != TOKEN_OBJ)
     {
-        encoded[ctr] = '\0';
+        return 0;
     }
-    for (ctr = 12; ctr < 32; ctr++)
+    for (uint32_t ctr = 0; ctr < ctx->tokens[object].len; ctr++)
     {
-        strncpy(byteStrBuf, &string[2 * ((ctr - 12)) + 2], 2);
-        encoded[ctr] = (uint8_t)(strtol(byteStrBuf, NULL, 16));
+        if (ctx->tokens[entry].len == keyLen && 0 == memcmp(tokenStr(ctx, entry), key, keyLen))
+        {
+            return entry + 1;
+        }
+        entry = ctx->tokens[entry + 1].next;
     }
-    return SUCCESS;
+    return 0;
 }
 
-int encString(const char *string, uint8_t *encoded)
+/* string value of key in the object, 0 if there is none */
+static uint32_t objectGetString(const eip712_ctx_t *ctx, uint32_t object, const char *key)
 {
-    struct SHA3_CTX strCtx;
-
-    sha3_256_Init(&strCtx);
-    sha3_Update(&strCtx, (const unsigned char *)string, (size_t)strlen(string));
-    keccak_Final(&strCtx, encoded);
-    return SUCCESS;
+    uint32_t value = objectGet(ctx, object, key);
+    return (value != 0 && ctx->tokens[value].type == TOKEN_STRING) ? value : 0;
 }
 
-int encodeBytes(const char *string, uint8_t *encoded)
+static bool typeIs(const char *typeStr, size_t typeLen, const char *name)
 {
-    struct SHA3_CTX byteCtx;
-    const char *valStrPtr = string + 2;
-    uint8_t valByte[1];
-    char byteStrBuf[3] = {0};
-
-    sha3_256_Init(&byteCtx);
-    while (*valStrPtr != '\0')
-    {
-        strncpy(byteStrBuf, valStrPtr, 2);
-        valByte[0] = (uint8_t)(strtol(byteStrBuf, NULL, 16));
-        sha3_Update(&byteCtx,
-                    (const unsigned char *)valByte,
-                    (size_t)sizeof(uint8_t));
-        valStrPtr += 2;
-    }
-    keccak_Final(&byteCtx, encoded);
-    return SUCCESS;
+    return typeLen == strlen(name) && 0 == memcmp(typeStr, name, typeLen);
 }
 
-int encodeBytesN(const char *typeT, const char *string, uint8_t *encoded)
+/* true if typeStr is prefix followed by nothing or only digits, e.g. uint, uint256 */
+static bool typeIsSized(const char *typeStr, size_t typeLen, const char *prefix)
 {
-    char byteStrBuf[3] = {0};
-    unsigned ctr;
+    size_t prefixLen = strlen(prefix);
+    if (typeLen < prefixLen || 0 != memcmp(typeStr, prefix, prefixLen))
+    {
+        return false;
+    }
+    for (size_t ctr = prefixLen; ctr < typeLen; ctr++)
+    {
+        if (typeStr[ctr] < '0' || typeStr[ctr] > '9')
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-    if (MAX_ENCBYTEN_SIZE < strlen(string))
+/* bytes1 .. bytes32, 0 otherwise */
+static unsigned bytesSize(const char *typeStr, size_t typeLen)
+{
+    unsigned size = 0;
+    for (size_t ctr = 5; ctr < typeLen && ctr < 8; ctr++)
     {
-        return BYTESN_STRING_ERROR;
+        size = size * 10 + (typeStr[ctr] - '0');
     }
+    return (typeLen > 5 && typeLen < 8 && size <= 32) ? size : 0;
+}
 
-    // parse out the length val
-    uint8_t byteTypeSize = (uint8_t)(strtol((typeT + 5), NULL, 10));
-    if (32 < byteTypeSize)
+/* uint8 .. uint256 in steps of 8, uint alone is uint256, 0 otherwise */
+static unsigned intBits(const char *typeStr, size_t typeLen, size_t prefixLen)
+{
+    unsigned bits = 0;
+    if (typeLen == prefixLen)
     {
-        return BYTESN_SIZE_ERROR;
+        return 256;
     }
-    for (ctr = 0; ctr < 32; ctr++)
+    if (typeLen > prefixLen + 3 || typeStr[prefixLen] == '0')
     {
-        // zero padding
-        encoded[ctr] = 0;
+        return 0;
     }
-    unsigned zeroFillLen = 32 - ((strlen(string) - 2 /* skip '0x' */) / 2);
-    // bytesN are zero padded on the right
-    for (ctr = zeroFillLen; ctr < 32; ctr++)
+    for (size_t ctr = prefixLen; ctr < typeLen; ctr++)
     {
-        strncpy(byteStrBuf, &string[2 + 2 * (ctr - zeroFillLen)], 2);
-        encoded[ctr - zeroFillLen] = (uint8_t)(strtol(byteStrBuf, NULL, 16));
+        bits = bits * 10 + (typeStr[ctr] - '0');
     }
-    return SUCCESS;
+    return (bits <= 256 && bits % 8 == 0) ? bits : 0;
 }
 
-int confirmName(const char *name, bool valAvailable)
+/* typeStr is not null terminated, it may be the element type of an array */
+static int encodableType(const char *typeStr, size_t typeLen)
 {
-    if (valAvailable)
+    if (typeIs(typeStr, typeLen, "address"))
     {
-        nameForValue = name;
+        return ADDRESS;
     }
-    else
+    if (typeIs(typeStr, typeLen, "string"))
     {
-        //(void)review(ButtonRequestType_ButtonRequest_Other, "MESSAGE DATA", "Press button to continue for\n\"%s\" values", name);
+        return STRING;
     }
-    return SUCCESS;
-}
-
-int confirmValue(const char *value)
-{
-    //(void)review(ButtonRequestType_ButtonRequest_Other, "MESSAGE DATA", "%s %s", nameForValue, value);
-    return SUCCESS;
-}
-
-static const char *dsname = NULL, *dsversion = NULL, *dschainId = NULL, *dsverifyingContract = NULL;
-void marshallDsVals(const char *value)
-{
-
-    if (0 == strncmp(nameForValue, "name", sizeof("name")))
+    if (typeIs(typeStr, typeLen, "bool"))
+    {
+        return BOOL;
+    }
+    if (typeIs(typeStr, typeLen, "bytes"))
     {
-        dsname = value;
+        return BYTES;
     }
-    if (0 == strncmp(nameForValue, "version", sizeof("version")))
+    if (typeIsSized(typeStr, typeLen, "bytes"))
     {
-        dsversion = value;
+        // 'bytes1', ..., 'bytes32'
+        return bytesSize(typeStr, typeLen) != 0 ? BYTES_N : NOT_ENCODABLE;
     }
-    if (0 == strncmp(nameForValue, "chainId", sizeof("chainId")))
+    if (typeIsSized(typeStr, typeLen, "uint"))
     {
-        dschainId = value;
+        return intBits(typeStr, typeLen, 4) != 0 ? UINT : NOT_ENCODABLE;
     }
-    if (0 == strncmp(nameForValue, "verifyingContract", sizeof("verifyingContract")))
+    if (typeIsSized(typeStr, typeLen, "int"))
     {
-        dsverifyingContract = value;
+        return intBits(typeStr, typeLen, 3) != 0 ? INT : NOT_ENCODABLE;
     }
-    return;
+    return UDEF_TYPE;
 }
 
-/*
-    Entry:
-            eip712Types points to the eip712 types structure
-            jType points to eip712 json type structure to parse
-            nextVal points to the next value to encode
-            msgCtx points to caller allocated hash context to hash encoded values into.
-    Exit:
-            msgCtx points to current final hash context
-            returns error status
-
-    NOTE: reentrant!
-*/
-int parseVals(const json_t *eip712Types, const json_t *jType, const json_t *nextVal, struct SHA3_CTX *msgCtx)
+/* strcmp order of two strings with lengths */
+static int nameCompare(const char *a, size_t aLen, const char *b, size_t bLen)
 {
-    json_t const *tarray, *pairs, *walkVals, *obTest;
-    int ctr;
-    const char *typeName = NULL, *typeType = NULL;
-    uint8_t encBytes[32] = {0}; // holds the encrypted bytes for the message
-    const char *valStr = NULL;
-    struct SHA3_CTX valCtx = {0}; // local hash context
-    bool hasValue = 0;
-    bool ds_vals = 0; // domain sep values are confirmed on a single screen
-    int errRet = SUCCESS;
+    int diff = memcmp(a, b, aLen < bLen ? aLen : bLen);
+    if (diff != 0)
+    {
+        return diff;
+    }
+    return (aLen > bLen) - (aLen < bLen);
+}
 
-    if (0 == strncmp(json_getName(jType), "EIP712Domain", sizeof("EIP712Domain")))
+static int findType(const eip712_ctx_t *ctx, const char *name, size_t nameLen)
+{
+    int low = 0;
+    int high = ctx->types_len - 1;
+    while (low <= high)
     {
-        ds_vals = true;
+        int mid = (low + high) / 2;
+        uint32_t token = ctx->types[mid].name;
+        int diff = nameCompare(tokenStr(ctx, token), ctx->tokens[token].len, name, nameLen);
+        if (diff == 0)
+        {
+            return mid;
+        }
+        if (diff < 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
     }
+    return -1;
+}
 
-    tarray = json_getChild(jType);
+/*
+    Indexes the "types" object: the table is kept sorted by name, then the
+    struct types each member refers to are collected into deps and closed
+    transitively, a type may refer to itself.
+*/
+static int parseTypes(eip712_ctx_t *ctx, uint32_t eip712Types)
+{
+    const eip712_token_t *tokens = ctx->tokens;
 
-    while (tarray != 0)
+    if (eip712Types == 0 || tokens[eip712Types].type != TOKEN_OBJ)
+    {
+        return JSON_TYPESPROPERR;
+    }
+    uint32_t entry = eip712Types + 1;
+    for (uint32_t ctr = 0; ctr < tokens[eip712Types].len; ctr++, entry = tokens[entry + 1].next)
     {
-        if (NULL == (pairs = json_getChild(tarray)))
+        const char *name = tokenStr(ctx, entry);
+        size_t nameLen = tokens[entry].len;
+        if (nameLen == 0)
         {
-            errRet = JSON_NO_PAIRS;
-            return errRet;
+            return JSON_TYPE_S_NAMEERR;
         }
-        // should be type JSON_TEXT
-        if (pairs->type != JSON_TEXT)
+        if (tokens[entry + 1].type != TOKEN_ARRAY)
         {
-            errRet = JSON_PAIRS_NOTEXT;
-            return errRet;
+            return JSON_TYPE_S_ERR;
         }
-        else
+        if (ctx->types_len == EIP712_MAX_TYPES)
+        {
+            return UDEFS_OVERFLOW;
+        }
+        int pos = ctx->types_len;
+        int diff = 1;
+        while (pos > 0)
         {
-            if (NULL == (typeName = json_getValue(pairs)))
+            uint32_t other = ctx->types[pos - 1].name;
+            diff = nameCompare(tokenStr(ctx, other), tokens[other].len, name, nameLen);
+            if (diff <= 0)
             {
-                errRet = JSON_NOPAIRNAME;
-                return errRet;
+                break;
             }
-            if (NULL == (obTest = json_getSibling(pairs)))
+            ctx->types[pos] = ctx->types[pos - 1];
+            pos--;
+        }
+        if (pos > 0 && diff == 0)
+        {
+            return UDEF_NAME_ERROR;
+        }
+        memset(&ctx->types[pos], 0, sizeof(eip712_type_t));
+        ctx->types[pos].name = entry;
+        ctx->types[pos].members = entry + 1;
+        ctx->types_len++;
+    }
+
+    for (int ctr = 0; ctr < ctx->types_len; ctr++)
+    {
+        uint32_t members = ctx->types[ctr].members;
+        uint32_t member = members + 1;
+        for (uint32_t memberCtr = 0; memberCtr < tokens[members].len; memberCtr++, member = tokens[member].next)
+        {
+            if (0 == objectGetString(ctx, member, "name"))
             {
-                errRet = JSON_NO_PAIRS_SIB;
-                return errRet;
+                return JSON_NOPAIRNAME;
             }
-            if (NULL == (typeType = json_getValue(obTest)))
+            uint32_t typeType = objectGetString(ctx, member, "type");
+            if (typeType == 0)
             {
-                errRet = JSON_TYPE_T_NOVAL;
-                return errRet;
+                return JSON_TYPE_T_NOVAL;
             }
-            walkVals = nextVal;
-            while (0 != walkVals)
+            const char *typeStr = tokenStr(ctx, typeType);
+            size_t baseLen = 0;
+            while (baseLen < tokens[typeType].len && typeStr[baseLen] != '[')
             {
-                if (0 == strcmp(json_getName(walkVals), typeName))
-                {
-                    valStr = json_getValue(walkVals);
-                    break;
-                }
-                else
-                {
-                    // keep looking for val
-                    walkVals = json_getSibling(walkVals);
-                }
+                baseLen++;
             }
-
-            if (JSON_TEXT == json_getType(walkVals) || JSON_INTEGER == json_getType(walkVals))
+            int encTest = encodableType(typeStr, baseLen);
+            if (encTest == NOT_ENCODABLE)
             {
-                hasValue = 1;
+                return TYPE_NOT_ENCODABLE;
             }
-            else
+            if (encTest == UDEF_TYPE)
             {
-                hasValue = 0;
+                int dep = findType(ctx, typeStr, baseLen);
+                if (dep < 0)
+                {
+                    return TYPE_NOT_ENCODABLE;
+                }
+                ctx->types[ctr].deps |= (uint32_t)1 << dep;
             }
-            confirmName(typeName, hasValue);
-
-            if (walkVals == 0)
+        }
+    }
+    for (int via = 0; via < ctx->types_len; via++)
+    {
+        for (int ctr = 0; ctr < ctx->types_len; ctr++)
+        {
+            if (ctx->types[ctr].deps & ((uint32_t)1 << via))
             {
-                errRet = JSON_TYPE_WNOVAL;
-                return errRet;
+                ctx->types[ctr].deps |= ctx->types[via].deps;
             }
-            else
-            {
-                if (0 == strncmp("address", typeType, strlen("address") - 1))
-                {
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        // array of addresses
-                        json_t const *addrVals = json_getChild(walkVals);
-                        sha3_256_Init(&valCtx); // hash of concatenated encoded strings
-                        while (0 != addrVals)
-                        {
-                            // just walk the string values assuming, for fixed sizes, all values are there.
-                            if (ds_vals)
-                            {
-                                marshallDsVals(json_getValue(addrVals));
-                            }
-                            else
-                            {
-                                confirmValue(json_getValue(addrVals));
-                            }
-
-                            errRet = encAddress(json_getValue(addrVals), encBytes);
-                            if (SUCCESS != errRet)
-                            {
-                                return errRet;
-                            }
-                            sha3_Update(&valCtx, (const unsigned char *)encBytes, 32);
-                            addrVals = json_getSibling(addrVals);
-                        }
-                        keccak_Final(&valCtx, encBytes);
-                    }
-                    else
-                    {
-                        if (ds_vals)
-                        {
-                            marshallDsVals(valStr);
-                        }
-                        else
-                        {
-                            confirmValue(valStr);
-                        }
-                        errRet = encAddress(valStr, encBytes);
-                        if (SUCCESS != errRet)
-                        {
-                            return errRet;
-                        }
-                    }
-                }
-                else if (0 == strncmp("string", typeType, strlen("string") - 1))
-                {
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        // array of strings
-                        json_t const *stringVals = json_getChild(walkVals);
-                        uint8_t strEncBytes[32];
-                        sha3_256_Init(&valCtx); // hash of concatenated encoded strings
-                        while (0 != stringVals)
-                        {
-                            // just walk the string values assuming, for fixed sizes, all values are there.
-                            if (ds_vals)
-                            {
-                                marshallDsVals(json_getValue(stringVals));
-                            }
-                            else
-                            {
-                                confirmValue(json_getValue(stringVals));
-                            }
-                            errRet = encString(json_getValue(stringVals), strEncBytes);
-                            if (SUCCESS != errRet)
-                            {
-                                return errRet;
-                            }
-                            sha3_Update(&valCtx, (const unsigned char *)strEncBytes, 32);
-                            stringVals = json_getSibling(stringVals);
-                        }
-                        keccak_Final(&valCtx, encBytes);
-                    }
-                    else
-                    {
-                        if (ds_vals)
-                        {
-                            marshallDsVals(valStr);
-                        }
-                        else
-                        {
-                            confirmValue(valStr);
-                        }
-                        errRet = encString(valStr, encBytes);
-                        if (SUCCESS != errRet)
-                        {
-                            return errRet;
-                        }
-                    }
-                }
-                else if ((0 == strncmp("uint", typeType, strlen("uint") - 1)) ||
-                         (0 == strncmp("int", typeType, strlen("int") - 1)))
-                {
+        }
+    }
+    return SUCCESS;
+}
 
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        return INT_ARRAY_ERROR;
-                    }
-                    else
-                    {
-                        if (ds_vals)
-                        {
-                            marshallDsVals(valStr);
-                        }
-                        else
-                        {
-                            confirmValue(valStr);
-                        }
-                        uint8_t negInt = 0; // 0 is positive, 1 is negative
-                        if (0 == strncmp("int", typeType, strlen("int") - 1))
-                        {
-                            if (*valStr == '-')
-                            {
-                                negInt = 1;
-                            }
-                        }
-                        // parse out the length val
-                        for (ctr = 0; ctr < 32; ctr++)
-                        {
-                            if (negInt)
-                            {
-                                // sign extend negative values
-                                encBytes[ctr] = 0xFF;
-                            }
-                            else
-                            {
-                                // zero padding for positive
-                                encBytes[ctr] = 0;
-                            }
-                        }
-                        // all int strings are assumed to be base 10 and fit into 64 bits
-                        long long intVal = strtoll(valStr, NULL, 10);
-                        // Needs to be big endian, so add to encBytes appropriately
-                        encBytes[24] = (intVal >> 56) & 0xff;
-                        encBytes[25] = (intVal >> 48) & 0xff;
-                        encBytes[26] = (intVal >> 40) & 0xff;
-                        encBytes[27] = (intVal >> 32) & 0xff;
-                        encBytes[28] = (intVal >> 24) & 0xff;
-                        encBytes[29] = (intVal >> 16) & 0xff;
-                        encBytes[30] = (intVal >> 8) & 0xff;
-                        encBytes[31] = (intVal) & 0xff;
-                    }
-                }
-                else if (0 == strncmp("bytes", typeType, strlen("bytes")))
-                {
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        return BYTESN_ARRAY_ERROR;
-                    }
-                    else
-                    {
-                        // This could be 'bytes', 'bytes1', ..., 'bytes32'
-                        if (ds_vals)
-                        {
-                            marshallDsVals(valStr);
-                        }
-                        else
-                        {
-                            confirmValue(valStr);
-                        }
-                        if (0 == strcmp(typeType, "bytes"))
-                        {
-                            errRet = encodeBytes(valStr, encBytes);
-                            if (SUCCESS != errRet)
-                            {
-                                return errRet;
-                            }
-                        }
-                        else
-                        {
-                            errRet = encodeBytesN(typeType, valStr, encBytes);
-                            if (SUCCESS != errRet)
-                            {
-                                return errRet;
-                            }
-                        }
-                    }
-                }
-                else if (0 == strncmp("bool", typeType, strlen(typeType)))
-                {
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        return BOOL_ARRAY_ERROR;
-                    }
-                    else
-                    {
-                        if (ds_vals)
-                        {
-                            marshallDsVals(valStr);
-                        }
-                        else
-                        {
-                            confirmValue(valStr);
-                        }
-                        for (ctr = 0; ctr < 32; ctr++)
-                        {
-                            // leading zeros in bool
-                            encBytes[ctr] = 0;
-                        }
-                        if (0 == strncmp(valStr, "true", sizeof("true")))
-                        {
-                            encBytes[31] = 0x01;
-                        }
-                    }
-                }
-                else
-                {
-                    // encode user defined type
-                    char encSubTypeStr[STRBUFSIZE + 1] = {0};
-                    // clear out the user-defined types list
-                    for (ctr = 0; ctr < MAX_USERDEF_TYPES; ctr++)
-                    {
-                        udefList[ctr] = NULL;
-                    }
+static void hashToken(keccak256_ctx_t *hashCtx, const eip712_ctx_t *ctx, uint32_t token)
+{
+    keccak256_update(hashCtx, (const uint8_t *)tokenStr(ctx, token), ctx->tokens[token].len);
+}
 
-                    char typeNoArrTok[MAX_TYPESTRING] = {0};
-                    // need to get typehash of type first
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        // array of structs. To parse name, remove array tokens.
-                        strncpy(typeNoArrTok, typeType, sizeof(typeNoArrTok) - 1);
-                        if (strlen(typeNoArrTok) < strlen(typeType))
-                        {
-                            return UDEF_ARRAY_NAME_ERR;
-                        }
-                        strtok(typeNoArrTok, "[");
-                        // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                        // {
-                        //     return errRet;
-                        // }
-                        if (SUCCESS != (errRet = parseType(eip712Types, typeNoArrTok, encSubTypeStr)))
-                        {
-                            return errRet;
-                        }
-                    }
-                    else
-                    {
-                        // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                        // {
-                        //     return errRet;
-                        // }
-                        if (SUCCESS != (errRet = parseType(eip712Types, typeType, encSubTypeStr)))
-                        {
-                            return errRet;
-                        }
-                    }
-                    sha3_256_Init(&valCtx);
-                    sha3_Update(&valCtx, (const unsigned char *)encSubTypeStr, (size_t)strlen(encSubTypeStr));
-                    keccak_Final(&valCtx, encBytes);
+/* Name(type1 name1,type2 name2) */
+static void hashTypeMembers(keccak256_ctx_t *typeCtx, const eip712_ctx_t *ctx, const eip712_type_t *type)
+{
+    uint32_t member = type->members + 1;
 
-                    if (']' == typeType[strlen(typeType) - 1])
-                    {
-                        // array of udefs
-                        struct SHA3_CTX eleCtx = {0}; // local hash context
-                        struct SHA3_CTX arrCtx = {0}; // array elements hash context
-                        uint8_t eleHashBytes[32];
-
-                        sha3_256_Init(&arrCtx);
-
-                        json_t const *udefVals = json_getChild(walkVals);
-                        while (0 != udefVals)
-                        {
-                            sha3_256_Init(&eleCtx);
-                            sha3_Update(&eleCtx, (const unsigned char *)encBytes, 32);
-                            // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                            // {
-                            //     return errRet;
-                            // }
-                            if (SUCCESS != (errRet =
-                                                parseVals(
-                                                    eip712Types,
-                                                    json_getProperty(eip712Types, strtok(typeNoArrTok, "]")),
-                                                    json_getChild(udefVals), // where to get the values
-                                                    &eleCtx                  // encode hash happens in parse, this is the return
-                                                    )))
-                            {
-                                return errRet;
-                            }
-                            keccak_Final(&eleCtx, eleHashBytes);
-                            sha3_Update(&arrCtx, (const unsigned char *)eleHashBytes, 32);
-                            // just walk the udef values assuming, for fixed sizes, all values are there.
-                            udefVals = json_getSibling(udefVals);
-                        }
-                        keccak_Final(&arrCtx, encBytes);
-                    }
-                    else
-                    {
-                        sha3_256_Init(&valCtx);
-                        sha3_Update(&valCtx, (const unsigned char *)encBytes, (size_t)sizeof(encBytes));
-                        // if (STACK_GOOD != (errRet = memcheck(STACK_SIZE_GUARD)))
-                        // {
-                        //     return errRet;
-                        // }
-                        if (SUCCESS != (errRet =
-                                            parseVals(
-                                                eip712Types,
-                                                json_getProperty(eip712Types, typeType),
-                                                json_getChild(walkVals), // where to get the values
-                                                &valCtx                  // val hash happens in parse, this is the return
-                                                )))
-                        {
-                            return errRet;
-                        }
-                        keccak_Final(&valCtx, encBytes);
-                    }
-                }
+    hashToken(typeCtx, ctx, type->name);
+    keccak256_update(typeCtx, (const uint8_t *)"(", 1);
+    for (uint32_t ctr = 0; ctr < ctx->tokens[type->members].len; ctr++, member = ctx->tokens[member].next)
+    {
+        if (ctr > 0)
+        {
+            keccak256_update(typeCtx, (const uint8_t *)",", 1);
+        }
+        hashToken(typeCtx, ctx, objectGetString(ctx, member, "type"));
+        keccak256_update(typeCtx, (const uint8_t *)" ", 1);
+        hashToken(typeCtx, ctx, objectGetString(ctx, member, "name"));
+    }
+    keccak256_update(typeCtx, (const uint8_t *)")", 1);
+}
+
+/* keccak(encodeType), the referenced types follow in name order, which is the table order */
+static const uint8_t *typeHash(eip712_ctx_t *ctx, int index)
+{
+    eip712_type_t *type = &ctx->types[index];
+    if (!type->has_type_hash)
+    {
+        keccak256_ctx_t typeCtx;
+        keccak256_init(&typeCtx);
+        hashTypeMembers(&typeCtx, ctx, type);
+        for (int ctr = 0; ctr < ctx->types_len; ctr++)
+        {
+            if (ctr != index && (type->deps & ((uint32_t)1 << ctr)))
+            {
+                hashTypeMembers(&typeCtx, ctx, &ctx->types[ctr]);
             }
+        }
+        keccak256_final(&typeCtx, type->type_hash);
+        type->has_type_hash = true;
+    }
+    return type->type_hash;
+}
 
-            // hash encoded bytes to final context
-            sha3_Update(msgCtx, (const unsigned char *)encBytes, 32);
+/* 0x followed by an even number of hex digits, at most maxLen bytes */
+static bool decodeHex(const char *string, size_t len, size_t maxLen, uint8_t *decoded, size_t *decodedLen)
+{
+    if (len < 2 || string[0] != '0' || (string[1] != 'x' && string[1] != 'X') || len % 2 != 0 || (len - 2) / 2 > maxLen)
+    {
+        return false;
+    }
+    for (size_t ctr = 2; ctr < len; ctr += 2)
+    {
+        int high = hexValue(string[ctr]);
+        int low = hexValue(string[ctr + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
         }
-        tarray = json_getSibling(tarray);
+        decoded[(ctr - 2) / 2] = (uint8_t)((high << 4) | low);
+    }
+    *decodedLen = (len - 2) / 2;
+    return true;
+}
+
+static int encAddress(const char *string, size_t len, uint8_t *encoded)
+{
+    size_t decodedLen;
+
+    memset(encoded, 0, 12);
+    if (len != ADDRESS_SIZE || !decodeHex(string, len, 20, encoded + 12, &decodedLen))
+    {
+        return ADDR_STRING_VFLOW;
     }
+    return SUCCESS;
+}
+
+static int encString(const char *string, size_t len, uint8_t *encoded)
+{
+    keccak256_ctx_t strCtx;
 
+    keccak256_init(&strCtx);
+    keccak256_update(&strCtx, (const uint8_t *)string, len);
+    keccak256_final(&strCtx, encoded);
     return SUCCESS;
 }
 
-int encode(const json_t *jsonTypes, const json_t *jsonVals, const char *typeS, uint8_t *hashRet)
+static int encodeBytes(const char *string, size_t len, uint8_t *encoded)
 {
-    int ctr;
-    char encTypeStr[STRBUFSIZE + 1] = {0};
-    uint8_t typeHash[32];
-    struct SHA3_CTX finalCtx = {0};
-    int errRet;
-    json_t const *typesProp;
-    json_t const *typeSprop;
-    json_t const *domainOrMessageProp;
-    json_t const *valsProp;
-    char *domOrMsgStr = NULL;
+    keccak256_ctx_t byteCtx;
+    uint8_t valBytes[32];
+    size_t valLen = 0;
 
-    // clear out the user-defined types list
-    for (ctr = 0; ctr < MAX_USERDEF_TYPES; ctr++)
+    if (len < 2 || string[0] != '0' || (string[1] != 'x' && string[1] != 'X') || len % 2 != 0)
     {
-        udefList[ctr] = NULL;
+        return BYTESN_STRING_ERROR;
     }
-    if (NULL == (typesProp = json_getProperty(jsonTypes, "types")))
+    keccak256_init(&byteCtx);
+    for (size_t ctr = 2; ctr < len; ctr += 2)
     {
-        errRet = JSON_TYPESPROPERR;
-        return errRet;
+        int high = hexValue(string[ctr]);
+        int low = hexValue(string[ctr + 1]);
+        if (high < 0 || low < 0)
+        {
+            return BYTESN_STRING_ERROR;
+        }
+        valBytes[valLen++] = (uint8_t)((high << 4) | low);
+        if (valLen == sizeof(valBytes))
+        {
+            keccak256_update(&byteCtx, valBytes, valLen);
+            valLen = 0;
+        }
     }
-    if (SUCCESS != (errRet =
-                        parseType(typesProp, typeS, encTypeStr)))
+    keccak256_update(&byteCtx, valBytes, valLen);
+    keccak256_final(&byteCtx, encoded);
+    return SUCCESS;
+}
+
+/* bytesN are zero padded on the right */
+static int encodeBytesN(const char *typeT, size_t typeLen, const char *string, size_t len, uint8_t *encoded)
+{
+    size_t decodedLen;
+
+    memset(encoded, 0, 32);
+    if (!decodeHex(string, len, bytesSize(typeT, typeLen), encoded, &decodedLen))
     {
-        return errRet;
+        return BYTESN_SIZE_ERROR;
     }
+    return SUCCESS;
+}
 
-    sha3_256_Init(&finalCtx);
-    sha3_Update(&finalCtx, (const unsigned char *)encTypeStr, (size_t)strlen(encTypeStr));
-    keccak_Final(&finalCtx, typeHash);
+/* encoded = encoded * base + digit, false on overflow of 256 bits */
+static bool intAppend(uint8_t *encoded, unsigned base, unsigned digit)
+{
+    unsigned carry = digit;
+    for (int ctr = 31; ctr >= 0; ctr--)
+    {
+        carry += encoded[ctr] * base;
+        encoded[ctr] = carry & 0xff;
+        carry >>= 8;
+    }
+    return carry == 0;
+}
 
-    // They typehash must be the first message of the final hash, this is the start
-    sha3_256_Init(&finalCtx);
-    sha3_Update(&finalCtx, (const unsigned char *)typeHash, (size_t)sizeof(typeHash));
+/* the integer digits of a decimal, the fraction and exponent have to cancel out: 1.5e3, 100e-2 */
+static int decodeDecimal(const char *string, const char *end, uint8_t *encoded)
+{
+    const char *digits = string;
+    const char *point = NULL;
+    const char *digitsEnd;
+    long exponent = 0;
 
-    if (NULL == (typeSprop = json_getProperty(typesProp, typeS)))
-    { // e.g., typeS = "EIP712Domain"
-        errRet = JSON_TYPESPROPERR;
-        return errRet;
+    while (string < end && ((*string >= '0' && *string <= '9') || (*string == '.' && point == NULL)))
+    {
+        if (*string == '.')
+        {
+            point = string;
+        }
+        string++;
     }
-
-    if (0 == strncmp(typeS, "EIP712Domain", sizeof("EIP712Domain")))
+    digitsEnd = string;
+    if (digitsEnd == digits || (point != NULL && (point == digits || point + 1 == digitsEnd)))
     {
-        confirmProp = DOMAIN;
-        domOrMsgStr = "domain";
+        return INT_VALUE_ERROR;
     }
-    else
+    if (string < end && (*string == 'e' || *string == 'E'))
     {
-        // This is the message value encoding
-        confirmProp = MESSAGE;
-        domOrMsgStr = "message";
+        bool negExp = false;
+        string++;
+        if (string < end && (*string == '+' || *string == '-'))
+        {
+            negExp = (*string == '-');
+            string++;
+        }
+        if (string == end)
+        {
+            return INT_VALUE_ERROR;
+        }
+        for (; string < end; string++)
+        {
+            if (*string < '0' || *string > '9')
+            {
+                return INT_VALUE_ERROR;
+            }
+            if (exponent < EIP712_MAX_EXPONENT)
+            {
+                exponent = exponent * 10 + (*string - '0');
+            }
+        }
+        if (negExp)
+        {
+            exponent = -exponent;
+        }
     }
-    if (NULL == (domainOrMessageProp = json_getProperty(jsonVals, domOrMsgStr)))
-    { // "message" or "domain" property
-        if (confirmProp == DOMAIN)
+    if (string != end)
+    {
+        return INT_VALUE_ERROR;
+    }
+    if (point != NULL)
+    {
+        exponent -= digitsEnd - point - 1;
+    }
+
+    // digits moved below the point by a negative exponent have to be zeros
+    while (exponent < 0 && digitsEnd > digits)
+    {
+        digitsEnd--;
+        if (*digitsEnd == '.')
         {
-            errRet = JSON_DPROPERR;
+            continue;
         }
-        else
+        if (*digitsEnd != '0')
         {
-            errRet = JSON_MPROPERR;
+            return INT_VALUE_ERROR;
         }
-        return errRet;
+        exponent++;
     }
-    if (NULL == (valsProp = json_getChild(domainOrMessageProp)))
-    { // "message" or "domain" property values
-        if (confirmProp == MESSAGE)
+    bool isZero = true;
+    for (const char *digit = digits; digit < digitsEnd; digit++)
+    {
+        if (*digit == '.')
         {
-            errRet = NULL_MSG_HASH; // this is legal, not an error.
-            return errRet;
+            continue;
+        }
+        isZero = isZero && *digit == '0';
+        if (!intAppend(encoded, 10, *digit - '0'))
+        {
+            return INT_VALUE_ERROR;
         }
     }
-
-    if (SUCCESS != (errRet = parseVals(typesProp, typeSprop, valsProp, &finalCtx)))
+    for (; exponent > 0 && !isZero; exponent--)
     {
-        return errRet;
+        if (!intAppend(encoded, 10, 0))
+        {
+            return INT_VALUE_ERROR;
+        }
     }
-
-    keccak_Final(&finalCtx, hashRet);
-    // clear typeStr
-    memzero(encTypeStr, sizeof(encTypeStr));
-
     return SUCCESS;
 }
 
-void ethereum_typed_hash(const uint8_t domain_separator_hash[32],
-                         const uint8_t message_hash[32],
-                         bool has_message_hash, uint8_t hash[32])
+/* decimal or 0x hex within the range of a bits wide int, negative values are sign extended to 256 bits */
+static int encodeInt(const char *string, size_t len, bool isSigned, unsigned bits, uint8_t *encoded)
 {
-    struct SHA3_CTX ctx = {0};
-    sha3_256_Init(&ctx);
-    sha3_Update(&ctx, (const uint8_t *)"\x19\x01", 2);
-    sha3_Update(&ctx, domain_separator_hash, 32);
-    if (has_message_hash)
+    const char *end = string + len;
+    bool negInt = false;
+    int errRet;
+
+    memset(encoded, 0, 32);
+    if (string < end && *string == '-')
+    {
+        if (!isSigned)
+        {
+            return INT_VALUE_ERROR;
+        }
+        negInt = true;
+        string++;
+    }
+    if (end - string > 2 && string[0] == '0' && (string[1] == 'x' || string[1] == 'X'))
     {
-        sha3_Update(&ctx, message_hash, 32);
+        for (string += 2; string < end; string++)
+        {
+            int digit = hexValue(*string);
+            if (digit < 0 || !intAppend(encoded, 16, digit))
+            {
+                return INT_VALUE_ERROR;
+            }
+        }
     }
-    keccak_Final(&ctx, hash);
+    else if (SUCCESS != (errRet = decodeDecimal(string, end, encoded)))
+    {
+        return errRet;
+    }
+
+    // the magnitude has to fit, signed ints reach one further on the negative side
+    size_t first = 32 - bits / 8;
+    for (size_t ctr = 0; ctr < first; ctr++)
+    {
+        if (encoded[ctr] != 0)
+        {
+            return INT_VALUE_ERROR;
+        }
+    }
+    if (isSigned && (encoded[first] & 0x80))
+    {
+        bool isMin = negInt && encoded[first] == 0x80;
+        for (size_t ctr = first + 1; ctr < 32 && isMin; ctr++)
+        {
+            isMin = encoded[ctr] == 0;
+        }
+        if (!isMin)
+        {
+            return INT_VALUE_ERROR;
+        }
+    }
+    if (negInt)
+    {
+        // two's complement
+        unsigned carry = 1;
+        for (int ctr = 31; ctr >= 0; ctr--)
+        {
+            carry += (uint8_t)~encoded[ctr];
+            encoded[ctr] = carry & 0xff;
+            carry >>= 8;
+        }
+    }
+    return SUCCESS;
 }
 
-void e712_types_values(Ethereum712TypesValues *msg, EthereumTypedDataSignature *resp)
+/* hashStruct: keccak(typeHash || encodeData) */
+static int hashStruct(eip712_ctx_t *ctx, int index, uint32_t values, uint8_t *hashRet)
 {
+    keccak256_ctx_t structCtx;
+    uint8_t encBytes[32];
     int errRet = SUCCESS;
-    json_t memTypes[JSON_OBJ_POOL_SIZE] = {0};
-    json_t memVals[JSON_OBJ_POOL_SIZE] = {0};
-    json_t memPType[4] = {0};
-    json_t const *jsonT;
-    json_t const *jsonV;
-    json_t const *jsonPT;
-    char *typesJsonStr;
-    char *primaryTypeJsonStr;
-    char *valuesJsonStr;
-    const char *primeType;
-    json_t const *obTest;
+    uint32_t members = ctx->types[index].members;
+    uint32_t member = members + 1;
 
-    typesJsonStr = msg->eip712types;
-    primaryTypeJsonStr = msg->eip712primetype;
-    valuesJsonStr = msg->eip712data;
-
-    jsonT = json_create(typesJsonStr, memTypes, sizeof memTypes / sizeof *memTypes);
-    jsonPT = json_create(primaryTypeJsonStr, memPType, sizeof memPType / sizeof *memPType);
-    jsonV = json_create(valuesJsonStr, memVals, sizeof memVals / sizeof *memVals);
-
-    if (!jsonT)
-    {
-        ESP_LOGE(TAG, "EIP-712 type property data error");
-        return;
-    }
-    if (!jsonPT)
+    if (values == 0 || ctx->tokens[values].type != TOKEN_OBJ)
     {
-        ESP_LOGE(TAG, "EIP-712 primaryType property data error");
-        return;
+        return JSON_TYPE_WNOVAL;
     }
-    if (!jsonV)
+    if (ctx->depth >= EIP712_MAX_DEPTH)
     {
-        ESP_LOGE(TAG, "EIP-712 values data error");
-        return;
+        return STACK_TOO_SMALL;
     }
+    ctx->depth++;
 
-    if (msg->eip712typevals == 1)
+    keccak256_init(&structCtx);
+    keccak256_update(&structCtx, typeHash(ctx, index), 32);
+    for (uint32_t ctr = 0; ctr < ctx->tokens[members].len; ctr++, member = ctx->tokens[member].next)
     {
-        // Compute domain seperator hash
-        if ((int)SUCCESS != (errRet =
-                                 encode(jsonT, jsonV, "EIP712Domain", resp->domain_separator_hash)))
+        uint32_t typeName = objectGetString(ctx, member, "name");
+        uint32_t typeType = objectGetString(ctx, member, "type");
+        uint32_t value = 0;
+        uint32_t entry = values + 1;
+        for (uint32_t valueCtr = 0; valueCtr < ctx->tokens[values].len; valueCtr++, entry = ctx->tokens[entry + 1].next)
+        {
+            if (ctx->tokens[entry].len == ctx->tokens[typeName].len &&
+                0 == memcmp(tokenStr(ctx, entry), tokenStr(ctx, typeName), ctx->tokens[entry].len))
+            {
+                value = entry + 1;
+                break;
+            }
+        }
+        if (value == 0)
         {
-            failMessage(errRet);
-            return;
+            errRet = JSON_TYPE_WNOVAL;
+            break;
         }
-        resp->has_domain_separator_hash = true;
-        resp->has_msg_hash = false;
+        if (SUCCESS != (errRet = encodeValue(ctx, tokenStr(ctx, typeType), ctx->tokens[typeType].len, value, encBytes)))
+        {
+            break;
+        }
+        keccak256_update(&structCtx, encBytes, 32);
     }
-    else
+    keccak256_final(&structCtx, hashRet);
+
+    ctx->depth--;
+    return errRet;
+}
+
+/* encodeData of one member value, arrays are the hash of their concatenated encoded elements */
+static int encodeValue(eip712_ctx_t *ctx, const char *typeStr, size_t typeLen, uint32_t value, uint8_t *encoded)
+{
+    const eip712_token_t *token = &ctx->tokens[value];
+
+    if (typeLen > 0 && typeStr[typeLen - 1] == ']')
     {
-        if (!resp->has_domain_separator_hash)
+        keccak256_ctx_t arrCtx;
+        uint8_t eleBytes[32];
+        int errRet;
+        size_t eleTypeLen = typeLen - 1;
+        while (eleTypeLen > 0 && typeStr[eleTypeLen] != '[')
         {
-            failMessage(MSG_NO_DS);
-            return;
+            eleTypeLen--;
         }
-        if (NULL == (obTest = json_getProperty(jsonPT, "primaryType")))
+        if (eleTypeLen == 0)
         {
-            failMessage(JSON_PTYPENAMEERR);
-            return;
+            return UDEF_ARRAY_NAME_ERR;
         }
-        if (0 == (primeType = json_getValue(obTest)))
+        if (token->type != TOKEN_ARRAY)
         {
-            failMessage(JSON_PTYPEVALERR);
-            return;
+            return JSON_TYPE_WNOVAL;
         }
-        if (0 != strncmp(primeType, "EIP712Domain", strlen(primeType)))
-        { // if primaryType is "EIP712Domain", message hash is NULL
-            errRet = encode(jsonT, jsonV, primeType, resp->message_hash);
-            if (!(SUCCESS == errRet || NULL_MSG_HASH == errRet))
+        keccak256_init(&arrCtx);
+        uint32_t element = value + 1;
+        for (uint32_t ctr = 0; ctr < token->len; ctr++, element = ctx->tokens[element].next)
+        {
+            if (SUCCESS != (errRet = encodeValue(ctx, typeStr, eleTypeLen, element, eleBytes)))
             {
-                failMessage(errRet);
-                return;
+                return errRet;
             }
+            keccak256_update(&arrCtx, eleBytes, 32);
         }
-        else
+        keccak256_final(&arrCtx, encoded);
+        return SUCCESS;
+    }
+
+    int encTest = encodableType(typeStr, typeLen);
+    if (encTest == UDEF_TYPE)
+    {
+        int index = findType(ctx, typeStr, typeLen);
+        if (index < 0)
         {
-            errRet = NULL_MSG_HASH;
-            return;
+            return TYPE_NOT_ENCODABLE;
         }
+        return hashStruct(ctx, index, value, encoded);
+    }
+
+    if (token->type == TOKEN_OBJ || token->type == TOKEN_ARRAY || token->type == TOKEN_NULL)
+    {
+        return JSON_TYPE_WNOVAL;
+    }
+    const char *valStr = tokenStr(ctx, value);
+    switch (encTest)
+    {
+    case ADDRESS:
+        return encAddress(valStr, token->len, encoded);
+    case STRING:
+        return encString(valStr, token->len, encoded);
+    case UINT:
+        return encodeInt(valStr, token->len, false, intBits(typeStr, typeLen, 4), encoded);
+    case INT:
+        return encodeInt(valStr, token->len, true, intBits(typeStr, typeLen, 3), encoded);
+    case BYTES:
+        return encodeBytes(valStr, token->len, encoded);
+    case BYTES_N:
+        return encodeBytesN(typeStr, typeLen, valStr, token->len, encoded);
+    case BOOL:
+        memset(encoded, 0, 32);
+        if ((token->len == 4 && 0 == memcmp(valStr, "true", 4)) || (token->len == 1 && valStr[0] == '1'))
+        {
+            encoded[31] = 0x01;
+            return SUCCESS;
+        }
+        if ((token->len == 5 && 0 == memcmp(valStr, "false", 5)) || (token->len == 1 && valStr[0] == '0'))
+        {
+            return SUCCESS;
+        }
+        return BOOL_VALUE_ERROR;
+    default:
+        return TYPE_NOT_ENCODABLE;
+    }
+}
+
+static void ethereum_typed_hash(const uint8_t domain_separator_hash[32],
+                                const uint8_t message_hash[32],
+                                bool has_message_hash, uint8_t hash[32])
+{
+    keccak256_ctx_t ctx = {0};
+    keccak256_init(&ctx);
+    keccak256_update(&ctx, (const uint8_t *)"\x19\x01", 2);
+    keccak256_update(&ctx, domain_separator_hash, 32);
+    if (has_message_hash)
+    {
+        keccak256_update(&ctx, message_hash, 32);
+    }
+    keccak256_final(&ctx, hash);
+}
+
+static int typedDataHash(eip712_ctx_t *ctx, uint8_t typed_data_hash[32])
+{
+    uint8_t domain_separator_hash[32];
+    uint8_t message_hash[32];
+    uint32_t primeType, domain, message;
+    int index;
+    int errRet;
+
+    // the types are indexed once and shared by the domain and the message
+    if (SUCCESS != (errRet = parseTypes(ctx, objectGet(ctx, 0, "types"))))
+    {
+        return errRet;
+    }
+    if (0 == objectGet(ctx, 0, "primaryType"))
+    {
+        return JSON_PTYPENAMEERR;
+    }
+    if (0 == (primeType = objectGetString(ctx, 0, "primaryType")))
+    {
+        return JSON_PTYPEVALERR;
+    }
+    if (0 == (domain = objectGet(ctx, 0, "domain")))
+    {
+        return JSON_DPROPERR;
+    }
+    if (0 > (index = findType(ctx, "EIP712Domain", strlen("EIP712Domain"))))
+    {
+        return JSON_TYPE_S_ERR;
+    }
+    if (SUCCESS != (errRet = hashStruct(ctx, index, domain, domain_separator_hash)))
+    {
+        return errRet;
+    }
+
+    if (typeIs(tokenStr(ctx, primeType), ctx->tokens[primeType].len, "EIP712Domain"))
+    {
+        // there is no message hash
+        ethereum_typed_hash(domain_separator_hash, NULL, false, typed_data_hash);
+        return SUCCESS;
+    }
+    if (0 == (message = objectGet(ctx, 0, "message")))
+    {
+        return JSON_MPROPERR;
+    }
+    if (0 > (index = findType(ctx, tokenStr(ctx, primeType), ctx->tokens[primeType].len)))
+    {
+        return JSON_TYPE_S_ERR;
+    }
+    if (SUCCESS != (errRet = hashStruct(ctx, index, message, message_hash)))
+    {
+        return errRet;
+    }
+    ethereum_typed_hash(domain_separator_hash, message_hash, true, typed_data_hash);
+    return SUCCESS;
+}
 
-        resp->has_message_hash = true;
-        resp->has_msg_hash = true;
+/* tokenizes the document, NULL if it is too long, invalid or there is no memory */
+static eip712_request_t *requestNew(char *json_str, size_t json_len)
+{
+    if (json_len > EIP712_MAX_DOCUMENT_LEN)
+    {
+        ESP_LOGE(TAG, "EIP-712 typed data too long");
+        return NULL;
+    }
+    uint32_t tokensLen = tokenCount(json_str, json_len);
+    eip712_request_t *request = malloc(sizeof(eip712_request_t) + tokensLen * sizeof(eip712_token_t));
+    if (request == NULL)
+    {
+        ESP_LOGE(TAG, "EIP-712 out of memory, %u tokens", (unsigned)tokensLen);
+        return NULL;
     }
+
+    eip712_tokenizer_t tokenizer = {json_str, json_len, 0, request->tokens, tokensLen, 0};
+    if (!tokenize(&tokenizer))
+    {
+        ESP_LOGE(TAG, "EIP-712 typed data error at %u", (unsigned)tokenizer.pos);
+        free(request);
+        return NULL;
+    }
+    memset(&request->ctx, 0, sizeof(eip712_ctx_t));
+    request->ctx.json = json_str;
+    request->ctx.tokens = request->tokens;
+    return request;
 }
 
-bool eip712_typed_data_hash_v4(
-    char *json_str_primary_type,
-    char *json_str_types,
-    char *json_str_domain,
-    char *json_str_message,
-    uint8_t typed_data_hash[32])
+/* "\nlabel: value" for a string or number, nothing if there is no such value */
+static void describeField(amount_writer_t *writer, const eip712_ctx_t *ctx, uint32_t value, const char *label)
 {
-    Ethereum712TypesValues *msg = malloc(sizeof(Ethereum712TypesValues));
-    memset(msg, 0, sizeof(Ethereum712TypesValues));
-    EthereumTypedDataSignature *resp = malloc(sizeof(EthereumTypedDataSignature));
-    memset(resp, 0, sizeof(EthereumTypedDataSignature));
-
-    // domain hash calculation
-
-    msg->eip712types = malloc(strlen(json_str_types) + 1);
-    strcpy(msg->eip712types, json_str_types);
-    msg->eip712primetype = malloc(strlen(json_str_primary_type) + 1);
-    strcpy(msg->eip712primetype, json_str_primary_type);
-    msg->eip712data = malloc(strlen(json_str_domain) + 1);
-    strcpy(msg->eip712data, json_str_domain);
-    msg->eip712typevals = 1;
-    e712_types_values(msg, resp);
-    free(msg->eip712types);
-    free(msg->eip712primetype);
-    free(msg->eip712data);
-    if (resp->has_domain_separator_hash == false)
-    {
-        free(resp);
-        free(msg);
+    if (value != 0 && (ctx->tokens[value].type == TOKEN_STRING || ctx->tokens[value].type == TOKEN_NUMBER))
+    {
+        amount_writer_printf(writer, "\n%s: %.*s", label, (int)ctx->tokens[value].len, tokenStr(ctx, value));
+    }
+}
+
+bool eip712_typed_data_hash_v4(char *json_str, size_t json_len, uint8_t typed_data_hash[32])
+{
+    eip712_request_t *request = requestNew(json_str, json_len);
+    if (request == NULL)
+    {
         return false;
     }
+    int errRet = typedDataHash(&request->ctx, typed_data_hash);
+    if (SUCCESS != errRet)
+    {
+        failMessage(errRet);
+    }
+    free(request);
+    return SUCCESS == errRet;
+}
 
-    // message hash calculation
-    msg->eip712types = malloc(strlen(json_str_types) + 1);
-    strcpy(msg->eip712types, json_str_types);
-    msg->eip712primetype = malloc(strlen(json_str_primary_type) + 1);
-    strcpy(msg->eip712primetype, json_str_primary_type);
-    msg->eip712data = malloc(strlen(json_str_message) + 1);
-    strcpy(msg->eip712data, json_str_message);
-    msg->eip712typevals = 2;
-    e712_types_values(msg, resp);
-    free(msg->eip712types);
-    free(msg->eip712primetype);
-    free(msg->eip712data);
-    if (resp->has_msg_hash == false)
-    {
-        free(resp);
-        free(msg);
+bool eip712_typed_data_describe(char *json_str, size_t json_len, char *out, size_t out_len)
+{
+    if (out == NULL || out_len == 0)
+    {
         return false;
     }
-    free(msg);
-    ethereum_typed_hash(resp->domain_separator_hash, resp->message_hash, true, typed_data_hash);
-    free(resp);
+    out[0] = '\0';
+    eip712_request_t *request = requestNew(json_str, json_len);
+    if (request == NULL)
+    {
+        return false;
+    }
+    const eip712_ctx_t *ctx = &request->ctx;
+    amount_writer_t writer = {out, out_len, 0};
+    uint32_t domain = objectGet(ctx, 0, "domain");
+    describeField(&writer, ctx, objectGetString(ctx, 0, "primaryType"), "primaryType");
+    if (domain != 0)
+    {
+        describeField(&writer, ctx, objectGet(ctx, domain, "name"), "domain");
+        describeField(&writer, ctx, objectGet(ctx, domain, "chainId"), "chainId");
+        describeField(&writer, ctx, objectGet(ctx, domain, "verifyingContract"), "verifyingContract");
+    }
+    free(request);
     return true;
 }
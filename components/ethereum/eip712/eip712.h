@@ -17,17 +17,15 @@
  */
 
 /*
-    Produces hashes based on the metamask v4 rules. This is different from the EIP-712 spec
-    in how arrays of structs are hashed but is compatable with metamask.
-    See https://github.com/MetaMask/eth-sig-util/pull/107
+    Produces hashes as eth_signTypedData_v4 does, arrays of structs included,
+    see https://github.com/MetaMask/eth-sig-util/pull/107
 
     eip712 data rules:
-    Parser wants to see C strings, not javascript strings:
-        requires all complete json message strings to be enclosed by braces, i.e., { ... }
-        Cannot have entire json string quoted, i.e., "{ ... }" will not work.
-        Remove all quote escape chars, e.g., {"types":  not  {\"types\":
-    int values must be hex. Negative sign indicates negative value, e.g., -5, -8a67
-        Note: Do not prefix ints or uints with 0x
+    The input is the whole typed data document as sent by the wallet:
+        {"types": {...}, "primaryType": "...", "domain": {...}, "message": {...}}
+    int values are decimal or 0x prefixed hex, within the range of their type. Negative sign indicates negative value, e.g., -5, -0x8a67
+    Decimals may have an exponent if the value stays an integer, e.g., 1e18
+    bool values are true, false, 0 or 1
     All hex and byte strings must be big-endian
     Byte strings and address should be prefixed by 0x
 */
@@ -35,16 +33,25 @@
 #define EIP712_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
-    bool eip712_typed_data_hash_v4(
-        char *json_str_primary_type,
-        char *json_str_types,
-        char *json_str_domain,
-        char *json_str_message,
-        uint8_t typed_data_hash[32]);
+    /*
+        Hash of the whole typed data document, json_str doesn't have to be null terminated.
+        The document is tokenized in place and its strings are unescaped where they are, so the
+        buffer is modified and can only be hashed once.
+     */
+    bool eip712_typed_data_hash_v4(char *json_str, size_t json_len, uint8_t typed_data_hash[32]);
+    /*
+        Review lines of the document: "\nprimaryType: ...", then the domain name, chainId and
+        verifyingContract, each only if present. Tokenizes in place like eip712_typed_data_hash_v4(),
+        the buffer can't be hashed afterwards. Returns false if the document can't be parsed.
+     */
+    bool eip712_typed_data_describe(char *json_str, size_t json_len, char *out, size_t out_len);
 
 #ifdef __cplusplus
 }
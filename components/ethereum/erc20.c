@@ -20,16 +20,19 @@
  **********************/
 
 /*
+  Sorted by chain id and address for get_erc20_info(), keep the order when updating.
   1. `Chrome` -> `Inspect` -> `Console`
   2. Run the following javascript code:
     ```javascript
     fetch('https://ipfs.io/ipns/tokens.uniswap.org')
     .then(response => response.json())
     .then(tokenData => {
-        const tokens = tokenData.tokens;
+        const tokens = tokenData.tokens.map(t => ({...t, address: t.address.toLowerCase()}));
+        tokens.sort((a, b) => (a.chainId - b.chainId) || (a.address < b.address ? -1 : a.address > b.address ? 1 : 0));
         let token_array = [];
         for (let i = 0; i < tokens.length; i++) {
-            token_array.push(`{${tokens[i].chainId},"${tokens[i].symbol}","${tokens[i].address.toLowerCase()}",${tokens[i].decimals}}`);
+            const bytes = tokens[i].address.slice(2).match(/../g).map(b => `0x${b}`).join(', ');
+            token_array.push(`{${tokens[i].chainId}, "${tokens[i].symbol}", {${bytes}}, ${tokens[i].decimals}}`);
         }
         console.log(token_array.join(',\n'));
     })
@@ -38,790 +41,853 @@
     });
     ```
  */
-static erc20_info_t erc20_tokens[] = {
-    {1, "1INCH", "0x111111111117dc0aa78b770fa6a738034120c302", 18},
-    {1, "A8", "0x3e5a19c91266ad8ce2477b91585d1856b84062df", 18},
-    {1, "AAVE", "0x7fc66500c84a76ad7e9c93437bfc5ac33e2ddae9", 18},
-    {1, "ABT", "0xb98d4c97425d9908e66e53a6fdf673acca0be986", 18},
-    {1, "ACH", "0xed04915c23f00a313a544955524eb7dbd823143d", 8},
-    {1, "ACX", "0x44108f0223a3c3028f5fe7aec7f9bb2e66bef82f", 18},
-    {1, "ADX", "0xade00c28244d5ce17d72e40330b1c318cd12b7c3", 18},
-    {1, "AERGO", "0x91af0fbb28aba7e31403cb457106ce79397fd4e6", 18},
-    {1, "AEVO", "0xb528edbef013aff855ac3c50b381f253af13b997", 18},
-    {1, "agEUR", "0x1a7e4e63778b4f12a199c062f3efdd288afcbce8", 18},
-    {1, "AGLD", "0x32353a6c91143bfd6c7d363b546e62a9a2489a20", 18},
-    {1, "AIOZ", "0x626e8036deb333b408be468f951bdb42433cbf18", 18},
-    {1, "ALCX", "0xdbdb4d16eda451d0503b854cf79d55697f90c8df", 18},
-    {1, "ALEPH", "0x27702a26126e0b3702af63ee09ac4d1a084ef628", 18},
-    {1, "ALI", "0x6b0b3a982b4634ac68dd83a4dbf02311ce324181", 18},
-    {1, "ALICE", "0xac51066d7bec65dc4589368da368b212745d63e8", 6},
-    {1, "ALPHA", "0xa1faa113cbe53436df28ff0aee54275c13b40975", 18},
-    {1, "ALT", "0x8457ca5040ad67fdebbcc8edce889a335bc0fbfb", 18},
-    {1, "AMP", "0xff20817765cb7f73d4bde2e66e067e58d11095c2", 18},
-    {1, "ANKR", "0x8290333cef9e6d528dd5618fb97a76f268f3edd4", 18},
-    {1, "ANT", "0xa117000000f279d81a1d3cc75430faa017fa5a2e", 18},
-    {1, "APE", "0x4d224452801aced8b2f0aebe155379bb5d594381", 18},
-    {1, "API3", "0x0b38210ea11411557c13457d4da7dc6ea731b88a", 18},
-    {1, "APU", "0x594daad7d77592a2b97b725a7ad59d7e188b5bfa", 18},
-    {1, "ARB", "0xb50721bcf8d664c30412cfbc6cf7a15145234ad1", 18},
-    {1, "ARKM", "0x6e2a43be0b1d33b726f0ca3b8de60b3482b8b050", 18},
-    {1, "ARPA", "0xba50933c268f567bdc86e1ac131be072c6b0b71a", 18},
-    {1, "ASH", "0x64d91f12ece7362f91a6f8e7940cd55f05060b92", 18},
-    {1, "ASM", "0x2565ae0385659badcada1031db704442e1b69982", 18},
-    {1, "AST", "0x27054b13b1b798b345b591a4d22e6562d47ea75a", 4},
-    {1, "ATA", "0xa2120b9e674d3fc3875f415a7df52e382f141225", 18},
-    {1, "ATH", "0xbe0ed4138121ecfc5c0e56b40517da27e6c5226b", 18},
-    {1, "AUCTION", "0xa9b1eb5908cfc3cdf91f9b8b3a74108598009096", 18},
-    {1, "AUDIO", "0x18aaa7115705e8be94bffebde57af9bfc265b998", 18},
-    {1, "AVT", "0x845576c64f9754cf09d87e45b720e82f3eef522c", 18},
-    {1, "AXL", "0x467719ad09025fcc6cf6f8311755809d45a5e5f3", 6},
-    {1, "AXS", "0xbb0e17ef65f82ab018d8edd776e8dd940327b28b", 18},
-    {1, "BADGER", "0x3472a5a71965499acd81997a54bba8d852c6e53d", 18},
-    {1, "BAL", "0xba100000625a3754423978a60c9317c58a424e3d", 18},
-    {1, "BAND", "0xba11d00c5f74255f56a5e366f4f77f5a186d7f55", 18},
-    {1, "BAT", "0x0d8775f648430679a709e98d2b0cb6250d2887ef", 18},
-    {1, "BEAM", "0x62d0a8458ed7719fdaf978fe5929c6d342b0bfce", 18},
-    {1, "BICO", "0xf17e65822b568b3903685a7c9f496cf7656cc6c2", 18},
-    {1, "BIGTIME", "0x64bc2ca1be492be7185faa2c8835d9b824c8a194", 18},
-    {1, "BIT", "0x1a4b46696b2bb4794eb3d4c26f1c55f9170fa4c5", 18},
-    {1, "BLUR", "0x5283d291dbcf85356a21ba090e6db59121208b44", 18},
-    {1, "BLZ", "0x5732046a883704404f284ce41ffadd5b007fd668", 18},
-    {1, "BNT", "0x1f573d6fb3f13d689ff844b4ce37794d79a7ff1c", 18},
-    {1, "BOBA", "0x42bbfa2e77757c645eeaad1655e0911a7553efbc", 18},
-    {1, "BOND", "0x0391d2021f89dc339f60fff84546ea23e337750f", 18},
-    {1, "BTRST", "0x799ebfabe77a6e34311eeee9825190b9ece32824", 18},
-    {1, "BUSD", "0x4fabb145d64652a948d72533023f6e7a623c7c53", 18},
-    {1, "C98", "0xae12c5930881c53715b369cec7606b70d8eb229f", 18},
-    {1, "cbBTC", "0xcbb7c0000ab88b473b1f5afd9ef808440eed33bf", 8},
-    {1, "cbETH", "0xbe9895146f7af43049ca1c1ae358b0541ea49704", 18},
-    {1, "CELO", "0x3294395e62f4eb6af3f1fcf89f5602d90fb3ef69", 18},
-    {1, "CELR", "0x4f9254c83eb525f9fcf346490bbb3ed28a81c667", 18},
-    {1, "CHR", "0x8a2279d4a90b6fe1c4b30fa660cc9f926797baa2", 6},
-    {1, "CHZ", "0x3506424f91fd33084466f402d5d97f05f8e3b4af", 18},
-    {1, "CLV", "0x80c62fe4487e1351b47ba49809ebd60ed085bf52", 18},
-    {1, "COMP", "0xc00e94cb662c3520282e6f5717214004a7f26888", 18},
-    {1, "COTI", "0xddb3422497e61e13543bea06989c0789117555c5", 18},
-    {1, "COVAL", "0x3d658390460295fb963f54dc0899cfb1c30776df", 8},
-    {1, "COW", "0xdef1ca1fb7fbcdc777520aa7f396b4e015f497ab", 18},
-    {1, "CPOOL", "0x66761fa41377003622aee3c7675fc7b5c1c2fac5", 18},
-    {1, "CQT", "0xd417144312dbf50465b1c641d016962017ef6240", 18},
-    {1, "CRO", "0xa0b73e1ff0b80914ab6fe0444e65848c4c34450b", 8},
-    {1, "CRPT", "0x08389495d7456e1951ddf7c3a1314a4bfb646d8b", 18},
-    {1, "CRV", "0xd533a949740bb3306d119cc777fa900ba034cd52", 18},
-    {1, "CTSI", "0x491604c0fdf08347dd1fa4ee062a822a5dd06b5d", 18},
-    {1, "CTX", "0x321c2fe4446c7c963dc41dd58879af648838f98d", 18},
-    {1, "CUBE", "0xdf801468a808a32656d2ed2d2d80b72a129739f4", 8},
-    {1, "CVC", "0x41e5560054824ea6b0732e656e3ad64e20e94e45", 8},
-    {1, "CVX", "0x4e3fbd56cd56c3e72c1403e103b45db9da5b9d2b", 18},
-    {1, "CXT", "0x7abc8a5768e6be61a6c693a6e4eacb5b60602c4d", 18},
-    {1, "DAI", "0x6b175474e89094c44da98b954eedeac495271d0f", 18},
-    {1, "DAR", "0x081131434f93063751813c619ecca9c4dc7862a3", 6},
-    {1, "DDX", "0x3a880652f47bfaa771908c07dd8673a787daed3a", 18},
-    {1, "DENT", "0x3597bfd533a99c9aa083587b074434e61eb0a258", 8},
-    {1, "DEXT", "0xfb7b4564402e5500db5bb6d63ae671302777c75a", 18},
-    {1, "DIA", "0x84ca8bc7997272c7cfb4d0cd3d55cd942b3c9419", 18},
-    {1, "DNT", "0x0abdace70d3790235af448c88547603b945604ea", 18},
-    {1, "DPI", "0x1494ca1f11d487c2bbe4543e90080aeba4ba3c2b", 18},
-    {1, "DREP", "0x3ab6ed69ef663bd986ee59205ccad8a20f98b4c2", 18},
-    {1, "DYDX", "0x92d6c1e31e14520e676a687f0a93788b716beff5", 18},
-    {1, "DYP", "0x961c8c0b1aad0c0b10a51fef6a867e3091bcef17", 18},
-    {1, "EIGEN", "0xec53bf9167f50cdeb3ae105f56099aaab9061f83", 18},
-    {1, "ELA", "0xe6fd75ff38adca4b97fbcd938c86b98772431867", 18},
-    {1, "ELON", "0x761d38e5ddf6ccf6cf7c55759d5210750b5d60f3", 18},
-    {1, "ENA", "0x57e114b691db790c35207b2e685d4a43181e6061", 18},
-    {1, "ENJ", "0xf629cbd94d3791c9250152bd8dfbdf380e2a3b9c", 18},
-    {1, "ENS", "0xc18360217d8f7ab5e7c516566761ea12ce7f9d72", 18},
-    {1, "ERN", "0xbbc2ae13b23d715c30720f079fcd9b4a74093505", 18},
-    {1, "ETHFI", "0xfe0c30065b384f05761f15d0cc899d4f9f9cc0eb", 18},
-    {1, "EUL", "0xd9fcd98c322942075a5c3860693e9f4f03aae07b", 18},
-    {1, "EURC", "0x1abaea1f7c830bd89acc67ec4af516284b1bc33c", 6},
-    {1, "EURQ", "0x8df723295214ea6f21026eeeb4382d475f146f9f", 6},
-    {1, "FARM", "0xa0246c9032bc3a600820415ae600c6388619a14d", 18},
-    {1, "FET", "0xaea46a60368a7bd060eec7df8cba43b7ef41ad85", 18},
-    {1, "FIS", "0xef3a930e1ffffacd2fc13434ac81bd278b0ecc8d", 18},
-    {1, "FLOKI", "0xcf0c122c6b73ff809c693db761e7baebe62b6a2e", 9},
-    {1, "FORT", "0x41545f8b9472d758bb669ed8eaeeecd7a9c4ec29", 18},
-    {1, "FORTH", "0x77fba179c79de5b7653f68b5039af940ada60ce0", 18},
-    {1, "FOX", "0xc770eefad204b5180df6a14ee197d99d808ee52d", 18},
-    {1, "FRAX", "0x853d955acef822db058eb8505911ed77f175b99e", 18},
-    {1, "FTM", "0x4e15361fd6b4bb609fa63c81a2be19d873717870", 18},
-    {1, "FX", "0x8c15ef5b4b21951d50e53e4fbda8298ffad25057", 18},
-    {1, "FXS", "0x3432b6a60d23ca0dfca7761b7ab56459d9c964d0", 18},
-    {1, "G", "0x9c7beba8f6ef6643abd725e45a4e8387ef260649", 18},
-    {1, "GAL", "0x5faa989af96af85384b8a938c2ede4a7378d9875", 18},
-    {1, "GALA", "0xd1d2eb1b1e90b638588728b4130137d262c87cae", 8},
-    {1, "GFI", "0xdab396ccf3d84cf2d07c4454e10c8a6f5b008d2b", 18},
-    {1, "GHST", "0x3f382dbd960e3a9bbceae22651e88158d2791550", 18},
-    {1, "GLM", "0x7dd9c5cba05e151c895fde1cf355c9a1d5da6429", 18},
-    {1, "GNO", "0x6810e776880c02933d47db1b9fc05908e5386b96", 18},
-    {1, "GODS", "0xccc8cb5229b0ac8069c51fd58367fd1e622afd97", 18},
-    {1, "GRT", "0xc944e90c64b2c07662a292be6244bdf05cda44a7", 18},
-    {1, "GTC", "0xde30da39c46104798bb5aa3fe8b9e0e1f348163f", 18},
-    {1, "GUSD", "0x056fd409e1d7a124bd7017459dfea2f387b6d5cd", 2},
-    {1, "GYEN", "0xc08512927d12348f6620a698105e1baac6ecd911", 6},
-    {1, "HFT", "0xb3999f658c0391d94a37f7ff328f3fec942bcadc", 18},
-    {1, "HIGH", "0x71ab77b7dbb4fa7e017bc15090b2163221420282", 18},
-    {1, "HOPR", "0xf5581dfefd8fb0e4aec526be659cfab1f8c781da", 18},
-    {1, "IDEX", "0xb705268213d593b8fd88d3fdeff93aff5cbdcfae", 18},
-    {1, "ILV", "0x767fe9edc9e0df98e07454847909b5e959d7ca0e", 18},
-    {1, "IMX", "0xf57e7e7c23978c3caec3c3548e3d615c346e79ff", 18},
-    {1, "INDEX", "0x0954906da0bf32d5479e25f46056d22f08464cab", 18},
-    {1, "INJ", "0xe28b3b32b6c345a34ff64674606124dd5aceca30", 18},
-    {1, "INV", "0x41d5d79431a913c4ae7d69a668ecdfe5ff9dfb68", 18},
-    {1, "IOTX", "0x6fb3e0a217407efff7ca062d46c26e5d60a14d69", 18},
-    {1, "JAM", "0x23894dc9da6c94ecb439911caf7d337746575a72", 18},
-    {1, "JASMY", "0x7420b4b9a0110cdc71fb720908340c03f9bc03ec", 18},
-    {1, "JUP", "0x4b1e80cac91e2216eeb63e29b957eb91ae9c2be8", 18},
-    {1, "KEEP", "0x85eee30c52b0b379b046fb0f85f4f3dc3009afec", 18},
-    {1, "KEY", "0x4cc19356f2d37338b9802aa8e8fc58b0373296e7", 18},
-    {1, "KNC", "0xdd974d5c2e2928dea5f71b9825b8b646686bd200", 18},
-    {1, "KP3R", "0x1ceb5cb57c4d4e2b2433641b95dd330a33185a44", 18},
-    {1, "KRL", "0x464ebe77c293e473b48cfe96ddcf88fcf7bfdac0", 18},
-    {1, "KUJI", "0x96543ef8d2c75c26387c1a319ae69c0bee6f3fe7", 6},
-    {1, "L3", "0x88909d489678dd17aa6d9609f89b0419bf78fd9a", 18},
-    {1, "LCX", "0x037a54aab062628c9bbae1fdb1583c195585fe41", 18},
-    {1, "LDO", "0x5a98fcbea516cf06857215779fd812ca3bef1b32", 18},
-    {1, "LINK", "0x514910771af9ca656af840dff83e8264ecf986ca", 18},
-    {1, "LIT", "0xb59490ab09a0f526cc7305822ac65f2ab12f9723", 18},
-    {1, "LOKA", "0x61e90a50137e1f645c9ef4a0d3a4f01477738406", 18},
-    {1, "LOOM", "0xa4e8c3ec456107ea67d3075bf9e3df3a75823db0", 18},
-    {1, "LPT", "0x58b6a8a3302369daec383334672404ee733ab239", 18},
-    {1, "LQTY", "0x6dea81c8171d0ba574754ef6f8b412f2ed88c54d", 18},
-    {1, "LRC", "0xbbbbca6a901c926f240b89eacb641d8aec7aeafd", 18},
-    {1, "LRDS", "0xd0a6053f087e87a25dc60701ba6e663b1a548e85", 18},
-    {1, "LUSD", "0x5f98805a4e8be255a32880fdec7f6728c6568ba0", 18},
-    {1, "MANA", "0x0f5d2fb29fb7d3cfee444a200298f468908cc942", 18},
-    {1, "MASK", "0x69af81e73a73b40adf4f3d4223cd9b1ece623074", 18},
-    {1, "MATH", "0x08d967bb0134f2d07f7cfb6e246680c53927dd30", 18},
-    {1, "MATIC", "0x7d1afa7b718fb893db30a3abc0cfc608aacfebb0", 18},
-    {1, "MC", "0x949d48eca67b17269629c7194f4b727d4ef9e5d6", 18},
-    {1, "MCO2", "0xfc98e825a2264d890f9a1e68ed50e1526abccacd", 18},
-    {1, "MDT", "0x814e0908b12a99fecf5bc101bb5d0b8b5cdf7d26", 18},
-    {1, "MEME", "0xb131f4a55907b10d1f0a50d8ab8fa09ec342cd74", 18},
-    {1, "METIS", "0x9e32b13ce7f2e80a01932b42553652e053d6ed8e", 18},
-    {1, "MIM", "0x99d8a9c45b2eca8864373a26d1459e3dff1e17f3", 18},
-    {1, "MIR", "0x09a3ecafa817268f77be1283176b946c4ff2e608", 18},
-    {1, "MKR", "0x9f8f72aa9304c8b593d555f12ef6589cc3a579a2", 18},
-    {1, "MLN", "0xec67005c4e498ec7f55e092bd1d35cbc47c91892", 18},
-    {1, "MOG", "0xaaee1a9723aadb7afa2810263653a34ba2c21c7a", 18},
-    {1, "MONA", "0x275f5ad03be0fa221b4c6649b8aee09a42d9412a", 18},
-    {1, "MORPHO", "0x58d97b57bb95320f9a05dc918aef65434969c2b2", 18},
-    {1, "MPL", "0x33349b282065b0284d756f0577fb39c158f935e6", 18},
-    {1, "MTL", "0xf433089366899d83a9f26a773d59ec7ecf30355e", 8},
-    {1, "MULTI", "0x65ef703f5594d2573eb71aaf55bc0cb548492df4", 18},
-    {1, "MUSD", "0xe2f2a5c287993345a840db3b0845fbc70f5935a5", 18},
-    {1, "MUSE", "0xb6ca7399b4f9ca56fc27cbff44f4d2e4eef1fc81", 18},
-    {1, "MV", "0xae788f80f2756a86aa2f410c651f2af83639b95b", 18},
-    {1, "MXC", "0x5ca381bbfb58f0092df149bd3d243b08b9a8386e", 18},
-    {1, "NCT", "0x9e46a38f5daabe8683e10793b06749eef7d733d1", 18},
-    {1, "NEST", "0x04abeda201850ac0124161f037efd70c74ddc74c", 18},
-    {1, "NKN", "0x5cf04716ba20127f1e2297addcf4b5035000c9eb", 18},
-    {1, "NMR", "0x1776e1f26f98b1a5df9cd347953a26dd3cb46671", 18},
-    {1, "NU", "0x4fe83213d56308330ec302a8bd641f1d0113a4cc", 18},
-    {1, "OCEAN", "0x967da4048cd07ab37855c090aaf366e4ce1b9f48", 18},
-    {1, "OGN", "0x8207c1ffc5b6804f6024322ccf34f29c3541ae26", 18},
-    {1, "OMG", "0xd26114cd6ee289accf82350c8d8487fedb8a0c07", 18},
-    {1, "OMNI", "0x36e66fbbce51e4cd5bd3c62b637eb411b18949d4", 18},
-    {1, "ONDO", "0xfaba6f8e4a5e8ab82f62fe7c39859fa577269be3", 18},
-    {1, "ORCA", "0x6f59e0461ae5e2799f1fb3847f05a63b16d0dbf8", 18},
-    {1, "ORN", "0x0258f474786ddfd37abce6df6bbb1dd5dfc4434a", 8},
-    {1, "OXT", "0x4575f41308ec1483f3d399aa9a2826d74da13deb", 18},
-    {1, "PAX", "0xc1d204d77861def49b6e769347a883b15ec397ff", 18},
-    {1, "PAXG", "0x45804880de22913dafe09f4980848ece6ecbaf78", 18},
-    {1, "PDA", "0x0d3cbed3f69ee050668adf3d9ea57241cba33a2b", 18},
-    {1, "PEPE", "0x6982508145454ce325ddbe47a25d4ec3d2311933", 18},
-    {1, "PERP", "0xbc396689893d065f41bc2c6ecbee5e0085233447", 18},
-    {1, "PIRATE", "0x7613c48e0cd50e42dd9bf0f6c235063145f6f8dc", 18},
-    {1, "PLU", "0xd8912c10681d8b21fd3742244f44658dba12264e", 18},
-    {1, "POL", "0x455e53cbb86018ac2b8092fdcd39d8444affc3f6", 18},
-    {1, "POLS", "0x83e6f1e41cdd28eaceb20cb649155049fac3d5aa", 18},
-    {1, "POLY", "0x9992ec3cf6a55b00978cddf2b27bc6882d88d1ec", 18},
-    {1, "POND", "0x57b946008913b82e4df85f501cbaed910e58d26c", 18},
-    {1, "PORTAL", "0x1bbe973bef3a977fc51cbed703e8ffdefe001fed", 18},
-    {1, "POWR", "0x595832f8fc6bf59c85c527fec3740a1b7a361269", 6},
-    {1, "PRIME", "0xb23d80f5fefcddaa212212f028021b41ded428cf", 18},
-    {1, "PRO", "0x226bb599a12c826476e3a771454697ea52e9e220", 8},
-    {1, "PRQ", "0x362bc847a3a9637d3af6624eec853618a43ed7d2", 18},
-    {1, "PSTAKE", "0xfb5c6815ca3ac72ce9f5006869ae67f18bf77006", 18},
-    {1, "PUFFER", "0x4d1c297d39c5c1277964d0e3f8aa901493664530", 18},
-    {1, "PYUSD", "0x6c3ea9036406852006290770bedfcaba0e23a0e8", 6},
-    {1, "QNT", "0x4a220e6096b25eadb88358cb44068a3248254675", 18},
-    {1, "QRDO", "0x4123a133ae3c521fd134d7b13a2dec35b56c2463", 8},
-    {1, "QSP", "0x99ea4db9ee77acd40b119bd1dc4e33e1c070b80d", 18},
-    {1, "QUICK", "0x6c28aef8977c9b773996d0e8376d2ee379446f2f", 18},
-    {1, "RAD", "0x31c8eacbffdd875c74b94b077895bd78cf1e64a3", 18},
-    {1, "RAI", "0x03ab458634910aad20ef5f1c8ee96f1d6ac54919", 18},
-    {1, "RARE", "0xba5bde662c17e2adff1075610382b9b691296350", 18},
-    {1, "RARI", "0xfca59cd816ab1ead66534d82bc21e7515ce441cf", 18},
-    {1, "RBC", "0xa4eed63db85311e22df4473f87ccfc3dadcfa3e3", 18},
-    {1, "RBN", "0x6123b0049f904d730db3c36a31167d9d4121fa6b", 18},
-    {1, "REN", "0x408e41876cccdc0f92210600ef50372656052a38", 18},
-    {1, "REP", "0x1985365e9f78359a9b6ad760e32412f4a445e862", 18},
-    {1, "REPv2", "0x221657776846890989a759ba2973e427dff5c9bb", 18},
-    {1, "REQ", "0x8f8221afbb33998d8584a2b05749ba73c37a938a", 18},
-    {1, "REVV", "0x557b933a7c2c45672b610f8954a3deb39a51a8ca", 18},
-    {1, "REZ", "0x3b50805453023a91a8bf641e279401a0b23fa6f9", 18},
-    {1, "RGT", "0xd291e7a03283640fdc51b121ac401383a46cc623", 18},
-    {1, "RLC", "0x607f4c5bb672230e8672085532f7e901544a7375", 9},
-    {1, "RLY", "0xf1f955016ecbcd7321c7266bccfb96c68ea5e49b", 18},
-    {1, "RNDR", "0x6de037ef9ad2725eb40118bb1702ebb27e4aeb24", 18},
-    {1, "ROOK", "0xfa5047c9c78b8877af97bdcb85db743fd7313d4a", 18},
-    {1, "SAFE", "0x5afe3855358e112b5647b952709e6165e1c1eeee", 18},
-    {1, "SAND", "0x3845badade8e6dff049820680d1f14bd3903a5d0", 18},
-    {1, "SD", "0x30d20208d987713f46dfd34ef128bb16c404d10f", 18},
-    {1, "SHIB", "0x95ad61b0a150d79219dcf64e1e6cc01f0b64c4ce", 18},
-    {1, "SHPING", "0x7c84e62859d0715eb77d1b1c4154ecd6abb21bec", 18},
-    {1, "SKL", "0x00c83aecc790e8a4453e5dd3b0b4b3680501a7a7", 18},
-    {1, "SKY", "0x56072c95faa701256059aa122697b133aded9279", 18},
-    {1, "SLP", "0xcc8fa225d80b9c7d42f96e9570156c65d6caaa25", 0},
-    {1, "SNT", "0x744d70fdbe2ba4cf95131626614a1763df805b9e", 18},
-    {1, "SNX", "0xc011a73ee8576fb46f5e1c5751ca3b9fe0af2a6f", 18},
-    {1, "SOCKS", "0x23b608675a2b2fb1890d3abbd85c5775c51691d5", 18},
-    {1, "SOL", "0xd31a59c85ae9d8edefec411d448f90841571b89c", 9},
-    {1, "SPELL", "0x090185f2135308bad17527004364ebcc2d37e5f6", 18},
-    {1, "STG", "0xaf5191b0de278c7286d6c7cc6ab6bb8a73ba2cd6", 18},
-    {1, "STORJ", "0xb64ef51c888972c908cfacf59b47c1afbc0ab8ac", 8},
-    {1, "STRK", "0xca14007eff0db1f8135f4c25b34de49ab0d42766", 18},
-    {1, "STX", "0x006bea43baa3f7a6f765f14f10a1a1b08334ef45", 18},
-    {1, "SUKU", "0x0763fdccf1ae541a5961815c0872a8c5bc6de4d7", 18},
-    {1, "SUPER", "0xe53ec727dbdeb9e2d5456c3be40cff031ab40a55", 18},
-    {1, "sUSD", "0x57ab1ec28d129707052df4df418d58a2d46d5f51", 18},
-    {1, "SUSHI", "0x6b3595068778dd592e39a122f4f5a5cf09c90fe2", 18},
-    {1, "SWFTC", "0x0bb217e40f8a5cb79adf04e1aab60e5abd0dfc1e", 8},
-    {1, "SXP", "0x8ce9137d39326ad0cd6491fb5cc0cba0e089b6a9", 18},
-    {1, "SYLO", "0xf293d23bf2cdc05411ca0eddd588eb1977e8dcd4", 18},
-    {1, "SYN", "0x0f2d719407fdbeff09d87557abb7232601fd9f29", 18},
-    {1, "SYRUP", "0x643c4e15d7d62ad0abec4a9bd4b001aa3ef52d66", 18},
-    {1, "T", "0xcdf7028ceab81fa0c6971208e83fa7872994bee5", 18},
-    {1, "tBTC", "0x18084fba666a33d37592fa2633fd49a74dd93a88", 18},
-    {1, "TIME", "0x485d17a6f1b8780392d53d64751824253011a260", 8},
-    {1, "TLM", "0x888888848b652b3e3a0f34c96e00eec0f3a23f72", 4},
-    {1, "TOKE", "0x2e9d63788249371f1dfc918a52f8d799f4a38c94", 18},
-    {1, "TONE", "0x2ab6bb8408ca3199b8fa6c92d5b455f820af03c4", 18},
-    {1, "TRAC", "0xaa7a9ca87d3694b5755f213b5d04094b8d0f0a6f", 18},
-    {1, "TRB", "0x88df592f8eb5d7bd38bfef7deb0fbc02cf3778a0", 18},
-    {1, "TRIBE", "0xc7283b66eb1eb5fb86327f08e1b5816b0720212b", 18},
-    {1, "TRU", "0x4c19596f5aaff459fa38b0f7ed92f11ae6543784", 8},
-    {1, "TURBO", "0xa35923162c49cf95e6bf26623385eb431ad920d3", 18},
-    {1, "TVK", "0xd084b83c305dafd76ae3e1b4e1f1fe2ecccb3988", 18},
-    {1, "UMA", "0x04fa0d235c4abf4bcf4787af4cf447de572ef828", 18},
-    {1, "UNFI", "0x441761326490cacf7af299725b6292597ee822c2", 18},
-    {1, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {1, "UPI", "0x70d2b7c19352bb76e4409858ff5746e500f2b67c", 18},
-    {1, "USDC", "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48", 6},
-    {1, "USDG", "0xe343167631d89b6ffc58b88d6b7fb0228795491d", 6},
-    {1, "USDP", "0x8e870d67f660d95d5be530380d0ec0bd388289e1", 18},
-    {1, "USDQ", "0xc83e27f270cce0a3a3a29521173a83f402c1768b", 6},
-    {1, "USDS", "0xdc035d45d973e3ec169d2276ddab16f1e407384f", 18},
-    {1, "USDT", "0xdac17f958d2ee523a2206206994597c13d831ec7", 6},
-    {1, "VGX", "0x3c4b6e6e1ea3d4863700d7f76b36b7f3d3f13e3d", 8},
-    {1, "WAMPL", "0xedb171c18ce90b633db442f2a6f72874093b49ef", 18},
-    {1, "WBTC", "0x2260fac5e5542a773aa44fbcfedf7c193bc2c599", 8},
-    {1, "WCFG", "0xc221b7e65ffc80de234bbb6667abdd46593d34f0", 18},
-    {1, "WETH", "0xc02aaa39b223fe8d0a0e5c4f27ead9083c756cc2", 18},
-    {1, "WOO", "0x4691937a7508860f876c9c0a2a617e7d9e945d4b", 18},
-    {1, "XCN", "0xa2cd3d43c775978a96bdbf12d733d5a1ed94fb18", 18},
-    {1, "XSGD", "0x70e8de73ce538da2beed35d14187f6959a8eca96", 6},
-    {1, "XYO", "0x55296f69f40ea6d20e478533c15a6b08b654e758", 18},
-    {1, "YFI", "0x0bc529c00c6401aef6d220be8c6ea1667f6ad93e", 18},
-    {1, "YFII", "0xa1d0e215a23d7030842fc67ce582a6afa3ccab83", 18},
-    {1, "YGG", "0x25f8087ead173b73d6e8b84329989a8eea16cf73", 18},
-    {1, "Zeta", "0xf091867ec603a6628ed83d274e835539d82e9cc8", 18},
-    {1, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {1, "ZRX", "0xe41d2489571d322189246dafa5ebde1f4699f498", 18},
-    {3, "DAI", "0xad6d458402f60fd3bd25163575031acdce07538d", 18},
-    {3, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {3, "WETH", "0xc778417e063141139fce010982780140aa0cd5ab", 18},
-    {4, "DAI", "0xc7ad46e0b8a400bb3c915120d284aafba8fc4735", 18},
-    {4, "MKR", "0xf9ba5210f91d0474bd1e1dcdaec4c58e359aad85", 18},
-    {4, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {4, "WETH", "0xc778417e063141139fce010982780140aa0cd5ab", 18},
-    {5, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {5, "WETH", "0xb4fbf271143f4fbf7b91a5ded31805e42b2208d6", 18},
-    {10, "1INCH", "0xad42d013ac31486b73b6b059e748172994736426", 18},
-    {10, "AAVE", "0x76fb31fb4af56892a25e32cfc43de717950c9278", 18},
-    {10, "ACX", "0xff733b2a3557a7ed6697007ab5d11b79fdd1b76b", 18},
-    {10, "ARPA", "0x334cc734866e97d8452ae6261d68fd9bc9bfa31e", 18},
-    {10, "BAL", "0xfe8b128ba8c78aabc59d4c64cee7ff28e9379921", 18},
-    {10, "BOBA", "0x07ad578ff86b135be19a12759064b802cb88854d", 18},
-    {10, "BOND", "0x3e7ef8f50246f725885102e8238cbba33f276747", 18},
-    {10, "BTRST", "0xed50ace88bd42b45cb0f49be15395021e141254e", 18},
-    {10, "BUSD", "0x9c9e5fd8bbc25984b178fdce6117defa39d2db39", 18},
-    {10, "cbETH", "0xaddb6a0412de1ba0f936dcaeb8aaa24578dcf3b2", 18},
-    {10, "CELO", "0x9b88d293b7a791e40d36a39765ffd5a1b9b5c349", 18},
-    {10, "CRV", "0x0994206dfe8de6ec6920ff4d779b0d950605fb53", 18},
-    {10, "CTSI", "0xec6adef5e1006bb305bb1975333e8fc4071295bf", 18},
-    {10, "DAI", "0xda10009cbd5d07dd0cecc66161fc93d7c9000da1", 18},
-    {10, "ENS", "0x65559aa14915a70190438ef90104769e5e890a00", 18},
-    {10, "FIS", "0xd8737ca46aa6285de7b8777a8e3db232911bad41", 18},
-    {10, "FOX", "0xf1a0da3367bc7aa04f8d94ba57b862ff37ced174", 18},
-    {10, "FRAX", "0x2e3d870790dc77a83dd1d18184acc7439a53f475", 18},
-    {10, "FXS", "0x67ccea5bb16181e7b4109c9c2143c24a1c2205be", 18},
-    {10, "GTC", "0x1eba7a6a72c894026cd654ac5cdcf83a46445b08", 18},
-    {10, "GYEN", "0x589d35656641d6ab57a545f08cf473ecd9b6d5f7", 6},
-    {10, "KUJI", "0x3a18dcc9745edcd1ef33ecb93b0b6eba5671e7ca", 6},
-    {10, "LDO", "0xfdb794692724153d1488ccdbe0c56c252596735f", 18},
-    {10, "LINK", "0x350a791bfc2c21f9ed5d10980dad2e2638ffa7f6", 18},
-    {10, "LRC", "0xfeaa9194f9f8c1b65429e31341a103071464907e", 18},
-    {10, "LUSD", "0xc40f949f8a4e094d1b49a23ea9241d289b7b2819", 18},
-    {10, "MASK", "0x3390108e913824b8ead638444cc52b9abdf63798", 18},
-    {10, "MKR", "0xab7badef82e9fe11f6f33f87bc9bc2aa27f2fcb5", 18},
-    {10, "OCEAN", "0x2561aa2bb1d2eb6629edd7b0938d7679b8b49f9e", 18},
-    {10, "OP", "0x4200000000000000000000000000000000000042", 18},
-    {10, "PEPE", "0xc1c167cc44f7923cd0062c4370df962f9ddb16f5", 18},
-    {10, "PERP", "0x9e1028f5f1d5ede59748ffcee5532509976840e0", 18},
-    {10, "RAI", "0x7fb688ccf682d58f86d7e38e03f9d22e7705448b", 18},
-    {10, "RGT", "0xb548f63d4405466b36c0c0ac3318a22fdcec711a", 18},
-    {10, "SNT", "0x650af3c15af43dcb218406d30784416d64cfb6b2", 18},
-    {10, "SNX", "0x8700daec35af8ff88c16bdf0418774cb3d7599b4", 18},
-    {10, "SOL", "0xba1cf949c382a32a09a17b2adf3587fc7fa664f1", 9},
-    {10, "SUKU", "0xef6301da234fc7b0545c6e877d3359fe0b9e50a4", 18},
-    {10, "sUSD", "0x8c6f28f2f1a3c87f0f938b96d27520d9751ec8d9", 18},
-    {10, "SUSHI", "0x3eaeb77b03dbc0f6321ae1b72b2e9adb0f60112b", 18},
-    {10, "T", "0x747e42eb0591547a0ab429b3627816208c734ea7", 18},
-    {10, "TRB", "0xaf8ca653fa2772d58f4368b0a71980e9e3ceb888", 18},
-    {10, "UMA", "0xe7798f023fc62146e8aa1b36da45fb70855a77ea", 18},
-    {10, "UNI", "0x6fd9d7ad17242c41f7131d257212c54a0e816691", 18},
-    {10, "USDC", "0x0b2c639c533813f4aa9d7837caf62653d097ff85", 6},
-    {10, "USDC.e", "0x7f5c764cbc14f9669b88837ca1490cca17c31607", 6},
-    {10, "USDT", "0x94b008aa00579c1307b0ef2c499ad98a8ce58e58", 6},
-    {10, "VELO", "0x9560e827af36c94d2ac33a39bce1fe78631088db", 18},
-    {10, "WBTC", "0x68f180fcce6836688e9084f035309e29bf0a2095", 8},
-    {10, "WETH", "0x4200000000000000000000000000000000000006", 18},
-    {10, "WOO", "0x871f2f2ff935fd1ed867842ff2a7bfd051a5e527", 18},
-    {10, "XYO", "0x9db118d43069b73b8a252bf0be49d50edbd81fc8", 18},
-    {10, "YFI", "0x9046d36440290ffde54fe0dd84db8b1cfee9107b", 18},
-    {10, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {10, "ZRX", "0xd1917629b3e6a72e6772aab5dbe58eb7fa3c2f33", 18},
-    {42, "DAI", "0x4f96fe3b7a6cf9725f59d353f723c1bdb64ca6aa", 18},
-    {42, "MKR", "0xaaf64bfcc32d0f15873a02163e7e500671a4ffcd", 18},
-    {42, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {42, "WETH", "0xd0a1e359811322d97991e03f863a0c30c2cf029c", 18},
-    {56, "1INCH", "0x111111111117dc0aa78b770fa6a738034120c302", 18},
-    {56, "AAVE", "0xfb6115445bff7b52feb98650c87f44907e58f802", 18},
-    {56, "ACH", "0xbc7d6b50616989655afd682fb42743507003056d", 8},
-    {56, "ADX", "0x6bff4fb161347ad7de4a625ae5aa3a1ca7077819", 18},
-    {56, "agEUR", "0x12f31b73d812c6bb0d735a218c086d44d5fe5f89", 18},
-    {56, "AIOZ", "0x33d08d8c7a168333a85285a68c0042b39fc3741d", 18},
-    {56, "ALEPH", "0x82d2f8e02afb160dd5a480a617692e62de9038c4", 18},
-    {56, "ALICE", "0xac51066d7bec65dc4589368da368b212745d63e8", 6},
-    {56, "ALPHA", "0xa1faa113cbe53436df28ff0aee54275c13b40975", 18},
-    {56, "ANKR", "0xf307910a4c7bbc79691fd374889b36d8531b08e3", 18},
-    {56, "ARPA", "0x6f769e65c14ebd1f68817f5f1dcdb61cfa2d6f7e", 18},
-    {56, "ATA", "0xa2120b9e674d3fc3875f415a7df52e382f141225", 18},
-    {56, "AXL", "0x8b1f4432f943c465a973fedc6d7aa50fc96f1f65", 6},
-    {56, "AXS", "0x715d400f88c167884bbcc41c5fea407ed4d2f8a0", 18},
-    {56, "BLZ", "0x935a544bf5816e3a7c13db2efe3009ffda0acda2", 18},
-    {56, "BUSD", "0xe9e7cea3dedca5984780bafc599bd69add087d56", 18},
-    {56, "C98", "0xaec945e04baf28b135fa7c640f624f8d90f1c3a6", 18},
-    {56, "CHR", "0xf9cec8d50f6c8ad3fb6dccec577e05aa32b224fe", 6},
-    {56, "CLV", "0x09e889bb4d5b474f561db0491c38702f367a4e4d", 18},
-    {56, "COMP", "0x52ce071bd9b1c4b00a0b92d298c512478cad67e8", 18},
-    {56, "COVAL", "0xd15cee1deafbad6c0b3fd7489677cc102b141464", 8},
-    {56, "CTSI", "0x8da443f84fea710266c8eb6bc34b71702d033ef2", 18},
-    {56, "DAI", "0x1af3f329e8be154074d8769d1ffa4ee058b1dbc3", 18},
-    {56, "DAR", "0x23ce9e926048273ef83be0a3a8ba9cb6d45cd978", 6},
-    {56, "DEXT", "0xe91a8d2c584ca93c7405f15c22cdfe53c29896e3", 18},
-    {56, "DIA", "0x99956d38059cf7beda96ec91aa7bb2477e0901dd", 18},
-    {56, "DREP", "0xec583f25a049cc145da9a256cdbe9b6201a705ff", 18},
-    {56, "DYP", "0x961c8c0b1aad0c0b10a51fef6a867e3091bcef17", 18},
-    {56, "ELON", "0x7bd6fabd64813c48545c9c0e312a0099d9be2540", 18},
-    {56, "FARM", "0x4b5c23cac08a567ecf0c1ffca8372a45a5d33743", 18},
-    {56, "FET", "0x031b41e504677879370e9dbcf937283a8691fa7f", 18},
-    {56, "FLOKI", "0xfb5b838b6cfeedc2873ab27866079ac55363d37e", 9},
-    {56, "FRAX", "0x90c97f71e18723b0cf0dfa30ee176ab653e89f40", 18},
-    {56, "FTM", "0xad29abb318791d579433d831ed122afeaf29dcfe", 18},
-    {56, "FXS", "0xe48a3d7d0bc88d552f730b62c006bc925eadb9ee", 18},
-    {56, "GAL", "0xe4cc45bb5dbda06db6183e8bf016569f40497aa5", 18},
-    {56, "HFT", "0x44ec807ce2f4a6f2737a92e985f318d035883e47", 18},
-    {56, "HIGH", "0x5f4bde007dc06b867f86ebfe4802e34a1ffeed63", 18},
-    {56, "INJ", "0xa2b726b1145a4773f68593cf171187d8ebe4d495", 18},
-    {56, "JUP", "0x0231f91e02debd20345ae8ab7d71a41f8e140ce7", 18},
-    {56, "KUJI", "0x073690e6ce25be816e68f32dca3e11067c9fb5cc", 6},
-    {56, "LINK", "0xf8a0bf9cf54bb92f17374d9e9a321e6a111a51bd", 18},
-    {56, "MASK", "0x2ed9a5c8c13b93955103b9a7c167b67ef4d568a3", 18},
-    {56, "MATH", "0xf218184af829cf2b0019f8e6f0b2423498a36983", 18},
-    {56, "MATIC", "0xcc42724c6683b7e57334c4e856f4c9965ed682bd", 18},
-    {56, "MC", "0x949d48eca67b17269629c7194f4b727d4ef9e5d6", 18},
-    {56, "METIS", "0xe552fb52a4f19e44ef5a967632dbc320b0820639", 18},
-    {56, "MIM", "0xfe19f0b51438fd612f6fd59c1dbb3ea319f433ba", 18},
-    {56, "MIR", "0x5b6dcf557e2abe2323c48445e8cc948910d8c2c9", 18},
-    {56, "MULTI", "0x9fb9a33956351cf4fa040f65a13b835a3c8764e3", 18},
-    {56, "NEST", "0x98f8669f6481ebb341b522fcd3663f79a3d1a6a7", 18},
-    {56, "PERP", "0x4e7f408be2d4e9d60f49a64b89bb619c84c7c6f5", 18},
-    {56, "POLS", "0x7e624fa0e1c4abfd309cc15719b7e2580887f570", 18},
-    {56, "PRQ", "0xd21d29b38374528675c34936bf7d5dd693d2a577", 18},
-    {56, "PSTAKE", "0x4c882ec256823ee773b25b414d36f92ef58a7c0c", 18},
-    {56, "REVV", "0x833f307ac507d47309fd8cdd1f835bef8d702a93", 18},
-    {56, "SD", "0x3bc5ac0dfdc871b365d159f728dd1b9a0b5481e8", 18},
-    {56, "SOL", "0xfa54ff1a158b5189ebba6ae130ced6bbd3aea76e", 9},
-    {56, "STG", "0xb0d502e938ed5f4df2e681fe6e419ff29631d62b", 18},
-    {56, "SUPER", "0x51ba0b044d96c3abfca52b64d733603ccc4f0d4d", 18},
-    {56, "SUSHI", "0x947950bcc74888a40ffa2593c5798f11fc9124c4", 18},
-    {56, "SWFTC", "0xe64e30276c2f826febd3784958d6da7b55dfbad3", 18},
-    {56, "SXP", "0x47bead2563dcbf3bf2c9407fea4dc236faba485a", 18},
-    {56, "SYN", "0xa4080f1778e69467e905b8d6f72f6e441f9e9484", 18},
-    {56, "TIME", "0x3b198e26e473b8fab2085b37978e36c9de5d7f68", 8},
-    {56, "TLM", "0x2222227e22102fe3322098e4cbfe18cfebd57c95", 4},
-    {56, "UNFI", "0x728c5bac3c3e370e372fc4671f9ef6916b814d8b", 18},
-    {56, "UNI", "0xbf5140a22578168fd562dccf235e5d43a02ce9b1", 18},
-    {56, "UPI", "0x0d35a2b85c5a63188d566d104bebf7c694334ee4", 18},
-    {56, "USDC", "0x8ac76a51cc950d9822d68b83fe1ad97b32cd580d", 18},
-    {56, "USDT", "0x55d398326f99059ff775485246999027b3197955", 18},
-    {56, "WBNB", "0xbb4cdb9cbd36b01bd1cbaebf2de08d9173bc095c", 18},
-    {56, "WETH", "0x2170ed0880ac9a755fd29b2688956bd959f933f8", 18},
-    {56, "WOO", "0x4691937a7508860f876c9c0a2a617e7d9e945d4b", 18},
-    {56, "XCN", "0x7324c7c0d95cebc73eea7e85cbaac0dbdf88a05b", 18},
-    {56, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {137, "AAVE", "0xd6df932a45c0f255f85145f286ea0b292b21c90b", 18},
-    {137, "agEUR", "0xe0b52e49357fd4daf2c15e02058dce6bc0057db4", 18},
-    {137, "AMP", "0x0621d647cecbfb64b79e44302c1933cb4f27054d", 18},
-    {137, "BAL", "0x9a71012b13ca4d3d0cdc72a177df3ef03b0e76a3", 18},
-    {137, "BAND", "0xa8b1e0764f85f53dfe21760e8afe5446d82606ac", 18},
-    {137, "BNT", "0xc26d47d5c33ac71ac5cf9f776d63ba292a4f7842", 18},
-    {137, "COMP", "0x8505b9d2254a7ae468c0e9dd10ccea3a837aef5c", 18},
-    {137, "CRV", "0x172370d5cd63279efa6d502dab29171933a610af", 18},
-    {137, "CVC", "0x66dc5a08091d1968e08c16aa5b27bac8398b02be", 8},
-    {137, "DAI", "0x8f3cf7ad23cd3cadbd9735aff958023239c6a063", 18},
-    {137, "ENS", "0xbd7a5cf51d22930b8b3df6d834f9bcef90ee7c4f", 18},
-    {137, "GNO", "0x5ffd62d3c3ee2e81c00a7b9079fb248e7df024a8", 18},
-    {137, "GRT", "0x5fe2b58c013d7601147dcdd68c143a77499f5531", 18},
-    {137, "KEEP", "0x42f37a1296b2981f7c3caced84c5096b2eb0c72c", 18},
-    {137, "KNC", "0x324b28d6565f784d596422b0f2e5ab6e9cfa1dc7", 18},
-    {137, "LINK", "0x53e0bca35ec356bd5dddfebbd1fc0fd03fabad39", 18},
-    {137, "LOOM", "0x66efb7cc647e0efab02eba4316a2d2941193f6b3", 18},
-    {137, "LRC", "0x84e1670f61347cdaed56dcc736fb990fbb47ddc1", 18},
-    {137, "MANA", "0xa1c57f48f0deb89f569dfbe6e2b7f46d33606fd4", 18},
-    {137, "MATIC", "0x0000000000000000000000000000000000001010", 18},
-    {137, "MKR", "0x6f7c932e7684666c9fd1d44527765433e01ff61d", 18},
-    {137, "NMR", "0x0bf519071b02f22c17e7ed5f4002ee1911f46729", 18},
-    {137, "OXT", "0x9880e3dda13c8e7d4804691a45160102d31f6060", 18},
-    {137, "REN", "0x19782d3dc4701ceeedcd90f0993f0a9126ed89d0", 18},
-    {137, "REPv2", "0x6563c1244820cfbd6ca8820fbdf0f2847363f733", 18},
-    {137, "SNX", "0x50b728d8d964fd00c2d0aad81718b71311fef68a", 18},
-    {137, "STORJ", "0xd72357daca2cf11a5f155b9ff7880e595a3f5792", 8},
-    {137, "sUSD", "0xf81b4bec6ca8f9fe7be01ca734f55b2b6e03a7a0", 18},
-    {137, "UMA", "0x3066818837c5e6ed6601bd5a91b0762877a6b731", 18},
-    {137, "UNI", "0xb33eaad8d922b1083446dc23f610c2567fb5180f", 18},
-    {137, "USDC", "0x3c499c542cef5e3811e1192ce70d8cc03d5c3359", 6},
-    {137, "USDC.e", "0x2791bca1f2de4661ed88a30c99a7a9449aa84174", 6},
-    {137, "USDT", "0xc2132d05d31c914a87c6611c10748aeb04b58e8f", 6},
-    {137, "VOXEL", "0xd0258a3fd00f38aa8090dfee343f10a9d4d30d3f", 18},
-    {137, "WBTC", "0x1bfd67037b42cf73acf2047067bd4f2c47d9bfd6", 8},
-    {137, "WETH", "0x7ceb23fd6bc0add59e62ac25578270cff1b9f619", 18},
-    {137, "WMATIC", "0x0d500b1d8e8ef31e21c99d1db9a6444d3adf1270", 18},
-    {137, "XSGD", "0xdc3326e71d45186f113a2f448984ca0e8d201995", 6},
-    {137, "YFI", "0xda537104d6a5edd53c6fbba9a898708e465260b6", 18},
-    {137, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {137, "ZRX", "0x5559edb74751a0ede9dea4dc23aee72cca6be3d5", 18},
-    {324, "ZK", "0x5a7d6b2f92c77fad6ccabd7ee0624e64907eaf3e", 18},
-    {480, "USDC.e", "0x79a02482a880bce3f13e09da970dc34db4cd24d1", 6},
-    {480, "WBTC", "0x03c7054bcb39f7b2e5b2c7acb37583e32d70cfa3", 8},
-    {480, "WETH", "0x4200000000000000000000000000000000000006", 18},
-    {8453, "1INCH", "0xc5fecc3a29fb57b5024eec8a2239d4621e111cbe", 18},
-    {8453, "AERO", "0x940181a94a35a4569e4529a3cdfb74e38fd98631", 18},
-    {8453, "ALI", "0x97c806e7665d3afd84a8fe1837921403d59f3dcc", 18},
-    {8453, "AMP", "0xb358489d5d92641edb4d8ee8063f8005964346ba", 18},
-    {8453, "APU", "0x7a2c5e7788e55ec0a7ba4aeec5b3da322718fb5e", 18},
-    {8453, "ARPA", "0x1c9fa01e87487712706fb469a13beb234262c867", 18},
-    {8453, "BAL", "0x4158734d47fc9692176b5085e0f52ee0da5d47f1", 18},
-    {8453, "BICO", "0xf5dbaa3dfc5e81405c7306039fb037a3dcd57ce2", 18},
-    {8453, "BOBA", "0x1f9bd96ddb4bd07d6061f8933e9ba9ede9967550", 18},
-    {8453, "BTRST", "0xa7d68d155d17cb30e311367c2ef1e82ab6022b67", 18},
-    {8453, "cbBTC", "0xcbb7c0000ab88b473b1f5afd9ef808440eed33bf", 8},
-    {8453, "cbETH", "0x2ae3f1ec7f1f5012cfeab0185bfc7aa3cf0dec22", 18},
-    {8453, "COMP", "0x9e1028f5f1d5ede59748ffcee5532509976840e0", 18},
-    {8453, "CRV", "0x8ee73c484a26e0a5df2ee2a4960b789967dd0415", 18},
-    {8453, "CTSI", "0x259fac10c5cbfefe3e710e1d9467f70a76138d45", 18},
-    {8453, "CTX", "0xbb22ff867f8ca3d5f2251b4084f6ec86d4666e14", 18},
-    {8453, "DAI", "0x50c5725949a6f0c72e6c4a641f24049a917db0cb", 18},
-    {8453, "DEGEN", "0x4ed4e862860bed51a9570b96d89af5e1b0efefed", 18},
-    {8453, "EURC", "0x60a3e35cc302bfa44cb288bc5a4f316fdb1adb42", 6},
-    {8453, "FARM", "0xd08a2917653d4e460893203471f0000826fb4034", 18},
-    {8453, "FET", "0x74f804b4140ee70830b3eef4e690325841575f89", 18},
-    {8453, "FORTH", "0x968b2323d4b005c7d39c67d31774fe83c9943a60", 18},
-    {8453, "FOX", "0x2dbe0d779c7a04f7a5de83326973effe23356930", 18},
-    {8453, "GHST", "0xcd2f22236dd9dfe2356d7c543161d4d260fd9bcb", 18},
-    {8453, "GRT", "0x0f4d237b09cb37d207ba60353dc254d4530d4df1", 18},
-    {8453, "IOTX", "0xbcbaf311cec8a4eac0430193a528d9ff27ae38c1", 18},
-    {8453, "JAM", "0xff9957816c813c5ad0b9881a8990df1e3aa2a057", 18},
-    {8453, "LQTY", "0x5259384690acf240e9b0a8811bd0ffbfbddc125c", 18},
-    {8453, "LRC", "0x0d760ee479401bb4c40bdb7604b329fff411b3f2", 18},
-    {8453, "LRDS", "0xb676f87a6e701f0de8de5ab91b56b66109766db1", 18},
-    {8453, "LUSD", "0x368181499736d0c0cc614dbb145e2ec1ac86b8c6", 18},
-    {8453, "MLN", "0x7c298664bd6582f6f264c2cb5a4b9cc09b6e3889", 18},
-    {8453, "MOG", "0x2da56acb9ea78330f947bd57c54119debda7af71", 18},
-    {8453, "MORPHO", "0xbaa5cc21fd487b8fcc2f632f3f4e8d37262a0842", 18},
-    {8453, "OGN", "0x7002458b1df59eccb57387bc79ffc7c29e22e6f7", 18},
-    {8453, "PEPE", "0xb4fde59a779991bfb6a52253b51947828b982be3", 18},
-    {8453, "PRIME", "0xfa980ced6895ac314e7de34ef1bfae90a5add21b", 18},
-    {8453, "PRO", "0x18dd5b087bca9920562aff7a0199b96b9230438b", 8},
-    {8453, "PSTAKE", "0x38815a4455921667d673b4cb3d48f0383ee93400", 18},
-    {8453, "SEAM", "0x1c7a460413dd4e964f96d8dfc56e7223ce88cd85", 18},
-    {8453, "SNX", "0x22e6966b799c4d5b13be962e1d117b56327fda66", 18},
-    {8453, "SUSHI", "0x7d49a065d17d6d4a55dc13649901fdbb98b2afba", 18},
-    {8453, "tBTC", "0x236aa50979d5f3de3bd1eeb40e81137f22ab794b", 18},
-    {8453, "TRAC", "0xa81a52b4dda010896cdd386c7fbdc5cdc835ba23", 18},
-    {8453, "TRB", "0xf8e9e61ffb2b491f7df29823a76009743671cd96", 18},
-    {8453, "UNI", "0xc3de830ea07524a0761646a6a4e4be0e114a3c83", 18},
-    {8453, "USDbC", "0xd9aaec86b65d86f6a7b5b1b0c42ffa531710b6ca", 6},
-    {8453, "USDC", "0x833589fcd6edb6e08f4c7c32d4f71b54bda02913", 6},
-    {8453, "WAMPL", "0x489fe42c267fe0366b16b0c39e7aeef977e841ef", 18},
-    {8453, "WELL", "0xa88594d404727625a9437c3f886c7643872296ae", 18},
-    {8453, "WETH", "0x4200000000000000000000000000000000000006", 18},
-    {8453, "XYO", "0xd7b99ffb8b2afc6fe013a17207cbe50f223adc94", 18},
-    {8453, "YFI", "0x9eaf8c1e34f05a589eda6bafdf391cf6ad3cb239", 18},
-    {8453, "YGG", "0xaac78d1219c08aecc8e37e03858fe885f5ef1799", 18},
-    {8453, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {8453, "ZRX", "0x3bb4445d30ac020a84c1b5a8a2c6248ebc9779d0", 18},
-    {42161, "1INCH", "0x6314c31a7a1652ce482cffe247e9cb7c3f4bb9af", 18},
-    {42161, "AAVE", "0xba5ddd1f9d7f570dc94a51479a000e3bce967196", 18},
-    {42161, "ACX", "0x53691596d1bce8cea565b84d4915e69e03d9c99d", 18},
-    {42161, "AEVO", "0x377c1fc73d4d0f5600cd943776ced07c2b9783cd", 18},
-    {42161, "agEUR", "0xfa5ed56a203466cbbc2430a43c66b9d8723528e7", 18},
-    {42161, "AGLD", "0xb7910e8b16e63efd51d5d1a093d56280012a3b9c", 18},
-    {42161, "AIOZ", "0xec76e8fe6e2242e6c2117caa244b9e2de1569923", 18},
-    {42161, "ALEPH", "0xe7dcd50836d0a28c959c72d72122fedb8e245a6c", 18},
-    {42161, "ALI", "0xef6124368c0b56556667e0de77ea008dfc0a71d1", 18},
-    {42161, "ALPHA", "0xc9cbf102c73fb77ec14f8b4c8bd88e050a6b2646", 18},
-    {42161, "ANKR", "0x1bfc5d35bf0f7b9e15dc24c78b8c02dbc1e95447", 18},
-    {42161, "APE", "0x74885b4d524d497261259b38900f54e6dbad2210", 18},
-    {42161, "API3", "0xf01db12f50d0cdf5fe360ae005b9c52f92ca7811", 18},
-    {42161, "ARB", "0x912ce59144191c1204e64559fe8253a0e49e6548", 18},
-    {42161, "ARKM", "0xdac5094b7d59647626444a4f905060fcda4e656e", 18},
-    {42161, "ATA", "0xac9ac2c17cdfed4abc80a53c5553388575714d03", 18},
-    {42161, "ATH", "0xc7def82ba77baf30bbbc9b6162dc075b49092fb4", 18},
-    {42161, "AXL", "0x23ee2343b892b1bb63503a4fabc840e0e2c6810f", 6},
-    {42161, "AXS", "0xe88998fb579266628af6a03e3821d5983e5d0089", 18},
-    {42161, "BADGER", "0xbfa641051ba0a0ad1b0acf549a89536a0d76472e", 18},
-    {42161, "BAL", "0x040d1edc9569d4bab2d15287dc5a4f10f56a56b8", 18},
-    {42161, "BAT", "0x3450687ef141dcd6110b77c2dc44b008616aee75", 18},
-    {42161, "BICO", "0xa68ec98d7ca870cf1dd0b00ebbb7c4bf60a8e74d", 18},
-    {42161, "BIT", "0x406c8db506653d882295875f633bec0beb921c2a", 18},
-    {42161, "BLUR", "0xef171a5ba71348eff16616fd692855c2fe606eb2", 18},
-    {42161, "BNT", "0x7a24159672b83ed1b89467c9d6a99556ba06d073", 18},
-    {42161, "BOND", "0x0d81e50bc677fa67341c44d7eaa9228dee64a4e1", 18},
-    {42161, "BUSD", "0x31190254504622cefdfa55a7d3d272e6462629a2", 18},
-    {42161, "cbBTC", "0xcbb7c0000ab88b473b1f5afd9ef808440eed33bf", 8},
-    {42161, "cbETH", "0x1debd73e752beaf79865fd6446b0c970eae7732f", 18},
-    {42161, "CELO", "0x4e51ac49bc5e2d87e0ef713e9e5ab2d71ef4f336", 18},
-    {42161, "CELR", "0x3a8b787f78d775aecfeea15706d4221b40f345ab", 18},
-    {42161, "COMP", "0x354a6da3fcde098f8389cad84b0182725c6c91de", 18},
-    {42161, "COTI", "0x6fe14d3cc2f7bddffba5cdb3bbe7467dd81ea101", 18},
-    {42161, "COW", "0xcb8b5cd20bdcaea9a010ac1f8d835824f5c87a04", 18},
-    {42161, "CQT", "0x69b937db799a9becc9e8a6f0a5d36ea3657273bf", 18},
-    {42161, "CRO", "0x8ea3156f834a0dfc78f1a5304fac2cda676f354c", 8},
-    {42161, "CRV", "0x11cdb42b0eb46d95f990bedd4695a6e3fa034978", 18},
-    {42161, "CTSI", "0x319f865b287fcc10b30d8ce6144e8b6d1b476999", 18},
-    {42161, "CTX", "0x84f5c2cfba754e76dd5ae4fb369cfc920425e12b", 18},
-    {42161, "CVC", "0x9dffb23cad3322440bccff7ab1c58e781ddbf144", 8},
-    {42161, "CVX", "0xaafcfd42c9954c6689ef1901e03db742520829c5", 18},
-    {42161, "DAI", "0xda10009cbd5d07dd0cecc66161fc93d7c9000da1", 18},
-    {42161, "DEXT", "0x3be7cb2e9413ef8f42b4a202a0114eb59b64e227", 18},
-    {42161, "DIA", "0xca642467c6ebe58c13cb4a7091317f34e17ac05e", 18},
-    {42161, "DNT", "0xe3696a02b2c9557639e29d829e9c45efa49ad47a", 18},
-    {42161, "DPI", "0x4667cf53c4edf659e402b733bea42b18b68dd74c", 18},
-    {42161, "DYDX", "0x51863cb90ce5d6da9663106f292fa27c8cc90c5a", 18},
-    {42161, "EIGEN", "0x606c3e5075e5555e79aa15f1e9facb776f96c248", 18},
-    {42161, "ELON", "0x3e4cff6e50f37f731284a92d44ae943e17077fd4", 18},
-    {42161, "ENA", "0xdf8f0c63d9335a0abd89f9f752d293a98ea977d8", 18},
-    {42161, "ENJ", "0x7fa9549791efc9030e1ed3f25d18014163806758", 18},
-    {42161, "ENS", "0xfea31d704deb0975da8e77bf13e04239e70d7c28", 18},
-    {42161, "ERN", "0x2354c8e9ea898c751f1a15addeb048714d667f96", 18},
-    {42161, "ETHFI", "0x07d65c18cecba423298c0aeb5d2beded4dfd5736", 18},
-    {42161, "EURC", "0x863708032b5c328e11abcbc0df9d79c71fc52a48", 6},
-    {42161, "FARM", "0x8553d254cb6934b16f87d2e486b64bbd24c83c70", 18},
-    {42161, "FET", "0x4be87c766a7ce11d5cc864b6c3abb7457dcc4cc9", 18},
-    {42161, "FIS", "0x849b40ab2469309117ed1038c5a99894767c7282", 18},
-    {42161, "FLOKI", "0xa8c25fdc09763a176353cc6a76882e05b4905fae", 9},
-    {42161, "FORT", "0x3a1429d50e0cbbc45c997af600541fe1cc3d2923", 18},
-    {42161, "FOX", "0xf929de51d91c77e42f5090069e0ad7a09e513c73", 18},
-    {42161, "FRAX", "0x7468a5d8e02245b00e8c0217fce021c70bc51305", 18},
-    {42161, "FTM", "0xd42785d323e608b9e99fa542bd8b1000d4c2df37", 18},
-    {42161, "FXS", "0xd9f9d2ee2d3efe420699079f16d9e924afffdea4", 18},
-    {42161, "GAL", "0xc27e7325a6bea1fcc06de7941473f5279bfd1182", 18},
-    {42161, "GALA", "0x2a676eead159c4c8e8593471c6d666f02827ff8c", 8},
-    {42161, "GMX", "0xfc5a1a6eb076a2c7ad06ed22c90d7e710e35ad0a", 18},
-    {42161, "GNO", "0xa0b862f60edef4452f25b4160f177db44deb6cf1", 18},
-    {42161, "GRT", "0x9623063377ad1b27544c965ccd7342f7ea7e88c7", 18},
-    {42161, "GTC", "0x7f9a7db853ca816b9a138aee3380ef34c437dee0", 18},
-    {42161, "GYEN", "0x589d35656641d6ab57a545f08cf473ecd9b6d5f7", 6},
-    {42161, "HIGH", "0xd12eeb0142d4efe7af82e4f29e5af382615bceea", 18},
-    {42161, "HOPR", "0x177f394a3ed18faa85c1462ae626438a70294ef7", 18},
-    {42161, "ILV", "0x61ca9d186f6b9a793bc08f6c79fd35f205488673", 18},
-    {42161, "IMX", "0x3cfd99593a7f035f717142095a3898e3fca7783e", 18},
-    {42161, "INJ", "0x2a2053cb633cad465b4a8975ed3d7f09df608f80", 18},
-    {42161, "JASMY", "0x25f05699548d3a0820b99f93c10c8bb573e27083", 18},
-    {42161, "KUJI", "0x3a18dcc9745edcd1ef33ecb93b0b6eba5671e7ca", 6},
-    {42161, "LDO", "0x13ad51ed4f1b7e9dc168d8a00cb3f4ddd85efa60", 18},
-    {42161, "LINK", "0xf97f4df75117a78c1a5a0dbb814af92458539fb4", 18},
-    {42161, "LIT", "0x349fc93da004a63f3b1343361465981330a40b25", 18},
-    {42161, "LPT", "0x289ba1701c2f088cf0faf8b3705246331cb8a839", 18},
-    {42161, "LQTY", "0xfb9e5d956d889d91a82737b9bfcdac1dce3e1449", 18},
-    {42161, "LRC", "0x46d0ce7de6247b0a95f67b43b589b4041bae7fbe", 18},
-    {42161, "LUSD", "0x93b346b6bc2548da6a1e7d98e9a421b42541425b", 18},
-    {42161, "MAGIC", "0x539bde0d7dbd336b79148aa742883198bbf60342", 18},
-    {42161, "MANA", "0x442d24578a564ef628a65e6a7e3e7be2a165e231", 18},
-    {42161, "MASK", "0x533a7b414cd1236815a5e09f1e97fc7d5c313739", 18},
-    {42161, "MATH", "0x99f40b01ba9c469193b360f72740e416b17ac332", 18},
-    {42161, "MATIC", "0x561877b6b3dd7651313794e5f2894b2f18be0766", 18},
-    {42161, "METIS", "0x7f728f3595db17b0b359f4fc47ae80fad2e33769", 18},
-    {42161, "MIM", "0xb20a02dffb172c474bc4bda3fd6f4ee70c04daf2", 18},
-    {42161, "MKR", "0x2e9a6df78e42a30712c10a9dc4b1c8656f8f2879", 18},
-    {42161, "MLN", "0x8f5c1a99b1df736ad685006cb6adca7b7ae4b514", 18},
-    {42161, "MOG", "0x96c42662820f6ea32f0a61a06a38a72b206aabac", 18},
-    {42161, "MPL", "0x29024832ec3babf5074d4f46102aa988097f0ca0", 18},
-    {42161, "MULTI", "0x7b9b94aebe5e2039531af8e31045f377ecd9a39a", 18},
-    {42161, "MV", "0x5445972e76c5e4cedd12b6e2bcef69133e15992f", 18},
-    {42161, "MXC", "0x91b468fe3dce581d7a6cfe34189f1314b6862ed6", 18},
-    {42161, "NCT", "0x53236015a675fcb937485f1ae58040e4fb920d5b", 18},
-    {42161, "NKN", "0xbe06ca305a5cb49abf6b1840da7c42690406177b", 18},
-    {42161, "NMR", "0x597701b32553b9fa473e21362d480b3a6b569711", 18},
-    {42161, "OCEAN", "0x933d31561e470478079feb9a6dd2691fad8234df", 18},
-    {42161, "OGN", "0x6feb262feb0f775b5312d2e009923f7f58ae423e", 18},
-    {42161, "OMG", "0xd962c1895c46ac0378c502c207748b7061421e8e", 18},
-    {42161, "ONDO", "0xa2d52a05b8bead5d824df54dd1aa63188b37a5e7", 18},
-    {42161, "ORN", "0x1bdcc2075d5370293e248cab0173ec3e551e6218", 8},
-    {42161, "PAXG", "0xfeb4dfc8c4cf7ed305bb08065d08ec6ee6728429", 18},
-    {42161, "PEPE", "0x35e6a59f786d9266c7961ea28c7b768b33959cbb", 18},
-    {42161, "PERP", "0x753d224bcf9aafacd81558c32341416df61d3dac", 18},
-    {42161, "POL", "0x044d8e7f3a17751d521efea8ccf9282268fe08cc", 18},
-    {42161, "POLS", "0xeeeb5eac2db7a7fc28134aa3248580d48b016b64", 18},
-    {42161, "POLY", "0xe12f29704f635f4a6e7ae154838d21f9b33809e9", 18},
-    {42161, "POND", "0xda0a57b710768ae17941a9fa33f8b720c8bd9ddd", 18},
-    {42161, "POWR", "0x4e91f2af1ee0f84b529478f19794f5afd423e4a6", 6},
-    {42161, "PRIME", "0x8d8e1b6ffc6832e8d2ef0de8a3d957cae7ac5067", 18},
-    {42161, "PRQ", "0x82164a8b646401a8776f9dc5c8cba35dcaf60cd2", 18},
-    {42161, "QNT", "0xc7557c73e0eca2e1bf7348bb6874aee63c7eff85", 18},
-    {42161, "RAI", "0xaef5bbcbfa438519a5ea80b4c7181b4e78d419f2", 18},
-    {42161, "RARI", "0xcf78572a8fe97b2b9a4b9709f6a7d9a863c1b8e0", 18},
-    {42161, "RBC", "0x2e9ae8f178d5ea81970c7799a377b3985cbc335f", 18},
-    {42161, "REN", "0x9fa891e1db0a6d1eeac4b929b5aae1011c79a204", 18},
-    {42161, "REQ", "0x1cb5bbc64e148c5b889e3c667b49edf78bb92171", 18},
-    {42161, "RGT", "0xef888bca6ab6b1d26dbec977c455388ecd794794", 18},
-    {42161, "RLC", "0xe575586566b02a16338c199c23ca6d295d794e66", 9},
-    {42161, "RNDR", "0xc8a4eea31e9b6b61c406df013dd4fec76f21e279", 18},
-    {42161, "SAND", "0xd1318eb19dbf2647743c720ed35174efd64e3dac", 18},
-    {42161, "SD", "0x1629c4112952a7a377cb9b8d7d8c903092f34b63", 18},
-    {42161, "SHIB", "0x5033833c9fe8b9d3e09eed2f73d2aaf7e3872fd1", 18},
-    {42161, "SKL", "0x4f9b7dedd8865871df65c5d26b1c2dd537267878", 18},
-    {42161, "SNT", "0x707f635951193ddafbb40971a0fcaab8a6415160", 18},
-    {42161, "SNX", "0xcba56cd8216fcbbf3fa6df6137f3147cbca37d60", 18},
-    {42161, "SOCKS", "0xb2be52744a804cc732d606817c2572c5a3b264e7", 18},
-    {42161, "SOL", "0xb74da9fe2f96b9e0a5f4a3cf0b92dd2bec617124", 9},
-    {42161, "SPELL", "0x3e6648c5a70a150a88bce65f4ad4d506fe15d2af", 18},
-    {42161, "STG", "0xe018c7a3d175fb0fe15d70da2c874d3ca16313ec", 18},
-    {42161, "STORJ", "0xe6320ebf209971b4f4696f7f0954b8457aa2fcc2", 8},
-    {42161, "SUPER", "0x7f9cf5a2630a0d58567122217df7609c26498956", 18},
-    {42161, "sUSD", "0xa970af1a584579b618be4d69ad6f73459d112f95", 18},
-    {42161, "SUSHI", "0xd4d42f0b6def4ce0383636770ef773390d85c61a", 18},
-    {42161, "SYN", "0x1bcfc0b4ee1471674cd6a9f6b363a034375ead84", 18},
-    {42161, "T", "0x0945cae3ae47cb384b2d47bc448dc6a9dec21f55", 18},
-    {42161, "tBTC", "0x7e2a1edee171c5b19e6c54d73752396c0a572594", 18},
-    {42161, "TRB", "0xd58d345fd9c82262e087d2d0607624b410d88242", 18},
-    {42161, "TRIBE", "0xbfae6fecd8124ba33cbb2180aab0fe4c03914a5a", 18},
-    {42161, "TURBO", "0x5c816d4582c857dcadb1bb1f62ad6c9dede4576a", 18},
-    {42161, "UMA", "0xd693ec944a85eeca4247ec1c3b130dca9b0c3b22", 18},
-    {42161, "UNI", "0xfa7f8980b0f1e64a2062791cc3b0871572f1f7f0", 18},
-    {42161, "USDC", "0xaf88d065e77c8cc2239327c5edb3a432268e5831", 6},
-    {42161, "USDC.e", "0xff970a61a04b1ca14834a43f5de4533ebddb5cc8", 6},
-    {42161, "USDP", "0x78df3a6044ce3cb1905500345b967788b699df8f", 18},
-    {42161, "USDT", "0xfd086bc7cd5c481dcc9c85ebe478a1c0b69fcbb9", 6},
-    {42161, "WAMPL", "0x1c8ec4de3c2bfd3050695d89853ec6d78ae650bb", 18},
-    {42161, "WBTC", "0x2f2a2543b76a4166549f7aab2e75bef0aefc5b0f", 8},
-    {42161, "WETH", "0x82af49447d8a07e3bd95bd0d56f35241523fbab1", 18},
-    {42161, "WOO", "0xcafcd85d8ca7ad1e1c6f82f651fa15e33aefd07b", 18},
-    {42161, "XCN", "0x58bbc087e36db40a84b22c1b93a042294deeafed", 18},
-    {42161, "XSGD", "0xa05245ade25cc1063ee50cf7c083b4524c1c4302", 6},
-    {42161, "YFI", "0x82e3a8f066a6989666b031d916c43672085b1582", 18},
-    {42161, "Zeta", "0x6ddbbce7858d276678fc2b36123fd60547b88954", 18},
-    {42161, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {42161, "ZRX", "0xbd591bd4ddb64b77b5f76eab8f03d02519235ae2", 18},
-    {42220, "BTC", "0xd629eb00deced2a080b7ec630ef6ac117e614f1b", 18},
-    {42220, "CELO", "0x471ece3750da237f93b8e339c536989b8978a438", 18},
-    {42220, "USDC", "0xceba9300f2b948710d2653dd7b07f33a8b32118c", 6},
-    {42220, "USDT", "0x48065fbbe25f71c9282ddf5e1cd6d6a887483d5e", 6},
-    {42220, "WETH", "0x2def4285787d58a2f811af24755a8150622f4361", 18},
-    {43114, "1INCH", "0xd501281565bf7789224523144fe5d98e8b28f267", 18},
-    {43114, "AAVE", "0x63a72806098bd3d9520cc43356dd78afe5d386d9", 18},
-    {43114, "agEUR", "0xaec8318a9a59baeb39861d10ff6c7f7bf1f96c57", 18},
-    {43114, "ALPHA", "0x2147efff675e4a4ee1c2f918d181cdbd7a8e208f", 18},
-    {43114, "ANKR", "0x20cf1b6e9d856321ed4686877cf4538f2c84b4de", 18},
-    {43114, "AXL", "0x44c784266cf024a60e8acf2427b9857ace194c5d", 6},
-    {43114, "BAT", "0x98443b96ea4b0858fdf3219cd13e98c7a4690588", 18},
-    {43114, "BUSD", "0x9c9e5fd8bbc25984b178fdce6117defa39d2db39", 18},
-    {43114, "COMP", "0xc3048e19e76cb9a3aa9d77d8c03c29fc906e2437", 18},
-    {43114, "CTSI", "0x6b289cceaa8639e3831095d75a3e43520fabf552", 18},
-    {43114, "DAI.e", "0xd586e7f844cea2f87f50152665bcbc2c279d8d70", 18},
-    {43114, "DYP", "0x961c8c0b1aad0c0b10a51fef6a867e3091bcef17", 18},
-    {43114, "EURC", "0xc891eb4cbdeff6e073e859e987815ed1505c2acd", 6},
-    {43114, "FRAX", "0xd24c2ad096400b6fbcd2ad8b24e7acbc21a1da64", 18},
-    {43114, "FXS", "0x214db107654ff987ad859f34125307783fc8e387", 18},
-    {43114, "GMX", "0x62edc0692bd897d2295872a9ffcac5425011c661", 18},
-    {43114, "GRT", "0x8a0cac13c7da965a312f08ea4229c37869e85cb9", 18},
-    {43114, "LINK", "0x5947bb275c521040051d82396192181b413227a3", 18},
-    {43114, "MIM", "0x130966628846bfd36ff31a822705796e8cb8c18d", 18},
-    {43114, "MKR", "0x88128fd4b259552a9a1d457f435a6527aab72d42", 18},
-    {43114, "MULTI", "0x9fb9a33956351cf4fa040f65a13b835a3c8764e3", 18},
-    {43114, "RAI", "0x97cd1cfe2ed5712660bb6c14053c0ecb031bff7d", 18},
-    {43114, "SNX", "0xbec243c995409e6520d7c41e404da5deba4b209b", 18},
-    {43114, "SOL", "0xfe6b19286885a4f7f55adad09c3cd1f906d2478f", 9},
-    {43114, "SPELL", "0xce1bffbd5374dac86a2893119683f4911a2f7814", 18},
-    {43114, "STG", "0x2f6f07cdcf3588944bf4c42ac74ff24bf56e7590", 18},
-    {43114, "SUSHI", "0x37b608519f91f70f2eeb0e5ed9af4061722e4f76", 18},
-    {43114, "SYN", "0x1f1e7c893855525b303f99bdf5c3c05be09ca251", 18},
-    {43114, "UMA", "0x3bd2b1c7ed8d396dbb98ded3aebb41350a5b2339", 18},
-    {43114, "UNI.e", "0x8ebaf22b6f053dffeaf46f4dd9efa95d89ba8580", 18},
-    {43114, "USDC", "0xb97ef9ef8734c71904d8002f8b6bc66dd9c48a6e", 6},
-    {43114, "USDT", "0x9702230a8ea53601f5cd2dc00fdbc13d4df4a8c7", 6},
-    {43114, "WAVAX", "0xb31f66aa3c1e785363f0875a1b74e27b85fd66c7", 18},
-    {43114, "WBTC", "0x50b7545627a5162f82a992c33b87adc75187b218", 8},
-    {43114, "WETH", "0x49d5c2bdffac6ce2bfdb6640f4f80f226bc10bab", 18},
-    {43114, "WOO", "0xabc9547b534519ff73921b1fba6e672b5f58d083", 18},
-    {43114, "YFI", "0x9eaac1b23d935365bd7b542fe22ceee2922f52dc", 18},
-    {43114, "ZRO", "0x6985884c4392d348587b19cb9eaaf157f13271cd", 18},
-    {43114, "ZRX", "0x596fa47043f99a4e0f122243b841e55375cde0d2", 18},
-    {80001, "WETH", "0xa6fa4fb5f76172d178d61b04b0ecd319c5d1c0aa", 18},
-    {80001, "WMATIC", "0x9c3c9283d3e44854697cd22d3faa240cfb032889", 18},
-    {81457, "BLAST", "0xb1a5700fa2358173fe465e6ea4ff52e36e88e2ad", 18},
-    {7777777, "USDzC", "0xcccccccc7021b32ebb4e8c08314bd62f7c653ec4", 6},
-    {11155111, "UNI", "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984", 18},
-    {11155111, "WETH", "0xfff9976782d46cc05630d1f6ebab18b2324d6b14", 18}};
+static const erc20_info_t erc20_tokens[] = {
+    {1, "STX", {0x00, 0x6b, 0xea, 0x43, 0xba, 0xa3, 0xf7, 0xa6, 0xf7, 0x65, 0xf1, 0x4f, 0x10, 0xa1, 0xa1, 0xb0, 0x83, 0x34, 0xef, 0x45}, 18},
+    {1, "SKL", {0x00, 0xc8, 0x3a, 0xec, 0xc7, 0x90, 0xe8, 0xa4, 0x45, 0x3e, 0x5d, 0xd3, 0xb0, 0xb4, 0xb3, 0x68, 0x05, 0x01, 0xa7, 0xa7}, 18},
+    {1, "ORN", {0x02, 0x58, 0xf4, 0x74, 0x78, 0x6d, 0xdf, 0xd3, 0x7a, 0xbc, 0xe6, 0xdf, 0x6b, 0xbb, 0x1d, 0xd5, 0xdf, 0xc4, 0x43, 0x4a}, 8},
+    {1, "LCX", {0x03, 0x7a, 0x54, 0xaa, 0xb0, 0x62, 0x62, 0x8c, 0x9b, 0xba, 0xe1, 0xfd, 0xb1, 0x58, 0x3c, 0x19, 0x55, 0x85, 0xfe, 0x41}, 18},
+    {1, "BOND", {0x03, 0x91, 0xd2, 0x02, 0x1f, 0x89, 0xdc, 0x33, 0x9f, 0x60, 0xff, 0xf8, 0x45, 0x46, 0xea, 0x23, 0xe3, 0x37, 0x75, 0x0f}, 18},
+    {1, "RAI", {0x03, 0xab, 0x45, 0x86, 0x34, 0x91, 0x0a, 0xad, 0x20, 0xef, 0x5f, 0x1c, 0x8e, 0xe9, 0x6f, 0x1d, 0x6a, 0xc5, 0x49, 0x19}, 18},
+    {1, "NEST", {0x04, 0xab, 0xed, 0xa2, 0x01, 0x85, 0x0a, 0xc0, 0x12, 0x41, 0x61, 0xf0, 0x37, 0xef, 0xd7, 0x0c, 0x74, 0xdd, 0xc7, 0x4c}, 18},
+    {1, "UMA", {0x04, 0xfa, 0x0d, 0x23, 0x5c, 0x4a, 0xbf, 0x4b, 0xcf, 0x47, 0x87, 0xaf, 0x4c, 0xf4, 0x47, 0xde, 0x57, 0x2e, 0xf8, 0x28}, 18},
+    {1, "GUSD", {0x05, 0x6f, 0xd4, 0x09, 0xe1, 0xd7, 0xa1, 0x24, 0xbd, 0x70, 0x17, 0x45, 0x9d, 0xfe, 0xa2, 0xf3, 0x87, 0xb6, 0xd5, 0xcd}, 2},
+    {1, "SUKU", {0x07, 0x63, 0xfd, 0xcc, 0xf1, 0xae, 0x54, 0x1a, 0x59, 0x61, 0x81, 0x5c, 0x08, 0x72, 0xa8, 0xc5, 0xbc, 0x6d, 0xe4, 0xd7}, 18},
+    {1, "DAR", {0x08, 0x11, 0x31, 0x43, 0x4f, 0x93, 0x06, 0x37, 0x51, 0x81, 0x3c, 0x61, 0x9e, 0xcc, 0xa9, 0xc4, 0xdc, 0x78, 0x62, 0xa3}, 6},
+    {1, "CRPT", {0x08, 0x38, 0x94, 0x95, 0xd7, 0x45, 0x6e, 0x19, 0x51, 0xdd, 0xf7, 0xc3, 0xa1, 0x31, 0x4a, 0x4b, 0xfb, 0x64, 0x6d, 0x8b}, 18},
+    {1, "MATH", {0x08, 0xd9, 0x67, 0xbb, 0x01, 0x34, 0xf2, 0xd0, 0x7f, 0x7c, 0xfb, 0x6e, 0x24, 0x66, 0x80, 0xc5, 0x39, 0x27, 0xdd, 0x30}, 18},
+    {1, "SPELL", {0x09, 0x01, 0x85, 0xf2, 0x13, 0x53, 0x08, 0xba, 0xd1, 0x75, 0x27, 0x00, 0x43, 0x64, 0xeb, 0xcc, 0x2d, 0x37, 0xe5, 0xf6}, 18},
+    {1, "INDEX", {0x09, 0x54, 0x90, 0x6d, 0xa0, 0xbf, 0x32, 0xd5, 0x47, 0x9e, 0x25, 0xf4, 0x60, 0x56, 0xd2, 0x2f, 0x08, 0x46, 0x4c, 0xab}, 18},
+    {1, "MIR", {0x09, 0xa3, 0xec, 0xaf, 0xa8, 0x17, 0x26, 0x8f, 0x77, 0xbe, 0x12, 0x83, 0x17, 0x6b, 0x94, 0x6c, 0x4f, 0xf2, 0xe6, 0x08}, 18},
+    {1, "DNT", {0x0a, 0xbd, 0xac, 0xe7, 0x0d, 0x37, 0x90, 0x23, 0x5a, 0xf4, 0x48, 0xc8, 0x85, 0x47, 0x60, 0x3b, 0x94, 0x56, 0x04, 0xea}, 18},
+    {1, "API3", {0x0b, 0x38, 0x21, 0x0e, 0xa1, 0x14, 0x11, 0x55, 0x7c, 0x13, 0x45, 0x7d, 0x4d, 0xa7, 0xdc, 0x6e, 0xa7, 0x31, 0xb8, 0x8a}, 18},
+    {1, "SWFTC", {0x0b, 0xb2, 0x17, 0xe4, 0x0f, 0x8a, 0x5c, 0xb7, 0x9a, 0xdf, 0x04, 0xe1, 0xaa, 0xb6, 0x0e, 0x5a, 0xbd, 0x0d, 0xfc, 0x1e}, 8},
+    {1, "YFI", {0x0b, 0xc5, 0x29, 0xc0, 0x0c, 0x64, 0x01, 0xae, 0xf6, 0xd2, 0x20, 0xbe, 0x8c, 0x6e, 0xa1, 0x66, 0x7f, 0x6a, 0xd9, 0x3e}, 18},
+    {1, "PDA", {0x0d, 0x3c, 0xbe, 0xd3, 0xf6, 0x9e, 0xe0, 0x50, 0x66, 0x8a, 0xdf, 0x3d, 0x9e, 0xa5, 0x72, 0x41, 0xcb, 0xa3, 0x3a, 0x2b}, 18},
+    {1, "BAT", {0x0d, 0x87, 0x75, 0xf6, 0x48, 0x43, 0x06, 0x79, 0xa7, 0x09, 0xe9, 0x8d, 0x2b, 0x0c, 0xb6, 0x25, 0x0d, 0x28, 0x87, 0xef}, 18},
+    {1, "SYN", {0x0f, 0x2d, 0x71, 0x94, 0x07, 0xfd, 0xbe, 0xff, 0x09, 0xd8, 0x75, 0x57, 0xab, 0xb7, 0x23, 0x26, 0x01, 0xfd, 0x9f, 0x29}, 18},
+    {1, "MANA", {0x0f, 0x5d, 0x2f, 0xb2, 0x9f, 0xb7, 0xd3, 0xcf, 0xee, 0x44, 0x4a, 0x20, 0x02, 0x98, 0xf4, 0x68, 0x90, 0x8c, 0xc9, 0x42}, 18},
+    {1, "1INCH", {0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdc, 0x0a, 0xa7, 0x8b, 0x77, 0x0f, 0xa6, 0xa7, 0x38, 0x03, 0x41, 0x20, 0xc3, 0x02}, 18},
+    {1, "DPI", {0x14, 0x94, 0xca, 0x1f, 0x11, 0xd4, 0x87, 0xc2, 0xbb, 0xe4, 0x54, 0x3e, 0x90, 0x08, 0x0a, 0xeb, 0xa4, 0xba, 0x3c, 0x2b}, 18},
+    {1, "NMR", {0x17, 0x76, 0xe1, 0xf2, 0x6f, 0x98, 0xb1, 0xa5, 0xdf, 0x9c, 0xd3, 0x47, 0x95, 0x3a, 0x26, 0xdd, 0x3c, 0xb4, 0x66, 0x71}, 18},
+    {1, "tBTC", {0x18, 0x08, 0x4f, 0xba, 0x66, 0x6a, 0x33, 0xd3, 0x75, 0x92, 0xfa, 0x26, 0x33, 0xfd, 0x49, 0xa7, 0x4d, 0xd9, 0x3a, 0x88}, 18},
+    {1, "AUDIO", {0x18, 0xaa, 0xa7, 0x11, 0x57, 0x05, 0xe8, 0xbe, 0x94, 0xbf, 0xfe, 0xbd, 0xe5, 0x7a, 0xf9, 0xbf, 0xc2, 0x65, 0xb9, 0x98}, 18},
+    {1, "REP", {0x19, 0x85, 0x36, 0x5e, 0x9f, 0x78, 0x35, 0x9a, 0x9b, 0x6a, 0xd7, 0x60, 0xe3, 0x24, 0x12, 0xf4, 0xa4, 0x45, 0xe8, 0x62}, 18},
+    {1, "BIT", {0x1a, 0x4b, 0x46, 0x69, 0x6b, 0x2b, 0xb4, 0x79, 0x4e, 0xb3, 0xd4, 0xc2, 0x6f, 0x1c, 0x55, 0xf9, 0x17, 0x0f, 0xa4, 0xc5}, 18},
+    {1, "agEUR", {0x1a, 0x7e, 0x4e, 0x63, 0x77, 0x8b, 0x4f, 0x12, 0xa1, 0x99, 0xc0, 0x62, 0xf3, 0xef, 0xdd, 0x28, 0x8a, 0xfc, 0xbc, 0xe8}, 18},
+    {1, "EURC", {0x1a, 0xba, 0xea, 0x1f, 0x7c, 0x83, 0x0b, 0xd8, 0x9a, 0xcc, 0x67, 0xec, 0x4a, 0xf5, 0x16, 0x28, 0x4b, 0x1b, 0xc3, 0x3c}, 6},
+    {1, "PORTAL", {0x1b, 0xbe, 0x97, 0x3b, 0xef, 0x3a, 0x97, 0x7f, 0xc5, 0x1c, 0xbe, 0xd7, 0x03, 0xe8, 0xff, 0xde, 0xfe, 0x00, 0x1f, 0xed}, 18},
+    {1, "KP3R", {0x1c, 0xeb, 0x5c, 0xb5, 0x7c, 0x4d, 0x4e, 0x2b, 0x24, 0x33, 0x64, 0x1b, 0x95, 0xdd, 0x33, 0x0a, 0x33, 0x18, 0x5a, 0x44}, 18},
+    {1, "BNT", {0x1f, 0x57, 0x3d, 0x6f, 0xb3, 0xf1, 0x3d, 0x68, 0x9f, 0xf8, 0x44, 0xb4, 0xce, 0x37, 0x79, 0x4d, 0x79, 0xa7, 0xff, 0x1c}, 18},
+    {1, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {1, "REPv2", {0x22, 0x16, 0x57, 0x77, 0x68, 0x46, 0x89, 0x09, 0x89, 0xa7, 0x59, 0xba, 0x29, 0x73, 0xe4, 0x27, 0xdf, 0xf5, 0xc9, 0xbb}, 18},
+    {1, "WBTC", {0x22, 0x60, 0xfa, 0xc5, 0xe5, 0x54, 0x2a, 0x77, 0x3a, 0xa4, 0x4f, 0xbc, 0xfe, 0xdf, 0x7c, 0x19, 0x3b, 0xc2, 0xc5, 0x99}, 8},
+    {1, "PRO", {0x22, 0x6b, 0xb5, 0x99, 0xa1, 0x2c, 0x82, 0x64, 0x76, 0xe3, 0xa7, 0x71, 0x45, 0x46, 0x97, 0xea, 0x52, 0xe9, 0xe2, 0x20}, 8},
+    {1, "JAM", {0x23, 0x89, 0x4d, 0xc9, 0xda, 0x6c, 0x94, 0xec, 0xb4, 0x39, 0x91, 0x1c, 0xaf, 0x7d, 0x33, 0x77, 0x46, 0x57, 0x5a, 0x72}, 18},
+    {1, "SOCKS", {0x23, 0xb6, 0x08, 0x67, 0x5a, 0x2b, 0x2f, 0xb1, 0x89, 0x0d, 0x3a, 0xbb, 0xd8, 0x5c, 0x57, 0x75, 0xc5, 0x16, 0x91, 0xd5}, 18},
+    {1, "ASM", {0x25, 0x65, 0xae, 0x03, 0x85, 0x65, 0x9b, 0xad, 0xca, 0xda, 0x10, 0x31, 0xdb, 0x70, 0x44, 0x42, 0xe1, 0xb6, 0x99, 0x82}, 18},
+    {1, "YGG", {0x25, 0xf8, 0x08, 0x7e, 0xad, 0x17, 0x3b, 0x73, 0xd6, 0xe8, 0xb8, 0x43, 0x29, 0x98, 0x9a, 0x8e, 0xea, 0x16, 0xcf, 0x73}, 18},
+    {1, "AST", {0x27, 0x05, 0x4b, 0x13, 0xb1, 0xb7, 0x98, 0xb3, 0x45, 0xb5, 0x91, 0xa4, 0xd2, 0x2e, 0x65, 0x62, 0xd4, 0x7e, 0xa7, 0x5a}, 4},
+    {1, "MONA", {0x27, 0x5f, 0x5a, 0xd0, 0x3b, 0xe0, 0xfa, 0x22, 0x1b, 0x4c, 0x66, 0x49, 0xb8, 0xae, 0xe0, 0x9a, 0x42, 0xd9, 0x41, 0x2a}, 18},
+    {1, "ALEPH", {0x27, 0x70, 0x2a, 0x26, 0x12, 0x6e, 0x0b, 0x37, 0x02, 0xaf, 0x63, 0xee, 0x09, 0xac, 0x4d, 0x1a, 0x08, 0x4e, 0xf6, 0x28}, 18},
+    {1, "TONE", {0x2a, 0xb6, 0xbb, 0x84, 0x08, 0xca, 0x31, 0x99, 0xb8, 0xfa, 0x6c, 0x92, 0xd5, 0xb4, 0x55, 0xf8, 0x20, 0xaf, 0x03, 0xc4}, 18},
+    {1, "TOKE", {0x2e, 0x9d, 0x63, 0x78, 0x82, 0x49, 0x37, 0x1f, 0x1d, 0xfc, 0x91, 0x8a, 0x52, 0xf8, 0xd7, 0x99, 0xf4, 0xa3, 0x8c, 0x94}, 18},
+    {1, "SD", {0x30, 0xd2, 0x02, 0x08, 0xd9, 0x87, 0x71, 0x3f, 0x46, 0xdf, 0xd3, 0x4e, 0xf1, 0x28, 0xbb, 0x16, 0xc4, 0x04, 0xd1, 0x0f}, 18},
+    {1, "RAD", {0x31, 0xc8, 0xea, 0xcb, 0xff, 0xdd, 0x87, 0x5c, 0x74, 0xb9, 0x4b, 0x07, 0x78, 0x95, 0xbd, 0x78, 0xcf, 0x1e, 0x64, 0xa3}, 18},
+    {1, "CTX", {0x32, 0x1c, 0x2f, 0xe4, 0x44, 0x6c, 0x7c, 0x96, 0x3d, 0xc4, 0x1d, 0xd5, 0x88, 0x79, 0xaf, 0x64, 0x88, 0x38, 0xf9, 0x8d}, 18},
+    {1, "AGLD", {0x32, 0x35, 0x3a, 0x6c, 0x91, 0x14, 0x3b, 0xfd, 0x6c, 0x7d, 0x36, 0x3b, 0x54, 0x6e, 0x62, 0xa9, 0xa2, 0x48, 0x9a, 0x20}, 18},
+    {1, "CELO", {0x32, 0x94, 0x39, 0x5e, 0x62, 0xf4, 0xeb, 0x6a, 0xf3, 0xf1, 0xfc, 0xf8, 0x9f, 0x56, 0x02, 0xd9, 0x0f, 0xb3, 0xef, 0x69}, 18},
+    {1, "MPL", {0x33, 0x34, 0x9b, 0x28, 0x20, 0x65, 0xb0, 0x28, 0x4d, 0x75, 0x6f, 0x05, 0x77, 0xfb, 0x39, 0xc1, 0x58, 0xf9, 0x35, 0xe6}, 18},
+    {1, "FXS", {0x34, 0x32, 0xb6, 0xa6, 0x0d, 0x23, 0xca, 0x0d, 0xfc, 0xa7, 0x76, 0x1b, 0x7a, 0xb5, 0x64, 0x59, 0xd9, 0xc9, 0x64, 0xd0}, 18},
+    {1, "BADGER", {0x34, 0x72, 0xa5, 0xa7, 0x19, 0x65, 0x49, 0x9a, 0xcd, 0x81, 0x99, 0x7a, 0x54, 0xbb, 0xa8, 0xd8, 0x52, 0xc6, 0xe5, 0x3d}, 18},
+    {1, "CHZ", {0x35, 0x06, 0x42, 0x4f, 0x91, 0xfd, 0x33, 0x08, 0x44, 0x66, 0xf4, 0x02, 0xd5, 0xd9, 0x7f, 0x05, 0xf8, 0xe3, 0xb4, 0xaf}, 18},
+    {1, "DENT", {0x35, 0x97, 0xbf, 0xd5, 0x33, 0xa9, 0x9c, 0x9a, 0xa0, 0x83, 0x58, 0x7b, 0x07, 0x44, 0x34, 0xe6, 0x1e, 0xb0, 0xa2, 0x58}, 8},
+    {1, "PRQ", {0x36, 0x2b, 0xc8, 0x47, 0xa3, 0xa9, 0x63, 0x7d, 0x3a, 0xf6, 0x62, 0x4e, 0xec, 0x85, 0x36, 0x18, 0xa4, 0x3e, 0xd7, 0xd2}, 18},
+    {1, "OMNI", {0x36, 0xe6, 0x6f, 0xbb, 0xce, 0x51, 0xe4, 0xcd, 0x5b, 0xd3, 0xc6, 0x2b, 0x63, 0x7e, 0xb4, 0x11, 0xb1, 0x89, 0x49, 0xd4}, 18},
+    {1, "SAND", {0x38, 0x45, 0xba, 0xda, 0xde, 0x8e, 0x6d, 0xff, 0x04, 0x98, 0x20, 0x68, 0x0d, 0x1f, 0x14, 0xbd, 0x39, 0x03, 0xa5, 0xd0}, 18},
+    {1, "DDX", {0x3a, 0x88, 0x06, 0x52, 0xf4, 0x7b, 0xfa, 0xa7, 0x71, 0x90, 0x8c, 0x07, 0xdd, 0x86, 0x73, 0xa7, 0x87, 0xda, 0xed, 0x3a}, 18},
+    {1, "DREP", {0x3a, 0xb6, 0xed, 0x69, 0xef, 0x66, 0x3b, 0xd9, 0x86, 0xee, 0x59, 0x20, 0x5c, 0xca, 0xd8, 0xa2, 0x0f, 0x98, 0xb4, 0xc2}, 18},
+    {1, "REZ", {0x3b, 0x50, 0x80, 0x54, 0x53, 0x02, 0x3a, 0x91, 0xa8, 0xbf, 0x64, 0x1e, 0x27, 0x94, 0x01, 0xa0, 0xb2, 0x3f, 0xa6, 0xf9}, 18},
+    {1, "VGX", {0x3c, 0x4b, 0x6e, 0x6e, 0x1e, 0xa3, 0xd4, 0x86, 0x37, 0x00, 0xd7, 0xf7, 0x6b, 0x36, 0xb7, 0xf3, 0xd3, 0xf1, 0x3e, 0x3d}, 8},
+    {1, "COVAL", {0x3d, 0x65, 0x83, 0x90, 0x46, 0x02, 0x95, 0xfb, 0x96, 0x3f, 0x54, 0xdc, 0x08, 0x99, 0xcf, 0xb1, 0xc3, 0x07, 0x76, 0xdf}, 8},
+    {1, "A8", {0x3e, 0x5a, 0x19, 0xc9, 0x12, 0x66, 0xad, 0x8c, 0xe2, 0x47, 0x7b, 0x91, 0x58, 0x5d, 0x18, 0x56, 0xb8, 0x40, 0x62, 0xdf}, 18},
+    {1, "GHST", {0x3f, 0x38, 0x2d, 0xbd, 0x96, 0x0e, 0x3a, 0x9b, 0xbc, 0xea, 0xe2, 0x26, 0x51, 0xe8, 0x81, 0x58, 0xd2, 0x79, 0x15, 0x50}, 18},
+    {1, "REN", {0x40, 0x8e, 0x41, 0x87, 0x6c, 0xcc, 0xdc, 0x0f, 0x92, 0x21, 0x06, 0x00, 0xef, 0x50, 0x37, 0x26, 0x56, 0x05, 0x2a, 0x38}, 18},
+    {1, "QRDO", {0x41, 0x23, 0xa1, 0x33, 0xae, 0x3c, 0x52, 0x1f, 0xd1, 0x34, 0xd7, 0xb1, 0x3a, 0x2d, 0xec, 0x35, 0xb5, 0x6c, 0x24, 0x63}, 8},
+    {1, "FORT", {0x41, 0x54, 0x5f, 0x8b, 0x94, 0x72, 0xd7, 0x58, 0xbb, 0x66, 0x9e, 0xd8, 0xea, 0xee, 0xec, 0xd7, 0xa9, 0xc4, 0xec, 0x29}, 18},
+    {1, "INV", {0x41, 0xd5, 0xd7, 0x94, 0x31, 0xa9, 0x13, 0xc4, 0xae, 0x7d, 0x69, 0xa6, 0x68, 0xec, 0xdf, 0xe5, 0xff, 0x9d, 0xfb, 0x68}, 18},
+    {1, "CVC", {0x41, 0xe5, 0x56, 0x00, 0x54, 0x82, 0x4e, 0xa6, 0xb0, 0x73, 0x2e, 0x65, 0x6e, 0x3a, 0xd6, 0x4e, 0x20, 0xe9, 0x4e, 0x45}, 8},
+    {1, "BOBA", {0x42, 0xbb, 0xfa, 0x2e, 0x77, 0x75, 0x7c, 0x64, 0x5e, 0xea, 0xad, 0x16, 0x55, 0xe0, 0x91, 0x1a, 0x75, 0x53, 0xef, 0xbc}, 18},
+    {1, "ACX", {0x44, 0x10, 0x8f, 0x02, 0x23, 0xa3, 0xc3, 0x02, 0x8f, 0x5f, 0xe7, 0xae, 0xc7, 0xf9, 0xbb, 0x2e, 0x66, 0xbe, 0xf8, 0x2f}, 18},
+    {1, "UNFI", {0x44, 0x17, 0x61, 0x32, 0x64, 0x90, 0xca, 0xcf, 0x7a, 0xf2, 0x99, 0x72, 0x5b, 0x62, 0x92, 0x59, 0x7e, 0xe8, 0x22, 0xc2}, 18},
+    {1, "POL", {0x45, 0x5e, 0x53, 0xcb, 0xb8, 0x60, 0x18, 0xac, 0x2b, 0x80, 0x92, 0xfd, 0xcd, 0x39, 0xd8, 0x44, 0x4a, 0xff, 0xc3, 0xf6}, 18},
+    {1, "OXT", {0x45, 0x75, 0xf4, 0x13, 0x08, 0xec, 0x14, 0x83, 0xf3, 0xd3, 0x99, 0xaa, 0x9a, 0x28, 0x26, 0xd7, 0x4d, 0xa1, 0x3d, 0xeb}, 18},
+    {1, "PAXG", {0x45, 0x80, 0x48, 0x80, 0xde, 0x22, 0x91, 0x3d, 0xaf, 0xe0, 0x9f, 0x49, 0x80, 0x84, 0x8e, 0xce, 0x6e, 0xcb, 0xaf, 0x78}, 18},
+    {1, "KRL", {0x46, 0x4e, 0xbe, 0x77, 0xc2, 0x93, 0xe4, 0x73, 0xb4, 0x8c, 0xfe, 0x96, 0xdd, 0xcf, 0x88, 0xfc, 0xf7, 0xbf, 0xda, 0xc0}, 18},
+    {1, "AXL", {0x46, 0x77, 0x19, 0xad, 0x09, 0x02, 0x5f, 0xcc, 0x6c, 0xf6, 0xf8, 0x31, 0x17, 0x55, 0x80, 0x9d, 0x45, 0xa5, 0xe5, 0xf3}, 6},
+    {1, "WOO", {0x46, 0x91, 0x93, 0x7a, 0x75, 0x08, 0x86, 0x0f, 0x87, 0x6c, 0x9c, 0x0a, 0x2a, 0x61, 0x7e, 0x7d, 0x9e, 0x94, 0x5d, 0x4b}, 18},
+    {1, "TIME", {0x48, 0x5d, 0x17, 0xa6, 0xf1, 0xb8, 0x78, 0x03, 0x92, 0xd5, 0x3d, 0x64, 0x75, 0x18, 0x24, 0x25, 0x30, 0x11, 0xa2, 0x60}, 8},
+    {1, "CTSI", {0x49, 0x16, 0x04, 0xc0, 0xfd, 0xf0, 0x83, 0x47, 0xdd, 0x1f, 0xa4, 0xee, 0x06, 0x2a, 0x82, 0x2a, 0x5d, 0xd0, 0x6b, 0x5d}, 18},
+    {1, "QNT", {0x4a, 0x22, 0x0e, 0x60, 0x96, 0xb2, 0x5e, 0xad, 0xb8, 0x83, 0x58, 0xcb, 0x44, 0x06, 0x8a, 0x32, 0x48, 0x25, 0x46, 0x75}, 18},
+    {1, "JUP", {0x4b, 0x1e, 0x80, 0xca, 0xc9, 0x1e, 0x22, 0x16, 0xee, 0xb6, 0x3e, 0x29, 0xb9, 0x57, 0xeb, 0x91, 0xae, 0x9c, 0x2b, 0xe8}, 18},
+    {1, "TRU", {0x4c, 0x19, 0x59, 0x6f, 0x5a, 0xaf, 0xf4, 0x59, 0xfa, 0x38, 0xb0, 0xf7, 0xed, 0x92, 0xf1, 0x1a, 0xe6, 0x54, 0x37, 0x84}, 8},
+    {1, "KEY", {0x4c, 0xc1, 0x93, 0x56, 0xf2, 0xd3, 0x73, 0x38, 0xb9, 0x80, 0x2a, 0xa8, 0xe8, 0xfc, 0x58, 0xb0, 0x37, 0x32, 0x96, 0xe7}, 18},
+    {1, "PUFFER", {0x4d, 0x1c, 0x29, 0x7d, 0x39, 0xc5, 0xc1, 0x27, 0x79, 0x64, 0xd0, 0xe3, 0xf8, 0xaa, 0x90, 0x14, 0x93, 0x66, 0x45, 0x30}, 18},
+    {1, "APE", {0x4d, 0x22, 0x44, 0x52, 0x80, 0x1a, 0xce, 0xd8, 0xb2, 0xf0, 0xae, 0xbe, 0x15, 0x53, 0x79, 0xbb, 0x5d, 0x59, 0x43, 0x81}, 18},
+    {1, "FTM", {0x4e, 0x15, 0x36, 0x1f, 0xd6, 0xb4, 0xbb, 0x60, 0x9f, 0xa6, 0x3c, 0x81, 0xa2, 0xbe, 0x19, 0xd8, 0x73, 0x71, 0x78, 0x70}, 18},
+    {1, "CVX", {0x4e, 0x3f, 0xbd, 0x56, 0xcd, 0x56, 0xc3, 0xe7, 0x2c, 0x14, 0x03, 0xe1, 0x03, 0xb4, 0x5d, 0xb9, 0xda, 0x5b, 0x9d, 0x2b}, 18},
+    {1, "CELR", {0x4f, 0x92, 0x54, 0xc8, 0x3e, 0xb5, 0x25, 0xf9, 0xfc, 0xf3, 0x46, 0x49, 0x0b, 0xbb, 0x3e, 0xd2, 0x8a, 0x81, 0xc6, 0x67}, 18},
+    {1, "BUSD", {0x4f, 0xab, 0xb1, 0x45, 0xd6, 0x46, 0x52, 0xa9, 0x48, 0xd7, 0x25, 0x33, 0x02, 0x3f, 0x6e, 0x7a, 0x62, 0x3c, 0x7c, 0x53}, 18},
+    {1, "NU", {0x4f, 0xe8, 0x32, 0x13, 0xd5, 0x63, 0x08, 0x33, 0x0e, 0xc3, 0x02, 0xa8, 0xbd, 0x64, 0x1f, 0x1d, 0x01, 0x13, 0xa4, 0xcc}, 18},
+    {1, "LINK", {0x51, 0x49, 0x10, 0x77, 0x1a, 0xf9, 0xca, 0x65, 0x6a, 0xf8, 0x40, 0xdf, 0xf8, 0x3e, 0x82, 0x64, 0xec, 0xf9, 0x86, 0xca}, 18},
+    {1, "BLUR", {0x52, 0x83, 0xd2, 0x91, 0xdb, 0xcf, 0x85, 0x35, 0x6a, 0x21, 0xba, 0x09, 0x0e, 0x6d, 0xb5, 0x91, 0x21, 0x20, 0x8b, 0x44}, 18},
+    {1, "XYO", {0x55, 0x29, 0x6f, 0x69, 0xf4, 0x0e, 0xa6, 0xd2, 0x0e, 0x47, 0x85, 0x33, 0xc1, 0x5a, 0x6b, 0x08, 0xb6, 0x54, 0xe7, 0x58}, 18},
+    {1, "REVV", {0x55, 0x7b, 0x93, 0x3a, 0x7c, 0x2c, 0x45, 0x67, 0x2b, 0x61, 0x0f, 0x89, 0x54, 0xa3, 0xde, 0xb3, 0x9a, 0x51, 0xa8, 0xca}, 18},
+    {1, "SKY", {0x56, 0x07, 0x2c, 0x95, 0xfa, 0xa7, 0x01, 0x25, 0x60, 0x59, 0xaa, 0x12, 0x26, 0x97, 0xb1, 0x33, 0xad, 0xed, 0x92, 0x79}, 18},
+    {1, "BLZ", {0x57, 0x32, 0x04, 0x6a, 0x88, 0x37, 0x04, 0x40, 0x4f, 0x28, 0x4c, 0xe4, 0x1f, 0xfa, 0xdd, 0x5b, 0x00, 0x7f, 0xd6, 0x68}, 18},
+    {1, "sUSD", {0x57, 0xab, 0x1e, 0xc2, 0x8d, 0x12, 0x97, 0x07, 0x05, 0x2d, 0xf4, 0xdf, 0x41, 0x8d, 0x58, 0xa2, 0xd4, 0x6d, 0x5f, 0x51}, 18},
+    {1, "POND", {0x57, 0xb9, 0x46, 0x00, 0x89, 0x13, 0xb8, 0x2e, 0x4d, 0xf8, 0x5f, 0x50, 0x1c, 0xba, 0xed, 0x91, 0x0e, 0x58, 0xd2, 0x6c}, 18},
+    {1, "ENA", {0x57, 0xe1, 0x14, 0xb6, 0x91, 0xdb, 0x79, 0x0c, 0x35, 0x20, 0x7b, 0x2e, 0x68, 0x5d, 0x4a, 0x43, 0x18, 0x1e, 0x60, 0x61}, 18},
+    {1, "LPT", {0x58, 0xb6, 0xa8, 0xa3, 0x30, 0x23, 0x69, 0xda, 0xec, 0x38, 0x33, 0x34, 0x67, 0x24, 0x04, 0xee, 0x73, 0x3a, 0xb2, 0x39}, 18},
+    {1, "MORPHO", {0x58, 0xd9, 0x7b, 0x57, 0xbb, 0x95, 0x32, 0x0f, 0x9a, 0x05, 0xdc, 0x91, 0x8a, 0xef, 0x65, 0x43, 0x49, 0x69, 0xc2, 0xb2}, 18},
+    {1, "APU", {0x59, 0x4d, 0xaa, 0xd7, 0xd7, 0x75, 0x92, 0xa2, 0xb9, 0x7b, 0x72, 0x5a, 0x7a, 0xd5, 0x9d, 0x7e, 0x18, 0x8b, 0x5b, 0xfa}, 18},
+    {1, "POWR", {0x59, 0x58, 0x32, 0xf8, 0xfc, 0x6b, 0xf5, 0x9c, 0x85, 0xc5, 0x27, 0xfe, 0xc3, 0x74, 0x0a, 0x1b, 0x7a, 0x36, 0x12, 0x69}, 6},
+    {1, "LDO", {0x5a, 0x98, 0xfc, 0xbe, 0xa5, 0x16, 0xcf, 0x06, 0x85, 0x72, 0x15, 0x77, 0x9f, 0xd8, 0x12, 0xca, 0x3b, 0xef, 0x1b, 0x32}, 18},
+    {1, "SAFE", {0x5a, 0xfe, 0x38, 0x55, 0x35, 0x8e, 0x11, 0x2b, 0x56, 0x47, 0xb9, 0x52, 0x70, 0x9e, 0x61, 0x65, 0xe1, 0xc1, 0xee, 0xee}, 18},
+    {1, "MXC", {0x5c, 0xa3, 0x81, 0xbb, 0xfb, 0x58, 0xf0, 0x09, 0x2d, 0xf1, 0x49, 0xbd, 0x3d, 0x24, 0x3b, 0x08, 0xb9, 0xa8, 0x38, 0x6e}, 18},
+    {1, "NKN", {0x5c, 0xf0, 0x47, 0x16, 0xba, 0x20, 0x12, 0x7f, 0x1e, 0x22, 0x97, 0xad, 0xdc, 0xf4, 0xb5, 0x03, 0x50, 0x00, 0xc9, 0xeb}, 18},
+    {1, "LUSD", {0x5f, 0x98, 0x80, 0x5a, 0x4e, 0x8b, 0xe2, 0x55, 0xa3, 0x28, 0x80, 0xfd, 0xec, 0x7f, 0x67, 0x28, 0xc6, 0x56, 0x8b, 0xa0}, 18},
+    {1, "GAL", {0x5f, 0xaa, 0x98, 0x9a, 0xf9, 0x6a, 0xf8, 0x53, 0x84, 0xb8, 0xa9, 0x38, 0xc2, 0xed, 0xe4, 0xa7, 0x37, 0x8d, 0x98, 0x75}, 18},
+    {1, "RLC", {0x60, 0x7f, 0x4c, 0x5b, 0xb6, 0x72, 0x23, 0x0e, 0x86, 0x72, 0x08, 0x55, 0x32, 0xf7, 0xe9, 0x01, 0x54, 0x4a, 0x73, 0x75}, 9},
+    {1, "RBN", {0x61, 0x23, 0xb0, 0x04, 0x9f, 0x90, 0x4d, 0x73, 0x0d, 0xb3, 0xc3, 0x6a, 0x31, 0x16, 0x7d, 0x9d, 0x41, 0x21, 0xfa, 0x6b}, 18},
+    {1, "LOKA", {0x61, 0xe9, 0x0a, 0x50, 0x13, 0x7e, 0x1f, 0x64, 0x5c, 0x9e, 0xf4, 0xa0, 0xd3, 0xa4, 0xf0, 0x14, 0x77, 0x73, 0x84, 0x06}, 18},
+    {1, "AIOZ", {0x62, 0x6e, 0x80, 0x36, 0xde, 0xb3, 0x33, 0xb4, 0x08, 0xbe, 0x46, 0x8f, 0x95, 0x1b, 0xdb, 0x42, 0x43, 0x3c, 0xbf, 0x18}, 18},
+    {1, "BEAM", {0x62, 0xd0, 0xa8, 0x45, 0x8e, 0xd7, 0x71, 0x9f, 0xda, 0xf9, 0x78, 0xfe, 0x59, 0x29, 0xc6, 0xd3, 0x42, 0xb0, 0xbf, 0xce}, 18},
+    {1, "SYRUP", {0x64, 0x3c, 0x4e, 0x15, 0xd7, 0xd6, 0x2a, 0xd0, 0xab, 0xec, 0x4a, 0x9b, 0xd4, 0xb0, 0x01, 0xaa, 0x3e, 0xf5, 0x2d, 0x66}, 18},
+    {1, "BIGTIME", {0x64, 0xbc, 0x2c, 0xa1, 0xbe, 0x49, 0x2b, 0xe7, 0x18, 0x5f, 0xaa, 0x2c, 0x88, 0x35, 0xd9, 0xb8, 0x24, 0xc8, 0xa1, 0x94}, 18},
+    {1, "ASH", {0x64, 0xd9, 0x1f, 0x12, 0xec, 0xe7, 0x36, 0x2f, 0x91, 0xa6, 0xf8, 0xe7, 0x94, 0x0c, 0xd5, 0x5f, 0x05, 0x06, 0x0b, 0x92}, 18},
+    {1, "MULTI", {0x65, 0xef, 0x70, 0x3f, 0x55, 0x94, 0xd2, 0x57, 0x3e, 0xb7, 0x1a, 0xaf, 0x55, 0xbc, 0x0c, 0xb5, 0x48, 0x49, 0x2d, 0xf4}, 18},
+    {1, "CPOOL", {0x66, 0x76, 0x1f, 0xa4, 0x13, 0x77, 0x00, 0x36, 0x22, 0xae, 0xe3, 0xc7, 0x67, 0x5f, 0xc7, 0xb5, 0xc1, 0xc2, 0xfa, 0xc5}, 18},
+    {1, "GNO", {0x68, 0x10, 0xe7, 0x76, 0x88, 0x0c, 0x02, 0x93, 0x3d, 0x47, 0xdb, 0x1b, 0x9f, 0xc0, 0x59, 0x08, 0xe5, 0x38, 0x6b, 0x96}, 18},
+    {1, "PEPE", {0x69, 0x82, 0x50, 0x81, 0x45, 0x45, 0x4c, 0xe3, 0x25, 0xdd, 0xbe, 0x47, 0xa2, 0x5d, 0x4e, 0xc3, 0xd2, 0x31, 0x19, 0x33}, 18},
+    {1, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {1, "MASK", {0x69, 0xaf, 0x81, 0xe7, 0x3a, 0x73, 0xb4, 0x0a, 0xdf, 0x4f, 0x3d, 0x42, 0x23, 0xcd, 0x9b, 0x1e, 0xce, 0x62, 0x30, 0x74}, 18},
+    {1, "ALI", {0x6b, 0x0b, 0x3a, 0x98, 0x2b, 0x46, 0x34, 0xac, 0x68, 0xdd, 0x83, 0xa4, 0xdb, 0xf0, 0x23, 0x11, 0xce, 0x32, 0x41, 0x81}, 18},
+    {1, "DAI", {0x6b, 0x17, 0x54, 0x74, 0xe8, 0x90, 0x94, 0xc4, 0x4d, 0xa9, 0x8b, 0x95, 0x4e, 0xed, 0xea, 0xc4, 0x95, 0x27, 0x1d, 0x0f}, 18},
+    {1, "SUSHI", {0x6b, 0x35, 0x95, 0x06, 0x87, 0x78, 0xdd, 0x59, 0x2e, 0x39, 0xa1, 0x22, 0xf4, 0xf5, 0xa5, 0xcf, 0x09, 0xc9, 0x0f, 0xe2}, 18},
+    {1, "QUICK", {0x6c, 0x28, 0xae, 0xf8, 0x97, 0x7c, 0x9b, 0x77, 0x39, 0x96, 0xd0, 0xe8, 0x37, 0x6d, 0x2e, 0xe3, 0x79, 0x44, 0x6f, 0x2f}, 18},
+    {1, "PYUSD", {0x6c, 0x3e, 0xa9, 0x03, 0x64, 0x06, 0x85, 0x20, 0x06, 0x29, 0x07, 0x70, 0xbe, 0xdf, 0xca, 0xba, 0x0e, 0x23, 0xa0, 0xe8}, 6},
+    {1, "RNDR", {0x6d, 0xe0, 0x37, 0xef, 0x9a, 0xd2, 0x72, 0x5e, 0xb4, 0x01, 0x18, 0xbb, 0x17, 0x02, 0xeb, 0xb2, 0x7e, 0x4a, 0xeb, 0x24}, 18},
+    {1, "LQTY", {0x6d, 0xea, 0x81, 0xc8, 0x17, 0x1d, 0x0b, 0xa5, 0x74, 0x75, 0x4e, 0xf6, 0xf8, 0xb4, 0x12, 0xf2, 0xed, 0x88, 0xc5, 0x4d}, 18},
+    {1, "ARKM", {0x6e, 0x2a, 0x43, 0xbe, 0x0b, 0x1d, 0x33, 0xb7, 0x26, 0xf0, 0xca, 0x3b, 0x8d, 0xe6, 0x0b, 0x34, 0x82, 0xb8, 0xb0, 0x50}, 18},
+    {1, "ORCA", {0x6f, 0x59, 0xe0, 0x46, 0x1a, 0xe5, 0xe2, 0x79, 0x9f, 0x1f, 0xb3, 0x84, 0x7f, 0x05, 0xa6, 0x3b, 0x16, 0xd0, 0xdb, 0xf8}, 18},
+    {1, "IOTX", {0x6f, 0xb3, 0xe0, 0xa2, 0x17, 0x40, 0x7e, 0xff, 0xf7, 0xca, 0x06, 0x2d, 0x46, 0xc2, 0x6e, 0x5d, 0x60, 0xa1, 0x4d, 0x69}, 18},
+    {1, "UPI", {0x70, 0xd2, 0xb7, 0xc1, 0x93, 0x52, 0xbb, 0x76, 0xe4, 0x40, 0x98, 0x58, 0xff, 0x57, 0x46, 0xe5, 0x00, 0xf2, 0xb6, 0x7c}, 18},
+    {1, "XSGD", {0x70, 0xe8, 0xde, 0x73, 0xce, 0x53, 0x8d, 0xa2, 0xbe, 0xed, 0x35, 0xd1, 0x41, 0x87, 0xf6, 0x95, 0x9a, 0x8e, 0xca, 0x96}, 6},
+    {1, "HIGH", {0x71, 0xab, 0x77, 0xb7, 0xdb, 0xb4, 0xfa, 0x7e, 0x01, 0x7b, 0xc1, 0x50, 0x90, 0xb2, 0x16, 0x32, 0x21, 0x42, 0x02, 0x82}, 18},
+    {1, "JASMY", {0x74, 0x20, 0xb4, 0xb9, 0xa0, 0x11, 0x0c, 0xdc, 0x71, 0xfb, 0x72, 0x09, 0x08, 0x34, 0x0c, 0x03, 0xf9, 0xbc, 0x03, 0xec}, 18},
+    {1, "SNT", {0x74, 0x4d, 0x70, 0xfd, 0xbe, 0x2b, 0xa4, 0xcf, 0x95, 0x13, 0x16, 0x26, 0x61, 0x4a, 0x17, 0x63, 0xdf, 0x80, 0x5b, 0x9e}, 18},
+    {1, "PIRATE", {0x76, 0x13, 0xc4, 0x8e, 0x0c, 0xd5, 0x0e, 0x42, 0xdd, 0x9b, 0xf0, 0xf6, 0xc2, 0x35, 0x06, 0x31, 0x45, 0xf6, 0xf8, 0xdc}, 18},
+    {1, "ELON", {0x76, 0x1d, 0x38, 0xe5, 0xdd, 0xf6, 0xcc, 0xf6, 0xcf, 0x7c, 0x55, 0x75, 0x9d, 0x52, 0x10, 0x75, 0x0b, 0x5d, 0x60, 0xf3}, 18},
+    {1, "ILV", {0x76, 0x7f, 0xe9, 0xed, 0xc9, 0xe0, 0xdf, 0x98, 0xe0, 0x74, 0x54, 0x84, 0x79, 0x09, 0xb5, 0xe9, 0x59, 0xd7, 0xca, 0x0e}, 18},
+    {1, "FORTH", {0x77, 0xfb, 0xa1, 0x79, 0xc7, 0x9d, 0xe5, 0xb7, 0x65, 0x3f, 0x68, 0xb5, 0x03, 0x9a, 0xf9, 0x40, 0xad, 0xa6, 0x0c, 0xe0}, 18},
+    {1, "BTRST", {0x79, 0x9e, 0xbf, 0xab, 0xe7, 0x7a, 0x6e, 0x34, 0x31, 0x1e, 0xee, 0xe9, 0x82, 0x51, 0x90, 0xb9, 0xec, 0xe3, 0x28, 0x24}, 18},
+    {1, "CXT", {0x7a, 0xbc, 0x8a, 0x57, 0x68, 0xe6, 0xbe, 0x61, 0xa6, 0xc6, 0x93, 0xa6, 0xe4, 0xea, 0xcb, 0x5b, 0x60, 0x60, 0x2c, 0x4d}, 18},
+    {1, "SHPING", {0x7c, 0x84, 0xe6, 0x28, 0x59, 0xd0, 0x71, 0x5e, 0xb7, 0x7d, 0x1b, 0x1c, 0x41, 0x54, 0xec, 0xd6, 0xab, 0xb2, 0x1b, 0xec}, 18},
+    {1, "MATIC", {0x7d, 0x1a, 0xfa, 0x7b, 0x71, 0x8f, 0xb8, 0x93, 0xdb, 0x30, 0xa3, 0xab, 0xc0, 0xcf, 0xc6, 0x08, 0xaa, 0xcf, 0xeb, 0xb0}, 18},
+    {1, "GLM", {0x7d, 0xd9, 0xc5, 0xcb, 0xa0, 0x5e, 0x15, 0x1c, 0x89, 0x5f, 0xde, 0x1c, 0xf3, 0x55, 0xc9, 0xa1, 0xd5, 0xda, 0x64, 0x29}, 18},
+    {1, "AAVE", {0x7f, 0xc6, 0x65, 0x00, 0xc8, 0x4a, 0x76, 0xad, 0x7e, 0x9c, 0x93, 0x43, 0x7b, 0xfc, 0x5a, 0xc3, 0x3e, 0x2d, 0xda, 0xe9}, 18},
+    {1, "CLV", {0x80, 0xc6, 0x2f, 0xe4, 0x48, 0x7e, 0x13, 0x51, 0xb4, 0x7b, 0xa4, 0x98, 0x09, 0xeb, 0xd6, 0x0e, 0xd0, 0x85, 0xbf, 0x52}, 18},
+    {1, "MDT", {0x81, 0x4e, 0x09, 0x08, 0xb1, 0x2a, 0x99, 0xfe, 0xcf, 0x5b, 0xc1, 0x01, 0xbb, 0x5d, 0x0b, 0x8b, 0x5c, 0xdf, 0x7d, 0x26}, 18},
+    {1, "OGN", {0x82, 0x07, 0xc1, 0xff, 0xc5, 0xb6, 0x80, 0x4f, 0x60, 0x24, 0x32, 0x2c, 0xcf, 0x34, 0xf2, 0x9c, 0x35, 0x41, 0xae, 0x26}, 18},
+    {1, "ANKR", {0x82, 0x90, 0x33, 0x3c, 0xef, 0x9e, 0x6d, 0x52, 0x8d, 0xd5, 0x61, 0x8f, 0xb9, 0x7a, 0x76, 0xf2, 0x68, 0xf3, 0xed, 0xd4}, 18},
+    {1, "POLS", {0x83, 0xe6, 0xf1, 0xe4, 0x1c, 0xdd, 0x28, 0xea, 0xce, 0xb2, 0x0c, 0xb6, 0x49, 0x15, 0x50, 0x49, 0xfa, 0xc3, 0xd5, 0xaa}, 18},
+    {1, "AVT", {0x84, 0x55, 0x76, 0xc6, 0x4f, 0x97, 0x54, 0xcf, 0x09, 0xd8, 0x7e, 0x45, 0xb7, 0x20, 0xe8, 0x2f, 0x3e, 0xef, 0x52, 0x2c}, 18},
+    {1, "ALT", {0x84, 0x57, 0xca, 0x50, 0x40, 0xad, 0x67, 0xfd, 0xeb, 0xbc, 0xc8, 0xed, 0xce, 0x88, 0x9a, 0x33, 0x5b, 0xc0, 0xfb, 0xfb}, 18},
+    {1, "DIA", {0x84, 0xca, 0x8b, 0xc7, 0x99, 0x72, 0x72, 0xc7, 0xcf, 0xb4, 0xd0, 0xcd, 0x3d, 0x55, 0xcd, 0x94, 0x2b, 0x3c, 0x94, 0x19}, 18},
+    {1, "FRAX", {0x85, 0x3d, 0x95, 0x5a, 0xce, 0xf8, 0x22, 0xdb, 0x05, 0x8e, 0xb8, 0x50, 0x59, 0x11, 0xed, 0x77, 0xf1, 0x75, 0xb9, 0x9e}, 18},
+    {1, "KEEP", {0x85, 0xee, 0xe3, 0x0c, 0x52, 0xb0, 0xb3, 0x79, 0xb0, 0x46, 0xfb, 0x0f, 0x85, 0xf4, 0xf3, 0xdc, 0x30, 0x09, 0xaf, 0xec}, 18},
+    {1, "TLM", {0x88, 0x88, 0x88, 0x84, 0x8b, 0x65, 0x2b, 0x3e, 0x3a, 0x0f, 0x34, 0xc9, 0x6e, 0x00, 0xee, 0xc0, 0xf3, 0xa2, 0x3f, 0x72}, 4},
+    {1, "L3", {0x88, 0x90, 0x9d, 0x48, 0x96, 0x78, 0xdd, 0x17, 0xaa, 0x6d, 0x96, 0x09, 0xf8, 0x9b, 0x04, 0x19, 0xbf, 0x78, 0xfd, 0x9a}, 18},
+    {1, "TRB", {0x88, 0xdf, 0x59, 0x2f, 0x8e, 0xb5, 0xd7, 0xbd, 0x38, 0xbf, 0xef, 0x7d, 0xeb, 0x0f, 0xbc, 0x02, 0xcf, 0x37, 0x78, 0xa0}, 18},
+    {1, "CHR", {0x8a, 0x22, 0x79, 0xd4, 0xa9, 0x0b, 0x6f, 0xe1, 0xc4, 0xb3, 0x0f, 0xa6, 0x60, 0xcc, 0x9f, 0x92, 0x67, 0x97, 0xba, 0xa2}, 6},
+    {1, "FX", {0x8c, 0x15, 0xef, 0x5b, 0x4b, 0x21, 0x95, 0x1d, 0x50, 0xe5, 0x3e, 0x4f, 0xbd, 0xa8, 0x29, 0x8f, 0xfa, 0xd2, 0x50, 0x57}, 18},
+    {1, "SXP", {0x8c, 0xe9, 0x13, 0x7d, 0x39, 0x32, 0x6a, 0xd0, 0xcd, 0x64, 0x91, 0xfb, 0x5c, 0xc0, 0xcb, 0xa0, 0xe0, 0x89, 0xb6, 0xa9}, 18},
+    {1, "EURQ", {0x8d, 0xf7, 0x23, 0x29, 0x52, 0x14, 0xea, 0x6f, 0x21, 0x02, 0x6e, 0xee, 0xb4, 0x38, 0x2d, 0x47, 0x5f, 0x14, 0x6f, 0x9f}, 6},
+    {1, "USDP", {0x8e, 0x87, 0x0d, 0x67, 0xf6, 0x60, 0xd9, 0x5d, 0x5b, 0xe5, 0x30, 0x38, 0x0d, 0x0e, 0xc0, 0xbd, 0x38, 0x82, 0x89, 0xe1}, 18},
+    {1, "REQ", {0x8f, 0x82, 0x21, 0xaf, 0xbb, 0x33, 0x99, 0x8d, 0x85, 0x84, 0xa2, 0xb0, 0x57, 0x49, 0xba, 0x73, 0xc3, 0x7a, 0x93, 0x8a}, 18},
+    {1, "AERGO", {0x91, 0xaf, 0x0f, 0xbb, 0x28, 0xab, 0xa7, 0xe3, 0x14, 0x03, 0xcb, 0x45, 0x71, 0x06, 0xce, 0x79, 0x39, 0x7f, 0xd4, 0xe6}, 18},
+    {1, "DYDX", {0x92, 0xd6, 0xc1, 0xe3, 0x1e, 0x14, 0x52, 0x0e, 0x67, 0x6a, 0x68, 0x7f, 0x0a, 0x93, 0x78, 0x8b, 0x71, 0x6b, 0xef, 0xf5}, 18},
+    {1, "MC", {0x94, 0x9d, 0x48, 0xec, 0xa6, 0x7b, 0x17, 0x26, 0x96, 0x29, 0xc7, 0x19, 0x4f, 0x4b, 0x72, 0x7d, 0x4e, 0xf9, 0xe5, 0xd6}, 18},
+    {1, "SHIB", {0x95, 0xad, 0x61, 0xb0, 0xa1, 0x50, 0xd7, 0x92, 0x19, 0xdc, 0xf6, 0x4e, 0x1e, 0x6c, 0xc0, 0x1f, 0x0b, 0x64, 0xc4, 0xce}, 18},
+    {1, "DYP", {0x96, 0x1c, 0x8c, 0x0b, 0x1a, 0xad, 0x0c, 0x0b, 0x10, 0xa5, 0x1f, 0xef, 0x6a, 0x86, 0x7e, 0x30, 0x91, 0xbc, 0xef, 0x17}, 18},
+    {1, "KUJI", {0x96, 0x54, 0x3e, 0xf8, 0xd2, 0xc7, 0x5c, 0x26, 0x38, 0x7c, 0x1a, 0x31, 0x9a, 0xe6, 0x9c, 0x0b, 0xee, 0x6f, 0x3f, 0xe7}, 6},
+    {1, "OCEAN", {0x96, 0x7d, 0xa4, 0x04, 0x8c, 0xd0, 0x7a, 0xb3, 0x78, 0x55, 0xc0, 0x90, 0xaa, 0xf3, 0x66, 0xe4, 0xce, 0x1b, 0x9f, 0x48}, 18},
+    {1, "POLY", {0x99, 0x92, 0xec, 0x3c, 0xf6, 0xa5, 0x5b, 0x00, 0x97, 0x8c, 0xdd, 0xf2, 0xb2, 0x7b, 0xc6, 0x88, 0x2d, 0x88, 0xd1, 0xec}, 18},
+    {1, "MIM", {0x99, 0xd8, 0xa9, 0xc4, 0x5b, 0x2e, 0xca, 0x88, 0x64, 0x37, 0x3a, 0x26, 0xd1, 0x45, 0x9e, 0x3d, 0xff, 0x1e, 0x17, 0xf3}, 18},
+    {1, "QSP", {0x99, 0xea, 0x4d, 0xb9, 0xee, 0x77, 0xac, 0xd4, 0x0b, 0x11, 0x9b, 0xd1, 0xdc, 0x4e, 0x33, 0xe1, 0xc0, 0x70, 0xb8, 0x0d}, 18},
+    {1, "G", {0x9c, 0x7b, 0xeb, 0xa8, 0xf6, 0xef, 0x66, 0x43, 0xab, 0xd7, 0x25, 0xe4, 0x5a, 0x4e, 0x83, 0x87, 0xef, 0x26, 0x06, 0x49}, 18},
+    {1, "METIS", {0x9e, 0x32, 0xb1, 0x3c, 0xe7, 0xf2, 0xe8, 0x0a, 0x01, 0x93, 0x2b, 0x42, 0x55, 0x36, 0x52, 0xe0, 0x53, 0xd6, 0xed, 0x8e}, 18},
+    {1, "NCT", {0x9e, 0x46, 0xa3, 0x8f, 0x5d, 0xaa, 0xbe, 0x86, 0x83, 0xe1, 0x07, 0x93, 0xb0, 0x67, 0x49, 0xee, 0xf7, 0xd7, 0x33, 0xd1}, 18},
+    {1, "MKR", {0x9f, 0x8f, 0x72, 0xaa, 0x93, 0x04, 0xc8, 0xb5, 0x93, 0xd5, 0x55, 0xf1, 0x2e, 0xf6, 0x58, 0x9c, 0xc3, 0xa5, 0x79, 0xa2}, 18},
+    {1, "FARM", {0xa0, 0x24, 0x6c, 0x90, 0x32, 0xbc, 0x3a, 0x60, 0x08, 0x20, 0x41, 0x5a, 0xe6, 0x00, 0xc6, 0x38, 0x86, 0x19, 0xa1, 0x4d}, 18},
+    {1, "CRO", {0xa0, 0xb7, 0x3e, 0x1f, 0xf0, 0xb8, 0x09, 0x14, 0xab, 0x6f, 0xe0, 0x44, 0x4e, 0x65, 0x84, 0x8c, 0x4c, 0x34, 0x45, 0x0b}, 8},
+    {1, "USDC", {0xa0, 0xb8, 0x69, 0x91, 0xc6, 0x21, 0x8b, 0x36, 0xc1, 0xd1, 0x9d, 0x4a, 0x2e, 0x9e, 0xb0, 0xce, 0x36, 0x06, 0xeb, 0x48}, 6},
+    {1, "ANT", {0xa1, 0x17, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xd8, 0x1a, 0x1d, 0x3c, 0xc7, 0x54, 0x30, 0xfa, 0xa0, 0x17, 0xfa, 0x5a, 0x2e}, 18},
+    {1, "YFII", {0xa1, 0xd0, 0xe2, 0x15, 0xa2, 0x3d, 0x70, 0x30, 0x84, 0x2f, 0xc6, 0x7c, 0xe5, 0x82, 0xa6, 0xaf, 0xa3, 0xcc, 0xab, 0x83}, 18},
+    {1, "ALPHA", {0xa1, 0xfa, 0xa1, 0x13, 0xcb, 0xe5, 0x34, 0x36, 0xdf, 0x28, 0xff, 0x0a, 0xee, 0x54, 0x27, 0x5c, 0x13, 0xb4, 0x09, 0x75}, 18},
+    {1, "ATA", {0xa2, 0x12, 0x0b, 0x9e, 0x67, 0x4d, 0x3f, 0xc3, 0x87, 0x5f, 0x41, 0x5a, 0x7d, 0xf5, 0x2e, 0x38, 0x2f, 0x14, 0x12, 0x25}, 18},
+    {1, "XCN", {0xa2, 0xcd, 0x3d, 0x43, 0xc7, 0x75, 0x97, 0x8a, 0x96, 0xbd, 0xbf, 0x12, 0xd7, 0x33, 0xd5, 0xa1, 0xed, 0x94, 0xfb, 0x18}, 18},
+    {1, "TURBO", {0xa3, 0x59, 0x23, 0x16, 0x2c, 0x49, 0xcf, 0x95, 0xe6, 0xbf, 0x26, 0x62, 0x33, 0x85, 0xeb, 0x43, 0x1a, 0xd9, 0x20, 0xd3}, 18},
+    {1, "LOOM", {0xa4, 0xe8, 0xc3, 0xec, 0x45, 0x61, 0x07, 0xea, 0x67, 0xd3, 0x07, 0x5b, 0xf9, 0xe3, 0xdf, 0x3a, 0x75, 0x82, 0x3d, 0xb0}, 18},
+    {1, "RBC", {0xa4, 0xee, 0xd6, 0x3d, 0xb8, 0x53, 0x11, 0xe2, 0x2d, 0xf4, 0x47, 0x3f, 0x87, 0xcc, 0xfc, 0x3d, 0xad, 0xcf, 0xa3, 0xe3}, 18},
+    {1, "AUCTION", {0xa9, 0xb1, 0xeb, 0x59, 0x08, 0xcf, 0xc3, 0xcd, 0xf9, 0x1f, 0x9b, 0x8b, 0x3a, 0x74, 0x10, 0x85, 0x98, 0x00, 0x90, 0x96}, 18},
+    {1, "TRAC", {0xaa, 0x7a, 0x9c, 0xa8, 0x7d, 0x36, 0x94, 0xb5, 0x75, 0x5f, 0x21, 0x3b, 0x5d, 0x04, 0x09, 0x4b, 0x8d, 0x0f, 0x0a, 0x6f}, 18},
+    {1, "MOG", {0xaa, 0xee, 0x1a, 0x97, 0x23, 0xaa, 0xdb, 0x7a, 0xfa, 0x28, 0x10, 0x26, 0x36, 0x53, 0xa3, 0x4b, 0xa2, 0xc2, 0x1c, 0x7a}, 18},
+    {1, "ALICE", {0xac, 0x51, 0x06, 0x6d, 0x7b, 0xec, 0x65, 0xdc, 0x45, 0x89, 0x36, 0x8d, 0xa3, 0x68, 0xb2, 0x12, 0x74, 0x5d, 0x63, 0xe8}, 6},
+    {1, "ADX", {0xad, 0xe0, 0x0c, 0x28, 0x24, 0x4d, 0x5c, 0xe1, 0x7d, 0x72, 0xe4, 0x03, 0x30, 0xb1, 0xc3, 0x18, 0xcd, 0x12, 0xb7, 0xc3}, 18},
+    {1, "C98", {0xae, 0x12, 0xc5, 0x93, 0x08, 0x81, 0xc5, 0x37, 0x15, 0xb3, 0x69, 0xce, 0xc7, 0x60, 0x6b, 0x70, 0xd8, 0xeb, 0x22, 0x9f}, 18},
+    {1, "MV", {0xae, 0x78, 0x8f, 0x80, 0xf2, 0x75, 0x6a, 0x86, 0xaa, 0x2f, 0x41, 0x0c, 0x65, 0x1f, 0x2a, 0xf8, 0x36, 0x39, 0xb9, 0x5b}, 18},
+    {1, "FET", {0xae, 0xa4, 0x6a, 0x60, 0x36, 0x8a, 0x7b, 0xd0, 0x60, 0xee, 0xc7, 0xdf, 0x8c, 0xba, 0x43, 0xb7, 0xef, 0x41, 0xad, 0x85}, 18},
+    {1, "STG", {0xaf, 0x51, 0x91, 0xb0, 0xde, 0x27, 0x8c, 0x72, 0x86, 0xd6, 0xc7, 0xcc, 0x6a, 0xb6, 0xbb, 0x8a, 0x73, 0xba, 0x2c, 0xd6}, 18},
+    {1, "MEME", {0xb1, 0x31, 0xf4, 0xa5, 0x59, 0x07, 0xb1, 0x0d, 0x1f, 0x0a, 0x50, 0xd8, 0xab, 0x8f, 0xa0, 0x9e, 0xc3, 0x42, 0xcd, 0x74}, 18},
+    {1, "PRIME", {0xb2, 0x3d, 0x80, 0xf5, 0xfe, 0xfc, 0xdd, 0xaa, 0x21, 0x22, 0x12, 0xf0, 0x28, 0x02, 0x1b, 0x41, 0xde, 0xd4, 0x28, 0xcf}, 18},
+    {1, "HFT", {0xb3, 0x99, 0x9f, 0x65, 0x8c, 0x03, 0x91, 0xd9, 0x4a, 0x37, 0xf7, 0xff, 0x32, 0x8f, 0x3f, 0xec, 0x94, 0x2b, 0xca, 0xdc}, 18},
+    {1, "ARB", {0xb5, 0x07, 0x21, 0xbc, 0xf8, 0xd6, 0x64, 0xc3, 0x04, 0x12, 0xcf, 0xbc, 0x6c, 0xf7, 0xa1, 0x51, 0x45, 0x23, 0x4a, 0xd1}, 18},
+    {1, "AEVO", {0xb5, 0x28, 0xed, 0xbe, 0xf0, 0x13, 0xaf, 0xf8, 0x55, 0xac, 0x3c, 0x50, 0xb3, 0x81, 0xf2, 0x53, 0xaf, 0x13, 0xb9, 0x97}, 18},
+    {1, "LIT", {0xb5, 0x94, 0x90, 0xab, 0x09, 0xa0, 0xf5, 0x26, 0xcc, 0x73, 0x05, 0x82, 0x2a, 0xc6, 0x5f, 0x2a, 0xb1, 0x2f, 0x97, 0x23}, 18},
+    {1, "STORJ", {0xb6, 0x4e, 0xf5, 0x1c, 0x88, 0x89, 0x72, 0xc9, 0x08, 0xcf, 0xac, 0xf5, 0x9b, 0x47, 0xc1, 0xaf, 0xbc, 0x0a, 0xb8, 0xac}, 8},
+    {1, "MUSE", {0xb6, 0xca, 0x73, 0x99, 0xb4, 0xf9, 0xca, 0x56, 0xfc, 0x27, 0xcb, 0xff, 0x44, 0xf4, 0xd2, 0xe4, 0xee, 0xf1, 0xfc, 0x81}, 18},
+    {1, "IDEX", {0xb7, 0x05, 0x26, 0x82, 0x13, 0xd5, 0x93, 0xb8, 0xfd, 0x88, 0xd3, 0xfd, 0xef, 0xf9, 0x3a, 0xff, 0x5c, 0xbd, 0xcf, 0xae}, 18},
+    {1, "ABT", {0xb9, 0x8d, 0x4c, 0x97, 0x42, 0x5d, 0x99, 0x08, 0xe6, 0x6e, 0x53, 0xa6, 0xfd, 0xf6, 0x73, 0xac, 0xca, 0x0b, 0xe9, 0x86}, 18},
+    {1, "BAL", {0xba, 0x10, 0x00, 0x00, 0x62, 0x5a, 0x37, 0x54, 0x42, 0x39, 0x78, 0xa6, 0x0c, 0x93, 0x17, 0xc5, 0x8a, 0x42, 0x4e, 0x3d}, 18},
+    {1, "BAND", {0xba, 0x11, 0xd0, 0x0c, 0x5f, 0x74, 0x25, 0x5f, 0x56, 0xa5, 0xe3, 0x66, 0xf4, 0xf7, 0x7f, 0x5a, 0x18, 0x6d, 0x7f, 0x55}, 18},
+    {1, "ARPA", {0xba, 0x50, 0x93, 0x3c, 0x26, 0x8f, 0x56, 0x7b, 0xdc, 0x86, 0xe1, 0xac, 0x13, 0x1b, 0xe0, 0x72, 0xc6, 0xb0, 0xb7, 0x1a}, 18},
+    {1, "RARE", {0xba, 0x5b, 0xde, 0x66, 0x2c, 0x17, 0xe2, 0xad, 0xff, 0x10, 0x75, 0x61, 0x03, 0x82, 0xb9, 0xb6, 0x91, 0x29, 0x63, 0x50}, 18},
+    {1, "AXS", {0xbb, 0x0e, 0x17, 0xef, 0x65, 0xf8, 0x2a, 0xb0, 0x18, 0xd8, 0xed, 0xd7, 0x76, 0xe8, 0xdd, 0x94, 0x03, 0x27, 0xb2, 0x8b}, 18},
+    {1, "LRC", {0xbb, 0xbb, 0xca, 0x6a, 0x90, 0x1c, 0x92, 0x6f, 0x24, 0x0b, 0x89, 0xea, 0xcb, 0x64, 0x1d, 0x8a, 0xec, 0x7a, 0xea, 0xfd}, 18},
+    {1, "ERN", {0xbb, 0xc2, 0xae, 0x13, 0xb2, 0x3d, 0x71, 0x5c, 0x30, 0x72, 0x0f, 0x07, 0x9f, 0xcd, 0x9b, 0x4a, 0x74, 0x09, 0x35, 0x05}, 18},
+    {1, "PERP", {0xbc, 0x39, 0x66, 0x89, 0x89, 0x3d, 0x06, 0x5f, 0x41, 0xbc, 0x2c, 0x6e, 0xcb, 0xee, 0x5e, 0x00, 0x85, 0x23, 0x34, 0x47}, 18},
+    {1, "ATH", {0xbe, 0x0e, 0xd4, 0x13, 0x81, 0x21, 0xec, 0xfc, 0x5c, 0x0e, 0x56, 0xb4, 0x05, 0x17, 0xda, 0x27, 0xe6, 0xc5, 0x22, 0x6b}, 18},
+    {1, "cbETH", {0xbe, 0x98, 0x95, 0x14, 0x6f, 0x7a, 0xf4, 0x30, 0x49, 0xca, 0x1c, 0x1a, 0xe3, 0x58, 0xb0, 0x54, 0x1e, 0xa4, 0x97, 0x04}, 18},
+    {1, "COMP", {0xc0, 0x0e, 0x94, 0xcb, 0x66, 0x2c, 0x35, 0x20, 0x28, 0x2e, 0x6f, 0x57, 0x17, 0x21, 0x40, 0x04, 0xa7, 0xf2, 0x68, 0x88}, 18},
+    {1, "SNX", {0xc0, 0x11, 0xa7, 0x3e, 0xe8, 0x57, 0x6f, 0xb4, 0x6f, 0x5e, 0x1c, 0x57, 0x51, 0xca, 0x3b, 0x9f, 0xe0, 0xaf, 0x2a, 0x6f}, 18},
+    {1, "WETH", {0xc0, 0x2a, 0xaa, 0x39, 0xb2, 0x23, 0xfe, 0x8d, 0x0a, 0x0e, 0x5c, 0x4f, 0x27, 0xea, 0xd9, 0x08, 0x3c, 0x75, 0x6c, 0xc2}, 18},
+    {1, "GYEN", {0xc0, 0x85, 0x12, 0x92, 0x7d, 0x12, 0x34, 0x8f, 0x66, 0x20, 0xa6, 0x98, 0x10, 0x5e, 0x1b, 0xaa, 0xc6, 0xec, 0xd9, 0x11}, 6},
+    {1, "ENS", {0xc1, 0x83, 0x60, 0x21, 0x7d, 0x8f, 0x7a, 0xb5, 0xe7, 0xc5, 0x16, 0x56, 0x67, 0x61, 0xea, 0x12, 0xce, 0x7f, 0x9d, 0x72}, 18},
+    {1, "PAX", {0xc1, 0xd2, 0x04, 0xd7, 0x78, 0x61, 0xde, 0xf4, 0x9b, 0x6e, 0x76, 0x93, 0x47, 0xa8, 0x83, 0xb1, 0x5e, 0xc3, 0x97, 0xff}, 18},
+    {1, "WCFG", {0xc2, 0x21, 0xb7, 0xe6, 0x5f, 0xfc, 0x80, 0xde, 0x23, 0x4b, 0xbb, 0x66, 0x67, 0xab, 0xdd, 0x46, 0x59, 0x3d, 0x34, 0xf0}, 18},
+    {1, "TRIBE", {0xc7, 0x28, 0x3b, 0x66, 0xeb, 0x1e, 0xb5, 0xfb, 0x86, 0x32, 0x7f, 0x08, 0xe1, 0xb5, 0x81, 0x6b, 0x07, 0x20, 0x21, 0x2b}, 18},
+    {1, "FOX", {0xc7, 0x70, 0xee, 0xfa, 0xd2, 0x04, 0xb5, 0x18, 0x0d, 0xf6, 0xa1, 0x4e, 0xe1, 0x97, 0xd9, 0x9d, 0x80, 0x8e, 0xe5, 0x2d}, 18},
+    {1, "USDQ", {0xc8, 0x3e, 0x27, 0xf2, 0x70, 0xcc, 0xe0, 0xa3, 0xa3, 0xa2, 0x95, 0x21, 0x17, 0x3a, 0x83, 0xf4, 0x02, 0xc1, 0x76, 0x8b}, 6},
+    {1, "GRT", {0xc9, 0x44, 0xe9, 0x0c, 0x64, 0xb2, 0xc0, 0x76, 0x62, 0xa2, 0x92, 0xbe, 0x62, 0x44, 0xbd, 0xf0, 0x5c, 0xda, 0x44, 0xa7}, 18},
+    {1, "STRK", {0xca, 0x14, 0x00, 0x7e, 0xff, 0x0d, 0xb1, 0xf8, 0x13, 0x5f, 0x4c, 0x25, 0xb3, 0x4d, 0xe4, 0x9a, 0xb0, 0xd4, 0x27, 0x66}, 18},
+    {1, "cbBTC", {0xcb, 0xb7, 0xc0, 0x00, 0x0a, 0xb8, 0x8b, 0x47, 0x3b, 0x1f, 0x5a, 0xfd, 0x9e, 0xf8, 0x08, 0x44, 0x0e, 0xed, 0x33, 0xbf}, 8},
+    {1, "SLP", {0xcc, 0x8f, 0xa2, 0x25, 0xd8, 0x0b, 0x9c, 0x7d, 0x42, 0xf9, 0x6e, 0x95, 0x70, 0x15, 0x6c, 0x65, 0xd6, 0xca, 0xaa, 0x25}, 0},
+    {1, "GODS", {0xcc, 0xc8, 0xcb, 0x52, 0x29, 0xb0, 0xac, 0x80, 0x69, 0xc5, 0x1f, 0xd5, 0x83, 0x67, 0xfd, 0x1e, 0x62, 0x2a, 0xfd, 0x97}, 18},
+    {1, "T", {0xcd, 0xf7, 0x02, 0x8c, 0xea, 0xb8, 0x1f, 0xa0, 0xc6, 0x97, 0x12, 0x08, 0xe8, 0x3f, 0xa7, 0x87, 0x29, 0x94, 0xbe, 0xe5}, 18},
+    {1, "FLOKI", {0xcf, 0x0c, 0x12, 0x2c, 0x6b, 0x73, 0xff, 0x80, 0x9c, 0x69, 0x3d, 0xb7, 0x61, 0xe7, 0xba, 0xeb, 0xe6, 0x2b, 0x6a, 0x2e}, 9},
+    {1, "TVK", {0xd0, 0x84, 0xb8, 0x3c, 0x30, 0x5d, 0xaf, 0xd7, 0x6a, 0xe3, 0xe1, 0xb4, 0xe1, 0xf1, 0xfe, 0x2e, 0xcc, 0xcb, 0x39, 0x88}, 18},
+    {1, "LRDS", {0xd0, 0xa6, 0x05, 0x3f, 0x08, 0x7e, 0x87, 0xa2, 0x5d, 0xc6, 0x07, 0x01, 0xba, 0x6e, 0x66, 0x3b, 0x1a, 0x54, 0x8e, 0x85}, 18},
+    {1, "GALA", {0xd1, 0xd2, 0xeb, 0x1b, 0x1e, 0x90, 0xb6, 0x38, 0x58, 0x87, 0x28, 0xb4, 0x13, 0x01, 0x37, 0xd2, 0x62, 0xc8, 0x7c, 0xae}, 8},
+    {1, "OMG", {0xd2, 0x61, 0x14, 0xcd, 0x6e, 0xe2, 0x89, 0xac, 0xcf, 0x82, 0x35, 0x0c, 0x8d, 0x84, 0x87, 0xfe, 0xdb, 0x8a, 0x0c, 0x07}, 18},
+    {1, "RGT", {0xd2, 0x91, 0xe7, 0xa0, 0x32, 0x83, 0x64, 0x0f, 0xdc, 0x51, 0xb1, 0x21, 0xac, 0x40, 0x13, 0x83, 0xa4, 0x6c, 0xc6, 0x23}, 18},
+    {1, "SOL", {0xd3, 0x1a, 0x59, 0xc8, 0x5a, 0xe9, 0xd8, 0xed, 0xef, 0xec, 0x41, 0x1d, 0x44, 0x8f, 0x90, 0x84, 0x15, 0x71, 0xb8, 0x9c}, 9},
+    {1, "CQT", {0xd4, 0x17, 0x14, 0x43, 0x12, 0xdb, 0xf5, 0x04, 0x65, 0xb1, 0xc6, 0x41, 0xd0, 0x16, 0x96, 0x20, 0x17, 0xef, 0x62, 0x40}, 18},
+    {1, "CRV", {0xd5, 0x33, 0xa9, 0x49, 0x74, 0x0b, 0xb3, 0x30, 0x6d, 0x11, 0x9c, 0xc7, 0x77, 0xfa, 0x90, 0x0b, 0xa0, 0x34, 0xcd, 0x52}, 18},
+    {1, "PLU", {0xd8, 0x91, 0x2c, 0x10, 0x68, 0x1d, 0x8b, 0x21, 0xfd, 0x37, 0x42, 0x24, 0x4f, 0x44, 0x65, 0x8d, 0xba, 0x12, 0x26, 0x4e}, 18},
+    {1, "EUL", {0xd9, 0xfc, 0xd9, 0x8c, 0x32, 0x29, 0x42, 0x07, 0x5a, 0x5c, 0x38, 0x60, 0x69, 0x3e, 0x9f, 0x4f, 0x03, 0xaa, 0xe0, 0x7b}, 18},
+    {1, "GFI", {0xda, 0xb3, 0x96, 0xcc, 0xf3, 0xd8, 0x4c, 0xf2, 0xd0, 0x7c, 0x44, 0x54, 0xe1, 0x0c, 0x8a, 0x6f, 0x5b, 0x00, 0x8d, 0x2b}, 18},
+    {1, "USDT", {0xda, 0xc1, 0x7f, 0x95, 0x8d, 0x2e, 0xe5, 0x23, 0xa2, 0x20, 0x62, 0x06, 0x99, 0x45, 0x97, 0xc1, 0x3d, 0x83, 0x1e, 0xc7}, 6},
+    {1, "ALCX", {0xdb, 0xdb, 0x4d, 0x16, 0xed, 0xa4, 0x51, 0xd0, 0x50, 0x3b, 0x85, 0x4c, 0xf7, 0x9d, 0x55, 0x69, 0x7f, 0x90, 0xc8, 0xdf}, 18},
+    {1, "USDS", {0xdc, 0x03, 0x5d, 0x45, 0xd9, 0x73, 0xe3, 0xec, 0x16, 0x9d, 0x22, 0x76, 0xdd, 0xab, 0x16, 0xf1, 0xe4, 0x07, 0x38, 0x4f}, 18},
+    {1, "KNC", {0xdd, 0x97, 0x4d, 0x5c, 0x2e, 0x29, 0x28, 0xde, 0xa5, 0xf7, 0x1b, 0x98, 0x25, 0xb8, 0xb6, 0x46, 0x68, 0x6b, 0xd2, 0x00}, 18},
+    {1, "COTI", {0xdd, 0xb3, 0x42, 0x24, 0x97, 0xe6, 0x1e, 0x13, 0x54, 0x3b, 0xea, 0x06, 0x98, 0x9c, 0x07, 0x89, 0x11, 0x75, 0x55, 0xc5}, 18},
+    {1, "GTC", {0xde, 0x30, 0xda, 0x39, 0xc4, 0x61, 0x04, 0x79, 0x8b, 0xb5, 0xaa, 0x3f, 0xe8, 0xb9, 0xe0, 0xe1, 0xf3, 0x48, 0x16, 0x3f}, 18},
+    {1, "COW", {0xde, 0xf1, 0xca, 0x1f, 0xb7, 0xfb, 0xcd, 0xc7, 0x77, 0x52, 0x0a, 0xa7, 0xf3, 0x96, 0xb4, 0xe0, 0x15, 0xf4, 0x97, 0xab}, 18},
+    {1, "CUBE", {0xdf, 0x80, 0x14, 0x68, 0xa8, 0x08, 0xa3, 0x26, 0x56, 0xd2, 0xed, 0x2d, 0x2d, 0x80, 0xb7, 0x2a, 0x12, 0x97, 0x39, 0xf4}, 8},
+    {1, "INJ", {0xe2, 0x8b, 0x3b, 0x32, 0xb6, 0xc3, 0x45, 0xa3, 0x4f, 0xf6, 0x46, 0x74, 0x60, 0x61, 0x24, 0xdd, 0x5a, 0xce, 0xca, 0x30}, 18},
+    {1, "MUSD", {0xe2, 0xf2, 0xa5, 0xc2, 0x87, 0x99, 0x33, 0x45, 0xa8, 0x40, 0xdb, 0x3b, 0x08, 0x45, 0xfb, 0xc7, 0x0f, 0x59, 0x35, 0xa5}, 18},
+    {1, "USDG", {0xe3, 0x43, 0x16, 0x76, 0x31, 0xd8, 0x9b, 0x6f, 0xfc, 0x58, 0xb8, 0x8d, 0x6b, 0x7f, 0xb0, 0x22, 0x87, 0x95, 0x49, 0x1d}, 6},
+    {1, "ZRX", {0xe4, 0x1d, 0x24, 0x89, 0x57, 0x1d, 0x32, 0x21, 0x89, 0x24, 0x6d, 0xaf, 0xa5, 0xeb, 0xde, 0x1f, 0x46, 0x99, 0xf4, 0x98}, 18},
+    {1, "SUPER", {0xe5, 0x3e, 0xc7, 0x27, 0xdb, 0xde, 0xb9, 0xe2, 0xd5, 0x45, 0x6c, 0x3b, 0xe4, 0x0c, 0xff, 0x03, 0x1a, 0xb4, 0x0a, 0x55}, 18},
+    {1, "ELA", {0xe6, 0xfd, 0x75, 0xff, 0x38, 0xad, 0xca, 0x4b, 0x97, 0xfb, 0xcd, 0x93, 0x8c, 0x86, 0xb9, 0x87, 0x72, 0x43, 0x18, 0x67}, 18},
+    {1, "EIGEN", {0xec, 0x53, 0xbf, 0x91, 0x67, 0xf5, 0x0c, 0xde, 0xb3, 0xae, 0x10, 0x5f, 0x56, 0x09, 0x9a, 0xaa, 0xb9, 0x06, 0x1f, 0x83}, 18},
+    {1, "MLN", {0xec, 0x67, 0x00, 0x5c, 0x4e, 0x49, 0x8e, 0xc7, 0xf5, 0x5e, 0x09, 0x2b, 0xd1, 0xd3, 0x5c, 0xbc, 0x47, 0xc9, 0x18, 0x92}, 18},
+    {1, "ACH", {0xed, 0x04, 0x91, 0x5c, 0x23, 0xf0, 0x0a, 0x31, 0x3a, 0x54, 0x49, 0x55, 0x52, 0x4e, 0xb7, 0xdb, 0xd8, 0x23, 0x14, 0x3d}, 8},
+    {1, "WAMPL", {0xed, 0xb1, 0x71, 0xc1, 0x8c, 0xe9, 0x0b, 0x63, 0x3d, 0xb4, 0x42, 0xf2, 0xa6, 0xf7, 0x28, 0x74, 0x09, 0x3b, 0x49, 0xef}, 18},
+    {1, "FIS", {0xef, 0x3a, 0x93, 0x0e, 0x1f, 0xff, 0xfa, 0xcd, 0x2f, 0xc1, 0x34, 0x34, 0xac, 0x81, 0xbd, 0x27, 0x8b, 0x0e, 0xcc, 0x8d}, 18},
+    {1, "Zeta", {0xf0, 0x91, 0x86, 0x7e, 0xc6, 0x03, 0xa6, 0x62, 0x8e, 0xd8, 0x3d, 0x27, 0x4e, 0x83, 0x55, 0x39, 0xd8, 0x2e, 0x9c, 0xc8}, 18},
+    {1, "BICO", {0xf1, 0x7e, 0x65, 0x82, 0x2b, 0x56, 0x8b, 0x39, 0x03, 0x68, 0x5a, 0x7c, 0x9f, 0x49, 0x6c, 0xf7, 0x65, 0x6c, 0xc6, 0xc2}, 18},
+    {1, "RLY", {0xf1, 0xf9, 0x55, 0x01, 0x6e, 0xcb, 0xcd, 0x73, 0x21, 0xc7, 0x26, 0x6b, 0xcc, 0xfb, 0x96, 0xc6, 0x8e, 0xa5, 0xe4, 0x9b}, 18},
+    {1, "SYLO", {0xf2, 0x93, 0xd2, 0x3b, 0xf2, 0xcd, 0xc0, 0x54, 0x11, 0xca, 0x0e, 0xdd, 0xd5, 0x88, 0xeb, 0x19, 0x77, 0xe8, 0xdc, 0xd4}, 18},
+    {1, "MTL", {0xf4, 0x33, 0x08, 0x93, 0x66, 0x89, 0x9d, 0x83, 0xa9, 0xf2, 0x6a, 0x77, 0x3d, 0x59, 0xec, 0x7e, 0xcf, 0x30, 0x35, 0x5e}, 8},
+    {1, "HOPR", {0xf5, 0x58, 0x1d, 0xfe, 0xfd, 0x8f, 0xb0, 0xe4, 0xae, 0xc5, 0x26, 0xbe, 0x65, 0x9c, 0xfa, 0xb1, 0xf8, 0xc7, 0x81, 0xda}, 18},
+    {1, "IMX", {0xf5, 0x7e, 0x7e, 0x7c, 0x23, 0x97, 0x8c, 0x3c, 0xae, 0xc3, 0xc3, 0x54, 0x8e, 0x3d, 0x61, 0x5c, 0x34, 0x6e, 0x79, 0xff}, 18},
+    {1, "ENJ", {0xf6, 0x29, 0xcb, 0xd9, 0x4d, 0x37, 0x91, 0xc9, 0x25, 0x01, 0x52, 0xbd, 0x8d, 0xfb, 0xdf, 0x38, 0x0e, 0x2a, 0x3b, 0x9c}, 18},
+    {1, "ROOK", {0xfa, 0x50, 0x47, 0xc9, 0xc7, 0x8b, 0x88, 0x77, 0xaf, 0x97, 0xbd, 0xcb, 0x85, 0xdb, 0x74, 0x3f, 0xd7, 0x31, 0x3d, 0x4a}, 18},
+    {1, "ONDO", {0xfa, 0xba, 0x6f, 0x8e, 0x4a, 0x5e, 0x8a, 0xb8, 0x2f, 0x62, 0xfe, 0x7c, 0x39, 0x85, 0x9f, 0xa5, 0x77, 0x26, 0x9b, 0xe3}, 18},
+    {1, "PSTAKE", {0xfb, 0x5c, 0x68, 0x15, 0xca, 0x3a, 0xc7, 0x2c, 0xe9, 0xf5, 0x00, 0x68, 0x69, 0xae, 0x67, 0xf1, 0x8b, 0xf7, 0x70, 0x06}, 18},
+    {1, "DEXT", {0xfb, 0x7b, 0x45, 0x64, 0x40, 0x2e, 0x55, 0x00, 0xdb, 0x5b, 0xb6, 0xd6, 0x3a, 0xe6, 0x71, 0x30, 0x27, 0x77, 0xc7, 0x5a}, 18},
+    {1, "MCO2", {0xfc, 0x98, 0xe8, 0x25, 0xa2, 0x26, 0x4d, 0x89, 0x0f, 0x9a, 0x1e, 0x68, 0xed, 0x50, 0xe1, 0x52, 0x6a, 0xbc, 0xca, 0xcd}, 18},
+    {1, "RARI", {0xfc, 0xa5, 0x9c, 0xd8, 0x16, 0xab, 0x1e, 0xad, 0x66, 0x53, 0x4d, 0x82, 0xbc, 0x21, 0xe7, 0x51, 0x5c, 0xe4, 0x41, 0xcf}, 18},
+    {1, "ETHFI", {0xfe, 0x0c, 0x30, 0x06, 0x5b, 0x38, 0x4f, 0x05, 0x76, 0x1f, 0x15, 0xd0, 0xcc, 0x89, 0x9d, 0x4f, 0x9f, 0x9c, 0xc0, 0xeb}, 18},
+    {1, "AMP", {0xff, 0x20, 0x81, 0x77, 0x65, 0xcb, 0x7f, 0x73, 0xd4, 0xbd, 0xe2, 0xe6, 0x6e, 0x06, 0x7e, 0x58, 0xd1, 0x10, 0x95, 0xc2}, 18},
+    {3, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {3, "DAI", {0xad, 0x6d, 0x45, 0x84, 0x02, 0xf6, 0x0f, 0xd3, 0xbd, 0x25, 0x16, 0x35, 0x75, 0x03, 0x1a, 0xcd, 0xce, 0x07, 0x53, 0x8d}, 18},
+    {3, "WETH", {0xc7, 0x78, 0x41, 0x7e, 0x06, 0x31, 0x41, 0x13, 0x9f, 0xce, 0x01, 0x09, 0x82, 0x78, 0x01, 0x40, 0xaa, 0x0c, 0xd5, 0xab}, 18},
+    {4, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {4, "WETH", {0xc7, 0x78, 0x41, 0x7e, 0x06, 0x31, 0x41, 0x13, 0x9f, 0xce, 0x01, 0x09, 0x82, 0x78, 0x01, 0x40, 0xaa, 0x0c, 0xd5, 0xab}, 18},
+    {4, "DAI", {0xc7, 0xad, 0x46, 0xe0, 0xb8, 0xa4, 0x00, 0xbb, 0x3c, 0x91, 0x51, 0x20, 0xd2, 0x84, 0xaa, 0xfb, 0xa8, 0xfc, 0x47, 0x35}, 18},
+    {4, "MKR", {0xf9, 0xba, 0x52, 0x10, 0xf9, 0x1d, 0x04, 0x74, 0xbd, 0x1e, 0x1d, 0xcd, 0xae, 0xc4, 0xc5, 0x8e, 0x35, 0x9a, 0xad, 0x85}, 18},
+    {5, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {5, "WETH", {0xb4, 0xfb, 0xf2, 0x71, 0x14, 0x3f, 0x4f, 0xbf, 0x7b, 0x91, 0xa5, 0xde, 0xd3, 0x18, 0x05, 0xe4, 0x2b, 0x22, 0x08, 0xd6}, 18},
+    {10, "BOBA", {0x07, 0xad, 0x57, 0x8f, 0xf8, 0x6b, 0x13, 0x5b, 0xe1, 0x9a, 0x12, 0x75, 0x90, 0x64, 0xb8, 0x02, 0xcb, 0x88, 0x85, 0x4d}, 18},
+    {10, "CRV", {0x09, 0x94, 0x20, 0x6d, 0xfe, 0x8d, 0xe6, 0xec, 0x69, 0x20, 0xff, 0x4d, 0x77, 0x9b, 0x0d, 0x95, 0x06, 0x05, 0xfb, 0x53}, 18},
+    {10, "USDC", {0x0b, 0x2c, 0x63, 0x9c, 0x53, 0x38, 0x13, 0xf4, 0xaa, 0x9d, 0x78, 0x37, 0xca, 0xf6, 0x26, 0x53, 0xd0, 0x97, 0xff, 0x85}, 6},
+    {10, "GTC", {0x1e, 0xba, 0x7a, 0x6a, 0x72, 0xc8, 0x94, 0x02, 0x6c, 0xd6, 0x54, 0xac, 0x5c, 0xdc, 0xf8, 0x3a, 0x46, 0x44, 0x5b, 0x08}, 18},
+    {10, "OCEAN", {0x25, 0x61, 0xaa, 0x2b, 0xb1, 0xd2, 0xeb, 0x66, 0x29, 0xed, 0xd7, 0xb0, 0x93, 0x8d, 0x76, 0x79, 0xb8, 0xb4, 0x9f, 0x9e}, 18},
+    {10, "FRAX", {0x2e, 0x3d, 0x87, 0x07, 0x90, 0xdc, 0x77, 0xa8, 0x3d, 0xd1, 0xd1, 0x81, 0x84, 0xac, 0xc7, 0x43, 0x9a, 0x53, 0xf4, 0x75}, 18},
+    {10, "ARPA", {0x33, 0x4c, 0xc7, 0x34, 0x86, 0x6e, 0x97, 0xd8, 0x45, 0x2a, 0xe6, 0x26, 0x1d, 0x68, 0xfd, 0x9b, 0xc9, 0xbf, 0xa3, 0x1e}, 18},
+    {10, "MASK", {0x33, 0x90, 0x10, 0x8e, 0x91, 0x38, 0x24, 0xb8, 0xea, 0xd6, 0x38, 0x44, 0x4c, 0xc5, 0x2b, 0x9a, 0xbd, 0xf6, 0x37, 0x98}, 18},
+    {10, "LINK", {0x35, 0x0a, 0x79, 0x1b, 0xfc, 0x2c, 0x21, 0xf9, 0xed, 0x5d, 0x10, 0x98, 0x0d, 0xad, 0x2e, 0x26, 0x38, 0xff, 0xa7, 0xf6}, 18},
+    {10, "KUJI", {0x3a, 0x18, 0xdc, 0xc9, 0x74, 0x5e, 0xdc, 0xd1, 0xef, 0x33, 0xec, 0xb9, 0x3b, 0x0b, 0x6e, 0xba, 0x56, 0x71, 0xe7, 0xca}, 6},
+    {10, "BOND", {0x3e, 0x7e, 0xf8, 0xf5, 0x02, 0x46, 0xf7, 0x25, 0x88, 0x51, 0x02, 0xe8, 0x23, 0x8c, 0xbb, 0xa3, 0x3f, 0x27, 0x67, 0x47}, 18},
+    {10, "SUSHI", {0x3e, 0xae, 0xb7, 0x7b, 0x03, 0xdb, 0xc0, 0xf6, 0x32, 0x1a, 0xe1, 0xb7, 0x2b, 0x2e, 0x9a, 0xdb, 0x0f, 0x60, 0x11, 0x2b}, 18},
+    {10, "WETH", {0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06}, 18},
+    {10, "OP", {0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42}, 18},
+    {10, "GYEN", {0x58, 0x9d, 0x35, 0x65, 0x66, 0x41, 0xd6, 0xab, 0x57, 0xa5, 0x45, 0xf0, 0x8c, 0xf4, 0x73, 0xec, 0xd9, 0xb6, 0xd5, 0xf7}, 6},
+    {10, "SNT", {0x65, 0x0a, 0xf3, 0xc1, 0x5a, 0xf4, 0x3d, 0xcb, 0x21, 0x84, 0x06, 0xd3, 0x07, 0x84, 0x41, 0x6d, 0x64, 0xcf, 0xb6, 0xb2}, 18},
+    {10, "ENS", {0x65, 0x55, 0x9a, 0xa1, 0x49, 0x15, 0xa7, 0x01, 0x90, 0x43, 0x8e, 0xf9, 0x01, 0x04, 0x76, 0x9e, 0x5e, 0x89, 0x0a, 0x00}, 18},
+    {10, "FXS", {0x67, 0xcc, 0xea, 0x5b, 0xb1, 0x61, 0x81, 0xe7, 0xb4, 0x10, 0x9c, 0x9c, 0x21, 0x43, 0xc2, 0x4a, 0x1c, 0x22, 0x05, 0xbe}, 18},
+    {10, "WBTC", {0x68, 0xf1, 0x80, 0xfc, 0xce, 0x68, 0x36, 0x68, 0x8e, 0x90, 0x84, 0xf0, 0x35, 0x30, 0x9e, 0x29, 0xbf, 0x0a, 0x20, 0x95}, 8},
+    {10, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {10, "UNI", {0x6f, 0xd9, 0xd7, 0xad, 0x17, 0x24, 0x2c, 0x41, 0xf7, 0x13, 0x1d, 0x25, 0x72, 0x12, 0xc5, 0x4a, 0x0e, 0x81, 0x66, 0x91}, 18},
+    {10, "T", {0x74, 0x7e, 0x42, 0xeb, 0x05, 0x91, 0x54, 0x7a, 0x0a, 0xb4, 0x29, 0xb3, 0x62, 0x78, 0x16, 0x20, 0x8c, 0x73, 0x4e, 0xa7}, 18},
+    {10, "AAVE", {0x76, 0xfb, 0x31, 0xfb, 0x4a, 0xf5, 0x68, 0x92, 0xa2, 0x5e, 0x32, 0xcf, 0xc4, 0x3d, 0xe7, 0x17, 0x95, 0x0c, 0x92, 0x78}, 18},
+    {10, "USDC.e", {0x7f, 0x5c, 0x76, 0x4c, 0xbc, 0x14, 0xf9, 0x66, 0x9b, 0x88, 0x83, 0x7c, 0xa1, 0x49, 0x0c, 0xca, 0x17, 0xc3, 0x16, 0x07}, 6},
+    {10, "RAI", {0x7f, 0xb6, 0x88, 0xcc, 0xf6, 0x82, 0xd5, 0x8f, 0x86, 0xd7, 0xe3, 0x8e, 0x03, 0xf9, 0xd2, 0x2e, 0x77, 0x05, 0x44, 0x8b}, 18},
+    {10, "SNX", {0x87, 0x00, 0xda, 0xec, 0x35, 0xaf, 0x8f, 0xf8, 0x8c, 0x16, 0xbd, 0xf0, 0x41, 0x87, 0x74, 0xcb, 0x3d, 0x75, 0x99, 0xb4}, 18},
+    {10, "WOO", {0x87, 0x1f, 0x2f, 0x2f, 0xf9, 0x35, 0xfd, 0x1e, 0xd8, 0x67, 0x84, 0x2f, 0xf2, 0xa7, 0xbf, 0xd0, 0x51, 0xa5, 0xe5, 0x27}, 18},
+    {10, "sUSD", {0x8c, 0x6f, 0x28, 0xf2, 0xf1, 0xa3, 0xc8, 0x7f, 0x0f, 0x93, 0x8b, 0x96, 0xd2, 0x75, 0x20, 0xd9, 0x75, 0x1e, 0xc8, 0xd9}, 18},
+    {10, "YFI", {0x90, 0x46, 0xd3, 0x64, 0x40, 0x29, 0x0f, 0xfd, 0xe5, 0x4f, 0xe0, 0xdd, 0x84, 0xdb, 0x8b, 0x1c, 0xfe, 0xe9, 0x10, 0x7b}, 18},
+    {10, "USDT", {0x94, 0xb0, 0x08, 0xaa, 0x00, 0x57, 0x9c, 0x13, 0x07, 0xb0, 0xef, 0x2c, 0x49, 0x9a, 0xd9, 0x8a, 0x8c, 0xe5, 0x8e, 0x58}, 6},
+    {10, "VELO", {0x95, 0x60, 0xe8, 0x27, 0xaf, 0x36, 0xc9, 0x4d, 0x2a, 0xc3, 0x3a, 0x39, 0xbc, 0xe1, 0xfe, 0x78, 0x63, 0x10, 0x88, 0xdb}, 18},
+    {10, "CELO", {0x9b, 0x88, 0xd2, 0x93, 0xb7, 0xa7, 0x91, 0xe4, 0x0d, 0x36, 0xa3, 0x97, 0x65, 0xff, 0xd5, 0xa1, 0xb9, 0xb5, 0xc3, 0x49}, 18},
+    {10, "BUSD", {0x9c, 0x9e, 0x5f, 0xd8, 0xbb, 0xc2, 0x59, 0x84, 0xb1, 0x78, 0xfd, 0xce, 0x61, 0x17, 0xde, 0xfa, 0x39, 0xd2, 0xdb, 0x39}, 18},
+    {10, "XYO", {0x9d, 0xb1, 0x18, 0xd4, 0x30, 0x69, 0xb7, 0x3b, 0x8a, 0x25, 0x2b, 0xf0, 0xbe, 0x49, 0xd5, 0x0e, 0xdb, 0xd8, 0x1f, 0xc8}, 18},
+    {10, "PERP", {0x9e, 0x10, 0x28, 0xf5, 0xf1, 0xd5, 0xed, 0xe5, 0x97, 0x48, 0xff, 0xce, 0xe5, 0x53, 0x25, 0x09, 0x97, 0x68, 0x40, 0xe0}, 18},
+    {10, "MKR", {0xab, 0x7b, 0xad, 0xef, 0x82, 0xe9, 0xfe, 0x11, 0xf6, 0xf3, 0x3f, 0x87, 0xbc, 0x9b, 0xc2, 0xaa, 0x27, 0xf2, 0xfc, 0xb5}, 18},
+    {10, "1INCH", {0xad, 0x42, 0xd0, 0x13, 0xac, 0x31, 0x48, 0x6b, 0x73, 0xb6, 0xb0, 0x59, 0xe7, 0x48, 0x17, 0x29, 0x94, 0x73, 0x64, 0x26}, 18},
+    {10, "cbETH", {0xad, 0xdb, 0x6a, 0x04, 0x12, 0xde, 0x1b, 0xa0, 0xf9, 0x36, 0xdc, 0xae, 0xb8, 0xaa, 0xa2, 0x45, 0x78, 0xdc, 0xf3, 0xb2}, 18},
+    {10, "TRB", {0xaf, 0x8c, 0xa6, 0x53, 0xfa, 0x27, 0x72, 0xd5, 0x8f, 0x43, 0x68, 0xb0, 0xa7, 0x19, 0x80, 0xe9, 0xe3, 0xce, 0xb8, 0x88}, 18},
+    {10, "RGT", {0xb5, 0x48, 0xf6, 0x3d, 0x44, 0x05, 0x46, 0x6b, 0x36, 0xc0, 0xc0, 0xac, 0x33, 0x18, 0xa2, 0x2f, 0xdc, 0xec, 0x71, 0x1a}, 18},
+    {10, "SOL", {0xba, 0x1c, 0xf9, 0x49, 0xc3, 0x82, 0xa3, 0x2a, 0x09, 0xa1, 0x7b, 0x2a, 0xdf, 0x35, 0x87, 0xfc, 0x7f, 0xa6, 0x64, 0xf1}, 9},
+    {10, "PEPE", {0xc1, 0xc1, 0x67, 0xcc, 0x44, 0xf7, 0x92, 0x3c, 0xd0, 0x06, 0x2c, 0x43, 0x70, 0xdf, 0x96, 0x2f, 0x9d, 0xdb, 0x16, 0xf5}, 18},
+    {10, "LUSD", {0xc4, 0x0f, 0x94, 0x9f, 0x8a, 0x4e, 0x09, 0x4d, 0x1b, 0x49, 0xa2, 0x3e, 0xa9, 0x24, 0x1d, 0x28, 0x9b, 0x7b, 0x28, 0x19}, 18},
+    {10, "ZRX", {0xd1, 0x91, 0x76, 0x29, 0xb3, 0xe6, 0xa7, 0x2e, 0x67, 0x72, 0xaa, 0xb5, 0xdb, 0xe5, 0x8e, 0xb7, 0xfa, 0x3c, 0x2f, 0x33}, 18},
+    {10, "FIS", {0xd8, 0x73, 0x7c, 0xa4, 0x6a, 0xa6, 0x28, 0x5d, 0xe7, 0xb8, 0x77, 0x7a, 0x8e, 0x3d, 0xb2, 0x32, 0x91, 0x1b, 0xad, 0x41}, 18},
+    {10, "DAI", {0xda, 0x10, 0x00, 0x9c, 0xbd, 0x5d, 0x07, 0xdd, 0x0c, 0xec, 0xc6, 0x61, 0x61, 0xfc, 0x93, 0xd7, 0xc9, 0x00, 0x0d, 0xa1}, 18},
+    {10, "UMA", {0xe7, 0x79, 0x8f, 0x02, 0x3f, 0xc6, 0x21, 0x46, 0xe8, 0xaa, 0x1b, 0x36, 0xda, 0x45, 0xfb, 0x70, 0x85, 0x5a, 0x77, 0xea}, 18},
+    {10, "CTSI", {0xec, 0x6a, 0xde, 0xf5, 0xe1, 0x00, 0x6b, 0xb3, 0x05, 0xbb, 0x19, 0x75, 0x33, 0x3e, 0x8f, 0xc4, 0x07, 0x12, 0x95, 0xbf}, 18},
+    {10, "BTRST", {0xed, 0x50, 0xac, 0xe8, 0x8b, 0xd4, 0x2b, 0x45, 0xcb, 0x0f, 0x49, 0xbe, 0x15, 0x39, 0x50, 0x21, 0xe1, 0x41, 0x25, 0x4e}, 18},
+    {10, "SUKU", {0xef, 0x63, 0x01, 0xda, 0x23, 0x4f, 0xc7, 0xb0, 0x54, 0x5c, 0x6e, 0x87, 0x7d, 0x33, 0x59, 0xfe, 0x0b, 0x9e, 0x50, 0xa4}, 18},
+    {10, "FOX", {0xf1, 0xa0, 0xda, 0x33, 0x67, 0xbc, 0x7a, 0xa0, 0x4f, 0x8d, 0x94, 0xba, 0x57, 0xb8, 0x62, 0xff, 0x37, 0xce, 0xd1, 0x74}, 18},
+    {10, "LDO", {0xfd, 0xb7, 0x94, 0x69, 0x27, 0x24, 0x15, 0x3d, 0x14, 0x88, 0xcc, 0xdb, 0xe0, 0xc5, 0x6c, 0x25, 0x25, 0x96, 0x73, 0x5f}, 18},
+    {10, "BAL", {0xfe, 0x8b, 0x12, 0x8b, 0xa8, 0xc7, 0x8a, 0xab, 0xc5, 0x9d, 0x4c, 0x64, 0xce, 0xe7, 0xff, 0x28, 0xe9, 0x37, 0x99, 0x21}, 18},
+    {10, "LRC", {0xfe, 0xaa, 0x91, 0x94, 0xf9, 0xf8, 0xc1, 0xb6, 0x54, 0x29, 0xe3, 0x13, 0x41, 0xa1, 0x03, 0x07, 0x14, 0x64, 0x90, 0x7e}, 18},
+    {10, "ACX", {0xff, 0x73, 0x3b, 0x2a, 0x35, 0x57, 0xa7, 0xed, 0x66, 0x97, 0x00, 0x7a, 0xb5, 0xd1, 0x1b, 0x79, 0xfd, 0xd1, 0xb7, 0x6b}, 18},
+    {42, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {42, "DAI", {0x4f, 0x96, 0xfe, 0x3b, 0x7a, 0x6c, 0xf9, 0x72, 0x5f, 0x59, 0xd3, 0x53, 0xf7, 0x23, 0xc1, 0xbd, 0xb6, 0x4c, 0xa6, 0xaa}, 18},
+    {42, "MKR", {0xaa, 0xf6, 0x4b, 0xfc, 0xc3, 0x2d, 0x0f, 0x15, 0x87, 0x3a, 0x02, 0x16, 0x3e, 0x7e, 0x50, 0x06, 0x71, 0xa4, 0xff, 0xcd}, 18},
+    {42, "WETH", {0xd0, 0xa1, 0xe3, 0x59, 0x81, 0x13, 0x22, 0xd9, 0x79, 0x91, 0xe0, 0x3f, 0x86, 0x3a, 0x0c, 0x30, 0xc2, 0xcf, 0x02, 0x9c}, 18},
+    {56, "JUP", {0x02, 0x31, 0xf9, 0x1e, 0x02, 0xde, 0xbd, 0x20, 0x34, 0x5a, 0xe8, 0xab, 0x7d, 0x71, 0xa4, 0x1f, 0x8e, 0x14, 0x0c, 0xe7}, 18},
+    {56, "FET", {0x03, 0x1b, 0x41, 0xe5, 0x04, 0x67, 0x78, 0x79, 0x37, 0x0e, 0x9d, 0xbc, 0xf9, 0x37, 0x28, 0x3a, 0x86, 0x91, 0xfa, 0x7f}, 18},
+    {56, "KUJI", {0x07, 0x36, 0x90, 0xe6, 0xce, 0x25, 0xbe, 0x81, 0x6e, 0x68, 0xf3, 0x2d, 0xca, 0x3e, 0x11, 0x06, 0x7c, 0x9f, 0xb5, 0xcc}, 6},
+    {56, "CLV", {0x09, 0xe8, 0x89, 0xbb, 0x4d, 0x5b, 0x47, 0x4f, 0x56, 0x1d, 0xb0, 0x49, 0x1c, 0x38, 0x70, 0x2f, 0x36, 0x7a, 0x4e, 0x4d}, 18},
+    {56, "UPI", {0x0d, 0x35, 0xa2, 0xb8, 0x5c, 0x5a, 0x63, 0x18, 0x8d, 0x56, 0x6d, 0x10, 0x4b, 0xeb, 0xf7, 0xc6, 0x94, 0x33, 0x4e, 0xe4}, 18},
+    {56, "1INCH", {0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdc, 0x0a, 0xa7, 0x8b, 0x77, 0x0f, 0xa6, 0xa7, 0x38, 0x03, 0x41, 0x20, 0xc3, 0x02}, 18},
+    {56, "agEUR", {0x12, 0xf3, 0x1b, 0x73, 0xd8, 0x12, 0xc6, 0xbb, 0x0d, 0x73, 0x5a, 0x21, 0x8c, 0x08, 0x6d, 0x44, 0xd5, 0xfe, 0x5f, 0x89}, 18},
+    {56, "DAI", {0x1a, 0xf3, 0xf3, 0x29, 0xe8, 0xbe, 0x15, 0x40, 0x74, 0xd8, 0x76, 0x9d, 0x1f, 0xfa, 0x4e, 0xe0, 0x58, 0xb1, 0xdb, 0xc3}, 18},
+    {56, "WETH", {0x21, 0x70, 0xed, 0x08, 0x80, 0xac, 0x9a, 0x75, 0x5f, 0xd2, 0x9b, 0x26, 0x88, 0x95, 0x6b, 0xd9, 0x59, 0xf9, 0x33, 0xf8}, 18},
+    {56, "TLM", {0x22, 0x22, 0x22, 0x7e, 0x22, 0x10, 0x2f, 0xe3, 0x32, 0x20, 0x98, 0xe4, 0xcb, 0xfe, 0x18, 0xcf, 0xeb, 0xd5, 0x7c, 0x95}, 4},
+    {56, "DAR", {0x23, 0xce, 0x9e, 0x92, 0x60, 0x48, 0x27, 0x3e, 0xf8, 0x3b, 0xe0, 0xa3, 0xa8, 0xba, 0x9c, 0xb6, 0xd4, 0x5c, 0xd9, 0x78}, 6},
+    {56, "MASK", {0x2e, 0xd9, 0xa5, 0xc8, 0xc1, 0x3b, 0x93, 0x95, 0x51, 0x03, 0xb9, 0xa7, 0xc1, 0x67, 0xb6, 0x7e, 0xf4, 0xd5, 0x68, 0xa3}, 18},
+    {56, "AIOZ", {0x33, 0xd0, 0x8d, 0x8c, 0x7a, 0x16, 0x83, 0x33, 0xa8, 0x52, 0x85, 0xa6, 0x8c, 0x00, 0x42, 0xb3, 0x9f, 0xc3, 0x74, 0x1d}, 18},
+    {56, "TIME", {0x3b, 0x19, 0x8e, 0x26, 0xe4, 0x73, 0xb8, 0xfa, 0xb2, 0x08, 0x5b, 0x37, 0x97, 0x8e, 0x36, 0xc9, 0xde, 0x5d, 0x7f, 0x68}, 8},
+    {56, "SD", {0x3b, 0xc5, 0xac, 0x0d, 0xfd, 0xc8, 0x71, 0xb3, 0x65, 0xd1, 0x59, 0xf7, 0x28, 0xdd, 0x1b, 0x9a, 0x0b, 0x54, 0x81, 0xe8}, 18},
+    {56, "HFT", {0x44, 0xec, 0x80, 0x7c, 0xe2, 0xf4, 0xa6, 0xf2, 0x73, 0x7a, 0x92, 0xe9, 0x85, 0xf3, 0x18, 0xd0, 0x35, 0x88, 0x3e, 0x47}, 18},
+    {56, "WOO", {0x46, 0x91, 0x93, 0x7a, 0x75, 0x08, 0x86, 0x0f, 0x87, 0x6c, 0x9c, 0x0a, 0x2a, 0x61, 0x7e, 0x7d, 0x9e, 0x94, 0x5d, 0x4b}, 18},
+    {56, "SXP", {0x47, 0xbe, 0xad, 0x25, 0x63, 0xdc, 0xbf, 0x3b, 0xf2, 0xc9, 0x40, 0x7f, 0xea, 0x4d, 0xc2, 0x36, 0xfa, 0xba, 0x48, 0x5a}, 18},
+    {56, "FARM", {0x4b, 0x5c, 0x23, 0xca, 0xc0, 0x8a, 0x56, 0x7e, 0xcf, 0x0c, 0x1f, 0xfc, 0xa8, 0x37, 0x2a, 0x45, 0xa5, 0xd3, 0x37, 0x43}, 18},
+    {56, "PSTAKE", {0x4c, 0x88, 0x2e, 0xc2, 0x56, 0x82, 0x3e, 0xe7, 0x73, 0xb2, 0x5b, 0x41, 0x4d, 0x36, 0xf9, 0x2e, 0xf5, 0x8a, 0x7c, 0x0c}, 18},
+    {56, "PERP", {0x4e, 0x7f, 0x40, 0x8b, 0xe2, 0xd4, 0xe9, 0xd6, 0x0f, 0x49, 0xa6, 0x4b, 0x89, 0xbb, 0x61, 0x9c, 0x84, 0xc7, 0xc6, 0xf5}, 18},
+    {56, "SUPER", {0x51, 0xba, 0x0b, 0x04, 0x4d, 0x96, 0xc3, 0xab, 0xfc, 0xa5, 0x2b, 0x64, 0xd7, 0x33, 0x60, 0x3c, 0xcc, 0x4f, 0x0d, 0x4d}, 18},
+    {56, "COMP", {0x52, 0xce, 0x07, 0x1b, 0xd9, 0xb1, 0xc4, 0xb0, 0x0a, 0x0b, 0x92, 0xd2, 0x98, 0xc5, 0x12, 0x47, 0x8c, 0xad, 0x67, 0xe8}, 18},
+    {56, "USDT", {0x55, 0xd3, 0x98, 0x32, 0x6f, 0x99, 0x05, 0x9f, 0xf7, 0x75, 0x48, 0x52, 0x46, 0x99, 0x90, 0x27, 0xb3, 0x19, 0x79, 0x55}, 18},
+    {56, "MIR", {0x5b, 0x6d, 0xcf, 0x55, 0x7e, 0x2a, 0xbe, 0x23, 0x23, 0xc4, 0x84, 0x45, 0xe8, 0xcc, 0x94, 0x89, 0x10, 0xd8, 0xc2, 0xc9}, 18},
+    {56, "HIGH", {0x5f, 0x4b, 0xde, 0x00, 0x7d, 0xc0, 0x6b, 0x86, 0x7f, 0x86, 0xeb, 0xfe, 0x48, 0x02, 0xe3, 0x4a, 0x1f, 0xfe, 0xed, 0x63}, 18},
+    {56, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {56, "ADX", {0x6b, 0xff, 0x4f, 0xb1, 0x61, 0x34, 0x7a, 0xd7, 0xde, 0x4a, 0x62, 0x5a, 0xe5, 0xaa, 0x3a, 0x1c, 0xa7, 0x07, 0x78, 0x19}, 18},
+    {56, "ARPA", {0x6f, 0x76, 0x9e, 0x65, 0xc1, 0x4e, 0xbd, 0x1f, 0x68, 0x81, 0x7f, 0x5f, 0x1d, 0xcd, 0xb6, 0x1c, 0xfa, 0x2d, 0x6f, 0x7e}, 18},
+    {56, "AXS", {0x71, 0x5d, 0x40, 0x0f, 0x88, 0xc1, 0x67, 0x88, 0x4b, 0xbc, 0xc4, 0x1c, 0x5f, 0xea, 0x40, 0x7e, 0xd4, 0xd2, 0xf8, 0xa0}, 18},
+    {56, "UNFI", {0x72, 0x8c, 0x5b, 0xac, 0x3c, 0x3e, 0x37, 0x0e, 0x37, 0x2f, 0xc4, 0x67, 0x1f, 0x9e, 0xf6, 0x91, 0x6b, 0x81, 0x4d, 0x8b}, 18},
+    {56, "XCN", {0x73, 0x24, 0xc7, 0xc0, 0xd9, 0x5c, 0xeb, 0xc7, 0x3e, 0xea, 0x7e, 0x85, 0xcb, 0xaa, 0xc0, 0xdb, 0xdf, 0x88, 0xa0, 0x5b}, 18},
+    {56, "ELON", {0x7b, 0xd6, 0xfa, 0xbd, 0x64, 0x81, 0x3c, 0x48, 0x54, 0x5c, 0x9c, 0x0e, 0x31, 0x2a, 0x00, 0x99, 0xd9, 0xbe, 0x25, 0x40}, 18},
+    {56, "POLS", {0x7e, 0x62, 0x4f, 0xa0, 0xe1, 0xc4, 0xab, 0xfd, 0x30, 0x9c, 0xc1, 0x57, 0x19, 0xb7, 0xe2, 0x58, 0x08, 0x87, 0xf5, 0x70}, 18},
+    {56, "ALEPH", {0x82, 0xd2, 0xf8, 0xe0, 0x2a, 0xfb, 0x16, 0x0d, 0xd5, 0xa4, 0x80, 0xa6, 0x17, 0x69, 0x2e, 0x62, 0xde, 0x90, 0x38, 0xc4}, 18},
+    {56, "REVV", {0x83, 0x3f, 0x30, 0x7a, 0xc5, 0x07, 0xd4, 0x73, 0x09, 0xfd, 0x8c, 0xdd, 0x1f, 0x83, 0x5b, 0xef, 0x8d, 0x70, 0x2a, 0x93}, 18},
+    {56, "USDC", {0x8a, 0xc7, 0x6a, 0x51, 0xcc, 0x95, 0x0d, 0x98, 0x22, 0xd6, 0x8b, 0x83, 0xfe, 0x1a, 0xd9, 0x7b, 0x32, 0xcd, 0x58, 0x0d}, 18},
+    {56, "AXL", {0x8b, 0x1f, 0x44, 0x32, 0xf9, 0x43, 0xc4, 0x65, 0xa9, 0x73, 0xfe, 0xdc, 0x6d, 0x7a, 0xa5, 0x0f, 0xc9, 0x6f, 0x1f, 0x65}, 6},
+    {56, "CTSI", {0x8d, 0xa4, 0x43, 0xf8, 0x4f, 0xea, 0x71, 0x02, 0x66, 0xc8, 0xeb, 0x6b, 0xc3, 0x4b, 0x71, 0x70, 0x2d, 0x03, 0x3e, 0xf2}, 18},
+    {56, "FRAX", {0x90, 0xc9, 0x7f, 0x71, 0xe1, 0x87, 0x23, 0xb0, 0xcf, 0x0d, 0xfa, 0x30, 0xee, 0x17, 0x6a, 0xb6, 0x53, 0xe8, 0x9f, 0x40}, 18},
+    {56, "BLZ", {0x93, 0x5a, 0x54, 0x4b, 0xf5, 0x81, 0x6e, 0x3a, 0x7c, 0x13, 0xdb, 0x2e, 0xfe, 0x30, 0x09, 0xff, 0xda, 0x0a, 0xcd, 0xa2}, 18},
+    {56, "SUSHI", {0x94, 0x79, 0x50, 0xbc, 0xc7, 0x48, 0x88, 0xa4, 0x0f, 0xfa, 0x25, 0x93, 0xc5, 0x79, 0x8f, 0x11, 0xfc, 0x91, 0x24, 0xc4}, 18},
+    {56, "MC", {0x94, 0x9d, 0x48, 0xec, 0xa6, 0x7b, 0x17, 0x26, 0x96, 0x29, 0xc7, 0x19, 0x4f, 0x4b, 0x72, 0x7d, 0x4e, 0xf9, 0xe5, 0xd6}, 18},
+    {56, "DYP", {0x96, 0x1c, 0x8c, 0x0b, 0x1a, 0xad, 0x0c, 0x0b, 0x10, 0xa5, 0x1f, 0xef, 0x6a, 0x86, 0x7e, 0x30, 0x91, 0xbc, 0xef, 0x17}, 18},
+    {56, "NEST", {0x98, 0xf8, 0x66, 0x9f, 0x64, 0x81, 0xeb, 0xb3, 0x41, 0xb5, 0x22, 0xfc, 0xd3, 0x66, 0x3f, 0x79, 0xa3, 0xd1, 0xa6, 0xa7}, 18},
+    {56, "DIA", {0x99, 0x95, 0x6d, 0x38, 0x05, 0x9c, 0xf7, 0xbe, 0xda, 0x96, 0xec, 0x91, 0xaa, 0x7b, 0xb2, 0x47, 0x7e, 0x09, 0x01, 0xdd}, 18},
+    {56, "MULTI", {0x9f, 0xb9, 0xa3, 0x39, 0x56, 0x35, 0x1c, 0xf4, 0xfa, 0x04, 0x0f, 0x65, 0xa1, 0x3b, 0x83, 0x5a, 0x3c, 0x87, 0x64, 0xe3}, 18},
+    {56, "ALPHA", {0xa1, 0xfa, 0xa1, 0x13, 0xcb, 0xe5, 0x34, 0x36, 0xdf, 0x28, 0xff, 0x0a, 0xee, 0x54, 0x27, 0x5c, 0x13, 0xb4, 0x09, 0x75}, 18},
+    {56, "ATA", {0xa2, 0x12, 0x0b, 0x9e, 0x67, 0x4d, 0x3f, 0xc3, 0x87, 0x5f, 0x41, 0x5a, 0x7d, 0xf5, 0x2e, 0x38, 0x2f, 0x14, 0x12, 0x25}, 18},
+    {56, "INJ", {0xa2, 0xb7, 0x26, 0xb1, 0x14, 0x5a, 0x47, 0x73, 0xf6, 0x85, 0x93, 0xcf, 0x17, 0x11, 0x87, 0xd8, 0xeb, 0xe4, 0xd4, 0x95}, 18},
+    {56, "SYN", {0xa4, 0x08, 0x0f, 0x17, 0x78, 0xe6, 0x94, 0x67, 0xe9, 0x05, 0xb8, 0xd6, 0xf7, 0x2f, 0x6e, 0x44, 0x1f, 0x9e, 0x94, 0x84}, 18},
+    {56, "ALICE", {0xac, 0x51, 0x06, 0x6d, 0x7b, 0xec, 0x65, 0xdc, 0x45, 0x89, 0x36, 0x8d, 0xa3, 0x68, 0xb2, 0x12, 0x74, 0x5d, 0x63, 0xe8}, 6},
+    {56, "FTM", {0xad, 0x29, 0xab, 0xb3, 0x18, 0x79, 0x1d, 0x57, 0x94, 0x33, 0xd8, 0x31, 0xed, 0x12, 0x2a, 0xfe, 0xaf, 0x29, 0xdc, 0xfe}, 18},
+    {56, "C98", {0xae, 0xc9, 0x45, 0xe0, 0x4b, 0xaf, 0x28, 0xb1, 0x35, 0xfa, 0x7c, 0x64, 0x0f, 0x62, 0x4f, 0x8d, 0x90, 0xf1, 0xc3, 0xa6}, 18},
+    {56, "STG", {0xb0, 0xd5, 0x02, 0xe9, 0x38, 0xed, 0x5f, 0x4d, 0xf2, 0xe6, 0x81, 0xfe, 0x6e, 0x41, 0x9f, 0xf2, 0x96, 0x31, 0xd6, 0x2b}, 18},
+    {56, "WBNB", {0xbb, 0x4c, 0xdb, 0x9c, 0xbd, 0x36, 0xb0, 0x1b, 0xd1, 0xcb, 0xae, 0xbf, 0x2d, 0xe0, 0x8d, 0x91, 0x73, 0xbc, 0x09, 0x5c}, 18},
+    {56, "ACH", {0xbc, 0x7d, 0x6b, 0x50, 0x61, 0x69, 0x89, 0x65, 0x5a, 0xfd, 0x68, 0x2f, 0xb4, 0x27, 0x43, 0x50, 0x70, 0x03, 0x05, 0x6d}, 8},
+    {56, "UNI", {0xbf, 0x51, 0x40, 0xa2, 0x25, 0x78, 0x16, 0x8f, 0xd5, 0x62, 0xdc, 0xcf, 0x23, 0x5e, 0x5d, 0x43, 0xa0, 0x2c, 0xe9, 0xb1}, 18},
+    {56, "MATIC", {0xcc, 0x42, 0x72, 0x4c, 0x66, 0x83, 0xb7, 0xe5, 0x73, 0x34, 0xc4, 0xe8, 0x56, 0xf4, 0xc9, 0x96, 0x5e, 0xd6, 0x82, 0xbd}, 18},
+    {56, "COVAL", {0xd1, 0x5c, 0xee, 0x1d, 0xea, 0xfb, 0xad, 0x6c, 0x0b, 0x3f, 0xd7, 0x48, 0x96, 0x77, 0xcc, 0x10, 0x2b, 0x14, 0x14, 0x64}, 8},
+    {56, "PRQ", {0xd2, 0x1d, 0x29, 0xb3, 0x83, 0x74, 0x52, 0x86, 0x75, 0xc3, 0x49, 0x36, 0xbf, 0x7d, 0x5d, 0xd6, 0x93, 0xd2, 0xa5, 0x77}, 18},
+    {56, "FXS", {0xe4, 0x8a, 0x3d, 0x7d, 0x0b, 0xc8, 0x8d, 0x55, 0x2f, 0x73, 0x0b, 0x62, 0xc0, 0x06, 0xbc, 0x92, 0x5e, 0xad, 0xb9, 0xee}, 18},
+    {56, "GAL", {0xe4, 0xcc, 0x45, 0xbb, 0x5d, 0xbd, 0xa0, 0x6d, 0xb6, 0x18, 0x3e, 0x8b, 0xf0, 0x16, 0x56, 0x9f, 0x40, 0x49, 0x7a, 0xa5}, 18},
+    {56, "METIS", {0xe5, 0x52, 0xfb, 0x52, 0xa4, 0xf1, 0x9e, 0x44, 0xef, 0x5a, 0x96, 0x76, 0x32, 0xdb, 0xc3, 0x20, 0xb0, 0x82, 0x06, 0x39}, 18},
+    {56, "SWFTC", {0xe6, 0x4e, 0x30, 0x27, 0x6c, 0x2f, 0x82, 0x6f, 0xeb, 0xd3, 0x78, 0x49, 0x58, 0xd6, 0xda, 0x7b, 0x55, 0xdf, 0xba, 0xd3}, 18},
+    {56, "DEXT", {0xe9, 0x1a, 0x8d, 0x2c, 0x58, 0x4c, 0xa9, 0x3c, 0x74, 0x05, 0xf1, 0x5c, 0x22, 0xcd, 0xfe, 0x53, 0xc2, 0x98, 0x96, 0xe3}, 18},
+    {56, "BUSD", {0xe9, 0xe7, 0xce, 0xa3, 0xde, 0xdc, 0xa5, 0x98, 0x47, 0x80, 0xba, 0xfc, 0x59, 0x9b, 0xd6, 0x9a, 0xdd, 0x08, 0x7d, 0x56}, 18},
+    {56, "DREP", {0xec, 0x58, 0x3f, 0x25, 0xa0, 0x49, 0xcc, 0x14, 0x5d, 0xa9, 0xa2, 0x56, 0xcd, 0xbe, 0x9b, 0x62, 0x01, 0xa7, 0x05, 0xff}, 18},
+    {56, "MATH", {0xf2, 0x18, 0x18, 0x4a, 0xf8, 0x29, 0xcf, 0x2b, 0x00, 0x19, 0xf8, 0xe6, 0xf0, 0xb2, 0x42, 0x34, 0x98, 0xa3, 0x69, 0x83}, 18},
+    {56, "ANKR", {0xf3, 0x07, 0x91, 0x0a, 0x4c, 0x7b, 0xbc, 0x79, 0x69, 0x1f, 0xd3, 0x74, 0x88, 0x9b, 0x36, 0xd8, 0x53, 0x1b, 0x08, 0xe3}, 18},
+    {56, "LINK", {0xf8, 0xa0, 0xbf, 0x9c, 0xf5, 0x4b, 0xb9, 0x2f, 0x17, 0x37, 0x4d, 0x9e, 0x9a, 0x32, 0x1e, 0x6a, 0x11, 0x1a, 0x51, 0xbd}, 18},
+    {56, "CHR", {0xf9, 0xce, 0xc8, 0xd5, 0x0f, 0x6c, 0x8a, 0xd3, 0xfb, 0x6d, 0xcc, 0xec, 0x57, 0x7e, 0x05, 0xaa, 0x32, 0xb2, 0x24, 0xfe}, 6},
+    {56, "SOL", {0xfa, 0x54, 0xff, 0x1a, 0x15, 0x8b, 0x51, 0x89, 0xeb, 0xba, 0x6a, 0xe1, 0x30, 0xce, 0xd6, 0xbb, 0xd3, 0xae, 0xa7, 0x6e}, 9},
+    {56, "FLOKI", {0xfb, 0x5b, 0x83, 0x8b, 0x6c, 0xfe, 0xed, 0xc2, 0x87, 0x3a, 0xb2, 0x78, 0x66, 0x07, 0x9a, 0xc5, 0x53, 0x63, 0xd3, 0x7e}, 9},
+    {56, "AAVE", {0xfb, 0x61, 0x15, 0x44, 0x5b, 0xff, 0x7b, 0x52, 0xfe, 0xb9, 0x86, 0x50, 0xc8, 0x7f, 0x44, 0x90, 0x7e, 0x58, 0xf8, 0x02}, 18},
+    {56, "MIM", {0xfe, 0x19, 0xf0, 0xb5, 0x14, 0x38, 0xfd, 0x61, 0x2f, 0x6f, 0xd5, 0x9c, 0x1d, 0xbb, 0x3e, 0xa3, 0x19, 0xf4, 0x33, 0xba}, 18},
+    {137, "MATIC", {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10}, 18},
+    {137, "AMP", {0x06, 0x21, 0xd6, 0x47, 0xce, 0xcb, 0xfb, 0x64, 0xb7, 0x9e, 0x44, 0x30, 0x2c, 0x19, 0x33, 0xcb, 0x4f, 0x27, 0x05, 0x4d}, 18},
+    {137, "NMR", {0x0b, 0xf5, 0x19, 0x07, 0x1b, 0x02, 0xf2, 0x2c, 0x17, 0xe7, 0xed, 0x5f, 0x40, 0x02, 0xee, 0x19, 0x11, 0xf4, 0x67, 0x29}, 18},
+    {137, "WMATIC", {0x0d, 0x50, 0x0b, 0x1d, 0x8e, 0x8e, 0xf3, 0x1e, 0x21, 0xc9, 0x9d, 0x1d, 0xb9, 0xa6, 0x44, 0x4d, 0x3a, 0xdf, 0x12, 0x70}, 18},
+    {137, "CRV", {0x17, 0x23, 0x70, 0xd5, 0xcd, 0x63, 0x27, 0x9e, 0xfa, 0x6d, 0x50, 0x2d, 0xab, 0x29, 0x17, 0x19, 0x33, 0xa6, 0x10, 0xaf}, 18},
+    {137, "REN", {0x19, 0x78, 0x2d, 0x3d, 0xc4, 0x70, 0x1c, 0xee, 0xed, 0xcd, 0x90, 0xf0, 0x99, 0x3f, 0x0a, 0x91, 0x26, 0xed, 0x89, 0xd0}, 18},
+    {137, "WBTC", {0x1b, 0xfd, 0x67, 0x03, 0x7b, 0x42, 0xcf, 0x73, 0xac, 0xf2, 0x04, 0x70, 0x67, 0xbd, 0x4f, 0x2c, 0x47, 0xd9, 0xbf, 0xd6}, 8},
+    {137, "USDC.e", {0x27, 0x91, 0xbc, 0xa1, 0xf2, 0xde, 0x46, 0x61, 0xed, 0x88, 0xa3, 0x0c, 0x99, 0xa7, 0xa9, 0x44, 0x9a, 0xa8, 0x41, 0x74}, 6},
+    {137, "UMA", {0x30, 0x66, 0x81, 0x88, 0x37, 0xc5, 0xe6, 0xed, 0x66, 0x01, 0xbd, 0x5a, 0x91, 0xb0, 0x76, 0x28, 0x77, 0xa6, 0xb7, 0x31}, 18},
+    {137, "KNC", {0x32, 0x4b, 0x28, 0xd6, 0x56, 0x5f, 0x78, 0x4d, 0x59, 0x64, 0x22, 0xb0, 0xf2, 0xe5, 0xab, 0x6e, 0x9c, 0xfa, 0x1d, 0xc7}, 18},
+    {137, "USDC", {0x3c, 0x49, 0x9c, 0x54, 0x2c, 0xef, 0x5e, 0x38, 0x11, 0xe1, 0x19, 0x2c, 0xe7, 0x0d, 0x8c, 0xc0, 0x3d, 0x5c, 0x33, 0x59}, 6},
+    {137, "KEEP", {0x42, 0xf3, 0x7a, 0x12, 0x96, 0xb2, 0x98, 0x1f, 0x7c, 0x3c, 0xac, 0xed, 0x84, 0xc5, 0x09, 0x6b, 0x2e, 0xb0, 0xc7, 0x2c}, 18},
+    {137, "SNX", {0x50, 0xb7, 0x28, 0xd8, 0xd9, 0x64, 0xfd, 0x00, 0xc2, 0xd0, 0xaa, 0xd8, 0x17, 0x18, 0xb7, 0x13, 0x11, 0xfe, 0xf6, 0x8a}, 18},
+    {137, "LINK", {0x53, 0xe0, 0xbc, 0xa3, 0x5e, 0xc3, 0x56, 0xbd, 0x5d, 0xdd, 0xfe, 0xbb, 0xd1, 0xfc, 0x0f, 0xd0, 0x3f, 0xab, 0xad, 0x39}, 18},
+    {137, "ZRX", {0x55, 0x59, 0xed, 0xb7, 0x47, 0x51, 0xa0, 0xed, 0xe9, 0xde, 0xa4, 0xdc, 0x23, 0xae, 0xe7, 0x2c, 0xca, 0x6b, 0xe3, 0xd5}, 18},
+    {137, "GRT", {0x5f, 0xe2, 0xb5, 0x8c, 0x01, 0x3d, 0x76, 0x01, 0x14, 0x7d, 0xcd, 0xd6, 0x8c, 0x14, 0x3a, 0x77, 0x49, 0x9f, 0x55, 0x31}, 18},
+    {137, "GNO", {0x5f, 0xfd, 0x62, 0xd3, 0xc3, 0xee, 0x2e, 0x81, 0xc0, 0x0a, 0x7b, 0x90, 0x79, 0xfb, 0x24, 0x8e, 0x7d, 0xf0, 0x24, 0xa8}, 18},
+    {137, "REPv2", {0x65, 0x63, 0xc1, 0x24, 0x48, 0x20, 0xcf, 0xbd, 0x6c, 0xa8, 0x82, 0x0f, 0xbd, 0xf0, 0xf2, 0x84, 0x73, 0x63, 0xf7, 0x33}, 18},
+    {137, "CVC", {0x66, 0xdc, 0x5a, 0x08, 0x09, 0x1d, 0x19, 0x68, 0xe0, 0x8c, 0x16, 0xaa, 0x5b, 0x27, 0xba, 0xc8, 0x39, 0x8b, 0x02, 0xbe}, 8},
+    {137, "LOOM", {0x66, 0xef, 0xb7, 0xcc, 0x64, 0x7e, 0x0e, 0xfa, 0xb0, 0x2e, 0xba, 0x43, 0x16, 0xa2, 0xd2, 0x94, 0x11, 0x93, 0xf6, 0xb3}, 18},
+    {137, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {137, "MKR", {0x6f, 0x7c, 0x93, 0x2e, 0x76, 0x84, 0x66, 0x6c, 0x9f, 0xd1, 0xd4, 0x45, 0x27, 0x76, 0x54, 0x33, 0xe0, 0x1f, 0xf6, 0x1d}, 18},
+    {137, "WETH", {0x7c, 0xeb, 0x23, 0xfd, 0x6b, 0xc0, 0xad, 0xd5, 0x9e, 0x62, 0xac, 0x25, 0x57, 0x82, 0x70, 0xcf, 0xf1, 0xb9, 0xf6, 0x19}, 18},
+    {137, "LRC", {0x84, 0xe1, 0x67, 0x0f, 0x61, 0x34, 0x7c, 0xda, 0xed, 0x56, 0xdc, 0xc7, 0x36, 0xfb, 0x99, 0x0f, 0xbb, 0x47, 0xdd, 0xc1}, 18},
+    {137, "COMP", {0x85, 0x05, 0xb9, 0xd2, 0x25, 0x4a, 0x7a, 0xe4, 0x68, 0xc0, 0xe9, 0xdd, 0x10, 0xcc, 0xea, 0x3a, 0x83, 0x7a, 0xef, 0x5c}, 18},
+    {137, "DAI", {0x8f, 0x3c, 0xf7, 0xad, 0x23, 0xcd, 0x3c, 0xad, 0xbd, 0x97, 0x35, 0xaf, 0xf9, 0x58, 0x02, 0x32, 0x39, 0xc6, 0xa0, 0x63}, 18},
+    {137, "OXT", {0x98, 0x80, 0xe3, 0xdd, 0xa1, 0x3c, 0x8e, 0x7d, 0x48, 0x04, 0x69, 0x1a, 0x45, 0x16, 0x01, 0x02, 0xd3, 0x1f, 0x60, 0x60}, 18},
+    {137, "BAL", {0x9a, 0x71, 0x01, 0x2b, 0x13, 0xca, 0x4d, 0x3d, 0x0c, 0xdc, 0x72, 0xa1, 0x77, 0xdf, 0x3e, 0xf0, 0x3b, 0x0e, 0x76, 0xa3}, 18},
+    {137, "MANA", {0xa1, 0xc5, 0x7f, 0x48, 0xf0, 0xde, 0xb8, 0x9f, 0x56, 0x9d, 0xfb, 0xe6, 0xe2, 0xb7, 0xf4, 0x6d, 0x33, 0x60, 0x6f, 0xd4}, 18},
+    {137, "BAND", {0xa8, 0xb1, 0xe0, 0x76, 0x4f, 0x85, 0xf5, 0x3d, 0xfe, 0x21, 0x76, 0x0e, 0x8a, 0xfe, 0x54, 0x46, 0xd8, 0x26, 0x06, 0xac}, 18},
+    {137, "UNI", {0xb3, 0x3e, 0xaa, 0xd8, 0xd9, 0x22, 0xb1, 0x08, 0x34, 0x46, 0xdc, 0x23, 0xf6, 0x10, 0xc2, 0x56, 0x7f, 0xb5, 0x18, 0x0f}, 18},
+    {137, "ENS", {0xbd, 0x7a, 0x5c, 0xf5, 0x1d, 0x22, 0x93, 0x0b, 0x8b, 0x3d, 0xf6, 0xd8, 0x34, 0xf9, 0xbc, 0xef, 0x90, 0xee, 0x7c, 0x4f}, 18},
+    {137, "USDT", {0xc2, 0x13, 0x2d, 0x05, 0xd3, 0x1c, 0x91, 0x4a, 0x87, 0xc6, 0x61, 0x1c, 0x10, 0x74, 0x8a, 0xeb, 0x04, 0xb5, 0x8e, 0x8f}, 6},
+    {137, "BNT", {0xc2, 0x6d, 0x47, 0xd5, 0xc3, 0x3a, 0xc7, 0x1a, 0xc5, 0xcf, 0x9f, 0x77, 0x6d, 0x63, 0xba, 0x29, 0x2a, 0x4f, 0x78, 0x42}, 18},
+    {137, "VOXEL", {0xd0, 0x25, 0x8a, 0x3f, 0xd0, 0x0f, 0x38, 0xaa, 0x80, 0x90, 0xdf, 0xee, 0x34, 0x3f, 0x10, 0xa9, 0xd4, 0xd3, 0x0d, 0x3f}, 18},
+    {137, "AAVE", {0xd6, 0xdf, 0x93, 0x2a, 0x45, 0xc0, 0xf2, 0x55, 0xf8, 0x51, 0x45, 0xf2, 0x86, 0xea, 0x0b, 0x29, 0x2b, 0x21, 0xc9, 0x0b}, 18},
+    {137, "STORJ", {0xd7, 0x23, 0x57, 0xda, 0xca, 0x2c, 0xf1, 0x1a, 0x5f, 0x15, 0x5b, 0x9f, 0xf7, 0x88, 0x0e, 0x59, 0x5a, 0x3f, 0x57, 0x92}, 8},
+    {137, "YFI", {0xda, 0x53, 0x71, 0x04, 0xd6, 0xa5, 0xed, 0xd5, 0x3c, 0x6f, 0xbb, 0xa9, 0xa8, 0x98, 0x70, 0x8e, 0x46, 0x52, 0x60, 0xb6}, 18},
+    {137, "XSGD", {0xdc, 0x33, 0x26, 0xe7, 0x1d, 0x45, 0x18, 0x6f, 0x11, 0x3a, 0x2f, 0x44, 0x89, 0x84, 0xca, 0x0e, 0x8d, 0x20, 0x19, 0x95}, 6},
+    {137, "agEUR", {0xe0, 0xb5, 0x2e, 0x49, 0x35, 0x7f, 0xd4, 0xda, 0xf2, 0xc1, 0x5e, 0x02, 0x05, 0x8d, 0xce, 0x6b, 0xc0, 0x05, 0x7d, 0xb4}, 18},
+    {137, "sUSD", {0xf8, 0x1b, 0x4b, 0xec, 0x6c, 0xa8, 0xf9, 0xfe, 0x7b, 0xe0, 0x1c, 0xa7, 0x34, 0xf5, 0x5b, 0x2b, 0x6e, 0x03, 0xa7, 0xa0}, 18},
+    {324, "ZK", {0x5a, 0x7d, 0x6b, 0x2f, 0x92, 0xc7, 0x7f, 0xad, 0x6c, 0xca, 0xbd, 0x7e, 0xe0, 0x62, 0x4e, 0x64, 0x90, 0x7e, 0xaf, 0x3e}, 18},
+    {480, "WBTC", {0x03, 0xc7, 0x05, 0x4b, 0xcb, 0x39, 0xf7, 0xb2, 0xe5, 0xb2, 0xc7, 0xac, 0xb3, 0x75, 0x83, 0xe3, 0x2d, 0x70, 0xcf, 0xa3}, 8},
+    {480, "WETH", {0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06}, 18},
+    {480, "USDC.e", {0x79, 0xa0, 0x24, 0x82, 0xa8, 0x80, 0xbc, 0xe3, 0xf1, 0x3e, 0x09, 0xda, 0x97, 0x0d, 0xc3, 0x4d, 0xb4, 0xcd, 0x24, 0xd1}, 6},
+    {8453, "LRC", {0x0d, 0x76, 0x0e, 0xe4, 0x79, 0x40, 0x1b, 0xb4, 0xc4, 0x0b, 0xdb, 0x76, 0x04, 0xb3, 0x29, 0xff, 0xf4, 0x11, 0xb3, 0xf2}, 18},
+    {8453, "GRT", {0x0f, 0x4d, 0x23, 0x7b, 0x09, 0xcb, 0x37, 0xd2, 0x07, 0xba, 0x60, 0x35, 0x3d, 0xc2, 0x54, 0xd4, 0x53, 0x0d, 0x4d, 0xf1}, 18},
+    {8453, "PRO", {0x18, 0xdd, 0x5b, 0x08, 0x7b, 0xca, 0x99, 0x20, 0x56, 0x2a, 0xff, 0x7a, 0x01, 0x99, 0xb9, 0x6b, 0x92, 0x30, 0x43, 0x8b}, 8},
+    {8453, "SEAM", {0x1c, 0x7a, 0x46, 0x04, 0x13, 0xdd, 0x4e, 0x96, 0x4f, 0x96, 0xd8, 0xdf, 0xc5, 0x6e, 0x72, 0x23, 0xce, 0x88, 0xcd, 0x85}, 18},
+    {8453, "ARPA", {0x1c, 0x9f, 0xa0, 0x1e, 0x87, 0x48, 0x77, 0x12, 0x70, 0x6f, 0xb4, 0x69, 0xa1, 0x3b, 0xeb, 0x23, 0x42, 0x62, 0xc8, 0x67}, 18},
+    {8453, "BOBA", {0x1f, 0x9b, 0xd9, 0x6d, 0xdb, 0x4b, 0xd0, 0x7d, 0x60, 0x61, 0xf8, 0x93, 0x3e, 0x9b, 0xa9, 0xed, 0xe9, 0x96, 0x75, 0x50}, 18},
+    {8453, "SNX", {0x22, 0xe6, 0x96, 0x6b, 0x79, 0x9c, 0x4d, 0x5b, 0x13, 0xbe, 0x96, 0x2e, 0x1d, 0x11, 0x7b, 0x56, 0x32, 0x7f, 0xda, 0x66}, 18},
+    {8453, "tBTC", {0x23, 0x6a, 0xa5, 0x09, 0x79, 0xd5, 0xf3, 0xde, 0x3b, 0xd1, 0xee, 0xb4, 0x0e, 0x81, 0x13, 0x7f, 0x22, 0xab, 0x79, 0x4b}, 18},
+    {8453, "CTSI", {0x25, 0x9f, 0xac, 0x10, 0xc5, 0xcb, 0xfe, 0xfe, 0x3e, 0x71, 0x0e, 0x1d, 0x94, 0x67, 0xf7, 0x0a, 0x76, 0x13, 0x8d, 0x45}, 18},
+    {8453, "cbETH", {0x2a, 0xe3, 0xf1, 0xec, 0x7f, 0x1f, 0x50, 0x12, 0xcf, 0xea, 0xb0, 0x18, 0x5b, 0xfc, 0x7a, 0xa3, 0xcf, 0x0d, 0xec, 0x22}, 18},
+    {8453, "MOG", {0x2d, 0xa5, 0x6a, 0xcb, 0x9e, 0xa7, 0x83, 0x30, 0xf9, 0x47, 0xbd, 0x57, 0xc5, 0x41, 0x19, 0xde, 0xbd, 0xa7, 0xaf, 0x71}, 18},
+    {8453, "FOX", {0x2d, 0xbe, 0x0d, 0x77, 0x9c, 0x7a, 0x04, 0xf7, 0xa5, 0xde, 0x83, 0x32, 0x69, 0x73, 0xef, 0xfe, 0x23, 0x35, 0x69, 0x30}, 18},
+    {8453, "LUSD", {0x36, 0x81, 0x81, 0x49, 0x97, 0x36, 0xd0, 0xc0, 0xcc, 0x61, 0x4d, 0xbb, 0x14, 0x5e, 0x2e, 0xc1, 0xac, 0x86, 0xb8, 0xc6}, 18},
+    {8453, "PSTAKE", {0x38, 0x81, 0x5a, 0x44, 0x55, 0x92, 0x16, 0x67, 0xd6, 0x73, 0xb4, 0xcb, 0x3d, 0x48, 0xf0, 0x38, 0x3e, 0xe9, 0x34, 0x00}, 18},
+    {8453, "ZRX", {0x3b, 0xb4, 0x44, 0x5d, 0x30, 0xac, 0x02, 0x0a, 0x84, 0xc1, 0xb5, 0xa8, 0xa2, 0xc6, 0x24, 0x8e, 0xbc, 0x97, 0x79, 0xd0}, 18},
+    {8453, "BAL", {0x41, 0x58, 0x73, 0x4d, 0x47, 0xfc, 0x96, 0x92, 0x17, 0x6b, 0x50, 0x85, 0xe0, 0xf5, 0x2e, 0xe0, 0xda, 0x5d, 0x47, 0xf1}, 18},
+    {8453, "WETH", {0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06}, 18},
+    {8453, "WAMPL", {0x48, 0x9f, 0xe4, 0x2c, 0x26, 0x7f, 0xe0, 0x36, 0x6b, 0x16, 0xb0, 0xc3, 0x9e, 0x7a, 0xee, 0xf9, 0x77, 0xe8, 0x41, 0xef}, 18},
+    {8453, "DEGEN", {0x4e, 0xd4, 0xe8, 0x62, 0x86, 0x0b, 0xed, 0x51, 0xa9, 0x57, 0x0b, 0x96, 0xd8, 0x9a, 0xf5, 0xe1, 0xb0, 0xef, 0xef, 0xed}, 18},
+    {8453, "DAI", {0x50, 0xc5, 0x72, 0x59, 0x49, 0xa6, 0xf0, 0xc7, 0x2e, 0x6c, 0x4a, 0x64, 0x1f, 0x24, 0x04, 0x9a, 0x91, 0x7d, 0xb0, 0xcb}, 18},
+    {8453, "LQTY", {0x52, 0x59, 0x38, 0x46, 0x90, 0xac, 0xf2, 0x40, 0xe9, 0xb0, 0xa8, 0x81, 0x1b, 0xd0, 0xff, 0xbf, 0xbd, 0xdc, 0x12, 0x5c}, 18},
+    {8453, "EURC", {0x60, 0xa3, 0xe3, 0x5c, 0xc3, 0x02, 0xbf, 0xa4, 0x4c, 0xb2, 0x88, 0xbc, 0x5a, 0x4f, 0x31, 0x6f, 0xdb, 0x1a, 0xdb, 0x42}, 6},
+    {8453, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {8453, "OGN", {0x70, 0x02, 0x45, 0x8b, 0x1d, 0xf5, 0x9e, 0xcc, 0xb5, 0x73, 0x87, 0xbc, 0x79, 0xff, 0xc7, 0xc2, 0x9e, 0x22, 0xe6, 0xf7}, 18},
+    {8453, "FET", {0x74, 0xf8, 0x04, 0xb4, 0x14, 0x0e, 0xe7, 0x08, 0x30, 0xb3, 0xee, 0xf4, 0xe6, 0x90, 0x32, 0x58, 0x41, 0x57, 0x5f, 0x89}, 18},
+    {8453, "APU", {0x7a, 0x2c, 0x5e, 0x77, 0x88, 0xe5, 0x5e, 0xc0, 0xa7, 0xba, 0x4a, 0xee, 0xc5, 0xb3, 0xda, 0x32, 0x27, 0x18, 0xfb, 0x5e}, 18},
+    {8453, "MLN", {0x7c, 0x29, 0x86, 0x64, 0xbd, 0x65, 0x82, 0xf6, 0xf2, 0x64, 0xc2, 0xcb, 0x5a, 0x4b, 0x9c, 0xc0, 0x9b, 0x6e, 0x38, 0x89}, 18},
+    {8453, "SUSHI", {0x7d, 0x49, 0xa0, 0x65, 0xd1, 0x7d, 0x6d, 0x4a, 0x55, 0xdc, 0x13, 0x64, 0x99, 0x01, 0xfd, 0xbb, 0x98, 0xb2, 0xaf, 0xba}, 18},
+    {8453, "USDC", {0x83, 0x35, 0x89, 0xfc, 0xd6, 0xed, 0xb6, 0xe0, 0x8f, 0x4c, 0x7c, 0x32, 0xd4, 0xf7, 0x1b, 0x54, 0xbd, 0xa0, 0x29, 0x13}, 6},
+    {8453, "CRV", {0x8e, 0xe7, 0x3c, 0x48, 0x4a, 0x26, 0xe0, 0xa5, 0xdf, 0x2e, 0xe2, 0xa4, 0x96, 0x0b, 0x78, 0x99, 0x67, 0xdd, 0x04, 0x15}, 18},
+    {8453, "AERO", {0x94, 0x01, 0x81, 0xa9, 0x4a, 0x35, 0xa4, 0x56, 0x9e, 0x45, 0x29, 0xa3, 0xcd, 0xfb, 0x74, 0xe3, 0x8f, 0xd9, 0x86, 0x31}, 18},
+    {8453, "FORTH", {0x96, 0x8b, 0x23, 0x23, 0xd4, 0xb0, 0x05, 0xc7, 0xd3, 0x9c, 0x67, 0xd3, 0x17, 0x74, 0xfe, 0x83, 0xc9, 0x94, 0x3a, 0x60}, 18},
+    {8453, "ALI", {0x97, 0xc8, 0x06, 0xe7, 0x66, 0x5d, 0x3a, 0xfd, 0x84, 0xa8, 0xfe, 0x18, 0x37, 0x92, 0x14, 0x03, 0xd5, 0x9f, 0x3d, 0xcc}, 18},
+    {8453, "COMP", {0x9e, 0x10, 0x28, 0xf5, 0xf1, 0xd5, 0xed, 0xe5, 0x97, 0x48, 0xff, 0xce, 0xe5, 0x53, 0x25, 0x09, 0x97, 0x68, 0x40, 0xe0}, 18},
+    {8453, "YFI", {0x9e, 0xaf, 0x8c, 0x1e, 0x34, 0xf0, 0x5a, 0x58, 0x9e, 0xda, 0x6b, 0xaf, 0xdf, 0x39, 0x1c, 0xf6, 0xad, 0x3c, 0xb2, 0x39}, 18},
+    {8453, "BTRST", {0xa7, 0xd6, 0x8d, 0x15, 0x5d, 0x17, 0xcb, 0x30, 0xe3, 0x11, 0x36, 0x7c, 0x2e, 0xf1, 0xe8, 0x2a, 0xb6, 0x02, 0x2b, 0x67}, 18},
+    {8453, "TRAC", {0xa8, 0x1a, 0x52, 0xb4, 0xdd, 0xa0, 0x10, 0x89, 0x6c, 0xdd, 0x38, 0x6c, 0x7f, 0xbd, 0xc5, 0xcd, 0xc8, 0x35, 0xba, 0x23}, 18},
+    {8453, "WELL", {0xa8, 0x85, 0x94, 0xd4, 0x04, 0x72, 0x76, 0x25, 0xa9, 0x43, 0x7c, 0x3f, 0x88, 0x6c, 0x76, 0x43, 0x87, 0x22, 0x96, 0xae}, 18},
+    {8453, "YGG", {0xaa, 0xc7, 0x8d, 0x12, 0x19, 0xc0, 0x8a, 0xec, 0xc8, 0xe3, 0x7e, 0x03, 0x85, 0x8f, 0xe8, 0x85, 0xf5, 0xef, 0x17, 0x99}, 18},
+    {8453, "AMP", {0xb3, 0x58, 0x48, 0x9d, 0x5d, 0x92, 0x64, 0x1e, 0xdb, 0x4d, 0x8e, 0xe8, 0x06, 0x3f, 0x80, 0x05, 0x96, 0x43, 0x46, 0xba}, 18},
+    {8453, "PEPE", {0xb4, 0xfd, 0xe5, 0x9a, 0x77, 0x99, 0x91, 0xbf, 0xb6, 0xa5, 0x22, 0x53, 0xb5, 0x19, 0x47, 0x82, 0x8b, 0x98, 0x2b, 0xe3}, 18},
+    {8453, "LRDS", {0xb6, 0x76, 0xf8, 0x7a, 0x6e, 0x70, 0x1f, 0x0d, 0xe8, 0xde, 0x5a, 0xb9, 0x1b, 0x56, 0xb6, 0x61, 0x09, 0x76, 0x6d, 0xb1}, 18},
+    {8453, "MORPHO", {0xba, 0xa5, 0xcc, 0x21, 0xfd, 0x48, 0x7b, 0x8f, 0xcc, 0x2f, 0x63, 0x2f, 0x3f, 0x4e, 0x8d, 0x37, 0x26, 0x2a, 0x08, 0x42}, 18},
+    {8453, "CTX", {0xbb, 0x22, 0xff, 0x86, 0x7f, 0x8c, 0xa3, 0xd5, 0xf2, 0x25, 0x1b, 0x40, 0x84, 0xf6, 0xec, 0x86, 0xd4, 0x66, 0x6e, 0x14}, 18},
+    {8453, "IOTX", {0xbc, 0xba, 0xf3, 0x11, 0xce, 0xc8, 0xa4, 0xea, 0xc0, 0x43, 0x01, 0x93, 0xa5, 0x28, 0xd9, 0xff, 0x27, 0xae, 0x38, 0xc1}, 18},
+    {8453, "UNI", {0xc3, 0xde, 0x83, 0x0e, 0xa0, 0x75, 0x24, 0xa0, 0x76, 0x16, 0x46, 0xa6, 0xa4, 0xe4, 0xbe, 0x0e, 0x11, 0x4a, 0x3c, 0x83}, 18},
+    {8453, "1INCH", {0xc5, 0xfe, 0xcc, 0x3a, 0x29, 0xfb, 0x57, 0xb5, 0x02, 0x4e, 0xec, 0x8a, 0x22, 0x39, 0xd4, 0x62, 0x1e, 0x11, 0x1c, 0xbe}, 18},
+    {8453, "cbBTC", {0xcb, 0xb7, 0xc0, 0x00, 0x0a, 0xb8, 0x8b, 0x47, 0x3b, 0x1f, 0x5a, 0xfd, 0x9e, 0xf8, 0x08, 0x44, 0x0e, 0xed, 0x33, 0xbf}, 8},
+    {8453, "GHST", {0xcd, 0x2f, 0x22, 0x23, 0x6d, 0xd9, 0xdf, 0xe2, 0x35, 0x6d, 0x7c, 0x54, 0x31, 0x61, 0xd4, 0xd2, 0x60, 0xfd, 0x9b, 0xcb}, 18},
+    {8453, "FARM", {0xd0, 0x8a, 0x29, 0x17, 0x65, 0x3d, 0x4e, 0x46, 0x08, 0x93, 0x20, 0x34, 0x71, 0xf0, 0x00, 0x08, 0x26, 0xfb, 0x40, 0x34}, 18},
+    {8453, "XYO", {0xd7, 0xb9, 0x9f, 0xfb, 0x8b, 0x2a, 0xfc, 0x6f, 0xe0, 0x13, 0xa1, 0x72, 0x07, 0xcb, 0xe5, 0x0f, 0x22, 0x3a, 0xdc, 0x94}, 18},
+    {8453, "USDbC", {0xd9, 0xaa, 0xec, 0x86, 0xb6, 0x5d, 0x86, 0xf6, 0xa7, 0xb5, 0xb1, 0xb0, 0xc4, 0x2f, 0xfa, 0x53, 0x17, 0x10, 0xb6, 0xca}, 6},
+    {8453, "BICO", {0xf5, 0xdb, 0xaa, 0x3d, 0xfc, 0x5e, 0x81, 0x40, 0x5c, 0x73, 0x06, 0x03, 0x9f, 0xb0, 0x37, 0xa3, 0xdc, 0xd5, 0x7c, 0xe2}, 18},
+    {8453, "TRB", {0xf8, 0xe9, 0xe6, 0x1f, 0xfb, 0x2b, 0x49, 0x1f, 0x7d, 0xf2, 0x98, 0x23, 0xa7, 0x60, 0x09, 0x74, 0x36, 0x71, 0xcd, 0x96}, 18},
+    {8453, "PRIME", {0xfa, 0x98, 0x0c, 0xed, 0x68, 0x95, 0xac, 0x31, 0x4e, 0x7d, 0xe3, 0x4e, 0xf1, 0xbf, 0xae, 0x90, 0xa5, 0xad, 0xd2, 0x1b}, 18},
+    {8453, "JAM", {0xff, 0x99, 0x57, 0x81, 0x6c, 0x81, 0x3c, 0x5a, 0xd0, 0xb9, 0x88, 0x1a, 0x89, 0x90, 0xdf, 0x1e, 0x3a, 0xa2, 0xa0, 0x57}, 18},
+    {42161, "BAL", {0x04, 0x0d, 0x1e, 0xdc, 0x95, 0x69, 0xd4, 0xba, 0xb2, 0xd1, 0x52, 0x87, 0xdc, 0x5a, 0x4f, 0x10, 0xf5, 0x6a, 0x56, 0xb8}, 18},
+    {42161, "POL", {0x04, 0x4d, 0x8e, 0x7f, 0x3a, 0x17, 0x75, 0x1d, 0x52, 0x1e, 0xfe, 0xa8, 0xcc, 0xf9, 0x28, 0x22, 0x68, 0xfe, 0x08, 0xcc}, 18},
+    {42161, "ETHFI", {0x07, 0xd6, 0x5c, 0x18, 0xce, 0xcb, 0xa4, 0x23, 0x29, 0x8c, 0x0a, 0xeb, 0x5d, 0x2b, 0xed, 0xed, 0x4d, 0xfd, 0x57, 0x36}, 18},
+    {42161, "T", {0x09, 0x45, 0xca, 0xe3, 0xae, 0x47, 0xcb, 0x38, 0x4b, 0x2d, 0x47, 0xbc, 0x44, 0x8d, 0xc6, 0xa9, 0xde, 0xc2, 0x1f, 0x55}, 18},
+    {42161, "BOND", {0x0d, 0x81, 0xe5, 0x0b, 0xc6, 0x77, 0xfa, 0x67, 0x34, 0x1c, 0x44, 0xd7, 0xea, 0xa9, 0x22, 0x8d, 0xee, 0x64, 0xa4, 0xe1}, 18},
+    {42161, "CRV", {0x11, 0xcd, 0xb4, 0x2b, 0x0e, 0xb4, 0x6d, 0x95, 0xf9, 0x90, 0xbe, 0xdd, 0x46, 0x95, 0xa6, 0xe3, 0xfa, 0x03, 0x49, 0x78}, 18},
+    {42161, "LDO", {0x13, 0xad, 0x51, 0xed, 0x4f, 0x1b, 0x7e, 0x9d, 0xc1, 0x68, 0xd8, 0xa0, 0x0c, 0xb3, 0xf4, 0xdd, 0xd8, 0x5e, 0xfa, 0x60}, 18},
+    {42161, "SD", {0x16, 0x29, 0xc4, 0x11, 0x29, 0x52, 0xa7, 0xa3, 0x77, 0xcb, 0x9b, 0x8d, 0x7d, 0x8c, 0x90, 0x30, 0x92, 0xf3, 0x4b, 0x63}, 18},
+    {42161, "HOPR", {0x17, 0x7f, 0x39, 0x4a, 0x3e, 0xd1, 0x8f, 0xaa, 0x85, 0xc1, 0x46, 0x2a, 0xe6, 0x26, 0x43, 0x8a, 0x70, 0x29, 0x4e, 0xf7}, 18},
+    {42161, "SYN", {0x1b, 0xcf, 0xc0, 0xb4, 0xee, 0x14, 0x71, 0x67, 0x4c, 0xd6, 0xa9, 0xf6, 0xb3, 0x63, 0xa0, 0x34, 0x37, 0x5e, 0xad, 0x84}, 18},
+    {42161, "ORN", {0x1b, 0xdc, 0xc2, 0x07, 0x5d, 0x53, 0x70, 0x29, 0x3e, 0x24, 0x8c, 0xab, 0x01, 0x73, 0xec, 0x3e, 0x55, 0x1e, 0x62, 0x18}, 8},
+    {42161, "ANKR", {0x1b, 0xfc, 0x5d, 0x35, 0xbf, 0x0f, 0x7b, 0x9e, 0x15, 0xdc, 0x24, 0xc7, 0x8b, 0x8c, 0x02, 0xdb, 0xc1, 0xe9, 0x54, 0x47}, 18},
+    {42161, "WAMPL", {0x1c, 0x8e, 0xc4, 0xde, 0x3c, 0x2b, 0xfd, 0x30, 0x50, 0x69, 0x5d, 0x89, 0x85, 0x3e, 0xc6, 0xd7, 0x8a, 0xe6, 0x50, 0xbb}, 18},
+    {42161, "REQ", {0x1c, 0xb5, 0xbb, 0xc6, 0x4e, 0x14, 0x8c, 0x5b, 0x88, 0x9e, 0x3c, 0x66, 0x7b, 0x49, 0xed, 0xf7, 0x8b, 0xb9, 0x21, 0x71}, 18},
+    {42161, "cbETH", {0x1d, 0xeb, 0xd7, 0x3e, 0x75, 0x2b, 0xea, 0xf7, 0x98, 0x65, 0xfd, 0x64, 0x46, 0xb0, 0xc9, 0x70, 0xea, 0xe7, 0x73, 0x2f}, 18},
+    {42161, "ERN", {0x23, 0x54, 0xc8, 0xe9, 0xea, 0x89, 0x8c, 0x75, 0x1f, 0x1a, 0x15, 0xad, 0xde, 0xb0, 0x48, 0x71, 0x4d, 0x66, 0x7f, 0x96}, 18},
+    {42161, "AXL", {0x23, 0xee, 0x23, 0x43, 0xb8, 0x92, 0xb1, 0xbb, 0x63, 0x50, 0x3a, 0x4f, 0xab, 0xc8, 0x40, 0xe0, 0xe2, 0xc6, 0x81, 0x0f}, 6},
+    {42161, "JASMY", {0x25, 0xf0, 0x56, 0x99, 0x54, 0x8d, 0x3a, 0x08, 0x20, 0xb9, 0x9f, 0x93, 0xc1, 0x0c, 0x8b, 0xb5, 0x73, 0xe2, 0x70, 0x83}, 18},
+    {42161, "LPT", {0x28, 0x9b, 0xa1, 0x70, 0x1c, 0x2f, 0x08, 0x8c, 0xf0, 0xfa, 0xf8, 0xb3, 0x70, 0x52, 0x46, 0x33, 0x1c, 0xb8, 0xa8, 0x39}, 18},
+    {42161, "MPL", {0x29, 0x02, 0x48, 0x32, 0xec, 0x3b, 0xab, 0xf5, 0x07, 0x4d, 0x4f, 0x46, 0x10, 0x2a, 0xa9, 0x88, 0x09, 0x7f, 0x0c, 0xa0}, 18},
+    {42161, "INJ", {0x2a, 0x20, 0x53, 0xcb, 0x63, 0x3c, 0xad, 0x46, 0x5b, 0x4a, 0x89, 0x75, 0xed, 0x3d, 0x7f, 0x09, 0xdf, 0x60, 0x8f, 0x80}, 18},
+    {42161, "GALA", {0x2a, 0x67, 0x6e, 0xea, 0xd1, 0x59, 0xc4, 0xc8, 0xe8, 0x59, 0x34, 0x71, 0xc6, 0xd6, 0x66, 0xf0, 0x28, 0x27, 0xff, 0x8c}, 8},
+    {42161, "MKR", {0x2e, 0x9a, 0x6d, 0xf7, 0x8e, 0x42, 0xa3, 0x07, 0x12, 0xc1, 0x0a, 0x9d, 0xc4, 0xb1, 0xc8, 0x65, 0x6f, 0x8f, 0x28, 0x79}, 18},
+    {42161, "RBC", {0x2e, 0x9a, 0xe8, 0xf1, 0x78, 0xd5, 0xea, 0x81, 0x97, 0x0c, 0x77, 0x99, 0xa3, 0x77, 0xb3, 0x98, 0x5c, 0xbc, 0x33, 0x5f}, 18},
+    {42161, "WBTC", {0x2f, 0x2a, 0x25, 0x43, 0xb7, 0x6a, 0x41, 0x66, 0x54, 0x9f, 0x7a, 0xab, 0x2e, 0x75, 0xbe, 0xf0, 0xae, 0xfc, 0x5b, 0x0f}, 8},
+    {42161, "BUSD", {0x31, 0x19, 0x02, 0x54, 0x50, 0x46, 0x22, 0xce, 0xfd, 0xfa, 0x55, 0xa7, 0xd3, 0xd2, 0x72, 0xe6, 0x46, 0x26, 0x29, 0xa2}, 18},
+    {42161, "CTSI", {0x31, 0x9f, 0x86, 0x5b, 0x28, 0x7f, 0xcc, 0x10, 0xb3, 0x0d, 0x8c, 0xe6, 0x14, 0x4e, 0x8b, 0x6d, 0x1b, 0x47, 0x69, 0x99}, 18},
+    {42161, "BAT", {0x34, 0x50, 0x68, 0x7e, 0xf1, 0x41, 0xdc, 0xd6, 0x11, 0x0b, 0x77, 0xc2, 0xdc, 0x44, 0xb0, 0x08, 0x61, 0x6a, 0xee, 0x75}, 18},
+    {42161, "LIT", {0x34, 0x9f, 0xc9, 0x3d, 0xa0, 0x04, 0xa6, 0x3f, 0x3b, 0x13, 0x43, 0x36, 0x14, 0x65, 0x98, 0x13, 0x30, 0xa4, 0x0b, 0x25}, 18},
+    {42161, "COMP", {0x35, 0x4a, 0x6d, 0xa3, 0xfc, 0xde, 0x09, 0x8f, 0x83, 0x89, 0xca, 0xd8, 0x4b, 0x01, 0x82, 0x72, 0x5c, 0x6c, 0x91, 0xde}, 18},
+    {42161, "PEPE", {0x35, 0xe6, 0xa5, 0x9f, 0x78, 0x6d, 0x92, 0x66, 0xc7, 0x96, 0x1e, 0xa2, 0x8c, 0x7b, 0x76, 0x8b, 0x33, 0x95, 0x9c, 0xbb}, 18},
+    {42161, "AEVO", {0x37, 0x7c, 0x1f, 0xc7, 0x3d, 0x4d, 0x0f, 0x56, 0x00, 0xcd, 0x94, 0x37, 0x76, 0xce, 0xd0, 0x7c, 0x2b, 0x97, 0x83, 0xcd}, 18},
+    {42161, "FORT", {0x3a, 0x14, 0x29, 0xd5, 0x0e, 0x0c, 0xbb, 0xc4, 0x5c, 0x99, 0x7a, 0xf6, 0x00, 0x54, 0x1f, 0xe1, 0xcc, 0x3d, 0x29, 0x23}, 18},
+    {42161, "KUJI", {0x3a, 0x18, 0xdc, 0xc9, 0x74, 0x5e, 0xdc, 0xd1, 0xef, 0x33, 0xec, 0xb9, 0x3b, 0x0b, 0x6e, 0xba, 0x56, 0x71, 0xe7, 0xca}, 6},
+    {42161, "CELR", {0x3a, 0x8b, 0x78, 0x7f, 0x78, 0xd7, 0x75, 0xae, 0xcf, 0xee, 0xa1, 0x57, 0x06, 0xd4, 0x22, 0x1b, 0x40, 0xf3, 0x45, 0xab}, 18},
+    {42161, "DEXT", {0x3b, 0xe7, 0xcb, 0x2e, 0x94, 0x13, 0xef, 0x8f, 0x42, 0xb4, 0xa2, 0x02, 0xa0, 0x11, 0x4e, 0xb5, 0x9b, 0x64, 0xe2, 0x27}, 18},
+    {42161, "IMX", {0x3c, 0xfd, 0x99, 0x59, 0x3a, 0x7f, 0x03, 0x5f, 0x71, 0x71, 0x42, 0x09, 0x5a, 0x38, 0x98, 0xe3, 0xfc, 0xa7, 0x78, 0x3e}, 18},
+    {42161, "ELON", {0x3e, 0x4c, 0xff, 0x6e, 0x50, 0xf3, 0x7f, 0x73, 0x12, 0x84, 0xa9, 0x2d, 0x44, 0xae, 0x94, 0x3e, 0x17, 0x07, 0x7f, 0xd4}, 18},
+    {42161, "SPELL", {0x3e, 0x66, 0x48, 0xc5, 0xa7, 0x0a, 0x15, 0x0a, 0x88, 0xbc, 0xe6, 0x5f, 0x4a, 0xd4, 0xd5, 0x06, 0xfe, 0x15, 0xd2, 0xaf}, 18},
+    {42161, "BIT", {0x40, 0x6c, 0x8d, 0xb5, 0x06, 0x65, 0x3d, 0x88, 0x22, 0x95, 0x87, 0x5f, 0x63, 0x3b, 0xec, 0x0b, 0xeb, 0x92, 0x1c, 0x2a}, 18},
+    {42161, "MANA", {0x44, 0x2d, 0x24, 0x57, 0x8a, 0x56, 0x4e, 0xf6, 0x28, 0xa6, 0x5e, 0x6a, 0x7e, 0x3e, 0x7b, 0xe2, 0xa1, 0x65, 0xe2, 0x31}, 18},
+    {42161, "DPI", {0x46, 0x67, 0xcf, 0x53, 0xc4, 0xed, 0xf6, 0x59, 0xe4, 0x02, 0xb7, 0x33, 0xbe, 0xa4, 0x2b, 0x18, 0xb6, 0x8d, 0xd7, 0x4c}, 18},
+    {42161, "LRC", {0x46, 0xd0, 0xce, 0x7d, 0xe6, 0x24, 0x7b, 0x0a, 0x95, 0xf6, 0x7b, 0x43, 0xb5, 0x89, 0xb4, 0x04, 0x1b, 0xae, 0x7f, 0xbe}, 18},
+    {42161, "FET", {0x4b, 0xe8, 0x7c, 0x76, 0x6a, 0x7c, 0xe1, 0x1d, 0x5c, 0xc8, 0x64, 0xb6, 0xc3, 0xab, 0xb7, 0x45, 0x7d, 0xcc, 0x4c, 0xc9}, 18},
+    {42161, "CELO", {0x4e, 0x51, 0xac, 0x49, 0xbc, 0x5e, 0x2d, 0x87, 0xe0, 0xef, 0x71, 0x3e, 0x9e, 0x5a, 0xb2, 0xd7, 0x1e, 0xf4, 0xf3, 0x36}, 18},
+    {42161, "POWR", {0x4e, 0x91, 0xf2, 0xaf, 0x1e, 0xe0, 0xf8, 0x4b, 0x52, 0x94, 0x78, 0xf1, 0x97, 0x94, 0xf5, 0xaf, 0xd4, 0x23, 0xe4, 0xa6}, 6},
+    {42161, "SKL", {0x4f, 0x9b, 0x7d, 0xed, 0xd8, 0x86, 0x58, 0x71, 0xdf, 0x65, 0xc5, 0xd2, 0x6b, 0x1c, 0x2d, 0xd5, 0x37, 0x26, 0x78, 0x78}, 18},
+    {42161, "SHIB", {0x50, 0x33, 0x83, 0x3c, 0x9f, 0xe8, 0xb9, 0xd3, 0xe0, 0x9e, 0xed, 0x2f, 0x73, 0xd2, 0xaa, 0xf7, 0xe3, 0x87, 0x2f, 0xd1}, 18},
+    {42161, "DYDX", {0x51, 0x86, 0x3c, 0xb9, 0x0c, 0xe5, 0xd6, 0xda, 0x96, 0x63, 0x10, 0x6f, 0x29, 0x2f, 0xa2, 0x7c, 0x8c, 0xc9, 0x0c, 0x5a}, 18},
+    {42161, "NCT", {0x53, 0x23, 0x60, 0x15, 0xa6, 0x75, 0xfc, 0xb9, 0x37, 0x48, 0x5f, 0x1a, 0xe5, 0x80, 0x40, 0xe4, 0xfb, 0x92, 0x0d, 0x5b}, 18},
+    {42161, "MASK", {0x53, 0x3a, 0x7b, 0x41, 0x4c, 0xd1, 0x23, 0x68, 0x15, 0xa5, 0xe0, 0x9f, 0x1e, 0x97, 0xfc, 0x7d, 0x5c, 0x31, 0x37, 0x39}, 18},
+    {42161, "ACX", {0x53, 0x69, 0x15, 0x96, 0xd1, 0xbc, 0xe8, 0xce, 0xa5, 0x65, 0xb8, 0x4d, 0x49, 0x15, 0xe6, 0x9e, 0x03, 0xd9, 0xc9, 0x9d}, 18},
+    {42161, "MAGIC", {0x53, 0x9b, 0xde, 0x0d, 0x7d, 0xbd, 0x33, 0x6b, 0x79, 0x14, 0x8a, 0xa7, 0x42, 0x88, 0x31, 0x98, 0xbb, 0xf6, 0x03, 0x42}, 18},
+    {42161, "MV", {0x54, 0x45, 0x97, 0x2e, 0x76, 0xc5, 0xe4, 0xce, 0xdd, 0x12, 0xb6, 0xe2, 0xbc, 0xef, 0x69, 0x13, 0x3e, 0x15, 0x99, 0x2f}, 18},
+    {42161, "MATIC", {0x56, 0x18, 0x77, 0xb6, 0xb3, 0xdd, 0x76, 0x51, 0x31, 0x37, 0x94, 0xe5, 0xf2, 0x89, 0x4b, 0x2f, 0x18, 0xbe, 0x07, 0x66}, 18},
+    {42161, "GYEN", {0x58, 0x9d, 0x35, 0x65, 0x66, 0x41, 0xd6, 0xab, 0x57, 0xa5, 0x45, 0xf0, 0x8c, 0xf4, 0x73, 0xec, 0xd9, 0xb6, 0xd5, 0xf7}, 6},
+    {42161, "XCN", {0x58, 0xbb, 0xc0, 0x87, 0xe3, 0x6d, 0xb4, 0x0a, 0x84, 0xb2, 0x2c, 0x1b, 0x93, 0xa0, 0x42, 0x29, 0x4d, 0xee, 0xaf, 0xed}, 18},
+    {42161, "NMR", {0x59, 0x77, 0x01, 0xb3, 0x25, 0x53, 0xb9, 0xfa, 0x47, 0x3e, 0x21, 0x36, 0x2d, 0x48, 0x0b, 0x3a, 0x6b, 0x56, 0x97, 0x11}, 18},
+    {42161, "TURBO", {0x5c, 0x81, 0x6d, 0x45, 0x82, 0xc8, 0x57, 0xdc, 0xad, 0xb1, 0xbb, 0x1f, 0x62, 0xad, 0x6c, 0x9d, 0xed, 0xe4, 0x57, 0x6a}, 18},
+    {42161, "EIGEN", {0x60, 0x6c, 0x3e, 0x50, 0x75, 0xe5, 0x55, 0x5e, 0x79, 0xaa, 0x15, 0xf1, 0xe9, 0xfa, 0xcb, 0x77, 0x6f, 0x96, 0xc2, 0x48}, 18},
+    {42161, "ILV", {0x61, 0xca, 0x9d, 0x18, 0x6f, 0x6b, 0x9a, 0x79, 0x3b, 0xc0, 0x8f, 0x6c, 0x79, 0xfd, 0x35, 0xf2, 0x05, 0x48, 0x86, 0x73}, 18},
+    {42161, "1INCH", {0x63, 0x14, 0xc3, 0x1a, 0x7a, 0x16, 0x52, 0xce, 0x48, 0x2c, 0xff, 0xe2, 0x47, 0xe9, 0xcb, 0x7c, 0x3f, 0x4b, 0xb9, 0xaf}, 18},
+    {42161, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {42161, "CQT", {0x69, 0xb9, 0x37, 0xdb, 0x79, 0x9a, 0x9b, 0xec, 0xc9, 0xe8, 0xa6, 0xf0, 0xa5, 0xd3, 0x6e, 0xa3, 0x65, 0x72, 0x73, 0xbf}, 18},
+    {42161, "Zeta", {0x6d, 0xdb, 0xbc, 0xe7, 0x85, 0x8d, 0x27, 0x66, 0x78, 0xfc, 0x2b, 0x36, 0x12, 0x3f, 0xd6, 0x05, 0x47, 0xb8, 0x89, 0x54}, 18},
+    {42161, "COTI", {0x6f, 0xe1, 0x4d, 0x3c, 0xc2, 0xf7, 0xbd, 0xdf, 0xfb, 0xa5, 0xcd, 0xb3, 0xbb, 0xe7, 0x46, 0x7d, 0xd8, 0x1e, 0xa1, 0x01}, 18},
+    {42161, "OGN", {0x6f, 0xeb, 0x26, 0x2f, 0xeb, 0x0f, 0x77, 0x5b, 0x53, 0x12, 0xd2, 0xe0, 0x09, 0x92, 0x3f, 0x7f, 0x58, 0xae, 0x42, 0x3e}, 18},
+    {42161, "SNT", {0x70, 0x7f, 0x63, 0x59, 0x51, 0x19, 0x3d, 0xda, 0xfb, 0xb4, 0x09, 0x71, 0xa0, 0xfc, 0xaa, 0xb8, 0xa6, 0x41, 0x51, 0x60}, 18},
+    {42161, "FRAX", {0x74, 0x68, 0xa5, 0xd8, 0xe0, 0x22, 0x45, 0xb0, 0x0e, 0x8c, 0x02, 0x17, 0xfc, 0xe0, 0x21, 0xc7, 0x0b, 0xc5, 0x13, 0x05}, 18},
+    {42161, "APE", {0x74, 0x88, 0x5b, 0x4d, 0x52, 0x4d, 0x49, 0x72, 0x61, 0x25, 0x9b, 0x38, 0x90, 0x0f, 0x54, 0xe6, 0xdb, 0xad, 0x22, 0x10}, 18},
+    {42161, "PERP", {0x75, 0x3d, 0x22, 0x4b, 0xcf, 0x9a, 0xaf, 0xac, 0xd8, 0x15, 0x58, 0xc3, 0x23, 0x41, 0x41, 0x6d, 0xf6, 0x1d, 0x3d, 0xac}, 18},
+    {42161, "USDP", {0x78, 0xdf, 0x3a, 0x60, 0x44, 0xce, 0x3c, 0xb1, 0x90, 0x55, 0x00, 0x34, 0x5b, 0x96, 0x77, 0x88, 0xb6, 0x99, 0xdf, 0x8f}, 18},
+    {42161, "BNT", {0x7a, 0x24, 0x15, 0x96, 0x72, 0xb8, 0x3e, 0xd1, 0xb8, 0x94, 0x67, 0xc9, 0xd6, 0xa9, 0x95, 0x56, 0xba, 0x06, 0xd0, 0x73}, 18},
+    {42161, "MULTI", {0x7b, 0x9b, 0x94, 0xae, 0xbe, 0x5e, 0x20, 0x39, 0x53, 0x1a, 0xf8, 0xe3, 0x10, 0x45, 0xf3, 0x77, 0xec, 0xd9, 0xa3, 0x9a}, 18},
+    {42161, "tBTC", {0x7e, 0x2a, 0x1e, 0xde, 0xe1, 0x71, 0xc5, 0xb1, 0x9e, 0x6c, 0x54, 0xd7, 0x37, 0x52, 0x39, 0x6c, 0x0a, 0x57, 0x25, 0x94}, 18},
+    {42161, "METIS", {0x7f, 0x72, 0x8f, 0x35, 0x95, 0xdb, 0x17, 0xb0, 0xb3, 0x59, 0xf4, 0xfc, 0x47, 0xae, 0x80, 0xfa, 0xd2, 0xe3, 0x37, 0x69}, 18},
+    {42161, "GTC", {0x7f, 0x9a, 0x7d, 0xb8, 0x53, 0xca, 0x81, 0x6b, 0x9a, 0x13, 0x8a, 0xee, 0x33, 0x80, 0xef, 0x34, 0xc4, 0x37, 0xde, 0xe0}, 18},
+    {42161, "SUPER", {0x7f, 0x9c, 0xf5, 0xa2, 0x63, 0x0a, 0x0d, 0x58, 0x56, 0x71, 0x22, 0x21, 0x7d, 0xf7, 0x60, 0x9c, 0x26, 0x49, 0x89, 0x56}, 18},
+    {42161, "ENJ", {0x7f, 0xa9, 0x54, 0x97, 0x91, 0xef, 0xc9, 0x03, 0x0e, 0x1e, 0xd3, 0xf2, 0x5d, 0x18, 0x01, 0x41, 0x63, 0x80, 0x67, 0x58}, 18},
+    {42161, "PRQ", {0x82, 0x16, 0x4a, 0x8b, 0x64, 0x64, 0x01, 0xa8, 0x77, 0x6f, 0x9d, 0xc5, 0xc8, 0xcb, 0xa3, 0x5d, 0xca, 0xf6, 0x0c, 0xd2}, 18},
+    {42161, "WETH", {0x82, 0xaf, 0x49, 0x44, 0x7d, 0x8a, 0x07, 0xe3, 0xbd, 0x95, 0xbd, 0x0d, 0x56, 0xf3, 0x52, 0x41, 0x52, 0x3f, 0xba, 0xb1}, 18},
+    {42161, "YFI", {0x82, 0xe3, 0xa8, 0xf0, 0x66, 0xa6, 0x98, 0x96, 0x66, 0xb0, 0x31, 0xd9, 0x16, 0xc4, 0x36, 0x72, 0x08, 0x5b, 0x15, 0x82}, 18},
+    {42161, "FIS", {0x84, 0x9b, 0x40, 0xab, 0x24, 0x69, 0x30, 0x91, 0x17, 0xed, 0x10, 0x38, 0xc5, 0xa9, 0x98, 0x94, 0x76, 0x7c, 0x72, 0x82}, 18},
+    {42161, "CTX", {0x84, 0xf5, 0xc2, 0xcf, 0xba, 0x75, 0x4e, 0x76, 0xdd, 0x5a, 0xe4, 0xfb, 0x36, 0x9c, 0xfc, 0x92, 0x04, 0x25, 0xe1, 0x2b}, 18},
+    {42161, "FARM", {0x85, 0x53, 0xd2, 0x54, 0xcb, 0x69, 0x34, 0xb1, 0x6f, 0x87, 0xd2, 0xe4, 0x86, 0xb6, 0x4b, 0xbd, 0x24, 0xc8, 0x3c, 0x70}, 18},
+    {42161, "EURC", {0x86, 0x37, 0x08, 0x03, 0x2b, 0x5c, 0x32, 0x8e, 0x11, 0xab, 0xcb, 0xc0, 0xdf, 0x9d, 0x79, 0xc7, 0x1f, 0xc5, 0x2a, 0x48}, 6},
+    {42161, "PRIME", {0x8d, 0x8e, 0x1b, 0x6f, 0xfc, 0x68, 0x32, 0xe8, 0xd2, 0xef, 0x0d, 0xe8, 0xa3, 0xd9, 0x57, 0xca, 0xe7, 0xac, 0x50, 0x67}, 18},
+    {42161, "CRO", {0x8e, 0xa3, 0x15, 0x6f, 0x83, 0x4a, 0x0d, 0xfc, 0x78, 0xf1, 0xa5, 0x30, 0x4f, 0xac, 0x2c, 0xda, 0x67, 0x6f, 0x35, 0x4c}, 8},
+    {42161, "MLN", {0x8f, 0x5c, 0x1a, 0x99, 0xb1, 0xdf, 0x73, 0x6a, 0xd6, 0x85, 0x00, 0x6c, 0xb6, 0xad, 0xca, 0x7b, 0x7a, 0xe4, 0xb5, 0x14}, 18},
+    {42161, "ARB", {0x91, 0x2c, 0xe5, 0x91, 0x44, 0x19, 0x1c, 0x12, 0x04, 0xe6, 0x45, 0x59, 0xfe, 0x82, 0x53, 0xa0, 0xe4, 0x9e, 0x65, 0x48}, 18},
+    {42161, "MXC", {0x91, 0xb4, 0x68, 0xfe, 0x3d, 0xce, 0x58, 0x1d, 0x7a, 0x6c, 0xfe, 0x34, 0x18, 0x9f, 0x13, 0x14, 0xb6, 0x86, 0x2e, 0xd6}, 18},
+    {42161, "OCEAN", {0x93, 0x3d, 0x31, 0x56, 0x1e, 0x47, 0x04, 0x78, 0x07, 0x9f, 0xeb, 0x9a, 0x6d, 0xd2, 0x69, 0x1f, 0xad, 0x82, 0x34, 0xdf}, 18},
+    {42161, "LUSD", {0x93, 0xb3, 0x46, 0xb6, 0xbc, 0x25, 0x48, 0xda, 0x6a, 0x1e, 0x7d, 0x98, 0xe9, 0xa4, 0x21, 0xb4, 0x25, 0x41, 0x42, 0x5b}, 18},
+    {42161, "GRT", {0x96, 0x23, 0x06, 0x33, 0x77, 0xad, 0x1b, 0x27, 0x54, 0x4c, 0x96, 0x5c, 0xcd, 0x73, 0x42, 0xf7, 0xea, 0x7e, 0x88, 0xc7}, 18},
+    {42161, "MOG", {0x96, 0xc4, 0x26, 0x62, 0x82, 0x0f, 0x6e, 0xa3, 0x2f, 0x0a, 0x61, 0xa0, 0x6a, 0x38, 0xa7, 0x2b, 0x20, 0x6a, 0xab, 0xac}, 18},
+    {42161, "MATH", {0x99, 0xf4, 0x0b, 0x01, 0xba, 0x9c, 0x46, 0x91, 0x93, 0xb3, 0x60, 0xf7, 0x27, 0x40, 0xe4, 0x16, 0xb1, 0x7a, 0xc3, 0x32}, 18},
+    {42161, "CVC", {0x9d, 0xff, 0xb2, 0x3c, 0xad, 0x33, 0x22, 0x44, 0x0b, 0xcc, 0xff, 0x7a, 0xb1, 0xc5, 0x8e, 0x78, 0x1d, 0xdb, 0xf1, 0x44}, 8},
+    {42161, "REN", {0x9f, 0xa8, 0x91, 0xe1, 0xdb, 0x0a, 0x6d, 0x1e, 0xea, 0xc4, 0xb9, 0x29, 0xb5, 0xaa, 0xe1, 0x01, 0x1c, 0x79, 0xa2, 0x04}, 18},
+    {42161, "XSGD", {0xa0, 0x52, 0x45, 0xad, 0xe2, 0x5c, 0xc1, 0x06, 0x3e, 0xe5, 0x0c, 0xf7, 0xc0, 0x83, 0xb4, 0x52, 0x4c, 0x1c, 0x43, 0x02}, 6},
+    {42161, "GNO", {0xa0, 0xb8, 0x62, 0xf6, 0x0e, 0xde, 0xf4, 0x45, 0x2f, 0x25, 0xb4, 0x16, 0x0f, 0x17, 0x7d, 0xb4, 0x4d, 0xeb, 0x6c, 0xf1}, 18},
+    {42161, "ONDO", {0xa2, 0xd5, 0x2a, 0x05, 0xb8, 0xbe, 0xad, 0x5d, 0x82, 0x4d, 0xf5, 0x4d, 0xd1, 0xaa, 0x63, 0x18, 0x8b, 0x37, 0xa5, 0xe7}, 18},
+    {42161, "BICO", {0xa6, 0x8e, 0xc9, 0x8d, 0x7c, 0xa8, 0x70, 0xcf, 0x1d, 0xd0, 0xb0, 0x0e, 0xbb, 0xb7, 0xc4, 0xbf, 0x60, 0xa8, 0xe7, 0x4d}, 18},
+    {42161, "FLOKI", {0xa8, 0xc2, 0x5f, 0xdc, 0x09, 0x76, 0x3a, 0x17, 0x63, 0x53, 0xcc, 0x6a, 0x76, 0x88, 0x2e, 0x05, 0xb4, 0x90, 0x5f, 0xae}, 9},
+    {42161, "sUSD", {0xa9, 0x70, 0xaf, 0x1a, 0x58, 0x45, 0x79, 0xb6, 0x18, 0xbe, 0x4d, 0x69, 0xad, 0x6f, 0x73, 0x45, 0x9d, 0x11, 0x2f, 0x95}, 18},
+    {42161, "CVX", {0xaa, 0xfc, 0xfd, 0x42, 0xc9, 0x95, 0x4c, 0x66, 0x89, 0xef, 0x19, 0x01, 0xe0, 0x3d, 0xb7, 0x42, 0x52, 0x08, 0x29, 0xc5}, 18},
+    {42161, "ATA", {0xac, 0x9a, 0xc2, 0xc1, 0x7c, 0xdf, 0xed, 0x4a, 0xbc, 0x80, 0xa5, 0x3c, 0x55, 0x53, 0x38, 0x85, 0x75, 0x71, 0x4d, 0x03}, 18},
+    {42161, "RAI", {0xae, 0xf5, 0xbb, 0xcb, 0xfa, 0x43, 0x85, 0x19, 0xa5, 0xea, 0x80, 0xb4, 0xc7, 0x18, 0x1b, 0x4e, 0x78, 0xd4, 0x19, 0xf2}, 18},
+    {42161, "USDC", {0xaf, 0x88, 0xd0, 0x65, 0xe7, 0x7c, 0x8c, 0xc2, 0x23, 0x93, 0x27, 0xc5, 0xed, 0xb3, 0xa4, 0x32, 0x26, 0x8e, 0x58, 0x31}, 6},
+    {42161, "MIM", {0xb2, 0x0a, 0x02, 0xdf, 0xfb, 0x17, 0x2c, 0x47, 0x4b, 0xc4, 0xbd, 0xa3, 0xfd, 0x6f, 0x4e, 0xe7, 0x0c, 0x04, 0xda, 0xf2}, 18},
+    {42161, "SOCKS", {0xb2, 0xbe, 0x52, 0x74, 0x4a, 0x80, 0x4c, 0xc7, 0x32, 0xd6, 0x06, 0x81, 0x7c, 0x25, 0x72, 0xc5, 0xa3, 0xb2, 0x64, 0xe7}, 18},
+    {42161, "SOL", {0xb7, 0x4d, 0xa9, 0xfe, 0x2f, 0x96, 0xb9, 0xe0, 0xa5, 0xf4, 0xa3, 0xcf, 0x0b, 0x92, 0xdd, 0x2b, 0xec, 0x61, 0x71, 0x24}, 9},
+    {42161, "AGLD", {0xb7, 0x91, 0x0e, 0x8b, 0x16, 0xe6, 0x3e, 0xfd, 0x51, 0xd5, 0xd1, 0xa0, 0x93, 0xd5, 0x62, 0x80, 0x01, 0x2a, 0x3b, 0x9c}, 18},
+    {42161, "AAVE", {0xba, 0x5d, 0xdd, 0x1f, 0x9d, 0x7f, 0x57, 0x0d, 0xc9, 0x4a, 0x51, 0x47, 0x9a, 0x00, 0x0e, 0x3b, 0xce, 0x96, 0x71, 0x96}, 18},
+    {42161, "ZRX", {0xbd, 0x59, 0x1b, 0xd4, 0xdd, 0xb6, 0x4b, 0x77, 0xb5, 0xf7, 0x6e, 0xab, 0x8f, 0x03, 0xd0, 0x25, 0x19, 0x23, 0x5a, 0xe2}, 18},
+    {42161, "NKN", {0xbe, 0x06, 0xca, 0x30, 0x5a, 0x5c, 0xb4, 0x9a, 0xbf, 0x6b, 0x18, 0x40, 0xda, 0x7c, 0x42, 0x69, 0x04, 0x06, 0x17, 0x7b}, 18},
+    {42161, "BADGER", {0xbf, 0xa6, 0x41, 0x05, 0x1b, 0xa0, 0xa0, 0xad, 0x1b, 0x0a, 0xcf, 0x54, 0x9a, 0x89, 0x53, 0x6a, 0x0d, 0x76, 0x47, 0x2e}, 18},
+    {42161, "TRIBE", {0xbf, 0xae, 0x6f, 0xec, 0xd8, 0x12, 0x4b, 0xa3, 0x3c, 0xbb, 0x21, 0x80, 0xaa, 0xb0, 0xfe, 0x4c, 0x03, 0x91, 0x4a, 0x5a}, 18},
+    {42161, "GAL", {0xc2, 0x7e, 0x73, 0x25, 0xa6, 0xbe, 0xa1, 0xfc, 0xc0, 0x6d, 0xe7, 0x94, 0x14, 0x73, 0xf5, 0x27, 0x9b, 0xfd, 0x11, 0x82}, 18},
+    {42161, "QNT", {0xc7, 0x55, 0x7c, 0x73, 0xe0, 0xec, 0xa2, 0xe1, 0xbf, 0x73, 0x48, 0xbb, 0x68, 0x74, 0xae, 0xe6, 0x3c, 0x7e, 0xff, 0x85}, 18},
+    {42161, "ATH", {0xc7, 0xde, 0xf8, 0x2b, 0xa7, 0x7b, 0xaf, 0x30, 0xbb, 0xbc, 0x9b, 0x61, 0x62, 0xdc, 0x07, 0x5b, 0x49, 0x09, 0x2f, 0xb4}, 18},
+    {42161, "RNDR", {0xc8, 0xa4, 0xee, 0xa3, 0x1e, 0x9b, 0x6b, 0x61, 0xc4, 0x06, 0xdf, 0x01, 0x3d, 0xd4, 0xfe, 0xc7, 0x6f, 0x21, 0xe2, 0x79}, 18},
+    {42161, "ALPHA", {0xc9, 0xcb, 0xf1, 0x02, 0xc7, 0x3f, 0xb7, 0x7e, 0xc1, 0x4f, 0x8b, 0x4c, 0x8b, 0xd8, 0x8e, 0x05, 0x0a, 0x6b, 0x26, 0x46}, 18},
+    {42161, "DIA", {0xca, 0x64, 0x24, 0x67, 0xc6, 0xeb, 0xe5, 0x8c, 0x13, 0xcb, 0x4a, 0x70, 0x91, 0x31, 0x7f, 0x34, 0xe1, 0x7a, 0xc0, 0x5e}, 18},
+    {42161, "WOO", {0xca, 0xfc, 0xd8, 0x5d, 0x8c, 0xa7, 0xad, 0x1e, 0x1c, 0x6f, 0x82, 0xf6, 0x51, 0xfa, 0x15, 0xe3, 0x3a, 0xef, 0xd0, 0x7b}, 18},
+    {42161, "COW", {0xcb, 0x8b, 0x5c, 0xd2, 0x0b, 0xdc, 0xae, 0xa9, 0xa0, 0x10, 0xac, 0x1f, 0x8d, 0x83, 0x58, 0x24, 0xf5, 0xc8, 0x7a, 0x04}, 18},
+    {42161, "SNX", {0xcb, 0xa5, 0x6c, 0xd8, 0x21, 0x6f, 0xcb, 0xbf, 0x3f, 0xa6, 0xdf, 0x61, 0x37, 0xf3, 0x14, 0x7c, 0xbc, 0xa3, 0x7d, 0x60}, 18},
+    {42161, "cbBTC", {0xcb, 0xb7, 0xc0, 0x00, 0x0a, 0xb8, 0x8b, 0x47, 0x3b, 0x1f, 0x5a, 0xfd, 0x9e, 0xf8, 0x08, 0x44, 0x0e, 0xed, 0x33, 0xbf}, 8},
+    {42161, "RARI", {0xcf, 0x78, 0x57, 0x2a, 0x8f, 0xe9, 0x7b, 0x2b, 0x9a, 0x4b, 0x97, 0x09, 0xf6, 0xa7, 0xd9, 0xa8, 0x63, 0xc1, 0xb8, 0xe0}, 18},
+    {42161, "HIGH", {0xd1, 0x2e, 0xeb, 0x01, 0x42, 0xd4, 0xef, 0xe7, 0xaf, 0x82, 0xe4, 0xf2, 0x9e, 0x5a, 0xf3, 0x82, 0x61, 0x5b, 0xce, 0xea}, 18},
+    {42161, "SAND", {0xd1, 0x31, 0x8e, 0xb1, 0x9d, 0xbf, 0x26, 0x47, 0x74, 0x3c, 0x72, 0x0e, 0xd3, 0x51, 0x74, 0xef, 0xd6, 0x4e, 0x3d, 0xac}, 18},
+    {42161, "FTM", {0xd4, 0x27, 0x85, 0xd3, 0x23, 0xe6, 0x08, 0xb9, 0xe9, 0x9f, 0xa5, 0x42, 0xbd, 0x8b, 0x10, 0x00, 0xd4, 0xc2, 0xdf, 0x37}, 18},
+    {42161, "SUSHI", {0xd4, 0xd4, 0x2f, 0x0b, 0x6d, 0xef, 0x4c, 0xe0, 0x38, 0x36, 0x36, 0x77, 0x0e, 0xf7, 0x73, 0x39, 0x0d, 0x85, 0xc6, 0x1a}, 18},
+    {42161, "TRB", {0xd5, 0x8d, 0x34, 0x5f, 0xd9, 0xc8, 0x22, 0x62, 0xe0, 0x87, 0xd2, 0xd0, 0x60, 0x76, 0x24, 0xb4, 0x10, 0xd8, 0x82, 0x42}, 18},
+    {42161, "UMA", {0xd6, 0x93, 0xec, 0x94, 0x4a, 0x85, 0xee, 0xca, 0x42, 0x47, 0xec, 0x1c, 0x3b, 0x13, 0x0d, 0xca, 0x9b, 0x0c, 0x3b, 0x22}, 18},
+    {42161, "OMG", {0xd9, 0x62, 0xc1, 0x89, 0x5c, 0x46, 0xac, 0x03, 0x78, 0xc5, 0x02, 0xc2, 0x07, 0x74, 0x8b, 0x70, 0x61, 0x42, 0x1e, 0x8e}, 18},
+    {42161, "FXS", {0xd9, 0xf9, 0xd2, 0xee, 0x2d, 0x3e, 0xfe, 0x42, 0x06, 0x99, 0x07, 0x9f, 0x16, 0xd9, 0xe9, 0x24, 0xaf, 0xff, 0xde, 0xa4}, 18},
+    {42161, "POND", {0xda, 0x0a, 0x57, 0xb7, 0x10, 0x76, 0x8a, 0xe1, 0x79, 0x41, 0xa9, 0xfa, 0x33, 0xf8, 0xb7, 0x20, 0xc8, 0xbd, 0x9d, 0xdd}, 18},
+    {42161, "DAI", {0xda, 0x10, 0x00, 0x9c, 0xbd, 0x5d, 0x07, 0xdd, 0x0c, 0xec, 0xc6, 0x61, 0x61, 0xfc, 0x93, 0xd7, 0xc9, 0x00, 0x0d, 0xa1}, 18},
+    {42161, "ARKM", {0xda, 0xc5, 0x09, 0x4b, 0x7d, 0x59, 0x64, 0x76, 0x26, 0x44, 0x4a, 0x4f, 0x90, 0x50, 0x60, 0xfc, 0xda, 0x4e, 0x65, 0x6e}, 18},
+    {42161, "ENA", {0xdf, 0x8f, 0x0c, 0x63, 0xd9, 0x33, 0x5a, 0x0a, 0xbd, 0x89, 0xf9, 0xf7, 0x52, 0xd2, 0x93, 0xa9, 0x8e, 0xa9, 0x77, 0xd8}, 18},
+    {42161, "STG", {0xe0, 0x18, 0xc7, 0xa3, 0xd1, 0x75, 0xfb, 0x0f, 0xe1, 0x5d, 0x70, 0xda, 0x2c, 0x87, 0x4d, 0x3c, 0xa1, 0x63, 0x13, 0xec}, 18},
+    {42161, "POLY", {0xe1, 0x2f, 0x29, 0x70, 0x4f, 0x63, 0x5f, 0x4a, 0x6e, 0x7a, 0xe1, 0x54, 0x83, 0x8d, 0x21, 0xf9, 0xb3, 0x38, 0x09, 0xe9}, 18},
+    {42161, "DNT", {0xe3, 0x69, 0x6a, 0x02, 0xb2, 0xc9, 0x55, 0x76, 0x39, 0xe2, 0x9d, 0x82, 0x9e, 0x9c, 0x45, 0xef, 0xa4, 0x9a, 0xd4, 0x7a}, 18},
+    {42161, "RLC", {0xe5, 0x75, 0x58, 0x65, 0x66, 0xb0, 0x2a, 0x16, 0x33, 0x8c, 0x19, 0x9c, 0x23, 0xca, 0x6d, 0x29, 0x5d, 0x79, 0x4e, 0x66}, 9},
+    {42161, "STORJ", {0xe6, 0x32, 0x0e, 0xbf, 0x20, 0x99, 0x71, 0xb4, 0xf4, 0x69, 0x6f, 0x7f, 0x09, 0x54, 0xb8, 0x45, 0x7a, 0xa2, 0xfc, 0xc2}, 8},
+    {42161, "ALEPH", {0xe7, 0xdc, 0xd5, 0x08, 0x36, 0xd0, 0xa2, 0x8c, 0x95, 0x9c, 0x72, 0xd7, 0x21, 0x22, 0xfe, 0xdb, 0x8e, 0x24, 0x5a, 0x6c}, 18},
+    {42161, "AXS", {0xe8, 0x89, 0x98, 0xfb, 0x57, 0x92, 0x66, 0x62, 0x8a, 0xf6, 0xa0, 0x3e, 0x38, 0x21, 0xd5, 0x98, 0x3e, 0x5d, 0x00, 0x89}, 18},
+    {42161, "AIOZ", {0xec, 0x76, 0xe8, 0xfe, 0x6e, 0x22, 0x42, 0xe6, 0xc2, 0x11, 0x7c, 0xaa, 0x24, 0x4b, 0x9e, 0x2d, 0xe1, 0x56, 0x99, 0x23}, 18},
+    {42161, "POLS", {0xee, 0xeb, 0x5e, 0xac, 0x2d, 0xb7, 0xa7, 0xfc, 0x28, 0x13, 0x4a, 0xa3, 0x24, 0x85, 0x80, 0xd4, 0x8b, 0x01, 0x6b, 0x64}, 18},
+    {42161, "BLUR", {0xef, 0x17, 0x1a, 0x5b, 0xa7, 0x13, 0x48, 0xef, 0xf1, 0x66, 0x16, 0xfd, 0x69, 0x28, 0x55, 0xc2, 0xfe, 0x60, 0x6e, 0xb2}, 18},
+    {42161, "ALI", {0xef, 0x61, 0x24, 0x36, 0x8c, 0x0b, 0x56, 0x55, 0x66, 0x67, 0xe0, 0xde, 0x77, 0xea, 0x00, 0x8d, 0xfc, 0x0a, 0x71, 0xd1}, 18},
+    {42161, "RGT", {0xef, 0x88, 0x8b, 0xca, 0x6a, 0xb6, 0xb1, 0xd2, 0x6d, 0xbe, 0xc9, 0x77, 0xc4, 0x55, 0x38, 0x8e, 0xcd, 0x79, 0x47, 0x94}, 18},
+    {42161, "API3", {0xf0, 0x1d, 0xb1, 0x2f, 0x50, 0xd0, 0xcd, 0xf5, 0xfe, 0x36, 0x0a, 0xe0, 0x05, 0xb9, 0xc5, 0x2f, 0x92, 0xca, 0x78, 0x11}, 18},
+    {42161, "FOX", {0xf9, 0x29, 0xde, 0x51, 0xd9, 0x1c, 0x77, 0xe4, 0x2f, 0x50, 0x90, 0x06, 0x9e, 0x0a, 0xd7, 0xa0, 0x9e, 0x51, 0x3c, 0x73}, 18},
+    {42161, "LINK", {0xf9, 0x7f, 0x4d, 0xf7, 0x51, 0x17, 0xa7, 0x8c, 0x1a, 0x5a, 0x0d, 0xbb, 0x81, 0x4a, 0xf9, 0x24, 0x58, 0x53, 0x9f, 0xb4}, 18},
+    {42161, "agEUR", {0xfa, 0x5e, 0xd5, 0x6a, 0x20, 0x34, 0x66, 0xcb, 0xbc, 0x24, 0x30, 0xa4, 0x3c, 0x66, 0xb9, 0xd8, 0x72, 0x35, 0x28, 0xe7}, 18},
+    {42161, "UNI", {0xfa, 0x7f, 0x89, 0x80, 0xb0, 0xf1, 0xe6, 0x4a, 0x20, 0x62, 0x79, 0x1c, 0xc3, 0xb0, 0x87, 0x15, 0x72, 0xf1, 0xf7, 0xf0}, 18},
+    {42161, "LQTY", {0xfb, 0x9e, 0x5d, 0x95, 0x6d, 0x88, 0x9d, 0x91, 0xa8, 0x27, 0x37, 0xb9, 0xbf, 0xcd, 0xac, 0x1d, 0xce, 0x3e, 0x14, 0x49}, 18},
+    {42161, "GMX", {0xfc, 0x5a, 0x1a, 0x6e, 0xb0, 0x76, 0xa2, 0xc7, 0xad, 0x06, 0xed, 0x22, 0xc9, 0x0d, 0x7e, 0x71, 0x0e, 0x35, 0xad, 0x0a}, 18},
+    {42161, "USDT", {0xfd, 0x08, 0x6b, 0xc7, 0xcd, 0x5c, 0x48, 0x1d, 0xcc, 0x9c, 0x85, 0xeb, 0xe4, 0x78, 0xa1, 0xc0, 0xb6, 0x9f, 0xcb, 0xb9}, 6},
+    {42161, "ENS", {0xfe, 0xa3, 0x1d, 0x70, 0x4d, 0xeb, 0x09, 0x75, 0xda, 0x8e, 0x77, 0xbf, 0x13, 0xe0, 0x42, 0x39, 0xe7, 0x0d, 0x7c, 0x28}, 18},
+    {42161, "PAXG", {0xfe, 0xb4, 0xdf, 0xc8, 0xc4, 0xcf, 0x7e, 0xd3, 0x05, 0xbb, 0x08, 0x06, 0x5d, 0x08, 0xec, 0x6e, 0xe6, 0x72, 0x84, 0x29}, 18},
+    {42161, "USDC.e", {0xff, 0x97, 0x0a, 0x61, 0xa0, 0x4b, 0x1c, 0xa1, 0x48, 0x34, 0xa4, 0x3f, 0x5d, 0xe4, 0x53, 0x3e, 0xbd, 0xdb, 0x5c, 0xc8}, 6},
+    {42220, "WETH", {0x2d, 0xef, 0x42, 0x85, 0x78, 0x7d, 0x58, 0xa2, 0xf8, 0x11, 0xaf, 0x24, 0x75, 0x5a, 0x81, 0x50, 0x62, 0x2f, 0x43, 0x61}, 18},
+    {42220, "CELO", {0x47, 0x1e, 0xce, 0x37, 0x50, 0xda, 0x23, 0x7f, 0x93, 0xb8, 0xe3, 0x39, 0xc5, 0x36, 0x98, 0x9b, 0x89, 0x78, 0xa4, 0x38}, 18},
+    {42220, "USDT", {0x48, 0x06, 0x5f, 0xbb, 0xe2, 0x5f, 0x71, 0xc9, 0x28, 0x2d, 0xdf, 0x5e, 0x1c, 0xd6, 0xd6, 0xa8, 0x87, 0x48, 0x3d, 0x5e}, 6},
+    {42220, "USDC", {0xce, 0xba, 0x93, 0x00, 0xf2, 0xb9, 0x48, 0x71, 0x0d, 0x26, 0x53, 0xdd, 0x7b, 0x07, 0xf3, 0x3a, 0x8b, 0x32, 0x11, 0x8c}, 6},
+    {42220, "BTC", {0xd6, 0x29, 0xeb, 0x00, 0xde, 0xce, 0xd2, 0xa0, 0x80, 0xb7, 0xec, 0x63, 0x0e, 0xf6, 0xac, 0x11, 0x7e, 0x61, 0x4f, 0x1b}, 18},
+    {43114, "MIM", {0x13, 0x09, 0x66, 0x62, 0x88, 0x46, 0xbf, 0xd3, 0x6f, 0xf3, 0x1a, 0x82, 0x27, 0x05, 0x79, 0x6e, 0x8c, 0xb8, 0xc1, 0x8d}, 18},
+    {43114, "SYN", {0x1f, 0x1e, 0x7c, 0x89, 0x38, 0x55, 0x52, 0x5b, 0x30, 0x3f, 0x99, 0xbd, 0xf5, 0xc3, 0xc0, 0x5b, 0xe0, 0x9c, 0xa2, 0x51}, 18},
+    {43114, "ANKR", {0x20, 0xcf, 0x1b, 0x6e, 0x9d, 0x85, 0x63, 0x21, 0xed, 0x46, 0x86, 0x87, 0x7c, 0xf4, 0x53, 0x8f, 0x2c, 0x84, 0xb4, 0xde}, 18},
+    {43114, "ALPHA", {0x21, 0x47, 0xef, 0xff, 0x67, 0x5e, 0x4a, 0x4e, 0xe1, 0xc2, 0xf9, 0x18, 0xd1, 0x81, 0xcd, 0xbd, 0x7a, 0x8e, 0x20, 0x8f}, 18},
+    {43114, "FXS", {0x21, 0x4d, 0xb1, 0x07, 0x65, 0x4f, 0xf9, 0x87, 0xad, 0x85, 0x9f, 0x34, 0x12, 0x53, 0x07, 0x78, 0x3f, 0xc8, 0xe3, 0x87}, 18},
+    {43114, "STG", {0x2f, 0x6f, 0x07, 0xcd, 0xcf, 0x35, 0x88, 0x94, 0x4b, 0xf4, 0xc4, 0x2a, 0xc7, 0x4f, 0xf2, 0x4b, 0xf5, 0x6e, 0x75, 0x90}, 18},
+    {43114, "SUSHI", {0x37, 0xb6, 0x08, 0x51, 0x9f, 0x91, 0xf7, 0x0f, 0x2e, 0xeb, 0x0e, 0x5e, 0xd9, 0xaf, 0x40, 0x61, 0x72, 0x2e, 0x4f, 0x76}, 18},
+    {43114, "UMA", {0x3b, 0xd2, 0xb1, 0xc7, 0xed, 0x8d, 0x39, 0x6d, 0xbb, 0x98, 0xde, 0xd3, 0xae, 0xbb, 0x41, 0x35, 0x0a, 0x5b, 0x23, 0x39}, 18},
+    {43114, "AXL", {0x44, 0xc7, 0x84, 0x26, 0x6c, 0xf0, 0x24, 0xa6, 0x0e, 0x8a, 0xcf, 0x24, 0x27, 0xb9, 0x85, 0x7a, 0xce, 0x19, 0x4c, 0x5d}, 6},
+    {43114, "WETH", {0x49, 0xd5, 0xc2, 0xbd, 0xff, 0xac, 0x6c, 0xe2, 0xbf, 0xdb, 0x66, 0x40, 0xf4, 0xf8, 0x0f, 0x22, 0x6b, 0xc1, 0x0b, 0xab}, 18},
+    {43114, "WBTC", {0x50, 0xb7, 0x54, 0x56, 0x27, 0xa5, 0x16, 0x2f, 0x82, 0xa9, 0x92, 0xc3, 0x3b, 0x87, 0xad, 0xc7, 0x51, 0x87, 0xb2, 0x18}, 8},
+    {43114, "LINK", {0x59, 0x47, 0xbb, 0x27, 0x5c, 0x52, 0x10, 0x40, 0x05, 0x1d, 0x82, 0x39, 0x61, 0x92, 0x18, 0x1b, 0x41, 0x32, 0x27, 0xa3}, 18},
+    {43114, "ZRX", {0x59, 0x6f, 0xa4, 0x70, 0x43, 0xf9, 0x9a, 0x4e, 0x0f, 0x12, 0x22, 0x43, 0xb8, 0x41, 0xe5, 0x53, 0x75, 0xcd, 0xe0, 0xd2}, 18},
+    {43114, "GMX", {0x62, 0xed, 0xc0, 0x69, 0x2b, 0xd8, 0x97, 0xd2, 0x29, 0x58, 0x72, 0xa9, 0xff, 0xca, 0xc5, 0x42, 0x50, 0x11, 0xc6, 0x61}, 18},
+    {43114, "AAVE", {0x63, 0xa7, 0x28, 0x06, 0x09, 0x8b, 0xd3, 0xd9, 0x52, 0x0c, 0xc4, 0x33, 0x56, 0xdd, 0x78, 0xaf, 0xe5, 0xd3, 0x86, 0xd9}, 18},
+    {43114, "ZRO", {0x69, 0x85, 0x88, 0x4c, 0x43, 0x92, 0xd3, 0x48, 0x58, 0x7b, 0x19, 0xcb, 0x9e, 0xaa, 0xf1, 0x57, 0xf1, 0x32, 0x71, 0xcd}, 18},
+    {43114, "CTSI", {0x6b, 0x28, 0x9c, 0xce, 0xaa, 0x86, 0x39, 0xe3, 0x83, 0x10, 0x95, 0xd7, 0x5a, 0x3e, 0x43, 0x52, 0x0f, 0xab, 0xf5, 0x52}, 18},
+    {43114, "MKR", {0x88, 0x12, 0x8f, 0xd4, 0xb2, 0x59, 0x55, 0x2a, 0x9a, 0x1d, 0x45, 0x7f, 0x43, 0x5a, 0x65, 0x27, 0xaa, 0xb7, 0x2d, 0x42}, 18},
+    {43114, "GRT", {0x8a, 0x0c, 0xac, 0x13, 0xc7, 0xda, 0x96, 0x5a, 0x31, 0x2f, 0x08, 0xea, 0x42, 0x29, 0xc3, 0x78, 0x69, 0xe8, 0x5c, 0xb9}, 18},
+    {43114, "UNI.e", {0x8e, 0xba, 0xf2, 0x2b, 0x6f, 0x05, 0x3d, 0xff, 0xea, 0xf4, 0x6f, 0x4d, 0xd9, 0xef, 0xa9, 0x5d, 0x89, 0xba, 0x85, 0x80}, 18},
+    {43114, "DYP", {0x96, 0x1c, 0x8c, 0x0b, 0x1a, 0xad, 0x0c, 0x0b, 0x10, 0xa5, 0x1f, 0xef, 0x6a, 0x86, 0x7e, 0x30, 0x91, 0xbc, 0xef, 0x17}, 18},
+    {43114, "USDT", {0x97, 0x02, 0x23, 0x0a, 0x8e, 0xa5, 0x36, 0x01, 0xf5, 0xcd, 0x2d, 0xc0, 0x0f, 0xdb, 0xc1, 0x3d, 0x4d, 0xf4, 0xa8, 0xc7}, 6},
+    {43114, "RAI", {0x97, 0xcd, 0x1c, 0xfe, 0x2e, 0xd5, 0x71, 0x26, 0x60, 0xbb, 0x6c, 0x14, 0x05, 0x3c, 0x0e, 0xcb, 0x03, 0x1b, 0xff, 0x7d}, 18},
+    {43114, "BAT", {0x98, 0x44, 0x3b, 0x96, 0xea, 0x4b, 0x08, 0x58, 0xfd, 0xf3, 0x21, 0x9c, 0xd1, 0x3e, 0x98, 0xc7, 0xa4, 0x69, 0x05, 0x88}, 18},
+    {43114, "BUSD", {0x9c, 0x9e, 0x5f, 0xd8, 0xbb, 0xc2, 0x59, 0x84, 0xb1, 0x78, 0xfd, 0xce, 0x61, 0x17, 0xde, 0xfa, 0x39, 0xd2, 0xdb, 0x39}, 18},
+    {43114, "YFI", {0x9e, 0xaa, 0xc1, 0xb2, 0x3d, 0x93, 0x53, 0x65, 0xbd, 0x7b, 0x54, 0x2f, 0xe2, 0x2c, 0xee, 0xe2, 0x92, 0x2f, 0x52, 0xdc}, 18},
+    {43114, "MULTI", {0x9f, 0xb9, 0xa3, 0x39, 0x56, 0x35, 0x1c, 0xf4, 0xfa, 0x04, 0x0f, 0x65, 0xa1, 0x3b, 0x83, 0x5a, 0x3c, 0x87, 0x64, 0xe3}, 18},
+    {43114, "WOO", {0xab, 0xc9, 0x54, 0x7b, 0x53, 0x45, 0x19, 0xff, 0x73, 0x92, 0x1b, 0x1f, 0xba, 0x6e, 0x67, 0x2b, 0x5f, 0x58, 0xd0, 0x83}, 18},
+    {43114, "agEUR", {0xae, 0xc8, 0x31, 0x8a, 0x9a, 0x59, 0xba, 0xeb, 0x39, 0x86, 0x1d, 0x10, 0xff, 0x6c, 0x7f, 0x7b, 0xf1, 0xf9, 0x6c, 0x57}, 18},
+    {43114, "WAVAX", {0xb3, 0x1f, 0x66, 0xaa, 0x3c, 0x1e, 0x78, 0x53, 0x63, 0xf0, 0x87, 0x5a, 0x1b, 0x74, 0xe2, 0x7b, 0x85, 0xfd, 0x66, 0xc7}, 18},
+    {43114, "USDC", {0xb9, 0x7e, 0xf9, 0xef, 0x87, 0x34, 0xc7, 0x19, 0x04, 0xd8, 0x00, 0x2f, 0x8b, 0x6b, 0xc6, 0x6d, 0xd9, 0xc4, 0x8a, 0x6e}, 6},
+    {43114, "SNX", {0xbe, 0xc2, 0x43, 0xc9, 0x95, 0x40, 0x9e, 0x65, 0x20, 0xd7, 0xc4, 0x1e, 0x40, 0x4d, 0xa5, 0xde, 0xba, 0x4b, 0x20, 0x9b}, 18},
+    {43114, "COMP", {0xc3, 0x04, 0x8e, 0x19, 0xe7, 0x6c, 0xb9, 0xa3, 0xaa, 0x9d, 0x77, 0xd8, 0xc0, 0x3c, 0x29, 0xfc, 0x90, 0x6e, 0x24, 0x37}, 18},
+    {43114, "EURC", {0xc8, 0x91, 0xeb, 0x4c, 0xbd, 0xef, 0xf6, 0xe0, 0x73, 0xe8, 0x59, 0xe9, 0x87, 0x81, 0x5e, 0xd1, 0x50, 0x5c, 0x2a, 0xcd}, 6},
+    {43114, "SPELL", {0xce, 0x1b, 0xff, 0xbd, 0x53, 0x74, 0xda, 0xc8, 0x6a, 0x28, 0x93, 0x11, 0x96, 0x83, 0xf4, 0x91, 0x1a, 0x2f, 0x78, 0x14}, 18},
+    {43114, "FRAX", {0xd2, 0x4c, 0x2a, 0xd0, 0x96, 0x40, 0x0b, 0x6f, 0xbc, 0xd2, 0xad, 0x8b, 0x24, 0xe7, 0xac, 0xbc, 0x21, 0xa1, 0xda, 0x64}, 18},
+    {43114, "1INCH", {0xd5, 0x01, 0x28, 0x15, 0x65, 0xbf, 0x77, 0x89, 0x22, 0x45, 0x23, 0x14, 0x4f, 0xe5, 0xd9, 0x8e, 0x8b, 0x28, 0xf2, 0x67}, 18},
+    {43114, "DAI.e", {0xd5, 0x86, 0xe7, 0xf8, 0x44, 0xce, 0xa2, 0xf8, 0x7f, 0x50, 0x15, 0x26, 0x65, 0xbc, 0xbc, 0x2c, 0x27, 0x9d, 0x8d, 0x70}, 18},
+    {43114, "SOL", {0xfe, 0x6b, 0x19, 0x28, 0x68, 0x85, 0xa4, 0xf7, 0xf5, 0x5a, 0xda, 0xd0, 0x9c, 0x3c, 0xd1, 0xf9, 0x06, 0xd2, 0x47, 0x8f}, 9},
+    {80001, "WMATIC", {0x9c, 0x3c, 0x92, 0x83, 0xd3, 0xe4, 0x48, 0x54, 0x69, 0x7c, 0xd2, 0x2d, 0x3f, 0xaa, 0x24, 0x0c, 0xfb, 0x03, 0x28, 0x89}, 18},
+    {80001, "WETH", {0xa6, 0xfa, 0x4f, 0xb5, 0xf7, 0x61, 0x72, 0xd1, 0x78, 0xd6, 0x1b, 0x04, 0xb0, 0xec, 0xd3, 0x19, 0xc5, 0xd1, 0xc0, 0xaa}, 18},
+    {81457, "BLAST", {0xb1, 0xa5, 0x70, 0x0f, 0xa2, 0x35, 0x81, 0x73, 0xfe, 0x46, 0x5e, 0x6e, 0xa4, 0xff, 0x52, 0xe3, 0x6e, 0x88, 0xe2, 0xad}, 18},
+    {7777777, "USDzC", {0xcc, 0xcc, 0xcc, 0xcc, 0x70, 0x21, 0xb3, 0x2e, 0xbb, 0x4e, 0x8c, 0x08, 0x31, 0x4b, 0xd6, 0x2f, 0x7c, 0x65, 0x3e, 0xc4}, 6},
+    {11155111, "UNI", {0x1f, 0x98, 0x40, 0xa8, 0x5d, 0x5a, 0xf5, 0xbf, 0x1d, 0x17, 0x62, 0xf9, 0x25, 0xbd, 0xad, 0xdc, 0x42, 0x01, 0xf9, 0x84}, 18},
+    {11155111, "WETH", {0xff, 0xf9, 0x97, 0x67, 0x82, 0xd4, 0x6c, 0xc0, 0x56, 0x30, 0xd1, 0xf6, 0xeb, 0xab, 0x18, 0xb2, 0x32, 0x4d, 0x6b, 0x14}, 18}};
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static int hex_digit(char c);
+static int erc20_compare(const erc20_info_t *token, unsigned long chain_id, const uint8_t address[ERC20_ADDRESS_LEN]);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-erc20_info_t *get_erc20_info_from_int_chain_id(char *address, long long chain_id);
-erc20_info_t *get_erc20_info_from_str_chain_id(char *address, char *chain_id_str);
+const erc20_info_t *get_erc20_info(const uint8_t address[ERC20_ADDRESS_LEN], long long chain_id);
+const erc20_info_t *get_erc20_info_from_int_chain_id(const char *address, long long chain_id);
+const erc20_info_t *get_erc20_info_from_str_chain_id(const char *address, const char *chain_id_str);
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static int erc20_compare(const erc20_info_t *token, unsigned long chain_id, const uint8_t address[ERC20_ADDRESS_LEN])
+{
+    if (token->chain_id != chain_id)
+    {
+        return token->chain_id < chain_id ? -1 : 1;
+    }
+    return memcmp(token->address, address, ERC20_ADDRESS_LEN);
+}
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-erc20_info_t *get_erc20_info_from_str_chain_id(char *address, char *chain_id_str)
+const erc20_info_t *get_erc20_info_from_str_chain_id(const char *address, const char *chain_id_str)
 {
     return get_erc20_info_from_int_chain_id(address, atoll(chain_id_str));
 }
-erc20_info_t *get_erc20_info_from_int_chain_id(char *address, long long chain_id)
+
+const erc20_info_t *get_erc20_info_from_int_chain_id(const char *address, long long chain_id)
+{
+    uint8_t address_bytes[ERC20_ADDRESS_LEN];
+    if (address == NULL)
+    {
+        return NULL;
+    }
+    if (address[0] == '0' && (address[1] == 'x' || address[1] == 'X'))
+    {
+        address += 2;
+    }
+    // checksummed (mixed case) addresses are accepted as well
+    for (int i = 0; i < ERC20_ADDRESS_LEN; i++)
+    {
+        int hi = hex_digit(address[2 * i]);
+        int lo = (hi < 0) ? -1 : hex_digit(address[2 * i + 1]);
+        if (lo < 0)
+        {
+            return NULL;
+        }
+        address_bytes[i] = (uint8_t)((hi << 4) | lo);
+    }
+    if (address[2 * ERC20_ADDRESS_LEN] != '\0')
+    {
+        return NULL;
+    }
+    return get_erc20_info(address_bytes, chain_id);
+}
+
+const erc20_info_t *get_erc20_info(const uint8_t address[ERC20_ADDRESS_LEN], long long chain_id)
 {
-    char *address_lower = strdup(address);
-    for (int i = 0; i < sizeof(erc20_tokens) / sizeof(erc20_tokens[0]); i++)
+    if (address == NULL || chain_id < 0 || chain_id > 0xFFFFFFFFLL)
     {
-        if (erc20_tokens[i].chain_id == chain_id && strcmp(erc20_tokens[i].address, address_lower) == 0)
+        return NULL;
+    }
+    size_t lo = 0;
+    size_t hi = sizeof(erc20_tokens) / sizeof(erc20_tokens[0]);
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = erc20_compare(&erc20_tokens[mid], (unsigned long)chain_id, address);
+        if (cmp == 0)
+        {
+            return &erc20_tokens[mid];
+        }
+        if (cmp < 0)
         {
-            free(address_lower);
-            address_lower = NULL;
-            return &erc20_tokens[i];
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
         }
     }
-    free(address_lower);
-    address_lower = NULL;
     return NULL;
-}
\ No newline at end of file
+}
@@ -4,17 +4,24 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
+/*********************
+ *      DEFINES
+ *********************/
+#define ERC20_ADDRESS_LEN 20
+
 /**********************
  *      TYPEDEFS
  **********************/
 typedef struct
 {
-    long long chain_id;
+    uint32_t chain_id;
     // char *name;
-    char *symbol;
-    char *address;
+    const char *symbol;
+    uint8_t address[ERC20_ADDRESS_LEN];
     int8_t decimal;
 } erc20_info_t;
 
@@ -25,8 +32,11 @@ extern "C"
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
-    erc20_info_t *get_erc20_info_from_int_chain_id(char *address, long long chain_id);
-    erc20_info_t *get_erc20_info_from_str_chain_id(char *address, char *chain_id_str);
+    /* binary search over the token table, address is the raw 20-byte contract address */
+    const erc20_info_t *get_erc20_info(const uint8_t address[ERC20_ADDRESS_LEN], long long chain_id);
+    /* address is a hex string with or without 0x prefix, in any case */
+    const erc20_info_t *get_erc20_info_from_int_chain_id(const char *address, long long chain_id);
+    const erc20_info_t *get_erc20_info_from_str_chain_id(const char *address, const char *chain_id_str);
 
 #ifdef __cplusplus
 }
@@ -1,18 +1,16 @@
 /*********************
  *      INCLUDES
  *********************/
-#include <stdio.h>
 #include "ethereum.h"
 #include "esp_log.h"
 #include "eip712/eip712.h"
-#include "utility/trezor/sha3.h"
+#include "keccak.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define TAG "ETHEREUM"
-// #define ETHEREUM_SIG_PREFIX "\x19Ethereum Signed Message:\n"
-#define ETHEREUM_SIG_PREFIX "Ethereum Signed Message:\n"
+#define ETHEREUM_SIG_PREFIX "\x19" "Ethereum Signed Message:\n"
 
 /**********************
  *      VARIABLES
@@ -29,15 +27,14 @@
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-bool ethereum_typed_data_hash_v4(
-    const char *json_str_primary_type,
-    const char *json_str_types,
-    const char *json_str_domain,
-    const char *json_str_message,
-    uint8_t typed_data_hash[32]);
+bool ethereum_typed_data_hash_v4(char *json_str, size_t json_len, uint8_t typed_data_hash[32]);
+bool ethereum_typed_data_describe(char *json_str, size_t json_len, char *out, size_t out_len);
 
 void ethereum_keccak256(const uint8_t *data, size_t len, uint8_t digest[32]);
 void ethereum_keccak256_eip191(const char *data, size_t len, uint8_t digest[32]);
+void ethereum_eip191_init(keccak256_ctx_t *ctx, size_t message_len);
+void ethereum_eip191_update(keccak256_ctx_t *ctx, const uint8_t *data, size_t len);
+void ethereum_eip191_final(keccak256_ctx_t *ctx, uint8_t digest[32]);
 
 /**********************
  *   STATIC FUNCTIONS
@@ -46,43 +43,61 @@ void ethereum_keccak256_eip191(const char *data, size_t len, uint8_t digest[32])
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-bool ethereum_typed_data_hash_v4(
-    const char *json_str_primary_type,
-    const char *json_str_types,
-    const char *json_str_domain,
-    const char *json_str_message,
-    uint8_t typed_data_hash[32])
+bool ethereum_typed_data_hash_v4(char *json_str, size_t json_len, uint8_t typed_data_hash[32])
 {
     memset(typed_data_hash, 0, 32);
-    if (json_str_domain == NULL || json_str_message == NULL || json_str_primary_type == NULL || json_str_types == NULL)
+    if (json_str == NULL)
     {
         return false;
     }
-    return eip712_typed_data_hash_v4(json_str_primary_type, json_str_types, json_str_domain, json_str_message, typed_data_hash);
+    return eip712_typed_data_hash_v4(json_str, json_len, typed_data_hash);
+}
+
+bool ethereum_typed_data_describe(char *json_str, size_t json_len, char *out, size_t out_len)
+{
+    if (json_str == NULL)
+    {
+        return false;
+    }
+    return eip712_typed_data_describe(json_str, json_len, out, out_len);
 }
 
 void ethereum_keccak256(const uint8_t *data, size_t len, uint8_t digest[32])
 {
-    keccak_256(data, len, digest);
+    keccak256(data, len, digest);
 }
 
-void ethereum_keccak256_eip191(const char *data, size_t len, uint8_t digest[32])
+void ethereum_eip191_init(keccak256_ctx_t *ctx, size_t message_len)
 {
-    char *data_len_str = (char *)malloc(20);
-    sprintf(data_len_str, "%zu", len);
+    char len_str[20];
+    size_t len_str_len = 0;
+    char *p = len_str + sizeof(len_str);
+    do
+    {
+        *--p = (char)('0' + message_len % 10);
+        message_len /= 10;
+        len_str_len++;
+    } while (message_len > 0);
 
-    char *_ETHEREUM_SIG_PREFIX = malloc(strlen(ETHEREUM_SIG_PREFIX) + 2);
-    _ETHEREUM_SIG_PREFIX[0] = 0x19;
-    strcpy(_ETHEREUM_SIG_PREFIX + 1, ETHEREUM_SIG_PREFIX);
-    size_t _ETHEREUM_SIG_PREFIX_len = strlen(_ETHEREUM_SIG_PREFIX);
+    keccak256_init(ctx);
+    keccak256_update(ctx, (const uint8_t *)ETHEREUM_SIG_PREFIX, sizeof(ETHEREUM_SIG_PREFIX) - 1);
+    keccak256_update(ctx, (const uint8_t *)p, len_str_len);
+}
+
+void ethereum_eip191_update(keccak256_ctx_t *ctx, const uint8_t *data, size_t len)
+{
+    keccak256_update(ctx, data, len);
+}
 
-    size_t joined_data_len = _ETHEREUM_SIG_PREFIX_len + strlen(data_len_str) + len;
-    char *joined_data = malloc(joined_data_len);
-    sprintf(joined_data, "%s%s", _ETHEREUM_SIG_PREFIX, data_len_str);
-    memcpy(joined_data + _ETHEREUM_SIG_PREFIX_len + strlen(data_len_str), data, len);
+void ethereum_eip191_final(keccak256_ctx_t *ctx, uint8_t digest[32])
+{
+    keccak256_final(ctx, digest);
+}
 
-    free(_ETHEREUM_SIG_PREFIX);
-    free(data_len_str);
-    ethereum_keccak256((uint8_t *)joined_data, joined_data_len, digest);
-    free(joined_data);
+void ethereum_keccak256_eip191(const char *data, size_t len, uint8_t digest[32])
+{
+    keccak256_ctx_t ctx;
+    ethereum_eip191_init(&ctx, len);
+    ethereum_eip191_update(&ctx, (const uint8_t *)data, len);
+    ethereum_eip191_final(&ctx, digest);
 }
@@ -6,6 +6,7 @@
  *********************/
 #include <string.h>
 #include <stdbool.h>
+#include "keccak.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -14,16 +15,21 @@ extern "C"
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
-    bool ethereum_typed_data_hash_v4(
-        const char *json_str_primary_type,
-        const char *json_str_types,
-        const char *json_str_domain,
-        const char *json_str_message,
-        uint8_t typed_data_hash[32]);
+    /* EIP-712 v4 hash of the typed data document {"types", "primaryType", "domain", "message"},
+       json_str is parsed in place and modified */
+    bool ethereum_typed_data_hash_v4(char *json_str, size_t json_len, uint8_t typed_data_hash[32]);
+    /* primaryType and domain of the typed data document for the review, json_str is parsed in place and modified */
+    bool ethereum_typed_data_describe(char *json_str, size_t json_len, char *out, size_t out_len);
 
     void ethereum_keccak256(const uint8_t *data, size_t len, uint8_t digest[32]);
     void ethereum_keccak256_eip191(const char *data, size_t len, uint8_t digest[32]);
 
+    /* streaming EIP-191 personal message hash, message_len is the total
+       length of the message that will be fed through update() */
+    void ethereum_eip191_init(keccak256_ctx_t *ctx, size_t message_len);
+    void ethereum_eip191_update(keccak256_ctx_t *ctx, const uint8_t *data, size_t len);
+    void ethereum_eip191_final(keccak256_ctx_t *ctx, uint8_t digest[32]);
+
 #ifdef __cplusplus
 }
 #endif
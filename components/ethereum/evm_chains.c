@@ -3,6 +3,10 @@
  *********************/
 #include "evm_chains.h"
 
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
 /*********************
  *      DEFINES
  *********************/
@@ -11,6 +15,25 @@
  *      MACROS
  **********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* all names and symbols back to back, so the table only keeps 16-bit offsets */
+typedef struct
+{
+#define EVM_CHAIN(id, name, symbol) \
+    char name_##id[sizeof(name)];   \
+    char symbol_##id[sizeof(symbol)];
+#include "evm_chains.def"
+#undef EVM_CHAIN
+} evm_chain_strings_t;
+
+typedef struct
+{
+    uint16_t name;
+    uint16_t symbol;
+} evm_chain_offsets_t;
+
 /**********************
  *      VARIABLES
  **********************/
@@ -18,2101 +41,91 @@
 /**********************
  *  STATIC VARIABLES
  **********************/
+static const evm_chain_strings_t chain_strings = {
+#define EVM_CHAIN(id, name, symbol) name, symbol,
+#include "evm_chains.def"
+#undef EVM_CHAIN
+};
 
-/*
-  1. Nav to https://evmchainlist.org/
-  2. `Inspect` -> `Console`
-  3. Run the following javascript code:
-    ```javascript
-    fetch('https://chainid.network/chains.json')
-    .then(response => response.json())
-    .then(chainList => {
-        let chains_array = [];
-        for (let i = 0; i < chainList.length; i++) {
-            chains_array.push(`{${chainList[i].chainId},"${chainList[i].name}","${chainList[i].nativeCurrency.symbol}"}`);
-        }
-        console.log(chains_array.join(',\n'));
-    })
-    .catch(error => {
-        console.error('Error fetching JSON data:', error);
-    });
-    ```
- */
-static evm_chain_info_t chains[] = {
-    {1, "Ethereum Mainnet", "ETH"},
-    {2, "Expanse Network", "EXP"},
-    {3, "Ropsten", "ETH"},
-    {4, "Rinkeby", "ETH"},
-    {5, "Goerli", "ETH"},
-    {6, "Kotti Testnet", "KOT"},
-    {7, "ThaiChain", "TCH"},
-    {8, "Ubiq", "UBQ"},
-    {9, "Ubiq Network Testnet", "TUBQ"},
-    {10, "OP Mainnet", "ETH"},
-    {11, "Metadium Mainnet", "META"},
-    {12, "Metadium Testnet", "KAL"},
-    {13, "Diode Testnet Staging", "sDIODE"},
-    {14, "Flare Mainnet", "FLR"},
-    {15, "Diode Prenet", "DIODE"},
-    {16, "Songbird Testnet Coston", "CFLR"},
-    {17, "ThaiChain 2.0 ThaiFi", "TFI"},
-    {18, "ThunderCore Testnet", "TST"},
-    {19, "Songbird Canary-Network", "SGB"},
-    {20, "Elastos Smart Chain", "ELA"},
-    {21, "Elastos Smart Chain Testnet", "tELA"},
-    {22, "ELA-DID-Sidechain Mainnet", "ELA"},
-    {23, "ELA-DID-Sidechain Testnet", "tELA"},
-    {24, "KardiaChain Mainnet", "KAI"},
-    {25, "Cronos Mainnet", "CRO"},
-    {26, "Genesis L1 testnet", "L1test"},
-    {27, "ShibaChain", "SHIB"},
-    {28, "Boba Network Rinkeby Testnet", "ETH"},
-    {29, "Genesis L1", "L1"},
-    {30, "Rootstock Mainnet", "RBTC"},
-    {31, "Rootstock Testnet", "tRBTC"},
-    {32, "GoodData Testnet", "GooD"},
-    {33, "GoodData Mainnet", "GooD"},
-    {34, "SecureChain Mainnet", "SCAI"},
-    {35, "TBWG Chain", "TBG"},
-    {36, "Dxchain Mainnet", "DX"},
-    {37, "Xpla Mainnet", "XPLA"},
-    {38, "Valorbit", "VAL"},
-    {39, "U2U Solaris Mainnet", "U2U"},
-    {40, "Telos EVM Mainnet", "TLOS"},
-    {41, "Telos EVM Testnet", "TLOS"},
-    {42, "LUKSO Mainnet", "LYX"},
-    {43, "Darwinia Pangolin Testnet", "PRING"},
-    {44, "Crab Network", "CRAB"},
-    {45, "Darwinia Pangoro Testnet", "ORING"},
-    {46, "Darwinia Network", "RING"},
-    {47, "Acria IntelliChain", "ACRIA"},
-    {48, "Ennothem Mainnet Proterozoic", "ETMP"},
-    {49, "Ennothem Testnet Pioneer", "ETMP"},
-    {50, "XDC Network", "XDC"},
-    {51, "XDC Apothem Network", "TXDC"},
-    {52, "CoinEx Smart Chain Mainnet", "cet"},
-    {53, "CoinEx Smart Chain Testnet", "cett"},
-    {54, "Openpiece Mainnet", "BELLY"},
-    {55, "Zyx Mainnet", "ZYX"},
-    {56, "BNB Smart Chain Mainnet", "BNB"},
-    {57, "Syscoin Mainnet", "SYS"},
-    {58, "Ontology Mainnet", "ONG"},
-    {59, "EOS EVM Legacy", "EOS"},
-    {60, "GoChain", "GO"},
-    {61, "Ethereum Classic", "ETC"},
-    {62, "Morden Testnet", "TETC"},
-    {63, "Mordor Testnet", "METC"},
-    {64, "Ellaism", "ELLA"},
-    {65, "OKExChain Testnet", "OKT"},
-    {66, "OKXChain Mainnet", "OKT"},
-    {67, "DBChain Testnet", "DBM"},
-    {68, "SoterOne Mainnet", "SOTER"},
-    {69, "Optimism Kovan", "ETH"},
-    {70, "Hoo Smart Chain", "HOO"},
-    {71, "Conflux eSpace (Testnet)", "CFX"},
-    {72, "DxChain Testnet", "DX"},
-    {73, "FNCY", "FNCY"},
-    {74, "IDChain Mainnet", "EIDI"},
-    {75, "Decimal Smart Chain Mainnet", "DEL"},
-    {76, "Mix", "MIX"},
-    {77, "POA Network Sokol", "SPOA"},
-    {78, "PrimusChain mainnet", "PETH"},
-    {79, "Zenith Mainnet", "ZENITH"},
-    {80, "GeneChain", "RNA"},
-    {81, "Japan Open Chain Mainnet", "JOC"},
-    {82, "Meter Mainnet", "MTR"},
-    {83, "Meter Testnet", "MTR"},
-    {84, "Linqto Devnet", "XRP"},
-    {85, "GateChain Testnet", "GT"},
-    {86, "GateChain Mainnet", "GT"},
-    {87, "Nova Network", "SNT"},
-    {88, "Viction", "VIC"},
-    {89, "Viction Testnet", "VIC"},
-    {90, "Garizon Stage0", "GAR"},
-    {91, "Garizon Stage1", "GAR"},
-    {92, "Garizon Stage2", "GAR"},
-    {93, "Garizon Stage3", "GAR"},
-    {94, "SwissDLT", "BCTS"},
-    {95, "CamDL Mainnet", "CADL"},
-    {96, "Bitkub Chain", "KUB"},
-    {97, "BNB Smart Chain Testnet", "tBNB"},
-    {98, "Six Protocol", "SIX"},
-    {99, "POA Network Core", "POA"},
-    {100, "Gnosis", "XDAI"},
-    {101, "EtherInc", "ETI"},
-    {102, "Web3Games Testnet", "W3G"},
-    {103, "WorldLand Mainnet", "WLC"},
-    {104, "Kaiba Lightning Chain Testnet", "tKAIBA"},
-    {105, "Web3Games Devnet", "W3G"},
-    {106, "Velas EVM Mainnet", "VLX"},
-    {107, "Nebula Testnet", "NBX"},
-    {108, "ThunderCore Mainnet", "TT"},
-    {109, "Shibarium", "BONE"},
-    {110, "Proton Testnet", "XPR"},
-    {111, "EtherLite Chain", "ETL"},
-    {112, "Coinbit Mainnet", "GIDR"},
-    {113, "Dehvo", "Deh"},
-    {114, "Flare Testnet Coston2", "C2FLR"},
-    {115, "DeBank Testnet(Deprecated)", "ETH"},
-    {116, "DeBank Mainnet", "ETH"},
-    {117, "Uptick Mainnet", "UPTICK"},
-    {118, "Arcology Testnet", "Acol"},
-    {119, "ENULS Mainnet", "NULS"},
-    {120, "ENULS Testnet", "NULS"},
-    {121, "Realchain Mainnet", "REAL"},
-    {122, "Fuse Mainnet", "FUSE"},
-    {123, "Fuse Sparknet", "SPARK"},
-    {124, "Decentralized Web Mainnet", "DWU"},
-    {125, "OYchain Testnet", "OY"},
-    {126, "OYchain Mainnet", "OY"},
-    {127, "Factory 127 Mainnet", "FETH"},
-    {128, "Huobi ECO Chain Mainnet", "HT"},
-    {129, "Innovator Chain", "INOV8"},
-    {130, "Unichain", "ETH"},
-    {131, "Engram Testnet", "tGRAM"},
-    {132, "Namefi Chain Mainnet", "NFIC"},
-    {133, "HashKey Chain Testnet", "HSK"},
-    {134, "iExec Sidechain", "xRLC"},
-    {135, "Alyx Chain Testnet", "ALYX"},
-    {136, "Deamchain Mainnet", "DEAM"},
-    {137, "Polygon Mainnet", "POL"},
-    {138, "Defi Oracle Meta Mainnet", "ETH"},
-    {139, "WoopChain Mainnet", "WOOC"},
-    {140, "Eternal Mainnet", "ETE"},
-    {141, "Openpiece Testnet", "BELLY"},
-    {142, "DAX CHAIN", "DAX"},
-    {143, "Monad Mainnet", "MON"},
-    {144, "PHI Network v2", "Φ"},
-    {145, "SoraAI Testnet", "SETH"},
-    {147, "Flag Mainnet", "FLAG"},
-    {148, "ShimmerEVM", "SMR"},
-    {150, "Six Protocol Testnet", "tSIX"},
-    {151, "Redbelly Network Mainnet", "RBNT"},
-    {152, "Redbelly Network Devnet", "RBNT"},
-    {153, "Redbelly Network Testnet", "RBNT"},
-    {154, "Redbelly Network TGE", "RBNT"},
-    {155, "Tenet Testnet", "TENET"},
-    {156, "OEBlock Testnet", "OEB"},
-    {157, "Puppynet Shibarium", "BONE"},
-    {158, "Roburna Mainnet", "RBA"},
-    {159, "Roburna Testnet", "RBAT"},
-    {160, "Armonia Eva Chain Mainnet", "AMAX"},
-    {161, "Armonia Eva Chain Testnet", "AMAX"},
-    {162, "Lightstreams Testnet", "PHT"},
-    {163, "Lightstreams Mainnet", "PHT"},
-    {164, "Omni Omega Testnet", "OMNI"},
-    {165, "Omni Testnet (Deprecated)", "OMNI"},
-    {166, "Omni", "OMNI"},
-    {167, "Atoshi Testnet", "ATOS"},
-    {168, "AIOZ Network", "AIOZ"},
-    {169, "Manta Pacific Mainnet", "ETH"},
-    {170, "HOO Smart Chain Testnet", "HOO"},
-    {171, "CO2e Ledger", "CO2E"},
-    {172, "Latam-Blockchain Resil Testnet", "usd"},
-    {175, "OTC", "OTC"},
-    {176, "DC Mainnet", "DCT"},
-    {177, "HashKey Chain", "HSK"},
-    {178, "ABEY Testnet", "tABEY"},
-    {179, "ABEY Mainnet", "ABEY"},
-    {180, "AME Chain Mainnet", "AME"},
-    {181, "Waterfall Network", "WATER"},
-    {182, "IOST Mainnet", "BNB"},
-    {183, "Ethernity", "ETH"},
-    {184, "Dojima Testnet", "DOJ"},
-    {185, "Mint Mainnet", "ETH"},
-    {186, "Seele Mainnet", "Seele"},
-    {187, "Dojima", "DOJ"},
-    {188, "BMC Mainnet", "BTM"},
-    {189, "BMC Testnet", "BTM"},
-    {190, "CMDAO BBQ Chain", "CMD"},
-    {191, "FileFileGo", "FFG"},
-    {193, "Crypto Emergency", "CEM"},
-    {195, "X Layer Testnet", "OKB"},
-    {196, "X Layer Mainnet", "OKB"},
-    {197, "Neutrinos TestNet", "NEUTR"},
-    {198, "Bitchain Mainnet", "BTC"},
-    {199, "BitTorrent Chain Mainnet", "BTT"},
-    {200, "Arbitrum on xDai", "xDAI"},
-    {201, "MOAC testnet", "mc"},
-    {202, "Edgeless Testnet", "EwEth"},
-    {204, "opBNB Mainnet", "BNB"},
-    {205, "EKAASH", "$EKH"},
-    {206, "VinuChain Testnet", "VC"},
-    {207, "VinuChain Network", "VC"},
-    {208, "Structx Mainnet", "utx"},
-    {210, "Bitnet", "BTN"},
-    {211, "Freight Trust Network", "0xF"},
-    {212, "MAPO Makalu", "MAPO"},
-    {213, "B2 Hub Mainnet", "B2"},
-    {214, "Shinarium Mainnet", "SHI"},
-    {217, "SiriusNet V2", "MCD"},
-    {218, "SoterOne Mainnet old", "SOTER"},
-    {220, "Scalind Testnet", "ETH"},
-    {221, "BlockEx Mainnet", "XBE"},
-    {222, "Permission", "ASK"},
-    {223, "B2 Mainnet", "BTC"},
-    {224, "Viridis Testnet", "VRD"},
-    {225, "LACHAIN Mainnet", "LA"},
-    {226, "LACHAIN Testnet", "TLA"},
-    {227, "Prom", "PROM"},
-    {228, "Mind Network Mainnet", "ETH"},
-    {230, "SwapDEX", "SDX"},
-    {233, "Ethernity Testnet", "ETH"},
-    {234, "ProtoJumbo Testnet", "JNFTC"},
-    {236, "Deamchain Testnet", "DEAM"},
-    {238, "Blast Mainnet", "ETH"},
-    {240, "Cronos zkEVM Testnet", "zkTCRO"},
-    {242, "Plinga Mainnet", "PLINGA"},
-    {246, "Energy Web Chain", "EWT"},
-    {248, "Oasys Mainnet", "OAS"},
-    {250, "Fantom Opera", "FTM"},
-    {251, "Glide L1 Protocol XP", "GLXP"},
-    {252, "Fraxtal", "frxETH"},
-    {253, "Glide L2 Protocol XP", "GLXP"},
-    {254, "Swan Chain Mainnet", "ETH"},
-    {255, "Kroma", "ETH"},
-    {256, "Huobi ECO Chain Testnet", "htt"},
-    {258, "Setheum", "SETM"},
-    {259, "Neonlink Mainnet", "NEON"},
-    {260, "Guru Network", "GURU"},
-    {261, "Guru Network Testnet", "tGURU"},
-    {262, "SUR Blockchain Network", "SRN"},
-    {266, "Neura", "ANKR"},
-    {267, "Neura Testnet", "ANKR"},
-    {268, "Neura Devnet", "ANKR"},
-    {269, "High Performance Blockchain", "HPB"},
-    {271, "EgonCoin Mainnet", "EGON"},
-    {274, "LaChain", "LAC"},
-    {278, "xFair.AI Mainnet", "FAI"},
-    {279, "BPX Chain", "BPX"},
-    {280, "zkSync Era Goerli Testnet (deprecated)", "ETH"},
-    {282, "Deprecated Cronos zkEVM Testnet", "zkTCRO"},
-    {288, "Boba Network", "ETH"},
-    {291, "Orderly Mainnet", "ETH"},
-    {293, "DaVinci", "DCOIN"},
-    {295, "Hedera Mainnet", "HBAR"},
-    {296, "Hedera Testnet", "HBAR"},
-    {297, "Hedera Previewnet", "HBAR"},
-    {298, "Hedera Localnet", "HBAR"},
-    {300, "zkSync Sepolia Testnet", "ETH"},
-    {301, "Bobaopera", "BOBA"},
-    {302, "zkCandy Sepolia Testnet", "ETH"},
-    {303, "Neurochain Testnet", "tNCN"},
-    {305, "ZKSats Mainnet", "BTC"},
-    {307, "Lovely Network Testnet", "LOVELY"},
-    {308, "Furtheon", "FTH"},
-    {309, "Wyzth Testnet", "WYZ"},
-    {311, "Omax Mainnet", "OMAX"},
-    {313, "Neurochain Mainnet", "NCN"},
-    {314, "Filecoin - Mainnet", "FIL"},
-    {321, "KCC Mainnet", "KCS"},
-    {322, "KCC Testnet", "tKCS"},
-    {323, "Cosvm Mainnet", "CVM"},
-    {324, "zkSync Mainnet", "ETH"},
-    {325, "GRVT Mainnet", "ETH"},
-    {326, "GRVT Sepolia Testnet", "ETH"},
-    {332, "Omax Testnet", "OMAXT"},
-    {333, "Web3Q Mainnet", "W3Q"},
-    {335, "DFK Chain Test", "JEWEL"},
-    {336, "Shiden", "SDN"},
-    {338, "Cronos Testnet", "TCRO"},
-    {345, "TSC Mainnet", "TAS"},
-    {360, "Shape", "ETH"},
-    {361, "Theta Mainnet", "TFUEL"},
-    {363, "Theta Sapphire Testnet", "TFUEL"},
-    {364, "Theta Amber Testnet", "TFUEL"},
-    {365, "Theta Testnet", "TFUEL"},
-    {369, "PulseChain", "PLS"},
-    {371, "Consta Testnet", "tCNT"},
-    {380, "ZKAmoeba Testnet", "FIL"},
-    {381, "ZKAmoeba Mainnet", "FIL"},
-    {385, "Lisinski", "LISINS"},
-    {388, "Cronos zkEVM Mainnet", "zkCRO"},
-    {395, "CamDL Testnet", "CADL"},
-    {397, "NEAR Protocol", "NEAR"},
-    {398, "NEAR Protocol Testnet", "NEAR"},
-    {399, "Nativ3 Mainnet", "USNT"},
-    {400, "HyperonChain TestNet", "HPN"},
-    {401, "Ozone Chain Testnet", "OZO"},
-    {404, "Syndr L3", "ETH"},
-    {411, "Pepe Chain Mainnet", "PEPE"},
-    {416, "SX Network Mainnet", "SX"},
-    {418, "LaTestnet", "TLA"},
-    {420, "Optimism Goerli Testnet", "ETH"},
-    {422, "Viridis Mainnet", "VRD"},
-    {424, "PGN (Public Goods Network)", "ETH"},
-    {425, "Stenix Mainnet", "STEN"},
-    {426, "The Widows Mite", "MITE"},
-    {427, "Zeeth Chain", "ZTH"},
-    {428, "Geso Verse", "OAS"},
-    {434, "Boyaa Mainnet", "BYC"},
-    {443, "Ten Testnet", "ETH"},
-    {444, "Synapse Chain Testnet", "ETH"},
-    {456, "ARZIO Chain", "AZO"},
-    {462, "Areon Network Testnet", "TAREA"},
-    {463, "Areon Network Mainnet", "AREA"},
-    {480, "World Chain", "ETH"},
-    {499, "Rupaya", "RUPX"},
-    {500, "Camino C-Chain", "CAM"},
-    {501, "Columbus Test Network", "CAM"},
-    {510, "Syndicate Chain", "ETH"},
-    {512, "Double-A Chain Mainnet", "AAC"},
-    {513, "Double-A Chain Testnet", "AAC"},
-    {516, "Gear Zero Network Mainnet", "GZN"},
-    {520, "XT Smart Chain Mainnet", "XT"},
-    {529, "Firechain Mainnet", "FIRE"},
-    {530, "F(x)Core Mainnet Network", "FX"},
-    {534, "Candle", "CNDL"},
-    {537, "OpTrust Mainnet", "BNB"},
-    {542, "PAWCHAIN Testnet", "PAW"},
-    {545, "EVM on Flow Testnet", "FLOW"},
-    {555, "Vela1 Chain Mainnet", "CLASS"},
-    {558, "Tao Network", "TAO"},
-    {565, "Prometheuz Testnet", "PYRE"},
-    {568, "Dogechain Testnet", "DOGE"},
-    {570, "Rollux Mainnet", "SYS"},
-    {571, "MetaChain Mainnet", "MTC"},
-    {579, "Filenova Mainnet", "FIL"},
-    {588, "Metis Stardust Testnet", "METIS"},
-    {592, "Astar", "ASTR"},
-    {595, "Acala Mandala Testnet TC9", "mACA"},
-    {596, "Karura Network Testnet", "KAR"},
-    {597, "Acala Network Testnet", "ACA"},
-    {599, "Metis Goerli Testnet", "METIS"},
-    {600, "Meshnyan testnet", "MESHT"},
-    {601, "Vine Testnet", "VNE"},
-    {610, "Darwin Devnet", "DNA"},
-    {612, "EIOB Mainnet", "EIOB"},
-    {614, "Graphlinq Blockchain Mainnet", "GLQ"},
-    {624, "Binary Mainnet", "BNRY"},
-    {625, "Binary Sepolia", "BNRY"},
-    {634, "Avocado", "USDC"},
-    {646, "Previewnet", "FLOW"},
-    {647, "SX Network Testnet", "SX"},
-    {648, "Endurance Smart Chain Mainnet", "ACE"},
-    {653, "Kalichain Testnet", "KALIS"},
-    {654, "Kalichain", "KALIS"},
-    {662, "UltronSmartchain", "ULC"},
-    {666, "Pixie Chain Testnet", "PCTT"},
-    {667, "LAOS Arrakis", "LAOS"},
-    {668, "JuncaChain", "JGC"},
-    {669, "JuncaChain testnet", "JGCT"},
-    {686, "Karura Network", "KAR"},
-    {689, "NERO Testnet", "NERO"},
-    {690, "Redstone", "ETH"},
-    {698, "Matchain", "BNB"},
-    {699, "Matchain Testnet", "BNB"},
-    {700, "Star Social Testnet", "SNS"},
-    {701, "Darwinia Koi Testnet", "KRING"},
-    {707, "BlockChain Station Mainnet", "BCS"},
-    {708, "BlockChain Station Testnet", "tBCS"},
-    {710, "Highbury", "FURY"},
-    {711, "Tucana", "TUC"},
-    {712, "Birdee-2", "TUC"},
-    {713, "Vrcscan Mainnet", "VRC"},
-    {719, "Shibarium Beta", "BONE"},
-    {721, "Lycan Chain", "LYC"},
-    {727, "Blucrates", "BLU"},
-    {730, "Lovely Network Mainnet", "LOVELY"},
-    {740, "Canto Testnet", "CANTO"},
-    {741, "Vention Smart Chain Testnet", "VNT"},
-    {742, "Script Testnet", "SPAY"},
-    {747, "EVM on Flow", "FLOW"},
-    {766, "QL1", "QOM"},
-    {776, "OpenChain Testnet", "TOPC"},
-    {777, "cheapETH", "cTH"},
-    {786, "MAAL Chain", "MAAL"},
-    {787, "Acala Network", "ACA"},
-    {788, "Aerochain Testnet", "TAero"},
-    {789, "Patex", "ETH"},
-    {799, "Rupaya Testnet", "TRUPX"},
-    {800, "Lucid Blockchain", "LUCID"},
-    {803, "Haic", "HAIC"},
-    {808, "Portal Fantasy Chain Test", "PFT"},
-    {810, "Haven1 Testnet", "H1"},
-    {813, "Qitmeer Network Mainnet", "MEER"},
-    {814, "Firechain zkEVM", "ETH"},
-    {818, "BeOne Chain Mainnet", "BOC"},
-    {820, "Callisto Mainnet", "CLO"},
-    {821, "Callisto Testnet Deprecated", "TCLO"},
-    {822, "Runic Chain Testnet", "rBTC"},
-    {831, "CheckDot Blockchain Devnet", "CDT"},
-    {841, "Taraxa Mainnet", "TARA"},
-    {842, "Taraxa Testnet", "TARA"},
-    {852, "HongKong Mainnet", "HK"},
-    {859, "Zeeth Chain Dev", "ZTH"},
-    {868, "Fantasia Chain Mainnet", "FST"},
-    {876, "Bandai Namco Research Verse Mainnet", "OAS"},
-    {877, "Dexit Network", "DXT"},
-    {880, "Ambros Chain Mainnet", "AMBROS"},
-    {888, "Wanchain", "WAN"},
-    {898, "MAXI Chain Testnet", "MGAS"},
-    {899, "MAXI Chain Mainnet", "MGAS"},
-    {900, "Garizon Testnet Stage0", "GAR"},
-    {901, "Garizon Testnet Stage1", "GAR"},
-    {902, "Garizon Testnet Stage2", "GAR"},
-    {903, "Garizon Testnet Stage3", "GAR"},
-    {909, "Portal Fantasy Chain", "PFT"},
-    {910, "DecentraBone Layer1 Testnet", "DBONE"},
-    {911, "TAPROOT Mainnet", "TBTC"},
-    {917, "Rinia Testnet", "FIRE"},
-    {918, "SlerfChain Mainnet", "WSLERF"},
-    {919, "Mode Testnet", "ETH"},
-    {927, "Yidark Chain Mainnet", "YDK"},
-    {938, "Haust Mainnet", "HAUST"},
-    {940, "PulseChain Testnet", "tPLS"},
-    {941, "PulseChain Testnet v2b", "tPLS"},
-    {942, "PulseChain Testnet v3", "tPLS"},
-    {943, "PulseChain Testnet v4", "tPLS"},
-    {945, "Subtensor EVM Testnet", "TAO"},
-    {956, "muNode Testnet", "ETH"},
-    {957, "Lyra Chain", "ETH"},
-    {963, "BTC20 Smart Chain", "BTCC"},
-    {969, "EthXY", "SEXY"},
-    {970, "Oort Mainnet", "OORT"},
-    {971, "Oort Huygens", "CCN"},
-    {972, "Oort Ascraeus", "CCNA"},
-    {973, "Palm Smart Chain", "PALM"},
-    {977, "Nepal Blockchain Network", "YETI"},
-    {979, "EthXY Testnet", "SEXY"},
-    {980, "TOP Mainnet EVM", "ETH"},
-    {985, "Memo Smart Chain Mainnet", "CMEMO"},
-    {987, "BinaryChain Mainnet", "BNRY"},
-    {989, "TOP Mainnet", "TOP"},
-    {990, "eLiberty Mainnet", "$EL"},
-    {995, "5ireChain Mainnet", "5ire"},
-    {996, "Bifrost Polkadot Mainnet", "WETH"},
-    {997, "5ireChain Thunder Testnet", "T5IRE"},
-    {998, "Lucky Network", "L99"},
-    {999, "Wanchain Testnet", "WAN"},
-    {1000, "GTON Mainnet", "GCD"},
-    {1001, "Kaia Testnet Kairos", "KAIA"},
-    {1003, "Tectum Emission Token", "TET"},
-    {1004, "T-EKTA", "T-EKTA"},
-    {1005, "LemonChainTestnet", "tLEMX"},
-    {1006, "LemonChain", "LEMX"},
-    {1007, "Newton Testnet", "NEW"},
-    {1008, "Eurus Mainnet", "EUN"},
-    {1009, "Jumbochain Mainnet", "JNFTC"},
-    {1010, "Evrice Network", "EVC"},
-    {1011, "Rebus Mainnet", "REBUS"},
-    {1012, "Newton", "NEW"},
-    {1022, "Sakura", "SKU"},
-    {1023, "Clover Testnet", "CLV"},
-    {1024, "CLV Parachain", "CLV"},
-    {1028, "BitTorrent Chain Testnet", "BTT"},
-    {1029, "BitTorrent Chain Donau", "BTT"},
-    {1030, "Conflux eSpace", "CFX"},
-    {1031, "Proxy Network Testnet", "PRX"},
-    {1038, "Bronos Testnet", "tBRO"},
-    {1039, "Bronos Mainnet", "BRO"},
-    {1071, "ShimmerEVM Testnet Deprecated", "SMR"},
-    {1072, "ShimmerEVM Testnet Deprecated 1072", "SMR"},
-    {1073, "ShimmerEVM Testnet", "SMR"},
-    {1075, "IOTA EVM Testnet", "IOTA"},
-    {1079, "Mintara Testnet", "MNTR"},
-    {1080, "Mintara Mainnet", "MNTR"},
-    {1088, "Metis Andromeda Mainnet", "METIS"},
-    {1089, "Humans.ai Mainnet", "HEART"},
-    {1099, "MOAC mainnet", "mc"},
-    {1100, "Dymension", "DYM"},
-    {1101, "Polygon zkEVM", "ETH"},
-    {1107, "BLXq Testnet", "BLXQ"},
-    {1108, "BLXq Mainnet", "BLXQ"},
-    {1111, "WEMIX3.0 Mainnet", "WEMIX"},
-    {1112, "WEMIX3.0 Testnet", "tWEMIX"},
-    {1113, "B2 Hub Testnet", "B2"},
-    {1115, "Core Blockchain Testnet", "tCORE"},
-    {1116, "Core Blockchain Mainnet", "CORE"},
-    {1117, "Dogcoin Mainnet", "DOGS"},
-    {1123, "B2 Testnet", "BTC"},
-    {1130, "DeFiChain EVM Network Mainnet", "DFI"},
-    {1131, "DeFiChain EVM Network Testnet", "DFI"},
-    {1133, "DeFiMetaChain Changi Testnet", "DFI"},
-    {1135, "Lisk", "ETH"},
-    {1138, "AmStar Testnet", "SINSO"},
-    {1139, "MathChain", "MATH"},
-    {1140, "MathChain Testnet", "MATH"},
-    {1147, "Flag Testnet", "FLAG"},
-    {1149, "Symplexia Smart Chain", "PLEX"},
-    {1170, "Origin Testnet", "UOC"},
-    {1174, "Litheum Test Network", "LTH"},
-    {1177, "Smart Host Teknoloji TESTNET", "tSHT"},
-    {1188, "ClubMos Mainnet", "MOS"},
-    {1197, "Iora Chain", "IORA"},
-    {1200, "Cuckoo Chain", "CAI"},
-    {1201, "Evanesco Testnet", "AVIS"},
-    {1202, "World Trade Technical Chain Mainnet", "WTT"},
-    {1209, "SaitaBlockChain(SBC)", "STC"},
-    {1210, "Cuckoo Sepolia", "CAI"},
-    {1212, "ADF Chain Testnet", "tADF"},
-    {1213, "Popcateum Mainnet", "POP"},
-    {1214, "EnterChain Mainnet", "ENTER"},
-    {1215, "ADF Chain", "ADF"},
-    {1221, "Cycle Network Testnet", "ETH"},
-    {1223, "Cycle Network Testnet Jellyfish", "ETH"},
-    {1224, "Hybrid Testnet (Deprecated)", "HYB"},
-    {1225, "Hybrid Testnet", "HYB"},
-    {1227, "Bitcoin Protocol Testnet", "BTCP"},
-    {1228, "Cycle Network Testnet Cuttlefish", "ETH"},
-    {1229, "Exzo Network Mainnet", "XZO"},
-    {1230, "Ultron Testnet", "ULX"},
-    {1231, "Ultron Mainnet", "ULX"},
-    {1234, "Step Network", "FITFI"},
-    {1235, "ITX Mainnet", "ITX"},
-    {1243, "ARC Mainnet", "ARC"},
-    {1244, "ARC Testnet", "ARC"},
-    {1246, "OM Platform Mainnet", "OM"},
-    {1248, "Dogether Mainnet", "dogeth"},
-    {1252, "CIC Chain Testnet", "CICT"},
-    {1260, "Metacces Testnet", "ACCES"},
-    {1280, "HALO Mainnet", "HO"},
-    {1284, "Moonbeam", "GLMR"},
-    {1285, "Moonriver", "MOVR"},
-    {1286, "Moonrock old", "ROC"},
-    {1287, "Moonbase Alpha", "DEV"},
-    {1288, "Moonrock", "ROC"},
-    {1291, "Swisstronik Testnet", "SWTR"},
-    {1294, "Bobabeam", "BOBA"},
-    {1297, "Bobabase Testnet", "BOBA"},
-    {1299, "Argochain", "AGC"},
-    {1301, "Unichain Sepolia Testnet", "ETH"},
-    {1311, "Dos Fuji Subnet", "DOS"},
-    {1313, "JaiHo Chain", "JaiHo"},
-    {1314, "Alyx Mainnet", "ALYX"},
-    {1319, "AIA Mainnet", "AIA"},
-    {1320, "AIA Testnet", "AIA"},
-    {1328, "Sei Testnet", "SEI"},
-    {1329, "Sei Network", "SEI"},
-    {1337, "Geth Testnet", "ETH"},
-    {1338, "Elysium Testnet", "LAVA"},
-    {1339, "Elysium Mainnet", "LAVA"},
-    {1343, "Blitz Subnet", "BGAS"},
-    {1353, "CIC Chain Mainnet", "CIC"},
-    {1369, "Zafirium Mainnet", "ZAFIC"},
-    {1370, "Ramestta Mainnet", "RAMA"},
-    {1377, "Pingaksha testnet", "tRAMA"},
-    {1379, "Kalar Chain", "KLC"},
-    {1388, "AmStar Mainnet", "SINSO"},
-    {1392, "Joseon Mainnet", "JSM"},
-    {1402, "Polygon zkEVM Testnet old", "ETH"},
-    {1414, "Silicon zkEVM Sepolia Testnet(Deprecated)", "ETH"},
-    {1422, "Polygon zkEVM Testnet Pre Audit-Upgraded", "ETH"},
-    {1433, "Rikeza Network Mainnet", "RIK"},
-    {1440, "Living Assets Mainnet", "LAS"},
-    {1442, "Polygon zkEVM Testnet", "ETH"},
-    {1452, "GIL Testnet", "GANG"},
-    {1453, "MetaChain Istanbul", "MTC"},
-    {1455, "Ctex Scan Blockchain", "CTEX"},
-    {1456, "ZKBase Mainnet", "ETH"},
-    {1480, "Islander", "ISL"},
-    {1490, "Vitruveo Mainnet", "VTRU"},
-    {1499, "iDos Games Chain Testnet", "IGC"},
-    {1501, "BEVM Canary", "BTC"},
-    {1506, "Sherpax Mainnet", "KSX"},
-    {1507, "Sherpax Testnet", "KSX"},
-    {1513, "Story Testnet", "IP"},
-    {1515, "Beagle Messaging Chain", "BG"},
-    {1516, "Story Odyssey Testnet", "IP"},
-    {1555, "Datacore Smart Chain", "DSC"},
-    {1559, "Tenet", "TENET"},
-    {1570, "StarCHAIN Testnet", "STARX"},
-    {1578, "StarCHAIN", "STARX"},
-    {1605, "Betherance", "BETH"},
-    {1617, "Ethereum Inscription Mainnet", "ETINS"},
-    {1618, "Catecoin Chain Mainnet", "CATE"},
-    {1620, "Atheios", "ATH"},
-    {1625, "Gravity Alpha Mainnet", "G"},
-    {1648, "Pivotal Mainnet", "ETH"},
-    {1657, "Btachain", "BTA"},
-    {1662, "Liquichain", "LCN"},
-    {1663, "Horizen Gobi Testnet", "tZEN"},
-    {1686, "Mint Testnet", "ETH"},
-    {1687, "Mint Sepolia Testnet", "ETH"},
-    {1688, "LUDAN Mainnet", "LUDAN"},
-    {1689, "NERO Mainnet", "NERO"},
-    {1701, "Anytype EVM Chain", "ANY"},
-    {1707, "TBSI Mainnet", "JINDA"},
-    {1708, "TBSI Testnet", "JINDA"},
-    {1717, "Doric Network", "DRC"},
-    {1718, "Palette Chain Mainnet", "PLT"},
-    {1729, "Reya Network", "ETH"},
-    {1740, "Metal L2 Testnet", "ETH"},
-    {1750, "Metal L2", "ETH"},
-    {1773, "PartyChain", "GRAMS"},
-    {1777, "Gauss Mainnet", "GANG"},
-    {1789, "ZKBase Sepolia Testnet", "ETH"},
-    {1804, "Kerleano", "CRC"},
-    {1807, "Rabbit Analog Testnet Chain", "rAna"},
-    {1811, "Lif3 Chain Testnet", "LIF3"},
-    {1818, "Cube Chain Mainnet", "CUBE"},
-    {1819, "Cube Chain Testnet", "CUBET"},
-    {1821, "Ruby Smart Chain MAINNET", "RUBY"},
-    {1829, "PlayBlock", "PBG"},
-    {1833, "Verify testnet", "MATIC"},
-    {1853, "HighOctane Subnet", "HO"},
-    {1856, "Teslafunds", "TSF"},
-    {1868, "Soneium", "ETH"},
-    {1875, "Whitechain", "WBT"},
-    {1881, "Gitshock Cartenz Testnet", "tGTFX"},
-    {1890, "Lightlink Phoenix Mainnet", "ETH"},
-    {1891, "Lightlink Pegasus Testnet", "ETH"},
-    {1898, "BON Network", "BOY"},
-    {1899, "ReDeFi Layer 2", "RED"},
-    {1904, "Sports Chain Network", "SCN"},
-    {1907, "Bitcichain Mainnet", "BITCI"},
-    {1908, "Bitcichain Testnet", "TBITCI"},
-    {1909, "Merkle Scan", "MRK"},
-    {1911, "Scalind", "ETH"},
-    {1912, "Ruby Smart Chain Testnet", "tRUBY"},
-    {1918, "UPB CRESCDI Testnet", "UPBEth"},
-    {1923, "Swell Network", "ETH"},
-    {1924, "Swell Network Testnet", "ETH"},
-    {1927, "Arvix Testnet", "tARV"},
-    {1945, "ONUS Chain Testnet", "ONUS"},
-    {1946, "Minato", "ETH"},
-    {1949, "Bionix Testnet", "tBIO"},
-    {1951, "D-Chain Mainnet", "DOINX"},
-    {1953, "Selendra Network Testnet", "tSEL"},
-    {1954, "Dexilla Testnet", "DXZ"},
-    {1956, "AIW3 Testnet", "BTC"},
-    {1961, "Selendra Network Mainnet", "SEL"},
-    {1967, "Eleanor", "MTC"},
-    {1969, "Super Smart Chain Testnet", "TSCS"},
-    {1970, "Super Smart Chain Mainnet", "SCS"},
-    {1971, "Atelier", "ATLR"},
-    {1972, "RedeCoin", "REDEV2"},
-    {1975, "ONUS Chain Mainnet", "ONUS"},
-    {1984, "Eurus Testnet", "EUN"},
-    {1985, "SatoshIE", "TUSHY"},
-    {1986, "SatoshIE Testnet", "TUSHY"},
-    {1987, "EtherGem", "EGEM"},
-    {1992, "Hubble Exchange", "USDC"},
-    {1993, "B3 Sepolia Testnet", "ETH"},
-    {1994, "Ekta", "EKTA"},
-    {1995, "edeXa Testnet", "EDX"},
-    {1996, "Sanko", "DMT"},
-    {1997, "Kyoto", "KYOTO"},
-    {1998, "Kyoto Testnet", "KYOTO"},
-    {2000, "Dogechain Mainnet", "DOGE"},
-    {2001, "Milkomeda C1 Mainnet", "mADA"},
-    {2002, "Milkomeda A1 Mainnet", "mALGO"},
-    {2004, "MetaLink Network", "MTL"},
-    {2008, "CloudWalk Testnet", "CWN"},
-    {2009, "CloudWalk Mainnet", "CWN"},
-    {2013, "Panarchy", "GAS"},
-    {2014, "NOW Chain Testnet", "NOW"},
-    {2016, "MainnetZ Mainnet", "NetZ"},
-    {2017, "Adiri", "TEL"},
-    {2018, "PublicMint Devnet", "USD"},
-    {2019, "PublicMint Testnet", "USD"},
-    {2020, "PublicMint Mainnet", "USD"},
-    {2021, "Edgeware EdgeEVM Mainnet", "EDG"},
-    {2022, "Beresheet BereEVM Testnet", "tEDG"},
-    {2023, "Taycan Testnet", "tSFL"},
-    {2024, "Swan Saturn Testnet", "sETH"},
-    {2025, "Rangers Protocol Mainnet", "RPG"},
-    {2026, "Edgeless Network", "EwEth"},
-    {2031, "Centrifuge", "CFG"},
-    {2032, "Catalyst", "NCFG"},
-    {2035, "Phala Network", "PHA"},
-    {2037, "Kiwi Subnet", "SHRAP"},
-    {2038, "Shrapnel Testnet", "SHRAPG"},
-    {2039, "Aleph Zero", "TZERO"},
-    {2040, "Vanar Mainnet", "VANRY"},
-    {2043, "NeuroWeb", "NEURO"},
-    {2044, "Shrapnel Subnet", "SHRAPG"},
-    {2045, "AIW3 Mainnet", "BTC"},
-    {2047, "Stratos Testnet", "STOS"},
-    {2048, "Stratos", "STOS"},
-    {2049, "Movo Smart Chain Mainnet", "MOVO"},
-    {2071, "Metacces Mainnet", "ACCES"},
-    {2077, "Quokkacoin Mainnet", "QKA"},
-    {2088, "Altair", "AIR"},
-    {2089, "Algol", "ALGL"},
-    {2100, "Ecoball Mainnet", "ECO"},
-    {2101, "Ecoball Testnet Espuma", "ECO"},
-    {2109, "Exosama Network", "SAMA"},
-    {2112, "UCHAIN Mainnet", "UCASH"},
-    {2121, "Catena Mainnet", "CMCX"},
-    {2122, "Metaplayerone Mainnet", "METAD"},
-    {2124, "Metaplayerone Dubai Testnet", "MEU"},
-    {2136, "BigShortBets Testnet", "Dolarz"},
-    {2137, "BigShortBets", "USDC"},
-    {2138, "Defi Oracle Meta Testnet", "tETH"},
-    {2140, "Oneness Network", "BTC"},
-    {2141, "Oneness TestNet", "BTC"},
-    {2151, "BOSagora Mainnet", "BOA"},
-    {2152, "Findora Mainnet", "FRA"},
-    {2153, "Findora Testnet", "FRA"},
-    {2154, "Findora Forge", "FRA"},
-    {2162, "Animechain Testnet", "COIN"},
-    {2187, "Game7", "G7"},
-    {2192, "SnaxChain", "ETH"},
-    {2199, "Moonsama Network", "SAMA"},
-    {2202, "Antofy Mainnet", "ABN"},
-    {2203, "Bitcoin EVM", "BTC"},
-    {2213, "Evanesco Mainnet", "EVA"},
-    {2221, "Kava Testnet", "TKAVA"},
-    {2222, "Kava", "KAVA"},
-    {2223, "VChain Mainnet", "VNDT"},
-    {2241, "Krest Network", "KRST"},
-    {2300, "BOMB Chain", "BOMB"},
-    {2306, "Ebro Network", "ebro"},
-    {2309, "Arevia", "ARÉV"},
-    {2311, "Chronicle Vesuvius - Lit Protocol Testnet", "tstLPX"},
-    {2323, "SOMA Network Testnet", "tSMA"},
-    {2330, "Altcoinchain", "ALT"},
-    {2331, "RSS3 VSL Sepolia Testnet", "RSS3"},
-    {2332, "SOMA Network Mainnet", "SMA"},
-    {2340, "Atleta Olympia", "ATLA"},
-    {2342, "Omnia Chain", "OMNIA"},
-    {2355, "Silicon zkEVM", "ETH"},
-    {2357, "(deprecated) Kroma Sepolia", "ETH"},
-    {2358, "Kroma Sepolia", "ETH"},
-    {2370, "Nexis Network Testnet", "NZT"},
-    {2399, "BOMB Chain Testnet", "tBOMB"},
-    {2400, "TCG Verse Mainnet", "OAS"},
-    {2410, "K2 Mainnet", "ETH"},
-    {2415, "XODEX", "XODEX"},
-    {2425, "King Of Legends Mainnet", "KCC"},
-    {2442, "Polygon zkEVM Cardona Testnet", "ETH"},
-    {2458, "Hybrid Chain Network Testnet", "tHRC"},
-    {2468, "Hybrid Chain Network Mainnet", "HRC"},
-    {2477, "6Degree of Outreach", "6DO"},
-    {2484, "Unicorn Ultra Nebulas Testnet", "U2U"},
-    {2511, "Karak Goerli", "KRK"},
-    {2512, "K2 Testnet", "ETH"},
-    {2522, "Fraxtal Testnet", "frxETH"},
-    {2525, "inEVM Mainnet", "INJ"},
-    {2552, "Bahamut horizon", "FTN"},
-    {2559, "Kortho Mainnet", "KTO"},
-    {2569, "TechPay Mainnet", "TPC"},
-    {2606, "PoCRNet", "CRC"},
-    {2611, "Redlight Chain Mainnet", "REDLC"},
-    {2612, "EZChain C-Chain Mainnet", "EZC"},
-    {2613, "EZChain C-Chain Testnet", "EZC"},
-    {2625, "Whitechain Testnet", "WBT"},
-    {2648, "AILayer Testnet", "BTC"},
-    {2649, "AILayer Mainnet", "BTC"},
-    {2662, "APEX", "ETH"},
-    {2710, "Morph Testnet", "ETH"},
-    {2718, "K-LAOS", "KLAOS"},
-    {2730, "XR Sepolia", "tXR"},
-    {2731, "Elizabeth Testnet", "TIME"},
-    {2741, "Abstract", "ETH"},
-    {2748, "Nanon", "ETH"},
-    {2777, "GM Network Mainnet", "ETH"},
-    {2810, "Morph Holesky", "ETH"},
-    {2818, "Morph", "ETH"},
-    {2868, "HyperAGI Mainnet", "HYPT"},
-    {2882, "Chips Network", "IOTA"},
-    {2888, "Boba Network Goerli Testnet", "ETH"},
-    {2889, "Aarma Mainnet", "ARMA"},
-    {2907, "Elux Chain", "ELUX"},
-    {2911, "HYCHAIN", "TOPIA"},
-    {2941, "Xenon Chain Testnet", "tXEN"},
-    {2999, "BitYuan Mainnet", "BTY"},
-    {3000, "CENNZnet Rata", "CPAY"},
-    {3001, "CENNZnet Nikau", "CPAY"},
-    {3003, "Canxium Mainnet", "CAU"},
-    {3011, "PLAYA3ULL GAMES", "3ULL"},
-    {3031, "Orlando Chain", "ORL"},
-    {3033, "Rebus Testnet", "REBUS"},
-    {3068, "Bifrost Mainnet", "BFC"},
-    {3073, "Movement EVM", "MOVE"},
-    {3084, "XL Network Testnet", "XLN"},
-    {3100, "Immu3 EVM", "IMMU"},
-    {3102, "Vulture EVM Beta", "VFI"},
-    {3109, "SatoshiVM Alpha Mainnet", "BTC"},
-    {3110, "SatoshiVM Testnet", "BTC"},
-    {3141, "Filecoin - Hyperspace testnet", "tFIL"},
-    {3269, "Dubxcoin network", "DUBX"},
-    {3270, "Dubxcoin testnet", "TDUBX"},
-    {3306, "Debounce Subnet Testnet", "DB"},
-    {3331, "ZCore Testnet", "ZCR"},
-    {3332, "EthStorage L2 Mainnet", "ETH"},
-    {3333, "EthStorage Testnet", "ETH"},
-    {3334, "Web3Q Galileo", "W3Q"},
-    {3335, "EthStorage L2 Devnet", "ETH"},
-    {3336, "EthStorage L2 Testnet", "ETH"},
-    {3337, "EthStorage Devnet", "ETH"},
-    {3338, "peaq", "PEAQ"},
-    {3339, "EthStorage Mainnet", "ETH"},
-    {3400, "Paribu Net Mainnet", "PRB"},
-    {3424, "EVOLVE Mainnet", "EVO"},
-    {3434, "SecureChain Testnet", "SCAI"},
-    {3456, "LayerEdge testnet", "BTC"},
-    {3490, "GTCSCAN", "GTC"},
-    {3500, "Paribu Net Testnet", "PRB"},
-    {3501, "JFIN Chain", "JFIN"},
-    {3502, "JZERO", "JZR"},
-    {3601, "PandoProject Mainnet", "PTX"},
-    {3602, "PandoProject Testnet", "PTX"},
-    {3630, "Tycooncoin", "TYCO"},
-    {3636, "Botanix Testnet", "BTC"},
-    {3637, "Botanix Mainnet", "BTC"},
-    {3639, "iChain Network", "ISLAMI"},
-    {3645, "iChain Testnet", "ISLAMI"},
-    {3666, "Jouleverse Mainnet", "J"},
-    {3690, "Bittex Mainnet", "BTX"},
-    {3693, "Empire Network", "EMPIRE"},
-    {3698, "SenjePowers Testnet", "SPC"},
-    {3699, "SenjePowers Mainnet", "SPC"},
-    {3701, "Xpla Testnet", "XPLA"},
-    {3737, "Crossbell", "CSB"},
-    {3776, "Astar zkEVM", "ETH"},
-    {3797, "AlveyChain Mainnet", "ALV"},
-    {3799, "Tangle Testnet", "tTNT"},
-    {3885, "Firechain zkEVM Ghostrider", "ETH"},
-    {3888, "KalyChain Mainnet", "KLC"},
-    {3889, "KalyChain Testnet", "KLC"},
-    {3912, "DRAC Network", "DRAC"},
-    {3939, "DOS Tesnet", "DOS"},
-    {3966, "DYNO Mainnet", "DYNO"},
-    {3967, "DYNO Testnet", "tDYNO"},
-    {3993, "APEX Testnet", "ETH"},
-    {3999, "YuanChain Mainnet", "YCC"},
-    {4000, "Ozone Chain Mainnet", "OZO"},
-    {4001, "Peperium Chain Testnet", "PERIUM"},
-    {4002, "Fantom Testnet", "FTM"},
-    {4003, "X1 Fastnet", "XN"},
-    {4040, "Carbonium Testnet Network", "tCBR"},
-    {4048, "GAN Testnet", "GP"},
-    {4051, "Bobaopera Testnet", "BOBA"},
-    {4058, "Bahamut ocean", "FTN"},
-    {4061, "Nahmii 3 Mainnet", "ETH"},
-    {4062, "Nahmii 3 Testnet", "ETH"},
-    {4078, "Muster Mainnet", "ETH"},
-    {4080, "Tobe Chain Testnet", "TOBE"},
-    {4088, "Zeroth Mainnet", "ZRH"},
-    {4090, "Fastex Chain (Bahamut) Oasis Testnet", "FTN"},
-    {4096, "Bitindi Testnet", "$BNI"},
-    {4099, "Bitindi Mainnet", "$BNI"},
-    {4102, "AIOZ Network Testnet", "AIOZ"},
-    {4139, "Humans.ai Testnet", "HEART"},
-    {4141, "Tipboxcoin Testnet", "TPBX"},
-    {4157, "CrossFi Testnet", "XFI"},
-    {4158, "CrossFi Mainnet", "XFI"},
-    {4162, "SX Rollup", "SX"},
-    {4181, "PHI Network V1", "Φ"},
-    {4200, "Merlin Mainnet", "BTC"},
-    {4201, "LUKSO Testnet", "LYXt"},
-    {4202, "Lisk Sepolia Testnet", "ETH"},
-    {4242, "Nexi Mainnet", "NEXI"},
-    {4243, "Nexi V2 Mainnet", "NEXI"},
-    {4269, "Laika Testnet", "DOGE"},
-    {4321, "Echos Chain", "USDC"},
-    {4328, "Bobafuji Testnet", "BOBA"},
-    {4337, "Beam", "BEAM"},
-    {4400, "Credit Smart Chain Mainnet", "CREDIT"},
-    {4422, "Testnet Pika", "tPKA"},
-    {4444, "Htmlcoin Mainnet", "HTML"},
-    {4460, "Orderly Sepolia Testnet", "ETH"},
-    {4488, "Hydra Chain", "HYDRA"},
-    {4544, "Emoney Network Testnet", "EMYC"},
-    {4613, "VERY Mainnet", "VERY"},
-    {4653, "Gold Chain", "ETH"},
-    {4689, "IoTeX Network Mainnet", "IOTX"},
-    {4690, "IoTeX Network Testnet", "IOTX"},
-    {4759, "MEVerse Chain Testnet", "MEV"},
-    {4777, "BlackFort Exchange Network Testnet", "TBXN"},
-    {4801, "World Chain Sepolia Testnet", "ETH"},
-    {4893, "Globel Chain", "GC"},
-    {4918, "Venidium Testnet", "XVM"},
-    {4919, "Venidium Mainnet", "XVM"},
-    {4999, "BlackFort Exchange Network", "BXN"},
-    {5000, "Mantle", "MNT"},
-    {5001, "Mantle Testnet", "MNT"},
-    {5002, "Treasurenet Mainnet Alpha", "UNIT"},
-    {5003, "Mantle Sepolia Testnet", "MNT"},
-    {5005, "Treasurenet Testnet", "UNIT"},
-    {5039, "ONIGIRI Test Subnet", "ONGR"},
-    {5040, "ONIGIRI Subnet", "ONGR"},
-    {5050, "Skate Mainnet", "ETH"},
-    {5051, "Nollie Skatechain Testnet", "ETH"},
-    {5080, "Pioneer Zero Chain", "PZO"},
-    {5090, "Pioneer Chain Testnet", "PIO"},
-    {5100, "Syndicate Testnet", "ETH"},
-    {5101, "Syndicate Frame Chain", "ETH"},
-    {5102, "SIC Testnet", "ETH"},
-    {5103, "Coordinape Testnet", "ETH"},
-    {5104, "Charmverse Testnet", "ETH"},
-    {5105, "Superloyalty Testnet", "ETH"},
-    {5106, "Azra Testnet", "ETH"},
-    {5112, "Ham", "ETH"},
-    {5115, "Citrea Testnet", "cBTC"},
-    {5151, "MeChain Testnet", "ZKME"},
-    {5165, "Bahamut", "FTN"},
-    {5169, "Smart Layer Network", "SU"},
-    {5177, "TLChain Network Mainnet", "TLC"},
-    {5197, "EraSwap Mainnet", "ES"},
-    {5234, "Humanode Mainnet", "eHMND"},
-    {5290, "Firechain Mainnet Old", "FIRE"},
-    {5315, "Uzmi Network Mainnet", "UZMI"},
-    {5317, "OpTrust Testnet", "tBNB"},
-    {5321, "ITX Testnet", "ITX"},
-    {5330, "Superseed", "ETH"},
-    {5333, "Netsbo", "NETS"},
-    {5353, "Tritanium Testnet", "tTRN"},
-    {5372, "Settlus Testnet", "SETL"},
-    {5424, "edeXa Mainnet", "EDX"},
-    {5439, "Egochain", "EGAX"},
-    {5522, "VEX EVM TESTNET", "VEX"},
-    {5545, "DuckChain Mainnet", "TON"},
-    {5551, "Nahmii 2 Mainnet", "ETH"},
-    {5553, "Nahmii 2 Testnet", "ETH"},
-    {5555, "Chain Verse Mainnet", "OAS"},
-    {5611, "opBNB Testnet", "tBNB"},
-    {5615, "Arcturus Testneet", "tARC"},
-    {5616, "Arcturus Chain Testnet", "tARCT"},
-    {5656, "QIE Blockchain", "QIE"},
-    {5675, "Filenova Testnet", "tFIL"},
-    {5678, "Tanssi Demo", "TANGO"},
-    {5700, "Syscoin Tanenbaum Testnet", "tSYS"},
-    {5729, "Hika Network Testnet", "HIK"},
-    {5758, "SatoshiChain Testnet", "SATS"},
-    {5777, "Ganache", "ETH"},
-    {5845, "Tangle", "TNT"},
-    {5851, "Ontology Testnet", "ONG"},
-    {5858, "Chang Chain Foundation Mainnet", "CTH"},
-    {5869, "Wegochain Rubidium Mainnet", "RBD"},
-    {6000, "BounceBit Testnet", "BB"},
-    {6001, "BounceBit Mainnet", "BB"},
-    {6060, "BC Hyper Chain Testnet", "TVTCN"},
-    {6065, "Tres Testnet", "TRES"},
-    {6066, "Tres Mainnet", "TRES"},
-    {6102, "Cascadia Testnet", "tCC"},
-    {6118, "UPTN Testnet", "UPTN"},
-    {6119, "UPTN", "UPTN"},
-    {6278, "Rails", "STEAMX"},
-    {6283, "LAOS", "LAOS"},
-    {6321, "Aura Euphoria Testnet", "eAura"},
-    {6322, "Aura Mainnet", "AURA"},
-    {6363, "Digit Soul Smart Chain", "DGC"},
-    {6398, "Connext Sepolia", "ETH"},
-    {6502, "Peerpay", "P2P"},
-    {6550, "Flamma Testnet", "FLA"},
-    {6552, "Scolcoin WeiChain Testnet", "SCOL"},
-    {6565, "Fox Testnet Network", "tFOX"},
-    {6626, "Pixie Chain Mainnet", "PIX"},
-    {6660, "Latest Chain Testnet", "LATEST"},
-    {6661, "Cybria Mainnet", "CYBA"},
-    {6666, "Cybria Testnet", "CYBA"},
-    {6667, "Storchain", "STR"},
-    {6678, "Edge Matrix Chain", "EMC"},
-    {6688, "IRIShub", "ERIS"},
-    {6699, "OX Chain", "OX"},
-    {6701, "PAXB Mainnet", "PAXB"},
-    {6779, "Compverse Mainnet", "CPV"},
-    {6789, "Gold Smart Chain Mainnet", "STAND"},
-    {6805, "RACE Mainnet", "ETH"},
-    {6806, "RACE Testnet", "ETH"},
-    {6868, "Pools Mainnet", "POOLS"},
-    {6880, "Mtt Mainnet", "MTT"},
-    {6900, "Nibiru Mainnet", "NIBI"},
-    {6942, "Laika Mainnet", "DOGE"},
-    {6969, "Tomb Chain Mainnet", "TOMB"},
-    {6999, "PolySmartChain", "PSC"},
-    {7000, "ZetaChain Mainnet", "ZETA"},
-    {7001, "ZetaChain Testnet", "ZETA"},
-    {7007, "BST Chain", "BSTC"},
-    {7027, "Ella the heart", "ELLA"},
-    {7070, "Planq Mainnet", "PLQ"},
-    {7077, "Planq Atlas Testnet", "tPLQ"},
-    {7100, "Nume", "DAI"},
-    {7117, "0XL3", "XL3"},
-    {7118, "Help The Homeless", "HTH"},
-    {7171, "Bitrock Mainnet", "BROCK"},
-    {7200, "exSat Mainnet", "BTC"},
-    {7210, "Nibiru Testnet-1", "NIBI"},
-    {7222, "Nibiru Devnet-3", "NIBI"},
-    {7244, "ZEUS Testnet", "ZEUSX"},
-    {7300, "XPLA Verse", "OAS"},
-    {7331, "KLYNTAR", "KLY"},
-    {7332, "Horizen EON Mainnet", "ZEN"},
-    {7341, "Shyft Mainnet", "SHYFT"},
-    {7484, "Raba Network Mainnet", "RABA"},
-    {7518, "MEVerse Chain Mainnet", "MEV"},
-    {7560, "Cyber Mainnet", "ETH"},
-    {7575, "ADIL Testnet", "ADIL"},
-    {7576, "Adil Chain V2 Mainnet", "ADIL"},
-    {7668, "The Root Network - Mainnet", "XRP"},
-    {7672, "The Root Network - Porcini Testnet", "XRP"},
-    {7700, "Canto", "CANTO"},
-    {7701, "Canto Tesnet", "CANTO"},
-    {7744, "Phron Testnet", "TPHR"},
-    {7771, "Bitrock Testnet", "BROCK"},
-    {7774, "GDCC MAINNET", "GDCC"},
-    {7775, "GDCC TESTNET", "GDCC"},
-    {7776, "PandaSea Mainnet", "PANDA"},
-    {7777, "Rise of the Warbots Testnet", "NMAC"},
-    {7778, "Orenium Mainnet Protocol", "ORE"},
-    {7798, "OpenEX LONG Testnet", "USDT"},
-    {7860, "MaalChain Testnet", "MAAL"},
-    {7862, "MaalChain V2", "MAAL"},
-    {7863, "MaalChain Testnet V2", "MAAL"},
-    {7878, "Hazlor Testnet", "TSCAS"},
-    {7879, "Vexon Testnet", "tVEX"},
-    {7887, "Kinto Mainnet", "ETH"},
-    {7895, "ARDENIUM Athena", "tARD"},
-    {7897, "arena-z", "ETH"},
-    {7923, "Dot Blox", "DTBX"},
-    {7924, "MO Mainnet", "MO"},
-    {7979, "DOS Chain", "DOS"},
-    {8000, "Teleport", "TELE"},
-    {8001, "Teleport Testnet", "TELE"},
-    {8008, "Polynomial", "ETH"},
-    {8017, "iSunCoin Mainnet", "ISC"},
-    {8029, "MDGL Testnet", "MDGLT"},
-    {8047, "BOAT Mainnet", "BOAT"},
-    {8054, "Karak Sepolia", "ETH"},
-    {8080, "Shardeum Liberty 1.X", "SHM"},
-    {8081, "Shardeum Liberty 2.X", "SHM"},
-    {8082, "Shardeum Sphinx 1.X", "SHM"},
-    {8086, "Bitcoin Chain", "BTC"},
-    {8087, "E-Dollar", "USD"},
-    {8098, "StreamuX Blockchain", "SmuX"},
-    {8108, "Zenchain", "ZCX"},
-    {8131, "Qitmeer Network Testnet", "MEER-T"},
-    {8132, "Qitmeer Network Mixnet", "MEER-M"},
-    {8133, "Qitmeer Network Privnet", "MEER-P"},
-    {8134, "Amana", "MEER"},
-    {8135, "Flana", "MEER"},
-    {8136, "Mizana", "MEER"},
-    {8181, "Testnet BeOne Chain", "tBOC"},
-    {8192, "Torus Mainnet", "TQF"},
-    {8194, "Torus Testnet", "TTQF"},
-    {8217, "Kaia Mainnet", "KAIA"},
-    {8227, "Space Subnet", "FUEL"},
-    {8272, "Blockton Blockchain", "BTON"},
-    {8285, "KorthoTest", "KTO"},
-    {8329, "Lorenzo", "stBTC"},
-    {8333, "B3", "ETH"},
-    {8387, "Dracones Financial Services", "FUCK"},
-    {8408, "Zenchain Testnet", "ZCX"},
-    {8428, "THAT Mainnet", "THAT"},
-    {8453, "Base", "ETH"},
-    {8545, "Chakra Testnet", "CKR"},
-    {8654, "Toki Network", "TOKI"},
-    {8655, "Toki Testnet", "TOKI"},
-    {8668, "Hela Official Runtime Mainnet", "HLUSD"},
-    {8723, "TOOL Global Mainnet", "OLO"},
-    {8724, "TOOL Global Testnet", "OLO"},
-    {8726, "Storagechain Mainnet", "STOR"},
-    {8727, "Storagechain Testnet", "STOR"},
-    {8732, "Bullions Smart Chain", "BLN"},
-    {8738, "Alph Network", "ALPH"},
-    {8768, "TMY Chain", "TMY"},
-    {8822, "IOTA EVM", "IOTA"},
-    {8844, "Hydra Chain Testnet", "tHYDRA"},
-    {8848, "MARO Blockchain Mainnet", "MARO"},
-    {8866, "SuperLumio", "ETH"},
-    {8869, "Lif3 Chain", "LIF3"},
-    {8880, "Unique", "UNQ"},
-    {8881, "Quartz by Unique", "QTZ"},
-    {8882, "Opal testnet by Unique", "UNQ"},
-    {8883, "Sapphire by Unique", "QTZ"},
-    {8886, "Avenium Testnet", "tAVE"},
-    {8888, "XANAChain", "XETA"},
-    {8889, "Vyvo Smart Chain", "VSC"},
-    {8890, "Orenium Testnet Protocol", "tORE"},
-    {8898, "Mammoth Mainnet", "MMT"},
-    {8899, "JIBCHAIN L1", "JBC"},
-    {8911, "Algen", "ALG"},
-    {8912, "Algen Testnet", "ALG"},
-    {8921, "Algen Layer2", "ALG"},
-    {8922, "Algen Layer2 Testnet", "ALG"},
-    {8989, "Giant Mammoth Mainnet", "GMMT"},
-    {8995, "bloxberg", "U+25B3"},
-    {9000, "Evmos Testnet", "tEVMOS"},
-    {9001, "Evmos", "EVMOS"},
-    {9007, "Shido Testnet Block", "SHIDO"},
-    {9008, "Shido Mainnet Block", "SHIDO"},
-    {9012, "BerylBit Mainnet", "BRB"},
-    {9024, "Nexa Testnet Block", "NEXB"},
-    {9025, "Nexa Mainnet Block", "NEXB"},
-    {9069, "Apex Fusion - Nexus Mainnet", "AP3X"},
-    {9070, "Apex Fusion - Nexus testnet", "tAP3X"},
-    {9091, "KPA Smart Chain Testnet", "tKPA"},
-    {9100, "Genesis Coin", "GNC"},
-    {9170, "Rinia Testnet Old", "FIRE"},
-    {9223, "Codefin Mainnet", "COF"},
-    {9302, "Galactica-Reticulum", "GNET"},
-    {9339, "Dogcoin Testnet", "DOGS"},
-    {9372, "Oasys Testnet", "OAS"},
-    {9393, "Dela Sepolia Testnet", "ETH"},
-    {9395, "Evoke Mainnet", "MTHN"},
-    {9496, "WeaveVM Testnet", "tWVM"},
-    {9527, "Rangers Protocol Testnet Robin", "tRPG"},
-    {9528, "QEasyWeb3 Testnet", "QET"},
-    {9559, "Neonlink Testnet", "tNEON"},
-    {9700, "Oort MainnetDev", "OORT"},
-    {9728, "Boba BNB Testnet", "BOBA"},
-    {9768, "MainnetZ Testnet", "NetZ"},
-    {9779, "PepeNetwork Mainnet", "WPEPE"},
-    {9788, "Tabi Testnetv2", "TABI"},
-    {9789, "Tabi Testnet", "TABI"},
-    {9790, "Carbon EVM", "SWTH"},
-    {9792, "Carbon EVM Testnet", "SWTH"},
-    {9797, "OptimusZ7 Mainnet", "OZ7"},
-    {9818, "IMPERIUM TESTNET", "tIMP"},
-    {9819, "IMPERIUM MAINNET", "IMP"},
-    {9876, "BinaryChain Testnet", "BNRY"},
-    {9888, "Dogelayer Mainnet", "DOGE"},
-    {9897, "arena-z-testnet", "ETH"},
-    {9898, "Larissa Chain", "LRS"},
-    {9901, "Zytron Linea Mainnet", "ETH"},
-    {9911, "Espento Mainnet", "SPENT"},
-    {9966, "UXER TESTNET NETWORK", "tUXER"},
-    {9977, "Mind Smart Chain Testnet", "tMIND"},
-    {9980, "Combo Mainnet", "BNB"},
-    {9981, "Volley Mainnet", "V2X"},
-    {9982, "MFEV CHAIN MAINNET", "MFEV"},
-    {9990, "Agung Network", "AGNG"},
-    {9996, "Mind Smart Chain Mainnet", "MIND"},
-    {9997, "AltLayer Testnet", "ETH"},
-    {9998, "Ztc Mainnet", "ZTC"},
-    {9999, "myOwn Testnet", "MYN"},
-    {10000, "Smart Bitcoin Cash", "BCH"},
-    {10001, "Smart Bitcoin Cash Testnet", "BCHT"},
-    {10010, "Warden Testnet", "WARD"},
-    {10024, "Gon Chain", "GT"},
-    {10025, "AEON Chain", "AEON"},
-    {10081, "Japan Open Chain Testnet", "JOCT"},
-    {10086, "SJATSH", "ETH"},
-    {10096, "MetaNova Verse", "MNV"},
-    {10101, "Blockchain Genesis Mainnet", "GEN"},
-    {10143, "Monad Testnet", "MON"},
-    {10200, "Gnosis Chiado Testnet", "XDAI"},
-    {10201, "MaxxChain Mainnet", "PWR"},
-    {10222, "GLScan", "GLC"},
-    {10242, "Arthera Mainnet", "AA"},
-    {10243, "Arthera Testnet", "AA"},
-    {10248, "0XTade", "0XT"},
-    {10321, "TAO EVM Mainnet", "TAO"},
-    {10324, "TAO EVM Testnet", "TAO"},
-    {10395, "WorldLand Testnet", "WLC"},
-    {10507, "Numbers Mainnet", "NUM"},
-    {10508, "Numbers Testnet", "NUM"},
-    {10823, "CryptoCoinPay", "CCP"},
-    {10849, "Lamina1", "L1"},
-    {10850, "Lamina1 Identity", "L1ID"},
-    {10888, "GameSwift Chain Testnet", "tGS"},
-    {10946, "Quadrans Blockchain", "QDC"},
-    {10947, "Quadrans Blockchain Testnet", "tQDC"},
-    {11000, "KB Chain", "KBC"},
-    {11011, "Shape Sepolia Testnet", "ETH"},
-    {11100, "Bool Network Beta Mainnet", "BOL"},
-    {11110, "Astra", "ASA"},
-    {11111, "WAGMI", "WGM"},
-    {11115, "Astra Testnet", "tASA"},
-    {11119, "HashBit Mainnet", "HBIT"},
-    {11124, "Abstract Testnet", "ETH"},
-    {11221, "Shine Chain", "SC20"},
-    {11227, "Jiritsu Testnet Subnet", "TZW"},
-    {11235, "Haqq Network", "ISLM"},
-    {11437, "Shyft Testnet", "SHYFTT"},
-    {11501, "BEVM Mainnet", "BTC"},
-    {11503, "BEVM Testnet", "BTC"},
-    {11521, "SatsChain", "SATS"},
-    {11612, "Sardis Testnet", "SRDX"},
-    {11822, "Artela Testnet", "ART"},
-    {11888, "Santiment Intelligence Network DEPRECATED", "SANold"},
-    {11891, "Polygon Supernet Arianee", "ARIA20"},
-    {12001, "Fuse Testnet", "ETH"},
-    {12009, "SatoshiChain Mainnet", "SATS"},
-    {12020, "Aternos", "ATR"},
-    {12051, "Singularity ZERO Testnet", "tZERO"},
-    {12052, "Singularity ZERO Mainnet", "ZERO"},
-    {12123, "BRC Chain Mainnet", "BRC"},
-    {12306, "Fibonacci Mainnet", "FIBO"},
-    {12321, "BLG Testnet", "BLG"},
-    {12324, "L3X Protocol", "ETH"},
-    {12325, "L3X Protocol Testnet", "ETH"},
-    {12345, "Step Testnet", "FITFI"},
-    {12358, "GDPR Mainnet", "GDPR"},
-    {12553, "RSS3 VSL Mainnet", "RSS3"},
-    {12715, "Rikeza Network Testnet", "RIK"},
-    {12781, "Playdapp Testnet", "PDA"},
-    {12890, "Quantum Chain Testnet", "tQNET"},
-    {12898, "PlayFair Testnet Subnet", "BTLT"},
-    {13000, "SPS", "ECG"},
-    {13308, "Credit Smart Chain", "CREDIT"},
-    {13337, "Beam Testnet", "BEAM"},
-    {13370, "Cannon Testnet", "ETH"},
-    {13371, "Immutable zkEVM", "IMX"},
-    {13381, "Phoenix Mainnet", "PHX"},
-    {13396, "Masa", "MASA"},
-    {13473, "Immutable zkEVM Testnet", "tIMX"},
-    {13505, "Gravity Alpha Testnet Sepolia", "G"},
-    {13600, "Kronobit Mainnet", "KNB"},
-    {13746, "Game7 Testnet", "TG7T"},
-    {13812, "Susono", "OPN"},
-    {14000, "SPS Testnet", "ECG"},
-    {14088, "Zeroth Testnet", "ZRHt"},
-    {14149, "Bitharvest Chian Mainnet", "BTH"},
-    {14324, "EVOLVE Testnet", "EVO"},
-    {14333, "Vitruveo Testnet", "tVTRU"},
-    {14800, "Vana Moksha Testnet", "VANA"},
-    {14801, "Vana Satori Testnet", "DAT"},
-    {14853, "Humanode Testnet 5 Israfel", "eHMND"},
-    {15003, "Immutable zkEVM Devnet", "dIMX"},
-    {15257, "Poodl Testnet", "POODL"},
-    {15259, "Poodl Mainnet", "POODL"},
-    {15430, "KYMTC Mainnet", "KYMTC"},
-    {15551, "LoopNetwork Mainnet", "LOOP"},
-    {15555, "Trust EVM Testnet", "EVM"},
-    {15557, "EOS EVM Network Testnet", "EOS"},
-    {16000, "MetaDot Mainnet", "MTT"},
-    {16001, "MetaDot Testnet", "MTTest"},
-    {16116, "DeFiVerse Mainnet", "OAS"},
-    {16166, "Cypherium Mainnet", "CPH"},
-    {16180, "PLYR PHI", "PLYR"},
-    {16182, "Eventum Testnet", "ETH"},
-    {16350, "Incentiv Devnet", "INC"},
-    {16481, "Pivotal Sepolia", "ETH"},
-    {16507, "Genesys Mainnet", "GSYS"},
-    {16600, "0G-Newton-Testnet", "A0GI"},
-    {16688, "IRIShub Testnet", "ERIS"},
-    {16718, "AirDAO Mainnet", "AMB"},
-    {16888, "IVAR Chain Testnet", "tIVAR"},
-    {17000, "Holesky", "ETH"},
-    {17001, "Redstone Holesky Testnet", "ETH"},
-    {17069, "Garnet Holesky", "ETH"},
-    {17071, "Onchain Points", "POP"},
-    {17117, "DeFiVerse Testnet", "OAS"},
-    {17171, "G8Chain Mainnet", "G8C"},
-    {17172, "Eclipse Subnet", "ECLP"},
-    {17180, "Palette Chain Testnet", "PLT"},
-    {17217, "KONET Mainnet", "KONET"},
-    {17777, "EOS EVM Network", "EOS"},
-    {18000, "Frontier of Dreams Testnet", "ZKST"},
-    {18122, "Smart Trade Networks", "STN"},
-    {18159, "Proof Of Memes", "POM"},
-    {18181, "G8Chain Testnet", "G8C"},
-    {18231, "unreal-old", "ETH"},
-    {18233, "unreal", "reETH"},
-    {18686, "MXC zkEVM Moonchain", "MXC"},
-    {18888, "Titan (TKX)", "TKX"},
-    {18889, "Titan (TKX) Testnet", "TKX"},
-    {19011, "HOME Verse Mainnet", "OAS"},
-    {19077, "BlockX Atlantis Testnet", "BCX"},
-    {19180, "LocaChain Mainnet", "LCC"},
-    {19191, "BlockX Mainnet", "BCX"},
-    {19224, "Decentraconnect Social", "DCSM"},
-    {19515, "SEC Testnet", "SEP"},
-    {19516, "SEC Mainnet", "SEP"},
-    {19527, "Magnet Network", "DOT"},
-    {19546, "Zytron Linea Testnet", "ETH"},
-    {19600, "LBRY Mainnet", "LBC"},
-    {19777, "Astra Sepolia", "ATX"},
-    {19845, "BTCIX Network", "BTCIX"},
-    {20001, "Camelark Mainnet", "ETHW"},
-    {20041, "Niza Chain Mainnet", "NIZA"},
-    {20073, "Niza Chain Testnet", "NIZA"},
-    {20143, "Monad Devnet", "MON"},
-    {20729, "Callisto Testnet", "CLO"},
-    {20736, "P12 Chain", "hP2"},
-    {20765, "Jono11 Subnet", "JONO"},
-    {21004, "C4EI", "C4EI"},
-    {21097, "Rivest Testnet", "tINCO"},
-    {21133, "All About Healthy", "AAH"},
-    {21210, "1Money Network Mainnet", "USD1"},
-    {21223, "DCpay Mainnet", "DCP"},
-    {21224, "DCpay Testnet", "DCP"},
-    {21337, "CENNZnet Azalea", "CPAY"},
-    {21363, "Lestnet", "LETH"},
-    {21816, "omChain Mainnet", "OMC"},
-    {21912, "BSL Mainnet", "ONF"},
-    {22023, "Taycan", "SFL"},
-    {22040, "AirDAO Testnet", "AMB"},
-    {22222, "Nautilus Mainnet", "ZBC"},
-    {22324, "GoldXChain Testnet", "GOLDX"},
-    {22776, "MAP Protocol", "MAPO"},
-    {23006, "Antofy Testnet", "ABN"},
-    {23118, "Opside Testnet", "IDE"},
-    {23294, "Oasis Sapphire", "ROSE"},
-    {23295, "Oasis Sapphire Testnet", "TEST"},
-    {23451, "DreyerX Mainnet", "DRX"},
-    {23452, "DreyerX Testnet", "DRX"},
-    {23888, "Blast Testnet", "ETH"},
-    {24076, "KYMTC Testnet", "KYMTC"},
-    {24116, "Amauti", "STEAMX"},
-    {24484, "Webchain", "WEB"},
-    {24734, "MintMe.com Coin", "MINTME"},
-    {25186, "LiquidLayer Mainnet", "LILA"},
-    {25327, "Everclear Mainnet", "ETH"},
-    {25839, "AlveyChain Testnet", "tALV"},
-    {25888, "Hammer Chain Mainnet", "GOLDT"},
-    {25925, "Bitkub Chain Testnet", "tKUB"},
-    {26026, "Ferrum Testnet", "tFRM"},
-    {26482, "DucatusX Testnet", "DUCX"},
-    {26483, "DucatusX", "DUCX"},
-    {26600, "Hertz Network Mainnet", "HTZ"},
-    {26863, "OasisChain Mainnet", "OAC"},
-    {27181, "KLAOS Nova", "KLAOS"},
-    {27483, "Nanon Sepolia", "ETH"},
-    {27827, "zeroone Mainnet Subnet", "ZERO"},
-    {28516, "Vizing Testnet", "ETH"},
-    {28518, "Vizing Mainnet", "ETH"},
-    {28528, "Optimism Bedrock (Goerli Alpha Testnet)", "ETH"},
-    {28882, "Boba Sepolia", "ETH"},
-    {29112, "HYCHAIN Testnet", "TOPIA"},
-    {29223, "Nexa MetaNet", "NEXA"},
-    {29225, "Nexa MetaTest", "NEXA"},
-    {29536, "KaiChain Testnet", "KEC"},
-    {29548, "MCH Verse Mainnet", "OAS"},
-    {30000, "qChain Mainnet", "QCO"},
-    {30067, "Piece testnet", "ECE"},
-    {30088, "MiYou Mainnet", "MY"},
-    {30103, "Cerium Testnet", "CAU"},
-    {30730, "Movement EVM Legacy", "MOVE"},
-    {30731, "Movement EVM Devnet", "MOVE"},
-    {30732, "Movement EVM Testnet", "MOVE"},
-    {31102, "Ethersocial Network", "ESN"},
-    {31223, "CloudTx Mainnet", "CLD"},
-    {31224, "CloudTx Testnet", "CLD"},
-    {31337, "GoChain Testnet", "GO"},
-    {31414, "Evoke Testnet", "MTHN"},
-    {31415, "Wirex Pay Mainnet", "ETH"},
-    {31611, "Mezo Matsnet Testnet", "BTC"},
-    {31753, "Xchain Mainnet", "INTD"},
-    {31754, "Xchain Testnet", "INTD"},
-    {32001, "W3Gamez Holesky Testnet", "ETH"},
-    {32382, "Santiment Intelligence Network", "SANR"},
-    {32520, "Bitgert Mainnet", "Brise"},
-    {32659, "Fusion Mainnet", "FSN"},
-    {32769, "Zilliqa EVM", "ZIL"},
-    {32770, "Zilliqa 2 EVM proto-mainnet", "ZIL"},
-    {32990, "Zilliqa EVM Isolated Server", "ZIL"},
-    {33033, "Entangle Mainnet", "NGL"},
-    {33101, "Zilliqa EVM Testnet", "ZIL"},
-    {33103, "Zilliqa 2 EVM proto-testnet", "ZIL"},
-    {33111, "Curtis", "APE"},
-    {33133, "Entangle Testnet", "NGL"},
-    {33139, "ApeChain", "APE"},
-    {33210, "Cloudverse Subnet", "XCLOUD"},
-    {33333, "Aves Mainnet", "AVS"},
-    {33385, "Zilliqa EVM Devnet", "ZIL"},
-    {33401, "SlingShot", "SLING"},
-    {33469, "Zilliqa 2 EVM devnet", "ZIL"},
-    {33979, "Funki", "ETH"},
-    {34443, "Mode", "ETH"},
-    {34504, "ZEUS Mainnet", "ZEUSX"},
-    {35011, "J2O Taro", "taro"},
-    {35441, "Q Mainnet", "QGOV"},
-    {35443, "Q Testnet", "Q"},
-    {37111, "Lens Testnet", "GRASS"},
-    {38400, "ConnectorManager", "cmRPG"},
-    {38401, "ConnectorManager Robin", "ttRPG"},
-    {39656, "PRM Mainnet", "PRM"},
-    {39797, "Energi Mainnet", "NRG"},
-    {39815, "OHO Mainnet", "OHO"},
-    {40000, "DIV Chain", "DIVC"},
-    {41455, "Aleph Zero EVM", "AZERO"},
-    {41500, "Opulent-X BETA", "OXYN"},
-    {41923, "EDU Chain", "EDU"},
-    {42069, "pegglecoin", "peggle"},
-    {42072, "AgentLayer Testnet", "AGENT"},
-    {42161, "Arbitrum One", "ETH"},
-    {42170, "Arbitrum Nova", "ETH"},
-    {42220, "Celo Mainnet", "CELO"},
-    {42261, "Oasis Emerald Testnet", "TEST"},
-    {42262, "Oasis Emerald", "ROSE"},
-    {42355, "GoldXChain Mainnet", "GOLDX"},
-    {42420, "Asset Chain Mainnet", "RWA"},
-    {42421, "Asset Chain Testnet", "RWA"},
-    {42766, "ZKFair Mainnet", "USDC"},
-    {42793, "Etherlink Mainnet", "XTZ"},
-    {42801, "Gesoten Verse Testnet", "OAS"},
-    {42888, "Kinto Testnet", "ETH"},
-    {43110, "Athereum", "ATH"},
-    {43111, "Hemi Network", "ETH"},
-    {43113, "Avalanche Fuji Testnet", "AVAX"},
-    {43114, "Avalanche C-Chain", "AVAX"},
-    {43288, "Boba Avax", "BOBA"},
-    {43851, "ZKFair Testnet", "USDC"},
-    {44444, "Frenchain", "FREN"},
-    {44445, "Quantum Network", "QTM"},
-    {44787, "Celo Alfajores Testnet", "CELO"},
-    {45000, "Autobahn Network", "TXL"},
-    {45454, "Swamps L2", "SWP"},
-    {45510, "Deelance Mainnet", "DEE"},
-    {45513, "Blessnet", "BLESS"},
-    {46688, "Fusion Testnet", "T-FSN"},
-    {47763, "Neo X Mainnet", "GAS"},
-    {47803, "ReDeFi Layer 1", "BAX"},
-    {47805, "REI Network", "REI"},
-    {48795, "Space Subnet Testnet", "FUEL"},
-    {48899, "Zircuit Testnet", "ETH"},
-    {48900, "Zircuit Mainnet", "ETH"},
-    {49049, "Wireshape Floripa Testnet", "WIRE"},
-    {49088, "Bifrost Testnet", "BFC"},
-    {49321, "GUNZ Testnet", "GUN"},
-    {49797, "Energi Testnet", "NRG"},
-    {50001, "Liveplex OracleEVM", "ETH"},
-    {50005, "Yooldo Verse Mainnet", "OAS"},
-    {50006, "Yooldo Verse Testnet", "OAS"},
-    {50021, "GTON Testnet", "GCD"},
-    {50104, "Sophon", "SOPH"},
-    {50888, "Erbie Mainnet", "ERB"},
-    {51178, "Lumoz Testnet Alpha", "MOZ"},
-    {51712, "Sardis Mainnet", "SRDX"},
-    {52014, "Electroneum Mainnet", "ETN"},
-    {52225, "Cytonic Testnet", "CCC"},
-    {53277, "DOID", "DOID"},
-    {53302, "Superseed Sepolia Testnet", "ETH"},
-    {53457, "DODOchain testnet", "DODO"},
-    {53935, "DFK Chain", "JEWEL"},
-    {54176, "OverProtocol Mainnet", "OVER"},
-    {54211, "Haqq Chain Testnet", "ISLMT"},
-    {54321, "Toronet Testnet", "TOROE"},
-    {55004, "Titan", "ETH"},
-    {55007, "Titan Sepolia", "ETH"},
-    {55244, "Superposition", "ETH"},
-    {55551, "Photon Aurora Testnet", "PTON"},
-    {55555, "REI Chain Mainnet", "REI"},
-    {55556, "REI Chain Testnet", "tREI"},
-    {55614, "Flamma Mainnet", "FLA"},
-    {56026, "Lambda Chain Mainnet", "ETH"},
-    {56288, "Boba BNB Mainnet", "BOBA"},
-    {56400, "Testnet Zeroone Subnet", "ZERO"},
-    {56789, "VELO Labs Mainnet", "NOVA"},
-    {56797, "DOID Testnet", "DOID"},
-    {57000, "Rollux Testnet", "TSYS"},
-    {57073, "Ink", "ETH"},
-    {57451, "COINSEC Network", "SEC"},
-    {58008, "Sepolia PGN (Public Goods Network)", "ETH"},
-    {58680, "Lumoz Quidditch Testnet", "MOZ"},
-    {59140, "Linea Goerli", "ETH"},
-    {59141, "Linea Sepolia", "ETH"},
-    {59144, "Linea", "ETH"},
-    {59902, "Metis Sepolia Testnet", "tMETIS"},
-    {59971, "Genesys Code Mainnet", "GCODE"},
-    {60000, "Thinkium Testnet Chain 0", "TKM"},
-    {60001, "Thinkium Testnet Chain 1", "TKM"},
-    {60002, "Thinkium Testnet Chain 2", "TKM"},
-    {60103, "Thinkium Testnet Chain 103", "TKM"},
-    {60808, "BOB", "ETH"},
-    {61022, "Orange Chain Mainnet", "BTC"},
-    {61406, "KaiChain", "KEC"},
-    {61800, "AxelChain Dev-Net", "AIUM"},
-    {61803, "Etica Mainnet", "EGAZ"},
-    {61916, "DoKEN Super Chain Mainnet", "DKN"},
-    {62049, "OPTOPIA Testnet", "ETH"},
-    {62050, "Optopia Mainnet", "ETH"},
-    {62092, "TikTrix Testnet", "tTTX"},
-    {62298, "Citrea Devnet", "cBTC"},
-    {62320, "Celo Baklava Testnet", "CELO"},
-    {62621, "MultiVAC Mainnet", "MTV"},
-    {62831, "PLYR TAU Testnet", "PLYR"},
-    {62850, "LAOS Sigma Testnet", "SIGMA"},
-    {63000, "eSync Network Mainnet", "ECS"},
-    {63001, "eCredits Testnet", "ECS"},
-    {63002, "eSync Network Testnet", "ECS"},
-    {63157, "Geist Mainnet", "GHST"},
-    {65349, "CratD2C Testnet", "CRAT"},
-    {65357, "Vecno Mainnet", "VE"},
-    {65450, "Scolcoin Mainnet", "SCOL"},
-    {65536, "Automata Mainnet", "ATA"},
-    {66665, "Creator Chain Testnet", "CETH"},
-    {66988, "Janus Testnet", "JNS"},
-    {67390, "SiriusNet", "MCD"},
-    {67588, "Cosmic Chain", "COSMIC"},
-    {68770, "DM2 Verse Mainnet", "OAS"},
-    {68775, "DM2 Verse Testnet", "OAS"},
-    {69420, "Condrieu", "CTE"},
-    {70000, "Thinkium Mainnet Chain 0", "TKM"},
-    {70001, "Thinkium Mainnet Chain 1", "TKM"},
-    {70002, "Thinkium Mainnet Chain 2", "TKM"},
-    {70103, "Thinkium Mainnet Chain 103", "TKM"},
-    {70700, "Proof of Play - Apex", "ETH"},
-    {70701, "Proof of Play - Boss", "ETH"},
-    {71111, "GuapcoinX", "GuapX"},
-    {71117, "Wadzchain Testnet", "WTK"},
-    {71393, "Polyjuice Testnet", "CKB"},
-    {71401, "Godwoken Testnet v1", "pCKB"},
-    {71402, "Godwoken Mainnet", "pCKB"},
-    {72778, "CAGA crypto Ankara testnet", "CAGA"},
-    {72992, "Grok Chain Mainnet", "GROC"},
-    {73114, "ICB Testnet", "ICBT"},
-    {73115, "ICB Network", "ICBX"},
-    {73799, "Energy Web Volta Testnet", "VT"},
-    {73927, "Mixin Virtual Machine", "ETH"},
-    {75000, "ResinCoin Mainnet", "RESIN"},
-    {75512, "GEEK Verse Mainnet", "OAS"},
-    {75513, "GEEK Verse Testnet", "OAS"},
-    {77001, "BORAchain mainnet", "BORA"},
-    {77238, "Foundry Chain Testnet", "tFNC"},
-    {77612, "Vention Smart Chain Mainnet", "VNT"},
-    {77677, "Cycle Network Mainnet Sailboat", "ETH"},
-    {77777, "Toronet Mainnet", "TOROE"},
-    {78110, "Firenze test network", "FIN"},
-    {78281, "Dragonfly Mainnet (Hexapod)", "DFLY"},
-    {78430, "Amplify Subnet", "AMP"},
-    {78431, "Bulletin Subnet", "BLT"},
-    {78432, "Conduit Subnet", "CON"},
-    {78600, "Vanguard", "VANRY"},
-    {79879, "Gold Smart Chain Testnet", "STAND"},
-    {80001, "Mumbai", "MATIC"},
-    {80002, "Amoy", "POL"},
-    {80008, "Polynomia Sepolia", "ETH"},
-    {80084, "Berachain bArtio", "BERA"},
-    {80085, "Berachain Artio", "BERA"},
-    {80096, "Hizoco mainnet", "HZC"},
-    {81041, "Nordek Mainnet", "NRK"},
-    {81341, "Amana Testnet", "MEER-T"},
-    {81342, "Amana Mixnet", "MEER-M"},
-    {81343, "Amana Privnet", "MEER-P"},
-    {81351, "Flana Testnet", "MEER-T"},
-    {81352, "Flana Mixnet", "MEER-M"},
-    {81353, "Flana Privnet", "MEER-P"},
-    {81361, "Mizana Testnet", "MEER-T"},
-    {81362, "Mizana Mixnet", "MEER-M"},
-    {81363, "Mizana Privnet", "MEER-P"},
-    {81457, "Blast", "ETH"},
-    {81720, "Quantum Chain Mainnet", "QNET"},
-    {82459, "Smart Layer Network Testnet", "SU"},
-    {83144, "Xprotocol Testnet", "KICK"},
-    {83278, "Esa", "Esa"},
-    {83872, "ZEDXION", "ZEDX"},
-    {84531, "Base Goerli Testnet", "ETH"},
-    {84532, "Base Sepolia Testnet", "ETH"},
-    {84886, "Aerie Network", "AER"},
-    {85321, "GDPR Testnet", "GDPR"},
-    {85449, "CYBERTRUST", "CYBER"},
-    {88002, "Nautilus Proteus Testnet", "tZBC"},
-    {88559, "InoAi", "INO"},
-    {88800, "ZKasino Mainnet", "ZKAS"},
-    {88811, "Unit Zero Mainnet", "UNIT0"},
-    {88817, "Unit Zero Testnet", "UNIT0"},
-    {88819, "Unit Zero Stagenet", "UNIT0"},
-    {88866, "Matr1x Testnet", "MAX"},
-    {88880, "Chiliz Scoville Testnet", "CHZ"},
-    {88882, "Chiliz Spicy Testnet", "CHZ"},
-    {88888, "Chiliz Chain Mainnet", "CHZ"},
-    {88899, "Unite", "UNITE"},
-    {90001, "F(x)Core Testnet Network", "FX"},
-    {90002, "UBIT SMARTCHAIN MAINNET", "USC"},
-    {90210, "Beverly Hills", "BVE"},
-    {90354, "Camp Testnet", "ETH"},
-    {91002, "Nautilus Trition Chain", "tZBC"},
-    {91120, "MetaDAP Enterprise Mainnet", "DAP"},
-    {91715, "Combo Testnet", "tcBNB"},
-    {92001, "Lambda Testnet", "LAMB"},
-    {93572, "LiquidLayer Testnet", "LILA"},
-    {93747, "StratoVM Testnet", "SVM"},
-    {95432, "SRICHAIN", "SRIX"},
-    {96970, "Mantis Testnet (Hexapod)", "MANTIS"},
-    {97053, "Tetron Testnet Smart Chain", "TSC"},
-    {97055, "Tetron Smart Chain", "TSC"},
-    {97288, "Boba BNB Mainnet Old", "BOBA"},
-    {97435, "SlingShot Testnet", "SLINGT"},
-    {97531, "Green Chain Testnet", "GREEN"},
-    {97766, "MetaBenz CHAIN", "MBC"},
-    {97970, "OptimusZ7 Testnet", "OZ7"},
-    {98864, "Plume Devnet", "ETH"},
-    {98865, "Plume Mainnet", "ETH"},
-    {98881, "Ebi Chain", "ETH"},
-    {98985, "Superposition Testnet", "SPN"},
-    {99099, "eLiberty Testnet", "$EL"},
-    {99876, "Edge Matrix Chain Testnet", "EMC"},
-    {99998, "UB Smart Chain(testnet)", "UBC"},
-    {99999, "UB Smart Chain", "UBC"},
-    {100000, "QuarkChain Mainnet Root", "QKC"},
-    {100001, "QuarkChain Mainnet Shard 0", "QKC"},
-    {100002, "QuarkChain Mainnet Shard 1", "QKC"},
-    {100003, "QuarkChain Mainnet Shard 2", "QKC"},
-    {100004, "QuarkChain Mainnet Shard 3", "QKC"},
-    {100005, "QuarkChain Mainnet Shard 4", "QKC"},
-    {100006, "QuarkChain Mainnet Shard 5", "QKC"},
-    {100007, "QuarkChain Mainnet Shard 6", "QKC"},
-    {100008, "QuarkChain Mainnet Shard 7", "QKC"},
-    {100009, "VeChain", "VET"},
-    {100010, "VeChain Testnet", "VET"},
-    {100011, "QuarkChain L2 Mainnet", "QKC"},
-    {100100, "Deprecated CHI", "xDAI"},
-    {101010, "Global Trust Network", "FREE"},
-    {102030, "Creditcoin", "CTC"},
-    {102031, "Creditcoin Testnet", "tCTC"},
-    {102032, "Creditcoin Devnet", "devCTC"},
-    {103090, "Crystaleum", "◈"},
-    {103454, "Masa Testnet", "MASA"},
-    {104566, "KaspaClassic Mainnet", "CAS"},
-    {105105, "Stratis Mainnet", "STRAX"},
-    {108801, "BROChain Mainnet", "BRO"},
-    {110000, "QuarkChain Devnet Root", "QKC"},
-    {110001, "QuarkChain Devnet Shard 0", "QKC"},
-    {110002, "QuarkChain Devnet Shard 1", "QKC"},
-    {110003, "QuarkChain Devnet Shard 2", "QKC"},
-    {110004, "QuarkChain Devnet Shard 3", "QKC"},
-    {110005, "QuarkChain Devnet Shard 4", "QKC"},
-    {110006, "QuarkChain Devnet Shard 5", "QKC"},
-    {110007, "QuarkChain Devnet Shard 6", "QKC"},
-    {110008, "QuarkChain Devnet Shard 7", "QKC"},
-    {110011, "QuarkChain L2 Testnet", "QKC"},
-    {110110, "Mars Credit", "MARS"},
-    {111000, "Siberium Test Network", "SIBR"},
-    {111111, "Siberium Network", "SIBR"},
-    {111188, "re.al", "reETH"},
-    {112358, "Metachain One Mainnet", "METAO"},
-    {119139, "MetaDAP Enterprise Testnet", "DAP"},
-    {123321, "Gemchain", "GEM"},
-    {123456, "ADIL Devnet", "ADIL"},
-    {128123, "Etherlink Testnet", "XTZ"},
-    {131313, "Odyssey Chain (Testnet)", "DIONE"},
-    {131419, "ETND Chain Mainnets", "ETND"},
-    {132902, "Form Testnet", "ETH"},
-    {141319, "MagApe Testnet", "MAG"},
-    {141491, "Bitharvest Chian Testnet", "bth"},
-    {142857, "ICPlaza Mainnet", "ict"},
-    {153153, "Odyssey Chain Mainnet", "DIONE"},
-    {158245, "CryptoX", "XCOIN"},
-    {158345, "XCOIN", "XCOIN"},
-    {161212, "PlayFi Mainnet", "PLAY"},
-    {165279, "Eclat Mainnet", "ECLAT"},
-    {167000, "Taiko Mainnet", "ETH"},
-    {167004, "Taiko (Alpha-2 Testnet)", "ETH"},
-    {167005, "Taiko Grimsvotn L2", "ETH"},
-    {167006, "Taiko Eldfell L3", "ETH"},
-    {167007, "Taiko Jolnir L2", "ETH"},
-    {167008, "Taiko Katla L2", "ETH"},
-    {167009, "Taiko Hekla L2", "ETH"},
-    {168168, "Zchains", "ZCD"},
-    {171000, "Fair Testnet", "FAIR"},
-    {175177, "Chronicle - Lit Protocol Testnet", "tstLIT"},
-    {175188, "Chronicle Yellowstone - Lit Protocol Testnet", "tstLPX"},
-    {188710, "Bitica Chain Mainnet", "BDCC"},
-    {188881, "Condor Test Network", "CONDOR"},
-    {192940, "Mind Network Testnet", "ETH"},
-    {193939, "R0AR Chain", "ETH"},
-    {199991, "MAZZE Testnet", "MAZZE"},
-    {200000, "xFair.AI Testnet", "FAI"},
-    {200101, "Milkomeda C1 Testnet", "mTAda"},
-    {200202, "Milkomeda A1 Testnet", "mTAlgo"},
-    {200625, "Akroma", "AKA"},
-    {200810, "Bitlayer Testnet", "BTC"},
-    {200901, "Bitlayer Mainnet", "BTC"},
-    {201018, "Alaya Mainnet", "atp"},
-    {201030, "Alaya Dev Testnet", "atp"},
-    {201804, "Mythical Chain", "MYTH"},
-    {202020, "Decimal Smart Chain Testnet", "tDEL"},
-    {202105, "DuckChain Testnet", "TON"},
-    {202202, "Bethel Sydney", "BECX"},
-    {202212, "X1 Devnet", "XN"},
-    {202401, "YMTECH-BESU Testnet", "ETH"},
-    {202424, "Blockfit", "BFIT"},
-    {202624, "Jellie", "TWL"},
-    {204005, "X1 Network", "XN"},
-    {205205, "Auroria Testnet", "tSTRAX"},
-    {210049, "GitAGI Atlas Testnet", "tGAGI"},
-    {210209, "Sorian", "SOR"},
-    {210210, "Sorian Testnet", "tSOR"},
-    {210425, "PlatON Mainnet", "lat"},
-    {212013, "Litentry", "LIT"},
-    {220315, "Mas Mainnet", "MAS"},
-    {221230, "Reapchain Mainnet", "REAP"},
-    {221231, "Reapchain Testnet", "tREAP"},
-    {222222, "HydraDX", "WETH"},
-    {222555, "DeepL Mainnet", "DEEPL"},
-    {222666, "DeepL Testnet", "DEEPL"},
-    {224168, "Taf ECO Chain Mainnet", "TAFECO"},
-    {224422, "CONET Sebolia Testnet", "CONET"},
-    {224433, "CONET Holesky", "CONET"},
-    {229772, "Abyss Protocol", "aETH"},
-    {230315, "HashKey Chain Testnet(discard)", "tHSK"},
-    {234666, "Haymo Testnet", "HYM"},
-    {240515, "Orange Chain Testnet", "BTC"},
-    {241120, "Anomaly Andromeda Testnet", "tNOM"},
-    {246529, "ARTIS sigma1", "ATS"},
-    {246785, "ARTIS Testnet tau1", "tATS"},
-    {247253, "Saakuru Testnet", "OAS"},
-    {256256, "CMP-Mainnet", "CMP"},
-    {262371, "Eclat Testnet", "ECLAT"},
-    {266256, "Gear Zero Network Testnet", "GZN"},
-    {271271, "EgonCoin Testnet", "EGON"},
-    {272247, "Nxy Area 51", "NXY"},
-    {272520, "Nxy Oasis", "NXY"},
-    {281121, "Social Smart Chain Mainnet", "$OC"},
-    {281123, "Athene Parthenon", "ETH"},
-    {282828, "Zillion Sepolia Testnet", "ETH"},
-    {292003, "Cipherem Testnet", "CIP"},
-    {309075, "One World Chain Mainnet", "OWCT"},
-    {313313, "SaharaAI Testnet", "SAH"},
-    {314159, "Filecoin - Calibration testnet", "tFIL"},
-    {322202, "Parex Mainnet", "PRX"},
-    {323213, "Bloom Genesis Testnet", "BGBC"},
-    {325000, "Camp Network Testnet V2", "ETH"},
-    {327126, "WABA Chain Testnet", "WABA"},
-    {328527, "Nal Mainnet", "ETH"},
-    {330844, "TTcoin Smart Chain Mainnet", "TC"},
-    {333313, "Bloom Genesis Mainnet", "BGBC"},
-    {333331, "Aves Testnet", "AVST"},
-    {333333, "Nativ3 Testnet", "USNT"},
-    {333666, "Oone Chain Testnet", "tOONE"},
-    {333777, "Oone Chain Devnet", "tOONE"},
-    {333888, "Polis Testnet", "tPOLIS"},
-    {333999, "Polis Mainnet", "POLIS"},
-    {336655, "UPchain Testnet", "UBTC"},
-    {336666, "UPchain Mainnet", "UBTC"},
-    {355110, "Bitfinity Network Mainnet", "BTF"},
-    {355113, "Bitfinity Network Testnet", "BTF"},
-    {360890, "LAVITA Mainnet", "vTFUEL"},
-    {363636, "Digit Soul Smart Chain 2", "DGC"},
-    {373737, "HAPchain Testnet", "HAP"},
-    {381931, "Metal C-Chain", "METAL"},
-    {381932, "Metal Tahoe C-Chain", "METAL"},
-    {383353, "CheeseChain", "CHEESE"},
-    {404040, "Tipboxcoin Mainnet", "TPBX"},
-    {413413, "AIE Testnet", "AIE"},
-    {420420, "Kekchain", "KEK"},
-    {420666, "Kekchain (kektest)", "tKEK"},
-    {420692, "Alterium L2 Testnet", "AltETH"},
-    {421611, "Arbitrum Rinkeby", "ETH"},
-    {421613, "Arbitrum Goerli", "AGOR"},
-    {421614, "Arbitrum Sepolia", "ETH"},
-    {424242, "Fastex Chain testnet", "FTN"},
-    {431140, "Markr Go", "AVAX"},
-    {432201, "Dexalot Subnet Testnet", "ALOT"},
-    {432204, "Dexalot Subnet", "ALOT"},
-    {444444, "Syndr L3 Sepolia", "ETH"},
-    {444900, "Weelink Testnet", "tWLK"},
-    {471100, "Patex Sepolia Testnet", "ETH"},
-    {473861, "Ultra Pro Mainnet", "UPRO"},
-    {474142, "OpenChain Mainnet", "OPC"},
-    {484752, "World Chain Sepolia Testnet Deprecated", "ETH"},
-    {486487, "Gobbl Testnet", "GOBBL"},
-    {490000, "Autonomys Testnet Nova Domain", "TATC"},
-    {504441, "Playdapp Network", "PDA"},
-    {512512, "CMP-Testnet", "CMP"},
-    {513100, "DisChain", "DIS"},
-    {526916, "DoCoin Community Chain", "DCT"},
-    {534351, "Scroll Sepolia Testnet", "ETH"},
-    {534352, "Scroll", "ETH"},
-    {534353, "Scroll Alpha Testnet", "ETH"},
-    {534354, "Scroll Pre-Alpha Testnet", "TSETH"},
-    {534849, "Shinarium Beta", "SHI"},
-    {535037, "BeanEco SmartChain", "BESC"},
-    {541764, "OverProtocol Testnet", "OVER"},
-    {543210, "ZERO Network", "ETH"},
-    {552981, "One World Chain Testnet", "OWCT"},
-    {555555, "Pentagon Testnet", "PEN"},
-    {555666, "Eclipse Testnet", "ECLPS"},
-    {555888, "DustBoy IoT", "DST"},
-    {622277, "Hypra Mainnet", "HYP"},
-    {622463, "Atlas", "TON"},
-    {631571, "Polter Testnet", "GHST"},
-    {641230, "Bear Network Chain Mainnet", "BRNKC"},
-    {651940, "ALL Mainnet", "ALL"},
-    {656476, "EDU Chain Testnet", "EDU"},
-    {660279, "Xai Mainnet", "XAI"},
-    {666666, "Vision - Vpioneer Test Chain", "VS"},
-    {666888, "Hela Official Runtime Testnet", "HLUSD"},
-    {686868, "Won Network", "WON"},
-    {696969, "Galadriel Devnet", "GAL"},
-    {710420, "Tiltyard Mainnet Subnet", "TILT"},
-    {713715, "Sei Devnet", "SEI"},
-    {721529, "ERAM Mainnet", "ERAM"},
-    {723107, "TixChain Testnet", "TIX"},
-    {743111, "Hemi Sepolia", "ETH"},
-    {751230, "Bear Network Chain Testnet", "tBRNKC"},
-    {752024, "Ternoa Testnet", "CAPS"},
-    {756689, "PAYSCAN CHAIN", "PYZ"},
-    {761412, "Miexs Smartchain", "MIX"},
-    {763373, "Ink Sepolia", "ETH"},
-    {764984, "Lamina1 Testnet", "L1T"},
-    {767368, "Lamina1 Identity Testnet", "L1IDT"},
-    {776877, "Modularium", "MDM"},
-    {786786, "Zebro Smart Chain", "ZEBRO"},
-    {800001, "OctaSpace", "OCTA"},
-    {808080, "BIZ Smart Chain Testnet", "tBIZT"},
-    {808813, "BOB Sepolia", "ETH"},
-    {810180, "zkLink Nova Mainnet", "ETH"},
-    {810181, "zkLink Nova Sepolia Testnet", "ETH"},
-    {810182, "zkLink Nova Goerli Testnet", "ETH"},
-    {812397, "SG Verse Mainnet", "OAS"},
-    {820522, "TSC Testnet", "tTAS"},
-    {827431, "CURVE Mainnet", "CURVE"},
-    {839320, "PRM Testnet", "PRM"},
-    {839999, "exSat Testnet", "BTC"},
-    {840000, "RUNEVM Testnet", "tBTC"},
-    {846000, "4GoodNetwork", "APTA"},
-    {855456, "Dodao", "DODAO"},
-    {879151, "BlocX Mainnet", "BLX"},
-    {888882, "REXX Mainnet", "REXX"},
-    {888888, "Vision - Mainnet", "VS"},
-    {888991, "Unite Testnet", "UNITE"},
-    {900000, "Posichain Mainnet Shard 0", "POSI"},
-    {910000, "Posichain Testnet Shard 0", "POSI"},
-    {911867, "Odyssey Testnet", "ETH"},
-    {912559, "Astria EVM Dusknet", "RIA"},
-    {920000, "Posichain Devnet Shard 0", "POSI"},
-    {920001, "Posichain Devnet Shard 1", "POSI"},
-    {923018, "FNCY Testnet", "FNCY"},
-    {955081, "Jono12 Subnet", "JONO"},
-    {955305, "Eluvio Content Fabric", "ELV"},
-    {978657, "Treasure Ruby", "MAGIC"},
-    {978658, "Treasure Topaz", "MAGIC"},
-    {984122, "Forma", "TIA"},
-    {984123, "Forma Sketchpad", "TIA"},
-    {988207, "Ecrox Chain Mainnet", "ECROX"},
-    {998899, "Supernet Testnet", "CHAIN"},
-    {999999, "AmChain", "AMC"},
-    {1100789, "Netmind Chain Testnet", "NMT"},
-    {1127469, "Tiltyard Subnet", "TILTG"},
-    {1212101, "1Money Network Testnet", "USD1"},
-    {1234567, "Sharecle Mainnet", "SHR"},
-    {1261120, "zKatana", "ETH"},
-    {1313114, "Etho Protocol", "ETHO"},
-    {1313500, "Xerom", "XERO"},
-    {1337702, "Kintsugi", "kiETH"},
-    {1337802, "Kiln", "ETH"},
-    {1337803, "Zhejiang", "ETH"},
-    {1398243, "Automata Testnet", "ATA"},
-    {1398244, "Automata Orbit Testnet", "ATA"},
-    {1612127, "PlayFi Albireo Testnet", "ETH"},
-    {1637450, "Xterio Testnet", "tBNB"},
-    {1731313, "Turkey Demo Dev", "ETH"},
-    {1998991, "Xphere Testnet", "XPT"},
-    {2021398, "DeBank Testnet", "USD"},
-    {2099156, "Plian Mainnet Main", "PI"},
-    {2203181, "PlatON Dev Testnet Deprecated", "lat"},
-    {2206132, "PlatON Dev Testnet2", "lat"},
-    {2222222, "Coinweb BNB shard", "CWEB"},
-    {2611555, "DPU Chain", "DGC"},
-    {2702128, "Xterio Chain (ETH)", "ETH"},
-    {3132023, "SaharaAI Network", "SAH"},
-    {3141592, "Filecoin - Butterfly testnet", "tFIL"},
-    {3397901, "Funki Sepolia Testnet", "ETH"},
-    {3441005, "Manta Pacific Testnet", "MANTA"},
-    {3441006, "Manta Pacific Sepolia Testnet", "ETH"},
-    {4000003, "AltLayer Zero Gas Network", "ZERO"},
-    {4281033, "Worlds Caldera", "ETH"},
-    {4444444, "Altar Testnet", "ETH"},
-    {4457845, "ZERO Testnet (Sepolia)", "ETH"},
-    {5112023, "NumBlock Chain", "NUMB"},
-    {5167003, "MXC Wannsee zkEVM Testnet", "MXC"},
-    {5167004, "Moonchain Geneva Testnet", "MXC"},
-    {5201420, "Electroneum Testnet", "ETN"},
-    {5318008, "Reactive Kopli", "REACT"},
-    {5555555, "Imversed Mainnet", "IMV"},
-    {5555558, "Imversed Testnet", "IMV"},
-    {6038361, "Astar zKyoto", "ETH"},
-    {6666665, "Safe(AnWang) Mainnet", "SAFE"},
-    {6666666, "Safe(AnWang) Testnet", "SAFE"},
-    {7082400, "COTI Testnet", "COTI"},
-    {7225878, "Saakuru Mainnet", "OAS"},
-    {7355310, "OpenVessel", "VETH"},
-    {7668378, "QL1 Testnet", "QOM"},
-    {7762959, "Musicoin", "MUSIC"},
-    {7777777, "Zora", "ETH"},
-    {8007736, "Plian Mainnet Subchain 1", "PI"},
-    {8008135, "Fhenix Helium", "tFHE"},
-    {8080808, "Hokum", "ETH"},
-    {8601152, "Waterfall 8 Test Network", "WATER"},
-    {8794598, "HAPchain", "HAP"},
-    {8888881, "Quarix Testnet", "QARE"},
-    {8888888, "Quarix", "QARE"},
-    {9322252, "XCAP", "GAS"},
-    {9322253, "Milvine", "GAS"},
-    {9999999, "Fluence", "FLT"},
-    {10058111, "Spotlight", "ETH"},
-    {10058112, "Spotlight Sepolia Testnet", "ETH"},
-    {10067275, "Plian Testnet Subchain 1", "TPI"},
-    {10101010, "Soverun Mainnet", "SVRN"},
-    {10241024, "AlienX Mainnet", "ETH"},
-    {10241025, "ALIENX Hal Testnet", "ETH"},
-    {11145513, "Blessnet Sepolia", "BLESS"},
-    {11155111, "Sepolia", "ETH"},
-    {11155420, "OP Sepolia Testnet", "ETH"},
-    {11166111, "R0AR Testnet", "ETH"},
-    {12020498, "Lummio Network", "LRPO"},
-    {12052024, "Memento Testnet", "ETH"},
-    {12227331, "NeoX Testnet T3", "GAS"},
-    {12227332, "Neo X Testnet T4", "GAS"},
-    {13068200, "COTI Devnet", "COTI2"},
-    {13371337, "PepChain Churchill", "TPEP"},
-    {14288640, "Anduschain Mainnet", "DEB"},
-    {16658437, "Plian Testnet Main", "TPI"},
-    {17000920, "Lambda Chain Testnet", "ETH"},
-    {18071918, "Mande Network Mainnet", "MAND"},
-    {18289463, "IOLite", "ILT"},
-    {19850818, "DeepBrainChain Testnet", "tDBC"},
-    {19880818, "DeepBrainChain Mainnet", "DBC"},
-    {20180427, "Stability Testnet", "FREE"},
-    {20180430, "SmartMesh Mainnet", "SMT"},
-    {20181205, "quarkblockchain", "QKI"},
-    {20201022, "Pego Network", "PG"},
-    {20230825, "Vcity Testnet", "VCITY"},
-    {20240324, "DeBank Sepolia Testnet", "USD"},
-    {20240603, "DBK Chain", "ETH"},
-    {20241133, "Swan Proxima Testnet", "sETH"},
-    {20482050, "Hokum Testnet", "ETH"},
-    {21000000, "Corn Maizenet", "BTCN"},
-    {21000001, "Corn Testnet", "BTCN"},
-    {22052002, "Excelon Mainnet", "xlon"},
-    {24132016, "XMTP", "USDC"},
-    {24772477, "6Degree of Outreach - Testnet", "6DO-T"},
-    {27082017, "Excoincial Chain Volta-Testnet", "TEXL"},
-    {27082022, "Excoincial Chain Mainnet", "EXL"},
-    {28122024, "Ancient8 Testnet", "ETH"},
-    {28945486, "Auxilium Network Mainnet", "AUX"},
-    {29032022, "Flachain Mainnet", "FLA"},
-    {31415926, "Filecoin - Local testnet", "tFIL"},
-    {33626250, "Toliman Suave Testnet", "TEEth"},
-    {34949059, "citronus-citro", "CITRO"},
-    {35855456, "Joys Digital Mainnet", "JOYS"},
-    {37084624, "SKALE Nebula Hub Testnet", "sFUEL"},
-    {39916801, "Kingdom Chain", "KOZI"},
-    {43214913, "maistestsubnet", "MAI"},
-    {52027071, "Deviant Token Blockchain", "DTBC"},
-    {52027080, "Deviant Token Blockchain Testnet", "tDTBC"},
-    {52164803, "Fluence Testnet", "tFLT"},
-    {61717561, "Aquachain", "AQUA"},
-    {65010000, "Autonity Bakerloo (Thames) Testnet", "ATN"},
-    {65010001, "Autonity Bakerloo (Barada) Testnet", "ATN"},
-    {65010002, "Autonity Bakerloo (Sumida) Testnet", "ATN"},
-    {65010003, "Autonity Bakerloo (Yamuna) Testnet", "ATN"},
-    {65100000, "Autonity Piccadilly (Thames) Testnet", "ATN"},
-    {65100001, "Autonity Piccadilly (Barada) Testnet", "ATN"},
-    {65100002, "Autonity Piccadilly (Sumida) Testnet", "ATN"},
-    {65100003, "Autonity Piccadilly (Yamuna) Testnet", "ATN"},
-    {68840142, "Frame Testnet", "ETH"},
-    {77787778, "0xHash Testnet", "HETH"},
-    {79479957, "SX Toronto Rollup", "SX"},
-    {88558801, "Backstop Testnet", "ZBS"},
-    {88888888, "T.E.A.M Blockchain", "$TEAM"},
-    {89346162, "Reya Cronos", "ETH"},
-    {94204209, "Polygon Blackberry", "ETH"},
-    {97912060, "ChadChain", "CHAD"},
-    {99415706, "Joys Digital TestNet", "TOYS"},
-    {100000000, "Ethos", "ETHOS"},
-    {108160679, "Oraichain Mainnet", "ORAI"},
-    {111557560, "Cyber Testnet", "ETH"},
-    {123420111, "OP Celestia Raspberry", "ETH"},
-    {161221135, "Plume Testnet", "ETH"},
-    {168587773, "Blast Sepolia Testnet", "ETH"},
-    {192837465, "Gather Mainnet Network", "GTH"},
-    {222000222, "Kanazawa", "gMELD"},
-    {241320161, "XMTP Sepolia", "USDC"},
-    {245022926, "Neon EVM Devnet", "NEON"},
-    {245022929, "Neon EVM Devnet Rollup", "NEON"},
-    {245022934, "Neon EVM Mainnet", "NEON"},
-    {245022940, "Neon EVM TestNet", "NEON"},
-    {253368190, "Flame", "TIA"},
-    {278611351, "Razor Skale Chain", "SFUEL"},
-    {311752642, "OneLedger Mainnet", "OLT"},
-    {328527624, "Nal Sepolia Testnet", "ETH"},
-    {333000333, "Meld", "gMELD"},
-    {344106930, "Deprecated SKALE Calypso Hub Testnet", "sFUEL"},
-    {356256156, "Gather Testnet Network", "GTH"},
-    {420420421, "Westend Asset Hub", "WND"},
-    {476158412, "Deprecated SKALE Europa Hub Testnet", "sFUEL"},
-    {476462898, "Skopje Testnet", "SkpGPT"},
-    {486217935, "Gather Devnet Network", "GTH"},
-    {503129905, "Deprecated SKALE Nebula Hub Testnet", "sFUEL"},
-    {531050104, "Sophon Testnet", "SOPH"},
-    {666666666, "Degen Chain", "DEGEN"},
-    {728126428, "Tron Mainnet", "TRX"},
-    {888888888, "Ancient8", "ETH"},
-    {889910245, "PTCESCAN Testnet", "PTCE"},
-    {889910246, "PTCESCAN Mainnet", "PTCE"},
-    {974399131, "SKALE Calypso Hub Testnet", "sFUEL"},
-    {994873017, "Lumia Mainnet", "LUMIA"},
-    {999999999, "Zora Sepolia Testnet", "ETH"},
-    {1020352220, "SKALE Titan Hub Testnet", "sFUEL"},
-    {1122334455, "IPOS Network", "IPOS"},
-    {1146703430, "CyberdeckNet", "CYB"},
-    {1273227453, "HUMAN Protocol", "sFUEL"},
-    {1313161554, "Aurora Mainnet", "ETH"},
-    {1313161555, "Aurora Testnet", "ETH"},
-    {1313161556, "Aurora Betanet", "ETH"},
-    {1313161560, "PowerGold", "ETH"},
-    {1350216234, "SKALE Titan Hub", "sFUEL"},
-    {1351057110, "Chaos (SKALE Testnet)", "sFUEL"},
-    {1380012617, "RARI Chain Mainnet", "ETH"},
-    {1380996178, "RaptorChain", "RPTR"},
-    {1444673419, "SKALE Europa Hub Testnet", "sFUEL"},
-    {1482601649, "SKALE Nebula Hub", "sFUEL"},
-    {1511670449, "GPT Mainnet", "GPT"},
-    {1517929550, "Deprecated SKALE Titan Hub Testnet", "sFUEL"},
-    {1564830818, "SKALE Calypso Hub", "sFUEL"},
-    {1570754601, "Haust Testnet", "HAUST"},
-    {1666600000, "Harmony Mainnet Shard 0", "ONE"},
-    {1666600001, "Harmony Mainnet Shard 1", "ONE"},
-    {1666600002, "Harmony Mainnet Shard 2", "ONE"},
-    {1666600003, "Harmony Mainnet Shard 3", "ONE"},
-    {1666700000, "Harmony Testnet Shard 0", "ONE"},
-    {1666700001, "Harmony Testnet Shard 1", "ONE"},
-    {1666900000, "Harmony Devnet Shard 0", "ONE"},
-    {1666900001, "Harmony Devnet Shard 1", "ONE"},
-    {1722641160, "Silicon zkEVM Sepolia Testnet", "ETH"},
-    {1802203764, "Kakarot Sepolia (Deprecated)", "ETH"},
-    {1903648807, "Gemuchain Testnet", "GEMU"},
-    {1918988905, "RARI Chain Testnet", "ETH"},
-    {1952959480, "Lumia Testnet", "LUMIA"},
-    {2021121117, "DataHopper", "HOP"},
-    {2046399126, "SKALE Europa Hub", "sFUEL"},
-    {2478899481, "Accumulate Kermit", "ACME"},
-    {2863311531, "Ancient8 Testnet (deprecated)", "ETH"},
-    {3125659152, "Pirl", "PIRL"},
-    {4216137055, "OneLedger Testnet Frankenstein", "OLT"},
-    {7078815900, "Mekong", "ETH"},
-    {11297108099, "Palm Testnet", "PALM"},
-    {11297108109, "Palm", "PALM"},
-    {28872323069, "GitSwarm Test Network", "GS-ETH"},
-    {37714555429, "Xai Testnet v2", "sXAI"},
-    {88153591557, "Arbitrum Blueberry", "CGT"},
-    {107107114116, "Kakarot Sepolia Deprecated", "ETH"},
-    {111222333444, "Alphabet Mainnet", "ALT"},
-    {111551119090, "Thanos Sepolia", "TON"},
-    {123420000220, "Fluence Stage", "tFLT"},
-    {123420000558, "PIN", "ETH"},
-    {123420000586, "sivo-defi-testnet", "ETH"},
-    {123420000588, "volmex", "ETH"},
-    {197710212030, "Ntity Mainnet", "NTT"},
-    {197710212031, "Haradev Testnet", "NTTH"},
-    {202402181627, "GM Network Testnet", "ETH"},
-    {383414847825, "Zeniq", "ZENIQ"},
-    {666301171999, "PDC Mainnet", "PDC"},
-    {6022140761023, "Molereum Network", "MOLE"},
-    {16604737732183, "Flame Testnet", "TIA"},
-    {868455272153094, "Godwoken Testnet (V1)", "CKB"},
-    {920637907288165, "Kakarot Starknet Sepolia", "ETH"},
-    {2713017997578000, "DCHAIN Testnet", "ETH"},
-    {2716446429837000, "DCHAIN", "ETH"}};
+/* sorted, searched with evm_chain_find() */
+static const uint64_t chain_ids[] = {
+#define EVM_CHAIN(id, name, symbol) id##ULL,
+#include "evm_chains.def"
+#undef EVM_CHAIN
+};
+
+static const evm_chain_offsets_t chain_offsets[] = {
+#define EVM_CHAIN(id, name, symbol) {offsetof(evm_chain_strings_t, name_##id), offsetof(evm_chain_strings_t, symbol_##id)},
+#include "evm_chains.def"
+#undef EVM_CHAIN
+};
+
+_Static_assert(sizeof(evm_chain_strings_t) <= UINT16_MAX, "chain strings don't fit 16-bit offsets");
+_Static_assert(sizeof(chain_ids) / sizeof(chain_ids[0]) == sizeof(chain_offsets) / sizeof(chain_offsets[0]), "chain tables mismatch");
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static int evm_chain_find(long long chain_id);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-evm_chain_info_t *evm_chain_name_from_int(long long chain_id);
-evm_chain_info_t *evm_chain_name_from_str(char *chain_id_str);
+bool evm_chain_name_from_int(long long chain_id, evm_chain_info_t *info);
+bool evm_chain_name_from_str(const char *chain_id_str, evm_chain_info_t *info);
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+/* index of the chain in the tables, -1 if unknown */
+static int evm_chain_find(long long chain_id)
+{
+   if (chain_id < 0)
+   {
+      return -1;
+   }
+   size_t lo = 0;
+   size_t hi = sizeof(chain_ids) / sizeof(chain_ids[0]);
+   while (lo < hi)
+   {
+      size_t mid = lo + (hi - lo) / 2;
+      if (chain_ids[mid] < (uint64_t)chain_id)
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+   if (lo < sizeof(chain_ids) / sizeof(chain_ids[0]) && chain_ids[lo] == (uint64_t)chain_id)
+   {
+      return (int)lo;
+   }
+   return -1;
+}
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-evm_chain_info_t *evm_chain_name_from_str(char *chain_id_str)
+bool evm_chain_name_from_str(const char *chain_id_str, evm_chain_info_t *info)
 {
    long long chain_id = atoll(chain_id_str);
-   return evm_chain_name_from_int(chain_id);
+   return evm_chain_name_from_int(chain_id, info);
 }
-evm_chain_info_t *evm_chain_name_from_int(long long chain_id)
+bool evm_chain_name_from_int(long long chain_id, evm_chain_info_t *info)
 {
-   for (int i = 0; i < sizeof(chains) / sizeof(chains[0]); i++)
+   int i = evm_chain_find(chain_id);
+   if (i < 0)
    {
-      if (chains[i].chain_id == chain_id)
-      {
-         return &chains[i];
-      }
+      return false;
+   }
+   if (info != NULL)
+   {
+      const char *strings = (const char *)&chain_strings;
+      info->chain_id = chain_id;
+      info->chain_name = strings + chain_offsets[i].name;
+      info->symbol = strings + chain_offsets[i].symbol;
    }
-   return "Unknown Chain";
+   return true;
 }
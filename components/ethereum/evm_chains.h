@@ -4,6 +4,7 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdbool.h>
 #include <string.h>
 
 /**********************
@@ -12,8 +13,8 @@
 typedef struct
 {
     long long chain_id;
-    char *chain_name;
-    char *symbol;
+    const char *chain_name;
+    const char *symbol;
 } evm_chain_info_t;
 
 #ifdef __cplusplus
@@ -23,8 +24,9 @@ extern "C"
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
-    evm_chain_info_t *evm_chain_name_from_int(long long chain_id);
-    evm_chain_info_t *evm_chain_name_from_str(char *chain_id_str);
+    /* binary search over the known chains, returns false if the chain is unknown */
+    bool evm_chain_name_from_int(long long chain_id, evm_chain_info_t *info);
+    bool evm_chain_name_from_str(const char *chain_id_str, evm_chain_info_t *info);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,154 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "amount.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_AMOUNT_MAX_HEX_BYTES 40
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *hex;
+    unsigned int decimals;
+    const char *unit;
+    const char *text; /* "" if the value must be rejected */
+} amount_vector_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char *uint256_max = "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff";
+
+static const amount_vector_t format_vectors[] = {
+    {"", 18, "ETH", "0 ETH"},
+    {"00", 0, NULL, "0"},
+    {"0de0b6b3a7640000", 18, "ETH", "1 ETH"},
+    {"59682f00", 9, "Gwei", "1.5 Gwei"},
+    {"01", 18, "ETH", "0.000000000000000001 ETH"},
+    {"01", 30, NULL, "0.000000000000000000000000000001"},
+    {"0a", 1, NULL, "1"},
+    {"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", 0, NULL,
+     "115792089237316195423570985008687907853269984665640564039457584007913129639935"},
+    {"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", 18, NULL,
+     "115792089237316195423570985008687907853269984665640564039457.584007913129639935"},
+    /* longer than 32 bytes, fine while the extra bytes are zero */
+    {"000000000000000000000000000000000000000000000000000000000000000000000005", 2, "X", "0.05 X"},
+    {"0100000000000000000000000000000000000000000000000000000000000000000005", 2, "X", ""},
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static size_t unhex(const char *hex, uint8_t *out)
+{
+    size_t len = strlen(hex) / 2;
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+    return len;
+}
+
+static void assert_word(const char *hex, const uint8_t word[AMOUNT_MAX_BYTES])
+{
+    uint8_t expected[AMOUNT_MAX_BYTES] = {0};
+    size_t len = strlen(hex) / 2;
+    unhex(hex, expected + AMOUNT_MAX_BYTES - len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, word, AMOUNT_MAX_BYTES);
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("amount format", "[ethereum]")
+{
+    uint8_t value[TEST_AMOUNT_MAX_HEX_BYTES];
+    char out[128];
+    for (size_t i = 0; i < sizeof(format_vectors) / sizeof(format_vectors[0]); i++)
+    {
+        const amount_vector_t *v = &format_vectors[i];
+        size_t len = unhex(v->hex, value);
+        TEST_ASSERT_EQUAL_size_t(strlen(v->text), amount_format(value, len, v->decimals, v->unit, out, sizeof(out)));
+        TEST_ASSERT_EQUAL_STRING(v->text, out);
+    }
+}
+
+TEST_CASE("amount format into a short buffer", "[ethereum]")
+{
+    uint8_t value[8];
+    char out[8];
+    size_t len = unhex("0de0b6b3a7640000", value);
+
+    /* "1 ETH" and the terminator */
+    TEST_ASSERT_EQUAL_size_t(5, amount_format(value, len, 18, "ETH", out, 6));
+    TEST_ASSERT_EQUAL_STRING("1 ETH", out);
+    TEST_ASSERT_EQUAL_size_t(0, amount_format(value, len, 18, "ETH", out, 5));
+    TEST_ASSERT_EQUAL_STRING("", out);
+    TEST_ASSERT_EQUAL_size_t(0, amount_format(value, len, 18, "ETH", out, 1));
+    TEST_ASSERT_EQUAL_STRING("", out);
+}
+
+TEST_CASE("amount multiply and add overflow", "[ethereum]")
+{
+    uint8_t a[TEST_AMOUNT_MAX_HEX_BYTES];
+    uint8_t b[TEST_AMOUNT_MAX_HEX_BYTES];
+    uint8_t result[AMOUNT_MAX_BYTES];
+    size_t a_len, b_len;
+
+    /* 30 Gwei * 100000 gas */
+    a_len = unhex("06fc23ac00", a);
+    b_len = unhex("0186a0", b);
+    TEST_ASSERT_TRUE(amount_mul(a, a_len, b, b_len, result));
+    assert_word("0aa87bee538000", result);
+
+    /* max * 1 fits, max * 2 doesn't */
+    a_len = unhex(uint256_max, a);
+    b_len = unhex("01", b);
+    TEST_ASSERT_TRUE(amount_mul(a, a_len, b, b_len, result));
+    assert_word(uint256_max, result);
+    b_len = unhex("02", b);
+    TEST_ASSERT_FALSE(amount_mul(a, a_len, b, b_len, result));
+    b_len = unhex("0186a0", b);
+    TEST_ASSERT_FALSE(amount_mul(a, a_len, b, b_len, result));
+
+    /* 2^128 * (2^128 - 1) fits, 2^128 * 2^128 doesn't */
+    a_len = unhex("0100000000000000000000000000000000", a);
+    b_len = unhex("ffffffffffffffffffffffffffffffff", b);
+    TEST_ASSERT_TRUE(amount_mul(a, a_len, b, b_len, result));
+    assert_word("ffffffffffffffffffffffffffffffff00000000000000000000000000000000", result);
+    b_len = unhex("0100000000000000000000000000000000", b);
+    TEST_ASSERT_FALSE(amount_mul(a, a_len, b, b_len, result));
+
+    /* zero times anything, even with leading zero bytes beyond 32 */
+    a_len = unhex("0000000000000000000000000000000000000000000000000000000000000000000000", a);
+    b_len = unhex(uint256_max, b);
+    TEST_ASSERT_TRUE(amount_mul(a, a_len, b, b_len, result));
+    assert_word("00", result);
+    a_len = unhex("010000000000000000000000000000000000000000000000000000000000000000", a);
+    b_len = unhex("01", b);
+    TEST_ASSERT_FALSE(amount_mul(a, a_len, b, b_len, result));
+
+    /* max + 0 fits, max + 1 doesn't */
+    a_len = unhex(uint256_max, a);
+    b_len = unhex("", b);
+    TEST_ASSERT_TRUE(amount_add(a, a_len, b, b_len, result));
+    assert_word(uint256_max, result);
+    b_len = unhex("01", b);
+    TEST_ASSERT_FALSE(amount_add(a, a_len, b, b_len, result));
+
+    /* carry through every limb, the sum may be an input */
+    a_len = unhex("00ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", result);
+    b_len = unhex("01", b);
+    TEST_ASSERT_TRUE(amount_add(result, a_len, b, b_len, result));
+    assert_word("0100000000000000000000000000000000000000000000000000000000000000", result);
+}
@@ -0,0 +1,357 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "calldata.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_CALL_MAX 512
+#define TEST_CALLDATA_MAX 4096
+#define TEST_DESCRIBE_MAX 2048
+
+#define SELECTOR_TRANSFER 0xa9059cbb
+#define SELECTOR_APPROVE 0x095ea7b3
+#define SELECTOR_SET_APPROVAL_FOR_ALL 0xa22cb465
+#define SELECTOR_PERMIT 0xd505accf
+#define SELECTOR_MULTICALL 0xac9650d8
+#define SELECTOR_MULTICALL_DEADLINE 0x5ae401dc
+#define SELECTOR_EXECUTE 0xb61d27f6
+#define SELECTOR_EXECUTE_BATCH 0x18dfb3c7
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* ABI encoded call, built by the abi_* helpers */
+typedef struct
+{
+    uint8_t data[TEST_CALL_MAX];
+    size_t len;
+} abi_call_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char *usdc = "a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48";
+static const char *vitalik = "d8da6bf26964af9d7eed9e03e53415d37aa96045";
+static const char *wallet = "2222222222222222222222222222222222222222";
+static const char *spender = "3333333333333333333333333333333333333333";
+
+static uint8_t calldata[TEST_CALLDATA_MAX];
+static char text[TEST_DESCRIBE_MAX];
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void unhex(const char *hex, uint8_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+}
+
+static void abi_selector(uint8_t *buf, size_t *len, uint32_t selector)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        buf[(*len)++] = (uint8_t)(selector >> (24 - 8 * i));
+    }
+}
+
+static void abi_word(uint8_t *buf, size_t *len, uint64_t value)
+{
+    memset(buf + *len, 0, CALLDATA_WORD_LEN);
+    for (int i = 0; i < 8; i++)
+    {
+        buf[*len + CALLDATA_WORD_LEN - 1 - i] = (uint8_t)(value >> (8 * i));
+    }
+    *len += CALLDATA_WORD_LEN;
+}
+
+static void abi_max_word(uint8_t *buf, size_t *len)
+{
+    memset(buf + *len, 0xff, CALLDATA_WORD_LEN);
+    *len += CALLDATA_WORD_LEN;
+}
+
+static void abi_address(uint8_t *buf, size_t *len, const char *hex)
+{
+    memset(buf + *len, 0, 12);
+    unhex(hex, buf + *len + 12, 20);
+    *len += CALLDATA_WORD_LEN;
+}
+
+/* length word and content padded to whole words */
+static void abi_bytes(uint8_t *buf, size_t *len, const uint8_t *data, size_t data_len)
+{
+    abi_word(buf, len, data_len);
+    size_t padded = (data_len + CALLDATA_WORD_LEN - 1) / CALLDATA_WORD_LEN * CALLDATA_WORD_LEN;
+    memset(buf + *len, 0, padded);
+    memcpy(buf + *len, data, data_len);
+    *len += padded;
+}
+
+/* bytes[] content: count, offsets relative to the first offset, elements */
+static void abi_bytes_array(uint8_t *buf, size_t *len, const abi_call_t *const *calls, size_t calls_len)
+{
+    abi_word(buf, len, calls_len);
+    size_t offset = calls_len * CALLDATA_WORD_LEN;
+    for (size_t i = 0; i < calls_len; i++)
+    {
+        abi_word(buf, len, offset);
+        offset += CALLDATA_WORD_LEN + (calls[i]->len + CALLDATA_WORD_LEN - 1) / CALLDATA_WORD_LEN * CALLDATA_WORD_LEN;
+    }
+    for (size_t i = 0; i < calls_len; i++)
+    {
+        abi_bytes(buf, len, calls[i]->data, calls[i]->len);
+    }
+}
+
+static void abi_transfer(abi_call_t *call, const char *to, uint64_t amount)
+{
+    call->len = 0;
+    abi_selector(call->data, &call->len, SELECTOR_TRANSFER);
+    abi_address(call->data, &call->len, to);
+    abi_word(call->data, &call->len, amount);
+}
+
+static void abi_approve_unlimited(abi_call_t *call, const char *to)
+{
+    call->len = 0;
+    abi_selector(call->data, &call->len, SELECTOR_APPROVE);
+    abi_address(call->data, &call->len, to);
+    abi_max_word(call->data, &call->len);
+}
+
+/* execute(address,uint256,bytes) */
+static void abi_execute(uint8_t *buf, size_t *len, const char *to, uint64_t value, const uint8_t *data, size_t data_len)
+{
+    abi_selector(buf, len, SELECTOR_EXECUTE);
+    abi_address(buf, len, to);
+    abi_word(buf, len, value);
+    abi_word(buf, len, 3 * CALLDATA_WORD_LEN);
+    abi_bytes(buf, len, data, data_len);
+}
+
+/* multicall(bytes[]) */
+static size_t abi_multicall(const abi_call_t *const *calls, size_t calls_len)
+{
+    size_t len = 0;
+    abi_selector(calldata, &len, SELECTOR_MULTICALL);
+    abi_word(calldata, &len, CALLDATA_WORD_LEN);
+    abi_bytes_array(calldata, &len, calls, calls_len);
+    return len;
+}
+
+static int describe(const char *to_hex, size_t len, size_t out_len)
+{
+    uint8_t to[20];
+    int result = 1;
+    unhex(to_hex, to, sizeof(to));
+    size_t text_len = calldata_describe(to, 1, calldata, len, text, out_len, &result);
+    TEST_ASSERT_EQUAL_size_t(strlen(text), text_len);
+    TEST_ASSERT_TRUE(text_len < out_len);
+    return result;
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("calldata token transfer and approve", "[ethereum]")
+{
+    abi_call_t call;
+    abi_transfer(&call, vitalik, 12500000);
+    memcpy(calldata, call.data, call.len);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, call.len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Transfer 12.5 USDC to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045", text);
+
+    /* token without known decimals */
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(wallet, call.len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Transfer 12500000 units to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045", text);
+
+    abi_approve_unlimited(&call, vitalik);
+    memcpy(calldata, call.data, call.len);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, call.len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Approve 0xd8da6bf26964af9d7eed9e03e53415d37aa96045 to spend unlimited USDC", text);
+}
+
+TEST_CASE("calldata permit and generic methods", "[ethereum]")
+{
+    size_t len = 0;
+    abi_selector(calldata, &len, SELECTOR_PERMIT);
+    abi_address(calldata, &len, vitalik);
+    abi_address(calldata, &len, spender);
+    abi_word(calldata, &len, 1000000);
+    abi_word(calldata, &len, 1800000000);
+    abi_word(calldata, &len, 27);
+    abi_word(calldata, &len, 1);
+    abi_word(calldata, &len, 2);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Permit 0x3333333333333333333333333333333333333333 to spend 1 USDC of "
+                             "0xd8da6bf26964af9d7eed9e03e53415d37aa96045 until 1800000000",
+                             text);
+
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_SET_APPROVAL_FOR_ALL);
+    abi_address(calldata, &len, vitalik);
+    abi_word(calldata, &len, 1);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("setApprovalForAll(address,bool)\n"
+                             "  0: 0xd8da6bf26964af9d7eed9e03e53415d37aa96045\n"
+                             "  1: true",
+                             text);
+}
+
+TEST_CASE("calldata unknown and invalid calls", "[ethereum]")
+{
+    size_t len = 0;
+    abi_selector(calldata, &len, 0x12345678);
+    abi_word(calldata, &len, 1);
+    abi_word(calldata, &len, 2);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_UNKNOWN, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Unknown call 0x12345678, 68 bytes", text);
+
+    /* address with dirty upper bytes */
+    abi_call_t call;
+    abi_transfer(&call, vitalik, 1);
+    memcpy(calldata, call.data, call.len);
+    calldata[4] = 0x01;
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INVALID, describe(usdc, call.len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Invalid transfer(address,uint256) call", text);
+
+    /* bool other than 0 or 1 */
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_SET_APPROVAL_FOR_ALL);
+    abi_address(calldata, &len, vitalik);
+    abi_word(calldata, &len, 2);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INVALID, describe(usdc, len, TEST_DESCRIBE_MAX));
+
+    /* every truncation of a call */
+    memcpy(calldata, call.data, call.len);
+    for (size_t l = CALLDATA_SELECTOR_LEN; l < call.len; l++)
+    {
+        TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INVALID, describe(usdc, l, TEST_DESCRIBE_MAX));
+    }
+
+    /* bytes[] offset and length outside the calldata */
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_MULTICALL);
+    abi_word(calldata, &len, 0x1000);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INVALID, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Invalid multicall(bytes[]) call", text);
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_MULTICALL);
+    abi_word(calldata, &len, CALLDATA_WORD_LEN);
+    abi_max_word(calldata, &len);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INVALID, describe(usdc, len, TEST_DESCRIBE_MAX));
+
+    /* contract deployment */
+    int result = 1;
+    calldata_describe(NULL, 1, calldata, len, text, TEST_DESCRIBE_MAX, &result);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_UNKNOWN, result);
+    TEST_ASSERT_EQUAL_STRING("Deploy contract, 68 bytes", text);
+}
+
+TEST_CASE("calldata batches", "[ethereum]")
+{
+    abi_call_t transfer, approve, unknown;
+    abi_transfer(&transfer, vitalik, 12500000);
+    abi_approve_unlimited(&approve, vitalik);
+    unknown.len = 0;
+    abi_selector(unknown.data, &unknown.len, 0xdeadbeef);
+
+    const abi_call_t *known[] = {&transfer, &approve};
+    size_t len = abi_multicall(known, 2);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Batch of 2 calls:\n"
+                             "  1. Transfer 12.5 USDC to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045\n"
+                             "  2. Approve 0xd8da6bf26964af9d7eed9e03e53415d37aa96045 to spend unlimited USDC",
+                             text);
+
+    /* a nested call that doesn't decode makes the batch incomplete */
+    const abi_call_t *mixed[] = {&transfer, &approve, &unknown};
+    len = abi_multicall(mixed, 3);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INCOMPLETE, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Batch of 3 calls:\n"
+                             "  1. Transfer 12.5 USDC to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045\n"
+                             "  2. Approve 0xd8da6bf26964af9d7eed9e03e53415d37aa96045 to spend unlimited USDC\n"
+                             "  3. Unknown call 0xdeadbeef, 4 bytes",
+                             text);
+
+    /* multicall(uint256 deadline, bytes[]) */
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_MULTICALL_DEADLINE);
+    abi_word(calldata, &len, 1800000000);
+    abi_word(calldata, &len, 2 * CALLDATA_WORD_LEN);
+    abi_bytes_array(calldata, &len, known, 1);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Batch of 1 calls:\n"
+                             "  1. Transfer 12.5 USDC to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045",
+                             text);
+
+    /* execute(address,uint256,bytes) of a token transfer */
+    len = 0;
+    abi_execute(calldata, &len, usdc, 0, transfer.data, transfer.len);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(wallet, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Call 0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48: "
+                             "Transfer 12.5 USDC to 0xd8da6bf26964af9d7eed9e03e53415d37aa96045",
+                             text);
+
+    /* executeBatch(address[],bytes[]) with fewer targets than calls */
+    len = 0;
+    abi_selector(calldata, &len, SELECTOR_EXECUTE_BATCH);
+    abi_word(calldata, &len, 2 * CALLDATA_WORD_LEN);
+    abi_word(calldata, &len, 4 * CALLDATA_WORD_LEN);
+    abi_word(calldata, &len, 1);
+    abi_address(calldata, &len, usdc);
+    abi_bytes_array(calldata, &len, known, 2);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INCOMPLETE, describe(wallet, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_STRING("Invalid batch: 1 targets for 2 calls", text);
+}
+
+TEST_CASE("calldata batch that doesn't fit is summarized", "[ethereum]")
+{
+    abi_call_t transfer;
+    abi_transfer(&transfer, vitalik, 12500000);
+    const abi_call_t *calls[20];
+    for (size_t i = 0; i < sizeof(calls) / sizeof(calls[0]); i++)
+    {
+        calls[i] = &transfer;
+    }
+    size_t len = abi_multicall(calls, sizeof(calls) / sizeof(calls[0]));
+    TEST_ASSERT_EQUAL_size_t(3268, len);
+
+    /* 20 lines of 70 characters fit */
+    TEST_ASSERT_EQUAL_INT(CALLDATA_OK, describe(usdc, len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_INT(0, strncmp(text, "Batch of 20 calls:\n", 19));
+
+    /* a partial list could hide calls, so none of it is shown */
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INCOMPLETE, describe(usdc, len, 512));
+    TEST_ASSERT_EQUAL_STRING("multicall(bytes[]): too long to describe, 3268 bytes", text);
+
+    /* even the summary doesn't fit, the text is cut but still terminated */
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INCOMPLETE, describe(usdc, len, 16));
+    TEST_ASSERT_EQUAL_size_t(15, strlen(text));
+
+    /* deeper than CALLDATA_MAX_DEPTH */
+    static uint8_t nested[2][TEST_CALLDATA_MAX];
+    size_t nested_len = transfer.len;
+    memcpy(nested[0], transfer.data, transfer.len);
+    for (int depth = 0; depth <= CALLDATA_MAX_DEPTH; depth++)
+    {
+        uint8_t *in = nested[depth % 2];
+        uint8_t *out = nested[(depth + 1) % 2];
+        size_t out_len = 0;
+        abi_execute(out, &out_len, depth == 0 ? usdc : wallet, 0, in, nested_len);
+        nested_len = out_len;
+    }
+    memcpy(calldata, nested[(CALLDATA_MAX_DEPTH + 1) % 2], nested_len);
+    TEST_ASSERT_EQUAL_INT(CALLDATA_ERR_INCOMPLETE, describe(wallet, nested_len, TEST_DESCRIBE_MAX));
+    TEST_ASSERT_EQUAL_INT(0, strncmp(text, "execute(address,uint256,bytes): too complex to describe", 55));
+}
@@ -0,0 +1,151 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "eip712/eip712.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_EIP712_MAX_DOC 2048
+
+/* one member document, type and value are pasted into the JSON as they are */
+#define RANGE_DOC(type, value)                                                                          \
+    "{\"types\":{\"EIP712Domain\":[{\"name\":\"name\",\"type\":\"string\"}],"                             \
+    "\"Test\":[{\"name\":\"v\",\"type\":\"" type "\"}]},"                                                \
+    "\"primaryType\":\"Test\",\"domain\":{\"name\":\"Range\"},\"message\":{\"v\":" value "}}"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *doc;
+    const char *hash; /* NULL if the document must be rejected */
+} eip712_vector_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* example from the EIP-712 specification */
+static const char *mail_doc =
+    "{\"types\":{\"EIP712Domain\":[{\"name\":\"name\",\"type\":\"string\"},{\"name\":\"version\",\"type\":\"string\"},"
+    "{\"name\":\"chainId\",\"type\":\"uint256\"},{\"name\":\"verifyingContract\",\"type\":\"address\"}],"
+    "\"Person\":[{\"name\":\"name\",\"type\":\"string\"},{\"name\":\"wallet\",\"type\":\"address\"}],"
+    "\"Mail\":[{\"name\":\"from\",\"type\":\"Person\"},{\"name\":\"to\",\"type\":\"Person\"},{\"name\":\"contents\",\"type\":\"string\"}]},"
+    "\"primaryType\":\"Mail\",\"domain\":{\"name\":\"Ether Mail\",\"version\":\"1\",\"chainId\":1,"
+    "\"verifyingContract\":\"0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC\"},"
+    "\"message\":{\"from\":{\"name\":\"Cow\",\"wallet\":\"0xCD2a3d9F938E13CD947Ec05AbC7FE734Df8DD826\"},"
+    "\"to\":{\"name\":\"Bob\",\"wallet\":\"0xbBbBBBBbbBBBbbbBbbBbbbbBBbBbbbbBbBbbBBbB\"},\"contents\":\"Hello, Bob!\"}}";
+static const char *mail_hash = "be609aee343fb3c4b28e1df9e632fca64fcfaede20f02e86244efddf30957bd2";
+
+/* signTypedData_v4 example with arrays from eth-sig-util */
+static const char *arrays_doc =
+    "{\"types\":{\"EIP712Domain\":[{\"name\":\"name\",\"type\":\"string\"},{\"name\":\"version\",\"type\":\"string\"},"
+    "{\"name\":\"chainId\",\"type\":\"uint256\"},{\"name\":\"verifyingContract\",\"type\":\"address\"}],"
+    "\"Person\":[{\"name\":\"name\",\"type\":\"string\"},{\"name\":\"wallets\",\"type\":\"address[]\"}],"
+    "\"Mail\":[{\"name\":\"from\",\"type\":\"Person\"},{\"name\":\"to\",\"type\":\"Person[]\"},{\"name\":\"contents\",\"type\":\"string\"}],"
+    "\"Group\":[{\"name\":\"name\",\"type\":\"string\"},{\"name\":\"members\",\"type\":\"Person[]\"}]},"
+    "\"domain\":{\"name\":\"Ether Mail\",\"version\":\"1\",\"chainId\":1,"
+    "\"verifyingContract\":\"0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC\"},\"primaryType\":\"Mail\","
+    "\"message\":{\"from\":{\"name\":\"Cow\",\"wallets\":[\"0xCD2a3d9F938E13CD947Ec05AbC7FE734Df8DD826\","
+    "\"0xDeaDbeefdEAdbeefdEadbEEFdeadbeEFdEaDbeeF\"]},\"to\":[{\"name\":\"Bob\",\"wallets\":["
+    "\"0xbBbBBBBbbBBBbbbBbbBbbbbBBbBbbbbBbBbbBBbB\",\"0xB0BdaBea57B0BDABeA57b0bdABEA57b0BDabEa57\","
+    "\"0xB0B0b0b0b0b0B000000000000000000000000000\"]}],\"contents\":\"Hello, Bob!\"}}";
+static const char *arrays_hash = "a85c2e2b118698e88db68a8105b794a8cc7cec074e89ef991cb4f5f533819cc2";
+
+/* values at the edges of their types */
+static const eip712_vector_t range_vectors[] = {
+    {RANGE_DOC("uint8", "255"), "0a8f96fe301fd170cd1ede35894d5bf59af593674799278e8312351b76c6fce9"},
+    {RANGE_DOC("uint8", "256"), NULL},
+    {RANGE_DOC("int8", "-128"), "13dfa08c667893506afec1b6c29169b60e5e80ec7c168e755d1ccf5e87498664"},
+    {RANGE_DOC("int8", "-129"), NULL},
+    {RANGE_DOC("uint16", "1.5e3"), "66cd1ca5c20e3fc2fd0e5bd3aaceba00d3aeeb60f058407cd3853eee095eb6da"},
+    {RANGE_DOC("uint16", "1.5e0"), NULL},
+    {RANGE_DOC("int256", "-1e40"), "45e931657b441b274b6d6f69639e78323721b546c290d26fab3cd4a194345d25"},
+    {RANGE_DOC("uint256", "1e999"), NULL},
+    {RANGE_DOC("uint256", "\"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff\""),
+     "9984689a2503e8dec21759a234b0d495a0c48df90c46ec7a3bd7d3b557159f99"},
+    {RANGE_DOC("bool", "1"), "e10b022699465784e0379fe42b535f4906990c4bfdbd103d504e95f974f56ac3"},
+    {RANGE_DOC("bool", "true"), "e10b022699465784e0379fe42b535f4906990c4bfdbd103d504e95f974f56ac3"},
+    {RANGE_DOC("bool", "2"), NULL},
+    {RANGE_DOC("uint7", "1"), NULL},
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void unhex(const char *hex, uint8_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+}
+
+/* the document is tokenized in place, hash a copy */
+static bool hash_doc(const char *doc, uint8_t hash[32])
+{
+    static char buf[TEST_EIP712_MAX_DOC];
+    size_t len = strlen(doc);
+    if (len > sizeof(buf))
+    {
+        return false;
+    }
+    memcpy(buf, doc, len);
+    return eip712_typed_data_hash_v4(buf, len, hash);
+}
+
+static void assert_hash(const char *doc, const char *hash)
+{
+    uint8_t expected[32];
+    uint8_t actual[32];
+    unhex(hash, expected, sizeof(expected));
+    TEST_ASSERT_TRUE(hash_doc(doc, actual));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, actual, sizeof(expected));
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("eip712 mail example", "[ethereum]")
+{
+    assert_hash(mail_doc, mail_hash);
+}
+
+TEST_CASE("eip712 v4 arrays example", "[ethereum]")
+{
+    assert_hash(arrays_doc, arrays_hash);
+}
+
+TEST_CASE("eip712 value ranges", "[ethereum]")
+{
+    uint8_t hash[32];
+    for (size_t i = 0; i < sizeof(range_vectors) / sizeof(range_vectors[0]); i++)
+    {
+        if (range_vectors[i].hash != NULL)
+        {
+            assert_hash(range_vectors[i].doc, range_vectors[i].hash);
+        }
+        else
+        {
+            TEST_ASSERT_FALSE_MESSAGE(hash_doc(range_vectors[i].doc, hash), range_vectors[i].doc);
+        }
+    }
+}
+
+TEST_CASE("eip712 describe", "[ethereum]")
+{
+    char buf[TEST_EIP712_MAX_DOC];
+    char out[256];
+    size_t len = strlen(mail_doc);
+    memcpy(buf, mail_doc, len);
+    TEST_ASSERT_TRUE(eip712_typed_data_describe(buf, len, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_STRING("\nprimaryType: Mail\ndomain: Ether Mail\nchainId: 1"
+                             "\nverifyingContract: 0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC",
+                             out);
+}
@@ -0,0 +1,298 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+#include "keccak.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define KECCAK_ROUNDS 24
+#define KECCAK_LANES 25
+#define KECCAK256_BLOCK_LANES (KECCAK256_BLOCK_LENGTH / 8)
+
+/**********************
+ *      MACROS
+ **********************/
+#define ROL32(x, n) (((n) & 31) ? (((x) << ((n) & 31)) | ((x) >> ((32 - (n)) & 31))) : (x))
+
+/* 64-bit rotate of an interleaved lane (e = even bits, o = odd bits) */
+#define ROL64_I(be, bo, ae, ao, r)              \
+    do                                          \
+    {                                           \
+        if ((r) & 1)                            \
+        {                                       \
+            (be) = ROL32((ao), ((r) + 1) / 2);  \
+            (bo) = ROL32((ae), (r) / 2);        \
+        }                                       \
+        else                                    \
+        {                                       \
+            (be) = ROL32((ae), (r) / 2);        \
+            (bo) = ROL32((ao), (r) / 2);        \
+        }                                       \
+    } while (0)
+
+#define E(i) (2 * (i))
+#define O(i) (2 * (i) + 1)
+
+#define KECCAK_THETA_C(x)                                                 \
+    do                                                                    \
+    {                                                                     \
+        C[E(x)] = A[E(x)] ^ A[E(x + 5)] ^ A[E(x + 10)] ^ A[E(x + 15)] ^ A[E(x + 20)]; \
+        C[O(x)] = A[O(x)] ^ A[O(x + 5)] ^ A[O(x + 10)] ^ A[O(x + 15)] ^ A[O(x + 20)]; \
+    } while (0)
+
+#define KECCAK_THETA_D(x)                                        \
+    do                                                           \
+    {                                                            \
+        De = C[E(((x) + 4) % 5)] ^ ROL32(C[O(((x) + 1) % 5)], 1); \
+        Do = C[O(((x) + 4) % 5)] ^ C[E(((x) + 1) % 5)];           \
+        A[E(x)] ^= De;                                           \
+        A[O(x)] ^= Do;                                           \
+        A[E(x + 5)] ^= De;                                       \
+        A[O(x + 5)] ^= Do;                                       \
+        A[E(x + 10)] ^= De;                                      \
+        A[O(x + 10)] ^= Do;                                      \
+        A[E(x + 15)] ^= De;                                      \
+        A[O(x + 15)] ^= Do;                                      \
+        A[E(x + 20)] ^= De;                                      \
+        A[O(x + 20)] ^= Do;                                      \
+    } while (0)
+
+#define KECCAK_RHO_PI(dst, src, r) ROL64_I(B[E(dst)], B[O(dst)], A[E(src)], A[O(src)], r)
+
+#define KECCAK_CHI_HALF(y, h)                                               \
+    do                                                                      \
+    {                                                                       \
+        A[2 * (5 * (y) + 0) + (h)] = B[2 * (5 * (y) + 0) + (h)] ^ (~B[2 * (5 * (y) + 1) + (h)] & B[2 * (5 * (y) + 2) + (h)]); \
+        A[2 * (5 * (y) + 1) + (h)] = B[2 * (5 * (y) + 1) + (h)] ^ (~B[2 * (5 * (y) + 2) + (h)] & B[2 * (5 * (y) + 3) + (h)]); \
+        A[2 * (5 * (y) + 2) + (h)] = B[2 * (5 * (y) + 2) + (h)] ^ (~B[2 * (5 * (y) + 3) + (h)] & B[2 * (5 * (y) + 4) + (h)]); \
+        A[2 * (5 * (y) + 3) + (h)] = B[2 * (5 * (y) + 3) + (h)] ^ (~B[2 * (5 * (y) + 4) + (h)] & B[2 * (5 * (y) + 0) + (h)]); \
+        A[2 * (5 * (y) + 4) + (h)] = B[2 * (5 * (y) + 4) + (h)] ^ (~B[2 * (5 * (y) + 0) + (h)] & B[2 * (5 * (y) + 1) + (h)]); \
+    } while (0)
+
+#define KECCAK_CHI(y)            \
+    do                           \
+    {                            \
+        KECCAK_CHI_HALF(y, 0);   \
+        KECCAK_CHI_HALF(y, 1);   \
+    } while (0)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* round constants, already split into {even, odd} bit halves */
+static const uint32_t keccak_round_constants[KECCAK_ROUNDS][2] = {
+    {0x00000001, 0x00000000},
+    {0x00000000, 0x00000089},
+    {0x00000000, 0x8000008B},
+    {0x00000000, 0x80008080},
+    {0x00000001, 0x0000008B},
+    {0x00000001, 0x00008000},
+    {0x00000001, 0x80008088},
+    {0x00000001, 0x80000082},
+    {0x00000000, 0x0000000B},
+    {0x00000000, 0x0000000A},
+    {0x00000001, 0x00008082},
+    {0x00000000, 0x00008003},
+    {0x00000001, 0x0000808B},
+    {0x00000001, 0x8000000B},
+    {0x00000001, 0x8000008A},
+    {0x00000001, 0x80000081},
+    {0x00000000, 0x80000081},
+    {0x00000000, 0x80000008},
+    {0x00000000, 0x00000083},
+    {0x00000000, 0x80008003},
+    {0x00000001, 0x80008088},
+    {0x00000000, 0x80000088},
+    {0x00000001, 0x00008000},
+    {0x00000000, 0x80008082},
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void keccak_f1600(uint32_t *A);
+static inline uint32_t bits_unshuffle(uint32_t x);
+static inline uint32_t bits_shuffle(uint32_t x);
+static void keccak_absorb_block(uint32_t *A, const uint8_t *block);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void keccak_f1600(uint32_t *A)
+{
+    uint32_t B[2 * KECCAK_LANES];
+    uint32_t C[10];
+    uint32_t De, Do;
+
+    for (int round = 0; round < KECCAK_ROUNDS; round++)
+    {
+        /* theta */
+        KECCAK_THETA_C(0);
+        KECCAK_THETA_C(1);
+        KECCAK_THETA_C(2);
+        KECCAK_THETA_C(3);
+        KECCAK_THETA_C(4);
+        KECCAK_THETA_D(0);
+        KECCAK_THETA_D(1);
+        KECCAK_THETA_D(2);
+        KECCAK_THETA_D(3);
+        KECCAK_THETA_D(4);
+
+        /* rho + pi */
+        KECCAK_RHO_PI(0, 0, 0);
+        KECCAK_RHO_PI(10, 1, 1);
+        KECCAK_RHO_PI(20, 2, 62);
+        KECCAK_RHO_PI(5, 3, 28);
+        KECCAK_RHO_PI(15, 4, 27);
+        KECCAK_RHO_PI(16, 5, 36);
+        KECCAK_RHO_PI(1, 6, 44);
+        KECCAK_RHO_PI(11, 7, 6);
+        KECCAK_RHO_PI(21, 8, 55);
+        KECCAK_RHO_PI(6, 9, 20);
+        KECCAK_RHO_PI(7, 10, 3);
+        KECCAK_RHO_PI(17, 11, 10);
+        KECCAK_RHO_PI(2, 12, 43);
+        KECCAK_RHO_PI(12, 13, 25);
+        KECCAK_RHO_PI(22, 14, 39);
+        KECCAK_RHO_PI(23, 15, 41);
+        KECCAK_RHO_PI(8, 16, 45);
+        KECCAK_RHO_PI(18, 17, 15);
+        KECCAK_RHO_PI(3, 18, 21);
+        KECCAK_RHO_PI(13, 19, 8);
+        KECCAK_RHO_PI(14, 20, 18);
+        KECCAK_RHO_PI(24, 21, 2);
+        KECCAK_RHO_PI(9, 22, 61);
+        KECCAK_RHO_PI(19, 23, 56);
+        KECCAK_RHO_PI(4, 24, 14);
+
+        /* chi */
+        KECCAK_CHI(0);
+        KECCAK_CHI(1);
+        KECCAK_CHI(2);
+        KECCAK_CHI(3);
+        KECCAK_CHI(4);
+
+        /* iota */
+        A[0] ^= keccak_round_constants[round][0];
+        A[1] ^= keccak_round_constants[round][1];
+    }
+}
+
+/* moves even bits to the low half-word and odd bits to the high half-word */
+static inline uint32_t bits_unshuffle(uint32_t x)
+{
+    uint32_t t;
+    t = (x ^ (x >> 1)) & 0x22222222;
+    x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00F000F0;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000FF00;
+    x ^= t ^ (t << 8);
+    return x;
+}
+
+/* inverse of bits_unshuffle */
+static inline uint32_t bits_shuffle(uint32_t x)
+{
+    uint32_t t;
+    t = (x ^ (x >> 8)) & 0x0000FF00;
+    x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00F000F0;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222;
+    x ^= t ^ (t << 1);
+    return x;
+}
+
+static void keccak_absorb_block(uint32_t *A, const uint8_t *block)
+{
+    for (int i = 0; i < KECCAK256_BLOCK_LANES; i++)
+    {
+        const uint8_t *p = block + 8 * i;
+        uint32_t lo = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        uint32_t hi = (uint32_t)p[4] | ((uint32_t)p[5] << 8) | ((uint32_t)p[6] << 16) | ((uint32_t)p[7] << 24);
+        lo = bits_unshuffle(lo);
+        hi = bits_unshuffle(hi);
+        A[E(i)] ^= (lo & 0x0000FFFF) | (hi << 16);
+        A[O(i)] ^= (lo >> 16) | (hi & 0xFFFF0000);
+    }
+    keccak_f1600(A);
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void keccak256_init(keccak256_ctx_t *ctx)
+{
+    memset(ctx, 0, sizeof(keccak256_ctx_t));
+}
+
+void keccak256_update(keccak256_ctx_t *ctx, const uint8_t *data, size_t len)
+{
+    if (ctx->buffer_len > 0)
+    {
+        size_t fill = KECCAK256_BLOCK_LENGTH - ctx->buffer_len;
+        if (len < fill)
+        {
+            memcpy(ctx->buffer + ctx->buffer_len, data, len);
+            ctx->buffer_len += len;
+            return;
+        }
+        memcpy(ctx->buffer + ctx->buffer_len, data, fill);
+        keccak_absorb_block(ctx->state, ctx->buffer);
+        ctx->buffer_len = 0;
+        data += fill;
+        len -= fill;
+    }
+    while (len >= KECCAK256_BLOCK_LENGTH)
+    {
+        keccak_absorb_block(ctx->state, data);
+        data += KECCAK256_BLOCK_LENGTH;
+        len -= KECCAK256_BLOCK_LENGTH;
+    }
+    if (len > 0)
+    {
+        memcpy(ctx->buffer, data, len);
+        ctx->buffer_len = len;
+    }
+}
+
+void keccak256_final(keccak256_ctx_t *ctx, uint8_t digest[KECCAK256_DIGEST_LENGTH])
+{
+    memset(ctx->buffer + ctx->buffer_len, 0, KECCAK256_BLOCK_LENGTH - ctx->buffer_len);
+    ctx->buffer[ctx->buffer_len] |= 0x01;
+    ctx->buffer[KECCAK256_BLOCK_LENGTH - 1] |= 0x80;
+    keccak_absorb_block(ctx->state, ctx->buffer);
+
+    for (int i = 0; i < KECCAK256_DIGEST_LENGTH / 8; i++)
+    {
+        uint32_t e = ctx->state[E(i)];
+        uint32_t o = ctx->state[O(i)];
+        uint32_t lo = bits_shuffle((e & 0x0000FFFF) | (o << 16));
+        uint32_t hi = bits_shuffle((e >> 16) | (o & 0xFFFF0000));
+        uint8_t *p = digest + 8 * i;
+        p[0] = (uint8_t)lo;
+        p[1] = (uint8_t)(lo >> 8);
+        p[2] = (uint8_t)(lo >> 16);
+        p[3] = (uint8_t)(lo >> 24);
+        p[4] = (uint8_t)hi;
+        p[5] = (uint8_t)(hi >> 8);
+        p[6] = (uint8_t)(hi >> 16);
+        p[7] = (uint8_t)(hi >> 24);
+    }
+    memset(ctx, 0, sizeof(keccak256_ctx_t));
+}
+
+void keccak256(const uint8_t *data, size_t len, uint8_t digest[KECCAK256_DIGEST_LENGTH])
+{
+    keccak256_ctx_t ctx;
+    keccak256_init(&ctx);
+    keccak256_update(&ctx, data, len);
+    keccak256_final(&ctx, digest);
+}
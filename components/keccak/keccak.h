@@ -0,0 +1,49 @@
+#ifndef KECCAK_H
+#define KECCAK_H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define KECCAK256_DIGEST_LENGTH 32
+#define KECCAK256_BLOCK_LENGTH 136
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**********************
+     *      TYPEDEFS
+     **********************/
+    /**
+     * Keccak-256 (Ethereum flavour, 0x01 padding) hashing context.
+     * The state is kept bit-interleaved: each 64-bit lane is stored as two
+     * 32-bit words holding its even and odd bits, so every rotation in the
+     * permutation is a native 32-bit rotate.
+     */
+    typedef struct __attribute__((aligned(4)))
+    {
+        uint32_t state[50];
+        uint8_t buffer[KECCAK256_BLOCK_LENGTH];
+        size_t buffer_len;
+    } keccak256_ctx_t;
+
+    /**********************
+     * GLOBAL PROTOTYPES
+     **********************/
+    void keccak256_init(keccak256_ctx_t *ctx);
+    void keccak256_update(keccak256_ctx_t *ctx, const uint8_t *data, size_t len);
+    void keccak256_final(keccak256_ctx_t *ctx, uint8_t digest[KECCAK256_DIGEST_LENGTH]);
+    void keccak256(const uint8_t *data, size_t len, uint8_t digest[KECCAK256_DIGEST_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KECCAK_H */
@@ -0,0 +1,147 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "esp_timer.h"
+#include "keccak.h"
+#include "utility/trezor/sha3.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_KECCAK_MAX_LEN (2 * KECCAK256_BLOCK_LENGTH)
+#define TEST_KECCAK_BENCH_LEN 1024
+#define TEST_KECCAK_BENCH_ROUNDS 200
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *message;
+    const char *digest;
+} keccak_vector_t;
+
+typedef struct
+{
+    size_t len;
+    const char *digest;
+} keccak_block_vector_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const keccak_vector_t vectors[] = {
+    {"", "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470"},
+    {"abc", "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45"},
+    {"The quick brown fox jumps over the lazy dog", "4d741b6f1eb29cb2a9b9911c82f56fa8d73b04959d3d9d222895df6c0b28aa15"},
+    {"transfer(address,uint256)", "a9059cbb2ab09eb219583f4a59a5d0623ade346d962bcd4e46b11da047c9049b"},
+};
+
+/* messages of bytes 0, 1, 2, ... around the rate boundary */
+static const keccak_block_vector_t block_vectors[] = {
+    {KECCAK256_BLOCK_LENGTH - 1, "cbdfd9dee5faad3818d6b06f95a219fd290b0e1706f6a82e5a595b9ce9faca62"},
+    {KECCAK256_BLOCK_LENGTH, "7ce759f1ab7f9ce437719970c26b0a66ff11fe3e38e17df89cf5d29c7d7f807e"},
+    {KECCAK256_BLOCK_LENGTH + 1, "ac73d4fae68b8453f764007c1a20ce95994187861f0c3227a3a8e99a73a3b1db"},
+    {2 * KECCAK256_BLOCK_LENGTH, "fdf2ec49e749960d3c8521a0219af8d03e30e2b3bf19bd16150ee0eaf133d66e"},
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void unhex(const char *hex, uint8_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+}
+
+static void fill_counter(uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        data[i] = (uint8_t)i;
+    }
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("keccak256 known answers", "[keccak]")
+{
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++)
+    {
+        unhex(vectors[i].digest, expected, sizeof(expected));
+        keccak256((const uint8_t *)vectors[i].message, strlen(vectors[i].message), digest);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(expected));
+    }
+}
+
+TEST_CASE("keccak256 messages around the block length", "[keccak]")
+{
+    uint8_t data[TEST_KECCAK_MAX_LEN];
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+
+    fill_counter(data, sizeof(data));
+    for (size_t i = 0; i < sizeof(block_vectors) / sizeof(block_vectors[0]); i++)
+    {
+        unhex(block_vectors[i].digest, expected, sizeof(expected));
+        keccak256(data, block_vectors[i].len, digest);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(expected));
+    }
+}
+
+TEST_CASE("keccak256 streaming matches one-shot at every split", "[keccak]")
+{
+    uint8_t data[TEST_KECCAK_MAX_LEN + 1];
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    keccak256_ctx_t ctx;
+
+    fill_counter(data, sizeof(data));
+    keccak256(data, sizeof(data), expected);
+    for (size_t split = 0; split <= sizeof(data); split++)
+    {
+        keccak256_init(&ctx);
+        keccak256_update(&ctx, data, split);
+        keccak256_update(&ctx, data + split, sizeof(data) - split);
+        keccak256_final(&ctx, digest);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(expected));
+    }
+}
+
+/* timed against the trezor keccak_256 it replaced, the digests must match */
+TEST_CASE("keccak256 benchmark against trezor keccak_256", "[keccak][benchmark]")
+{
+    static uint8_t data[TEST_KECCAK_BENCH_LEN];
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+
+    fill_counter(data, sizeof(data));
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < TEST_KECCAK_BENCH_ROUNDS; i++)
+    {
+        keccak_256(data, sizeof(data), expected);
+    }
+    int64_t trezor_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < TEST_KECCAK_BENCH_ROUNDS; i++)
+    {
+        keccak256(data, sizeof(data), digest);
+    }
+    int64_t keccak_us = esp_timer_get_time() - start;
+
+    printf("keccak256 of %d bytes: %lld us, trezor keccak_256: %lld us\n", TEST_KECCAK_BENCH_LEN,
+           (long long)(keccak_us / TEST_KECCAK_BENCH_ROUNDS), (long long)(trezor_us / TEST_KECCAK_BENCH_ROUNDS));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(expected));
+}
@@ -401,6 +401,7 @@ extern "C"
         uint8_t *hex_address = (uint8_t *)malloc(address_max_len);
         decode_base64url(address_base64.c_str(), hex_address, address_max_len);
         std::string address = "0x" + toHex(hex_address, 20);
+        memcpy(request->address_bin, hex_address, 20);
         free(hex_address);
 
         const cJSON *derivation_path_doc = cJSON_GetObjectItemCaseSensitive(json, KEY_DERIVATION_PATH);
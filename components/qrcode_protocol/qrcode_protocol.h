@@ -42,6 +42,7 @@ extern "C"
         uint64_t chain_id;
         char *derivation_path;
         char *address;
+        uint8_t address_bin[20];
     } metamask_sign_request_t;
 
     typedef enum
@@ -98,14 +98,24 @@ size_t int_to_bytes(size_t input, uint8_t resultArray[5])
     return i;
 }
 
-void rlp_decode(uint8_t *input, size_t input_len, struct RLP_ITEM *item)
+/*
+    Parses the item header, checks that the item fits in the input and is
+    encoded canonically (shortest form), as anything else is rejected by the network.
+ */
+static int rlp_read_header(const uint8_t *input, size_t input_len, struct RLP_ITEM *item)
 {
+    if (input_len == 0)
+    {
+        return RLP_ERR_END;
+    }
     uint8_t first_byte = input[0];
+    size_t len_of_len = 0;
 
     if (first_byte <= 0x7f)
     {
+        // the byte is its own content
         item->type = RLP_ITEM_BYTES;
-        item->content_offset = 1;
+        item->content_offset = 0;
         item->content_len = 1;
     }
     else if (first_byte <= 0xb7)
@@ -113,20 +123,15 @@ void rlp_decode(uint8_t *input, size_t input_len, struct RLP_ITEM *item)
         item->type = RLP_ITEM_BYTES;
         item->content_offset = 1;
         item->content_len = first_byte - 0x80;
+        if (item->content_len == 1 && (input_len < 2 || input[1] <= 0x7f))
+        {
+            return RLP_ERR_INVALID;
+        }
     }
-    // else if (first_byte <= 0xc0)
-    // {
-    //     item->type = RLP_ITEM_BYTES;
-    //     size_t content_arr_len = first_byte - 0xb7;
-    //     item->content_offset = 1 + content_arr_len;
-    //     item->content_len = bytes_to_int(input + 1, content_arr_len);
-    // }
     else if (first_byte <= 0xbf)
     {
         item->type = RLP_ITEM_BYTES;
-        size_t content_arr_len = first_byte - 0xb7;
-        item->content_offset = 1 + content_arr_len;
-        item->content_len = bytes_to_int(input + 1, content_arr_len);
+        len_of_len = first_byte - 0xb7;
     }
     else if (first_byte <= 0xf7)
     {
@@ -137,19 +142,88 @@ void rlp_decode(uint8_t *input, size_t input_len, struct RLP_ITEM *item)
     else
     {
         item->type = RLP_ITEM_LIST;
-        size_t content_arr_len = first_byte - 0xf7;
-        item->content_offset = 1 + content_arr_len;
-        item->content_len = bytes_to_int(input + 1, content_arr_len);
+        len_of_len = first_byte - 0xf7;
+    }
+
+    if (len_of_len > 0)
+    {
+        // long form: no leading zeros and only for lengths that don't fit the short one
+        if (len_of_len > sizeof(size_t) || input_len < 1 + len_of_len || input[1] == 0)
+        {
+            return RLP_ERR_INVALID;
+        }
+        item->content_offset = 1 + len_of_len;
+        item->content_len = bytes_to_int(input + 1, len_of_len);
+        if (item->content_len < 56)
+        {
+            return RLP_ERR_INVALID;
+        }
     }
 
-    item->content = input + item->content_offset;
+    if (item->content_offset > input_len || item->content_len > input_len - item->content_offset)
+    {
+        return RLP_ERR_INVALID;
+    }
+    item->content = (uint8_t *)input + item->content_offset;
+    return RLP_OK;
+}
 
-    if (input_len < (item->content_offset + item->content_len))
+void rlp_decode(uint8_t *input, size_t input_len, struct RLP_ITEM *item)
+{
+    if (rlp_read_header(input, input_len, item) != RLP_OK)
     {
         item->type = RLP_ITEM_NULL;
     }
 }
 
+void rlp_cursor_init(struct RLP_CURSOR *cursor, uint8_t *input, size_t input_len)
+{
+    cursor->ptr = input;
+    cursor->len = (input == NULL) ? 0 : input_len;
+}
+
+int rlp_cursor_end(const struct RLP_CURSOR *cursor)
+{
+    return cursor->len == 0;
+}
+
+int rlp_next(struct RLP_CURSOR *cursor, struct RLP_ITEM *item)
+{
+    int err = rlp_read_header(cursor->ptr, cursor->len, item);
+    if (err != RLP_OK)
+    {
+        return err;
+    }
+    size_t item_len = item->content_offset + item->content_len;
+    cursor->ptr += item_len;
+    cursor->len -= item_len;
+    return RLP_OK;
+}
+
+int rlp_enter_list(struct RLP_CURSOR *cursor, struct RLP_CURSOR *list)
+{
+    struct RLP_CURSOR next = *cursor;
+    struct RLP_ITEM item;
+    int err = rlp_next(&next, &item);
+    if (err != RLP_OK)
+    {
+        return err;
+    }
+    if (item.type != RLP_ITEM_LIST)
+    {
+        return RLP_ERR_TYPE;
+    }
+    *cursor = next;
+    rlp_cursor_init(list, item.content, item.content_len);
+    return RLP_OK;
+}
+
+int rlp_skip(struct RLP_CURSOR *cursor)
+{
+    struct RLP_ITEM item;
+    return rlp_next(cursor, &item);
+}
+
 #define __RLP_ENCODE_ARRAY_LEN_CHECK \
     do                               \
     {                                \
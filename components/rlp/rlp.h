@@ -15,6 +15,14 @@
 #define RLP_ITEM_LIST 1
 #define RLP_ITEM_BYTES 2
 
+#define RLP_OK 0
+/* no more items in the cursor */
+#define RLP_ERR_END -1
+/* malformed or non-canonical encoding, or the item doesn't fit the input */
+#define RLP_ERR_INVALID -2
+/* rlp_enter_list() found bytes instead of a list */
+#define RLP_ERR_TYPE -3
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -45,12 +53,32 @@ extern "C"
         size_t content_offset;
     };
 
+    /*
+        Position in an RLP encoded buffer, items are read in place without copies
+     */
+    struct RLP_CURSOR
+    {
+        uint8_t *ptr;
+        /* bytes left */
+        size_t len;
+    };
+
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
 
     void rlp_decode(uint8_t *input, size_t input_len, struct RLP_ITEM *item);
 
+    void rlp_cursor_init(struct RLP_CURSOR *cursor, uint8_t *input, size_t input_len);
+    /* returns 1 if all items have been read */
+    int rlp_cursor_end(const struct RLP_CURSOR *cursor);
+    /* reads the next item into `item` and moves past it, returns RLP_OK or RLP_ERR_* */
+    int rlp_next(struct RLP_CURSOR *cursor, struct RLP_ITEM *item);
+    /* reads the next item, which has to be a list, `list` is set to iterate over its items */
+    int rlp_enter_list(struct RLP_CURSOR *cursor, struct RLP_CURSOR *list);
+    /* moves past the next item without looking into it */
+    int rlp_skip(struct RLP_CURSOR *cursor);
+
     int rlp_encode_array(uint8_t *buf, size_t buf_len, struct RLP_ITEM **item_array, size_t item_array_size);
 
 #ifdef __cplusplus
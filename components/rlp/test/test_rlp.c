@@ -0,0 +1,196 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "rlp.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *hex;
+    const char *reason;
+} rlp_invalid_vector_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const rlp_invalid_vector_t invalid_vectors[] = {
+    {"8100", "single byte below 0x80 encoded with 0x81"},
+    {"817f", "single byte below 0x80 encoded with 0x81"},
+    {"b80564646f6764", "long form string shorter than 56 bytes"},
+    {"f80583646f6700", "long form list shorter than 56 bytes"},
+    {"b9003800", "length with a leading zero"},
+    {"bfffffffffffffffff00", "length of length larger than the input"},
+    {"bc0100000000", "length of length larger than size_t on 32-bit targets"},
+    {"b838", "long string without content"},
+    {"83646f", "string longer than the input"},
+    {"c583646f67", "list longer than the input"},
+    {"b8", "length of length without the length"},
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static size_t unhex(const char *hex, uint8_t *out)
+{
+    size_t len = strlen(hex) / 2;
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+    return len;
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("rlp decode short items", "[rlp]")
+{
+    uint8_t buf[8];
+    struct RLP_ITEM item;
+
+    /* a single byte below 0x80 is its own content */
+    size_t len = unhex("7f", buf);
+    rlp_decode(buf, len, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_size_t(0, item.content_offset);
+    TEST_ASSERT_EQUAL_size_t(1, item.content_len);
+    TEST_ASSERT_TRUE(item.content == buf);
+
+    len = unhex("8180", buf);
+    rlp_decode(buf, len, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_size_t(1, item.content_offset);
+    TEST_ASSERT_EQUAL_size_t(1, item.content_len);
+    TEST_ASSERT_EQUAL_HEX8(0x80, item.content[0]);
+
+    len = unhex("83646f67", buf);
+    rlp_decode(buf, len, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_size_t(3, item.content_len);
+    TEST_ASSERT_EQUAL_MEMORY("dog", item.content, 3);
+
+    len = unhex("80", buf);
+    rlp_decode(buf, len, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_size_t(0, item.content_len);
+
+    len = unhex("c0", buf);
+    rlp_decode(buf, len, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_LIST, item.type);
+    TEST_ASSERT_EQUAL_size_t(0, item.content_len);
+}
+
+TEST_CASE("rlp decode long items", "[rlp]")
+{
+    uint8_t buf[2 + 56];
+    struct RLP_ITEM item;
+
+    /* 56 bytes is the shortest long form */
+    buf[0] = 0xb8;
+    buf[1] = 56;
+    memset(buf + 2, 'a', 56);
+    rlp_decode(buf, sizeof(buf), &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_size_t(2, item.content_offset);
+    TEST_ASSERT_EQUAL_size_t(56, item.content_len);
+
+    buf[0] = 0xf8;
+    for (size_t i = 2; i < sizeof(buf); i++)
+    {
+        buf[i] = 0x01;
+    }
+    rlp_decode(buf, sizeof(buf), &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_LIST, item.type);
+    TEST_ASSERT_EQUAL_size_t(56, item.content_len);
+
+    /* one byte short */
+    rlp_decode(buf, sizeof(buf) - 1, &item);
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_NULL, item.type);
+}
+
+TEST_CASE("rlp rejects non-canonical and oversized items", "[rlp]")
+{
+    uint8_t buf[16];
+    struct RLP_ITEM item;
+    struct RLP_CURSOR cursor;
+
+    for (size_t i = 0; i < sizeof(invalid_vectors) / sizeof(invalid_vectors[0]); i++)
+    {
+        size_t len = unhex(invalid_vectors[i].hex, buf);
+        rlp_decode(buf, len, &item);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(RLP_ITEM_NULL, item.type, invalid_vectors[i].reason);
+
+        rlp_cursor_init(&cursor, buf, len);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(RLP_ERR_INVALID, rlp_next(&cursor, &item), invalid_vectors[i].reason);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(RLP_ERR_INVALID, rlp_skip(&cursor), invalid_vectors[i].reason);
+        /* the cursor doesn't move on errors */
+        TEST_ASSERT_TRUE(cursor.ptr == buf);
+        TEST_ASSERT_EQUAL_size_t(len, cursor.len);
+    }
+}
+
+TEST_CASE("rlp cursor walks nested lists", "[rlp]")
+{
+    /* [[1, 2], [3, [4]], "abc"] */
+    uint8_t buf[32];
+    size_t len = unhex("cbc20102c303c10483616263", buf);
+    struct RLP_CURSOR cursor, list, inner, innermost;
+    struct RLP_ITEM item;
+
+    rlp_cursor_init(&cursor, buf, len);
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_enter_list(&cursor, &list));
+    TEST_ASSERT_TRUE(rlp_cursor_end(&cursor));
+
+    /* skip [1, 2] as a whole */
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_skip(&list));
+
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_enter_list(&list, &inner));
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_next(&inner, &item));
+    TEST_ASSERT_EQUAL_INT(RLP_ITEM_BYTES, item.type);
+    TEST_ASSERT_EQUAL_HEX8(0x03, item.content[0]);
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_enter_list(&inner, &innermost));
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_next(&innermost, &item));
+    TEST_ASSERT_EQUAL_HEX8(0x04, item.content[0]);
+    TEST_ASSERT_EQUAL_INT(RLP_ERR_END, rlp_next(&innermost, &item));
+    TEST_ASSERT_TRUE(rlp_cursor_end(&inner));
+
+    /* "abc" is not a list */
+    TEST_ASSERT_EQUAL_INT(RLP_ERR_TYPE, rlp_enter_list(&list, &inner));
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_next(&list, &item));
+    TEST_ASSERT_EQUAL_size_t(3, item.content_len);
+    TEST_ASSERT_EQUAL_MEMORY("abc", item.content, 3);
+    TEST_ASSERT_TRUE(rlp_cursor_end(&list));
+    TEST_ASSERT_EQUAL_INT(RLP_ERR_END, rlp_skip(&list));
+
+    /* the inner list claims more than the outer one holds */
+    len = unhex("c3c30102", buf);
+    rlp_cursor_init(&cursor, buf, len);
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_enter_list(&cursor, &list));
+    TEST_ASSERT_EQUAL_INT(RLP_ERR_INVALID, rlp_enter_list(&list, &inner));
+    len = unhex("c2c301020304", buf);
+    rlp_cursor_init(&cursor, buf, len);
+    TEST_ASSERT_EQUAL_INT(RLP_OK, rlp_enter_list(&cursor, &list));
+    TEST_ASSERT_EQUAL_INT(RLP_ERR_INVALID, rlp_skip(&list));
+}
+
+TEST_CASE("rlp encode a list", "[rlp]")
+{
+    uint8_t cat[] = {'c', 'a', 't'};
+    uint8_t dog[] = {'d', 'o', 'g'};
+    struct RLP_ITEM a = {RLP_ITEM_BYTES, cat, sizeof(cat), 0};
+    struct RLP_ITEM b = {RLP_ITEM_BYTES, dog, sizeof(dog), 0};
+    struct RLP_ITEM *items[] = {&a, &b};
+    uint8_t expected[16];
+    uint8_t out[16];
+    size_t len = unhex("c88363617483646f67", expected);
+
+    TEST_ASSERT_EQUAL_INT((int)len, rlp_encode_array(out, sizeof(out), items, 2));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, out, len);
+}
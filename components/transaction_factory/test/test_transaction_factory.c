@@ -0,0 +1,159 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "keccak.h"
+#include "transaction_factory.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_TX_MAX_LEN 512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *hex;
+    uint8_t type;
+    const char *chain_id;
+} tx_vector_t;
+
+typedef struct
+{
+    const char *hex;
+} tx_invalid_vector_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const tx_vector_t valid_vectors[] = {
+    /* legacy with the EIP-155 chain id */
+    {"ec098504a817c80082520894d8da6bf26964af9d7eed9e03e53415d37aa96045880de0b6b3a764000080018080",
+     TRANSACTION_TYPE_LEGACY, "01"},
+    /* EIP-2930 with an access list */
+    {"01f8988189058506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960450180f872f85994d8da6bf2"
+     "6964af9d7eed9e03e53415d37aa96045f842a01111111111111111111111111111111111111111111111111111111111"
+     "111111a02222222222222222222222222222222222222222222222222222222222222222d69433333333333333333333"
+     "33333333333333333333c0",
+     TRANSACTION_TYPE_ACCESS_LIST_EIP2930, "89"},
+    /* EIP-1559 with data and an access list */
+    {"02f901030105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa96045823039b86400"
+     "0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f30"
+     "3132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f60"
+     "616263f872f85994d8da6bf26964af9d7eed9e03e53415d37aa96045f842a01111111111111111111111111111111111"
+     "111111111111111111111111111111a02222222222222222222222222222222222222222222222222222222222222222"
+     "d6943333333333333333333333333333333333333333c0",
+     TRANSACTION_TYPE_FEE_MARKET_EIP1559, "01"},
+    /* EIP-4844 with two blob hashes */
+    {"03f86e0105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c007f842a0"
+     "0100000000000000000000000000000000000000000000000000000000000000a0011111111111111111111111111111"
+     "1111111111111111111111111111111111",
+     TRANSACTION_TYPE_BLOB_EIP4844, "01"},
+    /* EIP-7702 with one authorization */
+    {"04f8870105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c0f85cf85a"
+     "0194d8da6bf26964af9d7eed9e03e53415d37aa960450301a04444444444444444444444444444444444444444444444"
+     "444444444444444444a05555555555555555555555555555555555555555555555555555555555555555",
+     TRANSACTION_TYPE_EOA_CODE_EIP7702, "01"},
+};
+
+static const tx_invalid_vector_t invalid_vectors[] = {
+    /* legacy without the EIP-155 chain id */
+    {"e9098504a817c80082520894d8da6bf26964af9d7eed9e03e53415d37aa96045880de0b6b3a764000080"},
+    /* single byte chain id encoded with 0x81 */
+    {"02ea018105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c0"},
+    /* nonce with a leading zero */
+    {"02eb01820005843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c0"},
+    /* trailing byte after the fields */
+    {"02e90105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c000"},
+    /* extra field */
+    {"02ea0105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa960458080c001"},
+    /* truncated payload */
+    {"02f88e0105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa9604580b86400010203"
+     "0405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f30313233"
+     "3435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f50"},
+    /* access list encoded as bytes */
+    {"02e90105843b9aca008506fc23ac00830186a094d8da6bf26964af9d7eed9e03e53415d37aa96045808080"},
+    /* unknown transaction type */
+    {"05c101"},
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static size_t unhex(const char *hex, uint8_t *out)
+{
+    size_t len = strlen(hex) / 2;
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte = 0;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = (uint8_t)byte;
+    }
+    return len;
+}
+
+/**********************
+ *   TEST CASES
+ **********************/
+TEST_CASE("transaction digest of every type", "[transaction_factory]")
+{
+    uint8_t tx[TEST_TX_MAX_LEN];
+    uint8_t chain_id[8];
+    uint8_t expected[KECCAK256_DIGEST_LENGTH];
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    transaction_data_t data;
+
+    for (size_t i = 0; i < sizeof(valid_vectors) / sizeof(valid_vectors[0]); i++)
+    {
+        const tx_vector_t *v = &valid_vectors[i];
+        size_t len = unhex(v->hex, tx);
+        size_t chain_id_len = unhex(v->chain_id, chain_id);
+
+        /* the streamed digest covers the whole payload, type byte included */
+        keccak256(tx, len, expected);
+        transaction_factory_init_digest(&data, tx, len, digest);
+        TEST_ASSERT_EQUAL_INT(0, data.error);
+        TEST_ASSERT_EQUAL_UINT8(v->type, data.transactionType);
+        TEST_ASSERT_EQUAL_size_t(chain_id_len, data.chainIdLen);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(chain_id, data.chainId, chain_id_len);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, digest, sizeof(digest));
+        transaction_factory_free(&data);
+
+        /* same fields without the digest */
+        transaction_factory_init(&data, tx, len);
+        TEST_ASSERT_EQUAL_INT(0, data.error);
+        TEST_ASSERT_EQUAL_UINT8(v->type, data.transactionType);
+        transaction_factory_free(&data);
+    }
+}
+
+TEST_CASE("transaction digest of invalid transactions", "[transaction_factory]")
+{
+    uint8_t tx[TEST_TX_MAX_LEN];
+    uint8_t zero[KECCAK256_DIGEST_LENGTH] = {0};
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    transaction_data_t data;
+
+    for (size_t i = 0; i < sizeof(invalid_vectors) / sizeof(invalid_vectors[0]); i++)
+    {
+        size_t len = unhex(invalid_vectors[i].hex, tx);
+        memset(digest, 0xaa, sizeof(digest));
+        transaction_factory_init_digest(&data, tx, len, digest);
+        TEST_ASSERT_NOT_EQUAL(0, data.error);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(zero, digest, sizeof(digest));
+        transaction_factory_free(&data);
+    }
+
+    /* every prefix of a valid transaction is rejected */
+    size_t len = unhex(valid_vectors[2].hex, tx);
+    for (size_t l = 0; l < len; l++)
+    {
+        transaction_factory_init_digest(&data, tx, l, digest);
+        TEST_ASSERT_NOT_EQUAL(0, data.error);
+        transaction_factory_free(&data);
+    }
+}
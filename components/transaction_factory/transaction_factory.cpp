@@ -2,17 +2,38 @@
  *      INCLUDES
  *********************/
 #include "transaction_factory.h"
-#include "Conversion.h"
 #include "rlp.h"
-#include <string>
-#include "utility/trezor/bignum.h"
+#include "calldata.h"
+#include "amount.h"
+#include "evm_chains.h"
+#include "keccak.h"
 #include "esp_log.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /*********************
  *      DEFINES
  *********************/
 #define TAG "transaction_factory"
+/* longer descriptions of batches are truncated */
+#define TRANSACTION_CALL_DESCRIPTION_LEN 1024
+/* all lines of transaction_factory_to_string() except the call, the data and the lists */
+#define TRANSACTION_FIELDS_TEXT_LEN 1536
+/* list lines per byte of the encoded list, an entry is never shorter than a quarter of its line */
+#define TRANSACTION_LIST_TEXT_RATIO 4
+/* EIP-4844 blob gas used by each blob */
+#define TRANSACTION_GAS_PER_BLOB 131072
+
+/* field kinds of the transaction schemas */
+#define TX_FIELD_INT 0         // big-endian integer up to 256 bits, no leading zeros
+#define TX_FIELD_ADDRESS 1     // 20 bytes or empty for contract creation
+#define TX_FIELD_DESTINATION 2 // 20 bytes
+#define TX_FIELD_BYTES 3
+#define TX_FIELD_LIST 4
+#define TX_FIELD_EMPTY 5 // EIP-155 placeholder for r and s, not stored
+#define TX_FIELD_CHAIN_ID 6 // integer up to 2^63 - 1, shown and looked up as a number
 
 /**********************
  *      MACROS
@@ -27,39 +48,344 @@
         hex_name[byteArrayLength * 2] = '\0';                \
     } while (0)
 
-#define BUFFER_TO_BIGNUMBER(input, inputLen, output)     \
-    do                                                   \
-    {                                                    \
-        uint8_t temp[32] = {0};                          \
-        memcpy(temp + (32 - inputLen), input, inputLen); \
-        bn_read_be(temp, output);                        \
-    } while (0)
+#define TX_FIELD(field, kind) {#field, offsetof(transaction_data_t, field), offsetof(transaction_data_t, field##Len), kind}
+#define TX_FIELD_PLACEHOLDER(name) {name, 0, 0, TX_FIELD_EMPTY}
+#define TX_SCHEMA(type, fields) {type, fields, sizeof(fields) / sizeof(fields[0])}
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    const char *name;
+    size_t data_offset;
+    size_t len_offset;
+    uint8_t kind;
+} transaction_field_t;
+
+/* keccak256 of the sign data, fed up to the end of each field as the cursor passes it */
+typedef struct
+{
+    keccak256_ctx_t ctx;
+    const uint8_t *pos;
+} transaction_hasher_t;
+
+typedef struct
+{
+    uint8_t transactionType;
+    const transaction_field_t *fields;
+    size_t fields_len;
+} transaction_schema_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* the EIP-155 tail is required, without a chain id the signature is valid on every chain */
+static const transaction_field_t legacy_fields[] = {
+    TX_FIELD(nonce, TX_FIELD_INT),
+    TX_FIELD(gasPrice, TX_FIELD_INT),
+    TX_FIELD(gasLimit, TX_FIELD_INT),
+    TX_FIELD(to, TX_FIELD_ADDRESS),
+    TX_FIELD(value, TX_FIELD_INT),
+    TX_FIELD(data, TX_FIELD_BYTES),
+    TX_FIELD(chainId, TX_FIELD_CHAIN_ID),
+    TX_FIELD_PLACEHOLDER("r"),
+    TX_FIELD_PLACEHOLDER("s"),
+};
+
+static const transaction_field_t eip2930_fields[] = {
+    TX_FIELD(chainId, TX_FIELD_CHAIN_ID),
+    TX_FIELD(nonce, TX_FIELD_INT),
+    TX_FIELD(gasPrice, TX_FIELD_INT),
+    TX_FIELD(gasLimit, TX_FIELD_INT),
+    TX_FIELD(to, TX_FIELD_ADDRESS),
+    TX_FIELD(value, TX_FIELD_INT),
+    TX_FIELD(data, TX_FIELD_BYTES),
+    TX_FIELD(accessList, TX_FIELD_LIST),
+};
+
+static const transaction_field_t eip1559_fields[] = {
+    TX_FIELD(chainId, TX_FIELD_CHAIN_ID),
+    TX_FIELD(nonce, TX_FIELD_INT),
+    TX_FIELD(maxPriorityFeePerGas, TX_FIELD_INT),
+    TX_FIELD(maxFeePerGas, TX_FIELD_INT),
+    TX_FIELD(gasLimit, TX_FIELD_INT),
+    TX_FIELD(to, TX_FIELD_ADDRESS),
+    TX_FIELD(value, TX_FIELD_INT),
+    TX_FIELD(data, TX_FIELD_BYTES),
+    TX_FIELD(accessList, TX_FIELD_LIST),
+};
+
+static const transaction_field_t eip4844_fields[] = {
+    TX_FIELD(chainId, TX_FIELD_CHAIN_ID),
+    TX_FIELD(nonce, TX_FIELD_INT),
+    TX_FIELD(maxPriorityFeePerGas, TX_FIELD_INT),
+    TX_FIELD(maxFeePerGas, TX_FIELD_INT),
+    TX_FIELD(gasLimit, TX_FIELD_INT),
+    TX_FIELD(to, TX_FIELD_DESTINATION),
+    TX_FIELD(value, TX_FIELD_INT),
+    TX_FIELD(data, TX_FIELD_BYTES),
+    TX_FIELD(accessList, TX_FIELD_LIST),
+    TX_FIELD(maxFeePerBlobGas, TX_FIELD_INT),
+    TX_FIELD(blobVersionedHashes, TX_FIELD_LIST),
+};
+
+static const transaction_field_t eip7702_fields[] = {
+    TX_FIELD(chainId, TX_FIELD_CHAIN_ID),
+    TX_FIELD(nonce, TX_FIELD_INT),
+    TX_FIELD(maxPriorityFeePerGas, TX_FIELD_INT),
+    TX_FIELD(maxFeePerGas, TX_FIELD_INT),
+    TX_FIELD(gasLimit, TX_FIELD_INT),
+    TX_FIELD(to, TX_FIELD_DESTINATION),
+    TX_FIELD(value, TX_FIELD_INT),
+    TX_FIELD(data, TX_FIELD_BYTES),
+    TX_FIELD(accessList, TX_FIELD_LIST),
+    TX_FIELD(authorizationList, TX_FIELD_LIST),
+};
+
+static const transaction_schema_t transaction_schemas[] = {
+    TX_SCHEMA(TRANSACTION_TYPE_LEGACY, legacy_fields),
+    TX_SCHEMA(TRANSACTION_TYPE_ACCESS_LIST_EIP2930, eip2930_fields),
+    TX_SCHEMA(TRANSACTION_TYPE_FEE_MARKET_EIP1559, eip1559_fields),
+    TX_SCHEMA(TRANSACTION_TYPE_BLOB_EIP4844, eip4844_fields),
+    TX_SCHEMA(TRANSACTION_TYPE_EOA_CODE_EIP7702, eip7702_fields),
+};
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-uint64_t to_uint64_t(uint8_t *input, size_t input_size);
-bignum256 to_bignum256(uint8_t *input, size_t input_size);
-std::string to_hex_string(uint8_t *input, size_t input_size);
+static bool transaction_field_valid(const transaction_field_t *field, const struct RLP_ITEM *item);
+static int transaction_schema_parse(const transaction_schema_t *schema, transaction_data_t *transaction_data, uint8_t *payload, size_t payload_len, transaction_hasher_t *hasher);
+static void transaction_hasher_absorb(transaction_hasher_t *hasher, const uint8_t *end);
+static void transaction_parse(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len, transaction_hasher_t *hasher);
+static uint64_t to_uint64_t(const uint8_t *input, size_t input_size);
+static void writer_amount(amount_writer_t *writer, const char *name, const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit);
+static void writer_hex(amount_writer_t *writer, const uint8_t *bytes, size_t bytes_len);
+static void writer_access_list(amount_writer_t *writer, uint8_t *list, size_t list_len);
+static void writer_authorization_list(amount_writer_t *writer, uint8_t *list, size_t list_len);
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-uint64_t to_uint64_t(uint8_t *input, size_t input_size)
+static bool transaction_field_valid(const transaction_field_t *field, const struct RLP_ITEM *item)
+{
+    if (field->kind == TX_FIELD_LIST)
+    {
+        return item->type == RLP_ITEM_LIST;
+    }
+    if (item->type != RLP_ITEM_BYTES)
+    {
+        return false;
+    }
+    switch (field->kind)
+    {
+    case TX_FIELD_INT:
+        return item->content_len <= 32 && (item->content_len == 0 || item->content[0] != 0);
+    case TX_FIELD_CHAIN_ID:
+        return item->content_len <= 8 && (item->content_len == 0 || item->content[0] != 0) &&
+               (item->content_len < 8 || item->content[0] < 0x80);
+    case TX_FIELD_ADDRESS:
+        return item->content_len == 0 || item->content_len == 20;
+    case TX_FIELD_DESTINATION:
+        return item->content_len == 20;
+    case TX_FIELD_EMPTY:
+        return item->content_len == 0;
+    default:
+        return true;
+    }
+}
+
+/* fills the fields of the schema with views into the payload, returns the error code */
+static int transaction_schema_parse(const transaction_schema_t *schema, transaction_data_t *transaction_data, uint8_t *payload, size_t payload_len, transaction_hasher_t *hasher)
+{
+    struct RLP_CURSOR cursor;
+    struct RLP_CURSOR fields;
+    struct RLP_ITEM item;
+
+    rlp_cursor_init(&cursor, payload, payload_len);
+    if (rlp_enter_list(&cursor, &fields) != RLP_OK || !rlp_cursor_end(&cursor))
+    {
+        ESP_LOGE(TAG, "Invalid RLP encoded data 1");
+        return 1;
+    }
+    for (size_t i = 0; i < schema->fields_len; i++)
+    {
+        const transaction_field_t *field = &schema->fields[i];
+        if (rlp_cursor_end(&fields))
+        {
+            ESP_LOGE(TAG, "Missing %s", field->name);
+            return 2;
+        }
+        if (rlp_next(&fields, &item) != RLP_OK)
+        {
+            ESP_LOGE(TAG, "Invalid RLP encoded data 2 at index:%zu", i);
+            return 2;
+        }
+        // the field is still in cache, hash it before moving on
+        transaction_hasher_absorb(hasher, fields.ptr);
+        if (!transaction_field_valid(field, &item))
+        {
+            ESP_LOGE(TAG, "Invalid %s", field->name);
+            return 3;
+        }
+        if (field->kind != TX_FIELD_EMPTY)
+        {
+            *(uint8_t **)((uint8_t *)transaction_data + field->data_offset) = item.content;
+            *(size_t *)((uint8_t *)transaction_data + field->len_offset) = item.content_len;
+        }
+    }
+    if (!rlp_cursor_end(&fields))
+    {
+        ESP_LOGE(TAG, "Invalid RLP encoded data 2: too many items");
+        return 2;
+    }
+    transaction_hasher_absorb(hasher, payload + payload_len);
+    return 0;
+}
+
+static void transaction_hasher_absorb(transaction_hasher_t *hasher, const uint8_t *end)
+{
+    if (hasher != NULL && end > hasher->pos)
+    {
+        keccak256_update(&hasher->ctx, hasher->pos, (size_t)(end - hasher->pos));
+        hasher->pos = end;
+    }
+}
+
+static void transaction_parse(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len, transaction_hasher_t *hasher)
+{
+    memset(transaction_data, 0, sizeof(transaction_data_t));
+    if (sign_data == NULL || sign_data_len == 0)
+    {
+        transaction_data->error = 1;
+        return;
+    }
+
+    uint8_t *payload = (uint8_t *)sign_data;
+    size_t payload_len = sign_data_len;
+    uint8_t transactionType = TRANSACTION_TYPE_LEGACY;
+    if (sign_data[0] <= 0x7f)
+    {
+        // Ethereum Transaction Type
+        transactionType = sign_data[0];
+        payload++;
+        payload_len--;
+    }
+
+    const transaction_schema_t *schema = NULL;
+    for (size_t i = 0; i < sizeof(transaction_schemas) / sizeof(transaction_schemas[0]); i++)
+    {
+        if (transaction_schemas[i].transactionType == transactionType)
+        {
+            schema = &transaction_schemas[i];
+            break;
+        }
+    }
+    if (schema == NULL || (transactionType == TRANSACTION_TYPE_LEGACY && payload != sign_data))
+    {
+        ESP_LOGE(TAG, "Unknown transaction type");
+        transaction_data->error = 1;
+        return;
+    }
+
+    int error = transaction_schema_parse(schema, transaction_data, payload, payload_len, hasher);
+    if (error != 0)
+    {
+        memset(transaction_data, 0, sizeof(transaction_data_t));
+        transaction_data->error = error;
+        return;
+    }
+    transaction_data->rlp_encoded = (uint8_t *)sign_data;
+    transaction_data->rlp_encoded_len = sign_data_len;
+    transaction_data->transactionType = transactionType;
+}
+
+static uint64_t to_uint64_t(const uint8_t *input, size_t input_size)
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < input_size; i++)
+    {
+        result = (result << 8) | input[i];
+    }
+    return result;
+}
+
+/* "name: amount unit\n" */
+static void writer_amount(amount_writer_t *writer, const char *name, const uint8_t *value, size_t value_len, unsigned int decimals, const char *unit)
 {
-    bignum256 _data = to_bignum256(input, input_size);
-    return bn_write_uint64(&_data);
+    amount_writer_printf(writer, "%s: ", name);
+    amount_writer_format(writer, value, value_len, decimals, unit);
+    amount_writer_printf(writer, "\n");
 }
-bignum256 to_bignum256(uint8_t *input, size_t input_size)
+
+static void writer_hex(amount_writer_t *writer, const uint8_t *bytes, size_t bytes_len)
 {
-    bignum256 _data;
-    BUFFER_TO_BIGNUMBER(input, input_size, &_data);
-    return _data;
+    amount_writer_printf(writer, "0x");
+    for (size_t i = 0; i < bytes_len; i++)
+    {
+        amount_writer_printf(writer, "%02x", bytes[i]);
+    }
 }
-std::string to_hex_string(uint8_t *input, size_t input_size)
+
+/* entries are [address, [storageKey, ...]], one line per address */
+static void writer_access_list(amount_writer_t *writer, uint8_t *list, size_t list_len)
 {
-    std::string _data = toHex(input, input_size);
-    return _data;
+    struct RLP_CURSOR cursor;
+    struct RLP_CURSOR entry;
+    struct RLP_CURSOR keys;
+    struct RLP_ITEM address;
+
+    amount_writer_printf(writer, "accessList: %zu entries\n", transaction_factory_list_count(list, list_len));
+    rlp_cursor_init(&cursor, list, list_len);
+    while (!rlp_cursor_end(&cursor))
+    {
+        if (rlp_enter_list(&cursor, &entry) != RLP_OK ||
+            rlp_next(&entry, &address) != RLP_OK || address.type != RLP_ITEM_BYTES || address.content_len != 20 ||
+            rlp_enter_list(&entry, &keys) != RLP_OK || !rlp_cursor_end(&entry))
+        {
+            amount_writer_printf(writer, "  invalid entry\n");
+            return;
+        }
+        amount_writer_printf(writer, "  ");
+        writer_hex(writer, address.content, address.content_len);
+        amount_writer_printf(writer, ": %zu storage keys\n", transaction_factory_list_count(keys.ptr, keys.len));
+    }
+}
+
+/* EIP-7702 entries are [chainId, address, nonce, yParity, r, s], the signature is not shown */
+static void writer_authorization_list(amount_writer_t *writer, uint8_t *list, size_t list_len)
+{
+    struct RLP_CURSOR cursor;
+    struct RLP_CURSOR entry;
+    struct RLP_ITEM chain_id;
+    struct RLP_ITEM address;
+    struct RLP_ITEM nonce;
+
+    amount_writer_printf(writer, "authorizationList: %zu entries\n", transaction_factory_list_count(list, list_len));
+    rlp_cursor_init(&cursor, list, list_len);
+    for (size_t i = 1; !rlp_cursor_end(&cursor); i++)
+    {
+        if (rlp_enter_list(&cursor, &entry) != RLP_OK ||
+            rlp_next(&entry, &chain_id) != RLP_OK || chain_id.type != RLP_ITEM_BYTES || chain_id.content_len > 32 ||
+            rlp_next(&entry, &address) != RLP_OK || address.type != RLP_ITEM_BYTES || address.content_len != 20 ||
+            rlp_next(&entry, &nonce) != RLP_OK || nonce.type != RLP_ITEM_BYTES || nonce.content_len > 8)
+        {
+            amount_writer_printf(writer, "  invalid entry\n");
+            return;
+        }
+        amount_writer_printf(writer, "  #%zu chainId: ", i);
+        amount_writer_format(writer, chain_id.content, chain_id.content_len, 0, NULL);
+        if (chain_id.content_len == 0)
+        {
+            // the delegation can be replayed on every chain
+            amount_writer_printf(writer, " (any chain)");
+        }
+        amount_writer_printf(writer, ", address: ");
+        writer_hex(writer, address.content, address.content_len);
+        amount_writer_printf(writer, ", nonce: ");
+        amount_writer_format(writer, nonce.content, nonce.content_len, 0, NULL);
+        amount_writer_printf(writer, "\n");
+    }
 }
 
 extern "C"
@@ -68,262 +394,172 @@ extern "C"
      * GLOBAL PROTOTYPES
      **********************/
     void transaction_factory_init(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len);
+    void transaction_factory_init_digest(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len, uint8_t digest[32]);
     void transaction_factory_free(transaction_data_t *transaction_data);
     char *transaction_factory_to_string(transaction_data_t *transaction_data);
+    size_t transaction_factory_list_count(const uint8_t *list, size_t list_len);
 
     /**********************
      *   GLOBAL FUNCTIONS
      **********************/
     void transaction_factory_init(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len)
     {
-        memset(transaction_data, 0, sizeof(transaction_data_t));
-
-        if (sign_data[0] <= 0x7f)
+        transaction_parse(transaction_data, sign_data, sign_data_len, NULL);
+    }
+    void transaction_factory_init_digest(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len, uint8_t digest[32])
+    {
+        transaction_hasher_t hasher;
+        keccak256_init(&hasher.ctx);
+        hasher.pos = sign_data;
+        transaction_parse(transaction_data, sign_data, sign_data_len, &hasher);
+        if (transaction_data->error != 0)
         {
-            // Ethereum Transaction Type
-            switch (sign_data[0])
-            {
-            case TRANSACTION_TYPE_ACCESS_LIST_EIP2930:
+            memset(digest, 0, 32);
+            return;
+        }
+        keccak256_final(&hasher.ctx, digest);
+    }
+    void transaction_factory_free(transaction_data_t *transaction_data)
+    {
+        // fields are views into the sign data, nothing is allocated
+        (void)transaction_data;
+    }
+    size_t transaction_factory_list_count(const uint8_t *list, size_t list_len)
+    {
+        struct RLP_CURSOR cursor;
+        size_t count = 0;
+        rlp_cursor_init(&cursor, (uint8_t *)list, list_len);
+        while (!rlp_cursor_end(&cursor))
+        {
+            if (rlp_skip(&cursor) != RLP_OK)
             {
-                // not implemented
-                ESP_LOGE(TAG, "TRANSACTION_TYPE_ACCESS_LIST_EIP2930 not implemented");
-                transaction_data->error = 1;
-                return;
+                return 0;
             }
-            case TRANSACTION_TYPE_FEE_MARKET_EIP1559:
+            count++;
+        }
+        return count;
+    }
+    char *transaction_factory_to_string(transaction_data_t *transaction_data)
+    {
+        const char *symbol = "ETH";
+        long long chainId = 1;
+        evm_chain_info_t chain_info;
+        if (transaction_data->chainId != NULL)
+        {
+            chainId = (long long)to_uint64_t(transaction_data->chainId, transaction_data->chainIdLen);
+        }
+        bool known_chain = evm_chain_name_from_int(chainId, &chain_info);
+        if (known_chain)
+        {
+            symbol = chain_info.symbol;
+        }
+
+        // one buffer for everything, undecoded data is printed as hex
+        size_t capacity = TRANSACTION_FIELDS_TEXT_LEN + TRANSACTION_CALL_DESCRIPTION_LEN + 2 * transaction_data->dataLen +
+                          TRANSACTION_LIST_TEXT_RATIO * (transaction_data->accessListLen + transaction_data->authorizationListLen);
+        amount_writer_t writer = {(char *)malloc(capacity), capacity, 0};
+        if (writer.out == NULL)
+        {
+            return NULL;
+        }
+        writer.out[0] = '\0';
+
+        if (transaction_data->chainId != NULL)
+        {
+            amount_writer_printf(&writer, "chainId: %llu", (unsigned long long)chainId);
+            if (known_chain)
             {
-                uint8_t *chainId = nullptr;
-                size_t chainIdLen = 0;
-                uint8_t *nonce = nullptr;
-                size_t nonceLen = 0;
-                uint8_t *maxPriorityFeePerGas = nullptr;
-                size_t maxPriorityFeePerGasLen = 0;
-                uint8_t *maxFeePerGas = nullptr;
-                size_t maxFeePerGasLen = 0;
-                uint8_t *gasLimit = nullptr;
-                size_t gasLimitLen = 0;
-                uint8_t *to = nullptr;
-                size_t toLen = 0;
-                uint8_t *value = nullptr;
-                size_t valueLen = 0;
-                uint8_t *data = nullptr;
-                size_t dataLen = 0;
-                uint8_t *accessList = nullptr;
-                size_t accessListLen = 0;
-
-                uint8_t *rlp_encoded_ptr = (uint8_t *)sign_data;
-                size_t rlp_encoded_len = sign_data_len;
-
-                rlp_encoded_ptr++;
-                rlp_encoded_len--;
-
-                struct RLP_ITEM item;
-
-                rlp_decode(rlp_encoded_ptr, rlp_encoded_len, &item);
-                if (item.type != RLP_ITEM_LIST)
-                {
-                    ESP_LOGE(TAG, "Invalid RLP encoded data 1");
-                    transaction_data->error = 1;
-                    return;
-                }
-                rlp_encoded_len = item.content_len;
-                rlp_encoded_ptr = item.content;
-                // EIP1559 Transaction has 9 items
-                const size_t transaction_item_len = 9;
-                for (size_t i = 0; i < transaction_item_len; i++)
-                {
-                    rlp_decode(rlp_encoded_ptr, rlp_encoded_len, &item);
-                    switch (i)
-                    {
-                    case 0:
-                    {
-                        chainId = item.content;
-                        chainIdLen = item.content_len;
-                        break;
-                    }
-                    case 1:
-                    {
-                        nonce = item.content;
-                        nonceLen = item.content_len;
-                        break;
-                    }
-                    case 2:
-                    {
-                        maxPriorityFeePerGas = item.content;
-                        maxPriorityFeePerGasLen = item.content_len;
-                        break;
-                    }
-                    case 3:
-                    {
-                        maxFeePerGas = item.content;
-                        maxFeePerGasLen = item.content_len;
-                        break;
-                    }
-                    case 4:
-                    {
-                        gasLimit = item.content;
-                        gasLimitLen = item.content_len;
-                        break;
-                    }
-                    case 5:
-                    {
-                        to = item.content;
-                        toLen = item.content_len;
-                        break;
-                    }
-                    case 6:
-                    {
-                        value = item.content;
-                        valueLen = item.content_len;
-                        break;
-                    }
-                    case 7:
-                    {
-                        data = item.content;
-                        dataLen = item.content_len;
-                        break;
-                    }
-                    case 8:
-                    {
-                        accessList = item.content;
-                        accessListLen = item.content_len;
-                        break;
-                    }
-                    }
-                    if (item.type == RLP_ITEM_NULL)
-                    {
-                        ESP_LOGE(TAG, "Invalid RLP encoded data 2 at index:%zu", i);
-                        transaction_data->error = 2;
-                        return;
-                    }
-                    else if (item.type == RLP_ITEM_BYTES)
-                    {
-                        size_t skip_len = item.content_offset + item.content_len;
-                        rlp_encoded_ptr += skip_len;
-                        rlp_encoded_len -= skip_len;
-                    }
-                    else if (item.type == RLP_ITEM_LIST)
-                    {
-                        size_t skip_len = item.content_offset + item.content_len;
-                        rlp_encoded_ptr += skip_len;
-                        rlp_encoded_len -= skip_len;
-                    }
-                    else
-                    {
-                        ESP_LOGE(TAG, "Invalid RLP encoded data 3");
-                        transaction_data->error = 3;
-                        return;
-                    }
-                }
-
-                transaction_data->rlp_encoded = (uint8_t *)malloc(sign_data_len);
-                memcpy(transaction_data->rlp_encoded, sign_data, sign_data_len);
-                transaction_data->rlp_encoded_len = sign_data_len;
-                transaction_data->transactionType = TRANSACTION_TYPE_FEE_MARKET_EIP1559;
-                transaction_data->chainId = chainId;
-                transaction_data->chainIdLen = chainIdLen;
-                transaction_data->nonce = nonce;
-                transaction_data->nonceLen = nonceLen;
-                transaction_data->maxPriorityFeePerGas = maxPriorityFeePerGas;
-                transaction_data->maxPriorityFeePerGasLen = maxPriorityFeePerGasLen;
-                transaction_data->maxFeePerGas = maxFeePerGas;
-                transaction_data->maxFeePerGasLen = maxFeePerGasLen;
-                transaction_data->gasLimit = gasLimit;
-                transaction_data->gasLimitLen = gasLimitLen;
-                transaction_data->to = to;
-                transaction_data->toLen = toLen;
-                transaction_data->value = value;
-                transaction_data->valueLen = valueLen;
-                transaction_data->data = data;
-                transaction_data->dataLen = dataLen;
-                transaction_data->accessList = accessList;
-                transaction_data->accessListLen = accessListLen;
-                return;
+                amount_writer_printf(&writer, " (%s)", chain_info.chain_name);
             }
-            case TRANSACTION_TYPE_BLOB_EIP4844:
+            amount_writer_printf(&writer, "\n");
+        }
+        writer_amount(&writer, "nonce", transaction_data->nonce, transaction_data->nonceLen, 0, NULL);
+
+        // fee of the whole gas limit at the highest price the transaction allows
+        const uint8_t *fee_per_gas = transaction_data->gasPrice;
+        size_t fee_per_gas_len = transaction_data->gasPriceLen;
+        if (transaction_data->gasPrice != NULL)
+        {
+            writer_amount(&writer, "gasPrice", transaction_data->gasPrice, transaction_data->gasPriceLen, AMOUNT_DECIMALS_GWEI, "Gwei");
+        }
+        if (transaction_data->maxPriorityFeePerGas != NULL)
+        {
+            writer_amount(&writer, "maxPriorityFeePerGas", transaction_data->maxPriorityFeePerGas, transaction_data->maxPriorityFeePerGasLen, AMOUNT_DECIMALS_GWEI, "Gwei");
+            writer_amount(&writer, "maxFeePerGas", transaction_data->maxFeePerGas, transaction_data->maxFeePerGasLen, AMOUNT_DECIMALS_GWEI, "Gwei");
+            fee_per_gas = transaction_data->maxFeePerGas;
+            fee_per_gas_len = transaction_data->maxFeePerGasLen;
+        }
+        writer_amount(&writer, "gasLimit", transaction_data->gasLimit, transaction_data->gasLimitLen, 0, NULL);
+        uint8_t max_fee[AMOUNT_MAX_BYTES];
+        bool max_fee_valid = amount_mul(fee_per_gas, fee_per_gas_len, transaction_data->gasLimit, transaction_data->gasLimitLen, max_fee);
+        if (max_fee_valid && transaction_data->maxFeePerBlobGas != NULL)
+        {
+            // blob gas is paid on top of the execution gas
+            uint64_t blob_gas = (uint64_t)transaction_factory_list_count(transaction_data->blobVersionedHashes, transaction_data->blobVersionedHashesLen) * TRANSACTION_GAS_PER_BLOB;
+            uint8_t blob_gas_bytes[sizeof(blob_gas)];
+            uint8_t blob_fee[AMOUNT_MAX_BYTES];
+            for (size_t i = 0; i < sizeof(blob_gas); i++)
             {
-                // not implemented
-                ESP_LOGE(TAG, "TRANSACTION_TYPE_BLOB_EIP4844 not implemented");
-                transaction_data->error = 1;
-                return;
+                blob_gas_bytes[i] = (uint8_t)(blob_gas >> (8 * (sizeof(blob_gas) - 1 - i)));
             }
+            max_fee_valid = amount_mul(transaction_data->maxFeePerBlobGas, transaction_data->maxFeePerBlobGasLen, blob_gas_bytes, sizeof(blob_gas_bytes), blob_fee) &&
+                            amount_add(max_fee, sizeof(max_fee), blob_fee, sizeof(blob_fee), max_fee);
+        }
+        if (max_fee_valid)
+        {
+            writer_amount(&writer, "maxFee", max_fee, sizeof(max_fee), AMOUNT_DECIMALS_ETH, symbol);
+        }
+
+        amount_writer_printf(&writer, "to: ");
+        writer_hex(&writer, transaction_data->to, transaction_data->toLen);
+        amount_writer_printf(&writer, "\n");
+
+        writer_amount(&writer, "value", transaction_data->value, transaction_data->valueLen, AMOUNT_DECIMALS_ETH, symbol);
 
-            case TRANSACTION_TYPE_EOA_CODE_EIP7702:
+        if (transaction_data->dataLen > 0)
+        {
+            int decoded;
+            amount_writer_printf(&writer, "call: ");
+            size_t description_len = writer.len - writer.pos;
+            if (description_len > TRANSACTION_CALL_DESCRIPTION_LEN)
             {
-                // not implemented
-                ESP_LOGE(TAG, "TRANSACTION_TYPE_EOA_CODE_EIP7702 not implemented");
-                transaction_data->error = 1;
-                return;
+                description_len = TRANSACTION_CALL_DESCRIPTION_LEN;
             }
-            default:
+            writer.pos += calldata_describe(
+                transaction_data->toLen == 20 ? transaction_data->to : NULL,
+                chainId,
+                transaction_data->data, transaction_data->dataLen,
+                writer.out + writer.pos, description_len, &decoded);
+            amount_writer_printf(&writer, "\n");
+            // calls that couldn't be decoded are shown as raw data too
+            if (decoded != CALLDATA_OK &&
+                writer.pos + 2 * transaction_data->dataLen + 8 < writer.len)
             {
-                // not implemented
-                ESP_LOGE(TAG, "Unknown transaction type");
-                transaction_data->error = 1;
-                return;
-            }
+                amount_writer_printf(&writer, "data: 0x");
+                BUFFER_TO_HEX((writer.out + writer.pos), transaction_data->data, transaction_data->dataLen);
+                writer.pos += 2 * transaction_data->dataLen;
+                amount_writer_printf(&writer, "\n");
             }
         }
         else
         {
-            // TransactionType_Legacy
-            // not implemented
-            ESP_LOGE(TAG, "TRANSACTION_TYPE_LEGACY not implemented");
-            transaction_data->error = 1;
-            return;
+            amount_writer_printf(&writer, "data: 0x\n");
         }
-    }
-    void transaction_factory_free(transaction_data_t *transaction_data)
-    {
-        if (transaction_data->rlp_encoded)
+
+        if (transaction_data->accessList != NULL)
         {
-            free(transaction_data->rlp_encoded);
+            writer_access_list(&writer, transaction_data->accessList, transaction_data->accessListLen);
         }
-    }
-    char *transaction_factory_to_string(transaction_data_t *transaction_data)
-    {
-        std::string result = "";
-        char temp[64];
-        result += "chainId: " + std::to_string(to_uint64_t(transaction_data->chainId, transaction_data->chainIdLen)) + "\n";
-
-        result += "nonce: " + std::to_string(to_uint64_t(transaction_data->nonce, transaction_data->nonceLen)) + "\n";
-
-        bignum256 maxPriorityFee = to_bignum256(
-            transaction_data->maxPriorityFeePerGas,
-            transaction_data->maxPriorityFeePerGasLen);
-        bn_format(
-            &maxPriorityFee,
-            "", "", 0, 0, false, temp, sizeof(temp));
-        result += "maxPriorityFeePerGas: " + std::string(temp) + "\n";
-
-        bignum256 maxFee = to_bignum256(
-            transaction_data->maxFeePerGas,
-            transaction_data->maxFeePerGasLen);
-        bn_format(
-            &maxFee,
-            "", "", 0, 0, false, temp, sizeof(temp));
-        result += "maxFeePerGas: " + std::string(temp) + "\n";
-
-        bignum256 gasLimit = to_bignum256(
-            transaction_data->gasLimit,
-            transaction_data->gasLimitLen);
-        bn_format(
-            &gasLimit,
-            "", "", 0, 0, false, temp, sizeof(temp));
-        result += "gasLimit: " + std::string(temp) + "\n";
-
-        result += "to: 0x" + to_hex_string(transaction_data->to, transaction_data->toLen) + "\n";
-
-        bignum256 value = to_bignum256(
-            transaction_data->value,
-            transaction_data->valueLen);
-        bn_format(
-            &value,
-            "", "", 0, 0, false, temp, sizeof(temp));
-        result += "value: " + std::string(temp) + "\n";
-
-        result += "data: 0x" + to_hex_string(transaction_data->data, transaction_data->dataLen) + "\n";
-
-        return strdup(result.c_str());
+        if (transaction_data->maxFeePerBlobGas != NULL)
+        {
+            writer_amount(&writer, "maxFeePerBlobGas", transaction_data->maxFeePerBlobGas, transaction_data->maxFeePerBlobGasLen, AMOUNT_DECIMALS_GWEI, "Gwei");
+            amount_writer_printf(&writer, "blobVersionedHashes: %zu\n", transaction_factory_list_count(transaction_data->blobVersionedHashes, transaction_data->blobVersionedHashesLen));
+        }
+        if (transaction_data->authorizationList != NULL)
+        {
+            writer_authorization_list(&writer, transaction_data->authorizationList, transaction_data->authorizationListLen);
+        }
+
+        return writer.out;
     }
 }
\ No newline at end of file
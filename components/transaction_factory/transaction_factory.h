@@ -25,6 +25,13 @@ extern "C"
      *      TYPEDEFS
      **********************/
 
+    /*
+        Fields point into the sign data passed to transaction_factory_init(),
+        which has to stay valid while the transaction data is used.
+        Fields the transaction type doesn't have are NULL.
+        List fields (accessList, blobVersionedHashes, authorizationList) are
+        the raw list contents, walk them with the rlp cursor when displayed.
+     */
     typedef struct __attribute__((aligned(4)))
     {
         /* error=0: success, error!=0: failed */
@@ -36,6 +43,8 @@ extern "C"
         size_t chainIdLen;
         uint8_t *nonce;
         size_t nonceLen;
+        uint8_t *gasPrice;
+        size_t gasPriceLen;
         uint8_t *maxPriorityFeePerGas;
         size_t maxPriorityFeePerGasLen;
         uint8_t *maxFeePerGas;
@@ -50,14 +59,28 @@ extern "C"
         size_t dataLen;
         uint8_t *accessList;
         size_t accessListLen;
+        uint8_t *maxFeePerBlobGas;
+        size_t maxFeePerBlobGasLen;
+        uint8_t *blobVersionedHashes;
+        size_t blobVersionedHashesLen;
+        uint8_t *authorizationList;
+        size_t authorizationListLen;
     } transaction_data_t;
 
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
     void transaction_factory_init(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len);
+    /*
+        transaction_factory_init() that also returns the signing hash, keccak256 of the sign data.
+        The hash is fed field by field while the cursor walks the payload, so the data is read once.
+        digest is zeroed if the transaction is invalid.
+     */
+    void transaction_factory_init_digest(transaction_data_t *transaction_data, const uint8_t *sign_data, size_t sign_data_len, uint8_t digest[32]);
     void transaction_factory_free(transaction_data_t *transaction_data);
     char *transaction_factory_to_string(transaction_data_t *transaction_data);
+    /* number of entries in a list field, 0 if the list is malformed */
+    size_t transaction_factory_list_count(const uint8_t *list, size_t list_len);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,219 @@
+#include "Arena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#endif
+
+// every block starts with a header of ARENA_ALIGN bytes: requested length,
+// the top bit marks blocks that live in an arena and are released by reset()
+#define ARENA_BLOCK_FLAG   ((size_t)1 << (sizeof(size_t)*8-1))
+#define ARENA_BLOCK_MAX    ((ARENA_BLOCK_FLAG - 1) & ~((size_t)ARENA_ALIGN - 1))
+
+// arena the current task allocates from, each task routes its own allocations
+static thread_local Arena * current = NULL;
+
+static size_t alignedLen(size_t len){
+    return (len + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+}
+
+static size_t * blockHeader(const void * ptr){
+    return (size_t *)((uint8_t *)ptr - ARENA_ALIGN);
+}
+
+static size_t blockLen(const void * ptr){
+    return *blockHeader(ptr) & ~ARENA_BLOCK_FLAG;
+}
+
+static bool isArenaBlock(const void * ptr){
+    return (*blockHeader(ptr) & ARENA_BLOCK_FLAG) != 0;
+}
+
+void Arena::init(void * start, size_t len){
+    // first block has to be aligned
+    size_t offset = alignedLen((uintptr_t)start) - (uintptr_t)start;
+    if(start == NULL || len < offset){
+        buffer = NULL;
+        size = 0;
+    }else{
+        buffer = (uint8_t *)start + offset;
+        size = len - offset;
+    }
+    used = 0;
+    peak = 0;
+    fallbacks = 0;
+}
+
+Arena::Arena(size_t len){
+#if defined(ESP_PLATFORM)
+    region = heap_caps_malloc(len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if(region == NULL){
+        region = malloc(len);
+    }
+#else
+    region = malloc(len);
+#endif
+    init(region, len);
+}
+
+Arena::Arena(void * external, size_t len){
+    region = NULL; // not ours
+    init(external, len);
+}
+
+Arena::~Arena(){
+    if(current == this){
+        current = NULL;
+    }
+    if(region != NULL){
+        free(region);
+    }
+}
+
+bool Arena::begin(){
+    if(buffer == NULL || (current != NULL && current != this)){
+        return false;
+    }
+    current = this;
+    return true;
+}
+
+void Arena::end(){
+    if(current == this){
+        current = NULL;
+    }
+}
+
+void Arena::reset(){
+    used = 0;
+    peak = 0;
+    fallbacks = 0;
+}
+
+bool Arena::isActive() const{
+    return current == this;
+}
+
+void * Arena::allocate(size_t len){
+    if(buffer == NULL || len > ARENA_BLOCK_MAX || size - used < ARENA_ALIGN + alignedLen(len)){
+        fallbacks++;
+        return NULL;
+    }
+    uint8_t * block = buffer + used;
+    *(size_t *)block = len | ARENA_BLOCK_FLAG;
+    used += ARENA_ALIGN + alignedLen(len);
+    if(used > peak){
+        peak = used;
+    }
+    return block + ARENA_ALIGN;
+}
+
+void * Arena::reallocate(void * ptr, size_t len){
+    uint8_t * block = (uint8_t *)ptr - ARENA_ALIGN;
+    size_t old = blockLen(ptr);
+    if(len > ARENA_BLOCK_MAX){
+        return NULL;
+    }
+    if(block + ARENA_ALIGN + alignedLen(old) == buffer + used){
+        // last block - grow or shrink in place
+        size_t need = ARENA_ALIGN + alignedLen(len);
+        if(need > size - (size_t)(block - buffer)){
+            return NULL;
+        }
+        used = (block - buffer) + need;
+        if(used > peak){
+            peak = used;
+        }
+        *(size_t *)block = len | ARENA_BLOCK_FLAG;
+        return ptr;
+    }
+    if(len <= old){
+        *(size_t *)block = len | ARENA_BLOCK_FLAG;
+        return ptr;
+    }
+    return NULL;
+}
+
+ArenaScope::ArenaScope(Arena * arena){
+    previous = current;
+    routed = (arena != NULL && bool(*arena));
+    if(routed){
+        current = arena;
+    }
+}
+
+ArenaScope::~ArenaScope(){
+    if(routed){
+        current = previous;
+    }
+}
+
+void * ubtc_malloc(size_t len){
+    if(current != NULL){
+        void * ptr = current->allocate(len);
+        if(ptr != NULL){
+            return ptr;
+        }
+    }
+    if(len > ARENA_BLOCK_MAX){
+        return NULL;
+    }
+    size_t * block = (size_t *)malloc(ARENA_ALIGN + len);
+    if(block == NULL){
+        return NULL;
+    }
+    *block = len;
+    return (uint8_t *)block + ARENA_ALIGN;
+}
+
+void * ubtc_calloc(size_t num, size_t len){
+    if(len != 0 && num > SIZE_MAX/len){
+        return NULL;
+    }
+    // arena memory is reused, clear it
+    void * ptr = ubtc_malloc(num*len);
+    if(ptr != NULL){
+        memset(ptr, 0, num*len);
+    }
+    return ptr;
+}
+
+void * ubtc_realloc(void * ptr, size_t len){
+    if(ptr == NULL){
+        return ubtc_malloc(len);
+    }
+    if(len > ARENA_BLOCK_MAX){
+        return NULL;
+    }
+    if(!isArenaBlock(ptr)){
+        size_t * block = (size_t *)realloc(blockHeader(ptr), ARENA_ALIGN + len);
+        if(block == NULL){
+            return NULL;
+        }
+        *block = len;
+        return (uint8_t *)block + ARENA_ALIGN;
+    }
+    if(current != NULL && current->contains(ptr)){
+        void * res = current->reallocate(ptr, len);
+        if(res != NULL){
+            return res;
+        }
+    }
+    // doesn't fit in place - moving, the old block stays until reset()
+    size_t old = blockLen(ptr);
+    void * res = ubtc_malloc(len);
+    if(res == NULL){
+        return NULL;
+    }
+    memcpy(res, ptr, (old < len) ? old : len);
+    return res;
+}
+
+void ubtc_free(void * ptr){
+    if(ptr == NULL || isArenaBlock(ptr)){
+        return;
+    }
+    free(blockHeader(ptr));
+}
@@ -0,0 +1,146 @@
+#ifndef __UBITCOIN_ARENA_H__
+#define __UBITCOIN_ARENA_H__
+
+#include "uBitcoin_conf.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+
+/** \brief Alignment of the arena blocks */
+#define ARENA_ALIGN 8
+
+/**
+ *  \brief Bump allocator for one parsing / signing session.<br>
+ *         Allocations go to the arena while it is routed for the calling task -
+ *         between begin() and end(), or inside an ArenaScope.
+ *         Routing is per task, other tasks keep allocating from the heap.<br>
+ *         Freeing an arena block is a no-op, all blocks are released at once by reset(),
+ *         so a large PSBT doesn't fragment the heap.<br>
+ *         If the region is full allocations fall back to the heap.<br>
+ *         Objects created in the session have to be destroyed before reset().
+ *
+ *  \code
+ *  Arena arena(256*1024); // in PSRAM on ESP32
+ *  {
+ *      PSBT psbt(&arena); // parse, sign and copies of the PSBT allocate from the arena
+ *      psbt.parse(buf, len);
+ *      psbt.sign(root);
+ *      ...
+ *  }
+ *  arena.reset();
+ *  \endcode
+ */
+class Arena{
+protected:
+    uint8_t * buffer;
+    size_t size;
+    size_t used;
+    size_t peak;
+    size_t fallbacks;
+    void * region; // allocated by the arena itself, NULL for external regions
+    void init(void * start, size_t len);
+public:
+    /** \brief allocates a region of `len` bytes, in PSRAM if available */
+    explicit Arena(size_t len);
+    /** \brief uses external region */
+    Arena(void * external, size_t len);
+    ~Arena();
+    /** \brief routes allocations of the current task to the arena, fails if another arena is routed */
+    bool begin();
+    /** \brief stops routing allocations to the arena, blocks stay valid until reset() */
+    void end();
+    /** \brief releases all blocks at once */
+    void reset();
+
+    /** \brief returns NULL if the block doesn't fit */
+    void * allocate(size_t len);
+    /** \brief resizes the last block in place or shrinks any block, returns NULL otherwise */
+    void * reallocate(void * ptr, size_t len);
+    bool contains(const void * ptr) const{ return (const uint8_t *)ptr >= buffer && (const uint8_t *)ptr < buffer+size; };
+    /** \brief the arena is routed for the calling task */
+    bool isActive() const;
+
+    /** \brief bytes currently in use */
+    size_t bytesUsed() const{ return used; };
+    /** \brief maximum bytes used since the last reset() */
+    size_t bytesPeak() const{ return peak; };
+    /** \brief number of allocations that didn't fit and went to the heap */
+    size_t heapFallbacks() const{ return fallbacks; };
+    size_t capacity() const{ return size; };
+    explicit operator bool() const{ return buffer != NULL; };
+};
+
+/** \brief Routes allocations of the current task to the arena until the end of the scope.
+ *         Restores the previous routing, does nothing for a NULL arena.
+ */
+class ArenaScope{
+protected:
+    Arena * previous;
+    bool routed;
+public:
+    explicit ArenaScope(Arena * arena);
+    ~ArenaScope();
+    ArenaScope(ArenaScope const &) = delete;
+    ArenaScope &operator=(ArenaScope const &) = delete;
+};
+
+/** \brief malloc / calloc / realloc / free that use the arena of the current task.
+ *         Blocks carry a header, so they can be freed from any task
+ *         and must not be passed to the libc functions.
+ */
+void * ubtc_malloc(size_t len);
+void * ubtc_calloc(size_t num, size_t len);
+void * ubtc_realloc(void * ptr, size_t len);
+void ubtc_free(void * ptr);
+
+/** \brief new[] replacement that goes through ubtc_malloc, free with ubtc_delete_array */
+template <typename T>
+T * ubtc_new_array(size_t num){
+    if(num > (SIZE_MAX - ARENA_ALIGN)/sizeof(T)){
+        return NULL;
+    }
+    uint8_t * ptr = (uint8_t *)ubtc_malloc(ARENA_ALIGN + num*sizeof(T));
+    if(ptr == NULL){
+        return NULL;
+    }
+    *(size_t *)ptr = num;
+    T * arr = (T *)(ptr + ARENA_ALIGN);
+    for(size_t i=0; i<num; i++){
+        new (&arr[i]) T;
+    }
+    return arr;
+}
+
+template <typename T>
+void ubtc_delete_array(T * arr){
+    if(arr == NULL){
+        return;
+    }
+    uint8_t * ptr = (uint8_t *)arr - ARENA_ALIGN;
+    size_t num = *(size_t *)ptr;
+    for(size_t i=0; i<num; i++){
+        arr[i].~T();
+    }
+    ubtc_free(ptr);
+}
+
+template <typename T>
+T * ubtc_new(){
+    void * ptr = ubtc_malloc(sizeof(T));
+    if(ptr == NULL){
+        return NULL;
+    }
+    return new (ptr) T;
+}
+
+template <typename T>
+void ubtc_delete(T * obj){
+    if(obj == NULL){
+        return;
+    }
+    obj->~T();
+    ubtc_free(obj);
+}
+
+#endif // __UBITCOIN_ARENA_H__
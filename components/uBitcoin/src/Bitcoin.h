@@ -9,6 +9,7 @@
 #include "BitcoinCurve.h"
 #include "Conversion.h"
 #include "Networks.h"
+#include "Arena.h"
 #include "utility/trezor/rand.h"
 #include <stdint.h>
 #include <string.h>
@@ -472,13 +473,22 @@ public:
 /**
  *  \brief Script class. Parsing requires the length of the script in the beginning.
  */
+/** \brief Scripts up to this length are stored inside the Script object without heap allocation */
+#ifndef SCRIPT_INLINE_SIZE
+#define SCRIPT_INLINE_SIZE 40
+#endif
+
 class Script : public Streamable{
 protected:
     virtual size_t from_stream(ParseStream *s);
     virtual size_t to_stream(SerializeStream *s, size_t offset = 0) const;
     uint8_t lenLen; // for parsing only, length of the varint
+    size_t scriptCapacity; // bytes available in scriptArray
+    uint8_t scriptBuffer[SCRIPT_INLINE_SIZE]; // scriptArray points here for short scripts
     void fromAddress(const char * address);
     void init();
+    bool reserve(size_t len);
+    void take(Script &other);
 public:
     uint8_t * scriptArray;
     size_t scriptLen;
@@ -500,7 +510,8 @@ public:
     /** \brief creates one of standart scripts (P2SH, P2WSH) */
     Script(const Script &other, ScriptType type);
     Script(const Script &other); // copy
-    ~Script(){ if(scriptArray){ free(scriptArray); } };
+    Script(Script &&other); // move
+    ~Script(){ if(scriptArray != scriptBuffer){ ubtc_free(scriptArray); } };
 
     /** \brief tries to determine the script type */
     ScriptType type() const;
@@ -524,12 +535,13 @@ public:
     /** \brief adds <len><der><sigType> to the script */
     size_t push(const Signature sig, SigHashType sigType = SIGHASH_ALL);
     /** \brief adds <len><script> to the script (used for P2SH) */
-    size_t push(const Script sc);
+    size_t push(const Script &sc);
 
     /** \brief returns scriptPubkey for this scripts (P2SH or P2WSH) */
     Script scriptPubkey(ScriptType type = P2SH) const;
 
     Script &operator=(const Script &other);                   // assignment
+    Script &operator=(Script &&other);                        // move assignment
 
     // Bool conversion. Allows to use if(script) construction. Returns false if script is empty, true otherwise
     explicit operator bool() const{ return (scriptLen > 0); };
@@ -569,7 +581,7 @@ public:
     Witness(const uint8_t * buffer, size_t len);
     Witness(const Signature sig, const PublicKey pub);
     Witness(const Witness &other); // copy
-    ~Witness(){ if(witnessArray){ free(witnessArray); } };
+    ~Witness(){ if(witnessArray){ ubtc_free(witnessArray); } };
     /** \brief returns number of elements in the witness */
     uint8_t count() const{ return numElements; };
     /** \brief adds `<len><data>` to the witness */
@@ -653,6 +665,18 @@ public:
     bool isValid() const{ return status==PARSING_DONE; };
     explicit operator bool() const{ return isValid(); };
 };
+
+/**
+ *  \brief Precomputed parts of the BIP143 sighash.<br>
+ *         They are the same for every input of the transaction,
+ *         so they can be calculated once and reused for all inputs.
+ */
+typedef struct{
+    uint8_t hashPrevouts[32];
+    uint8_t hashSequence[32];
+    uint8_t hashOutputs[32];
+} SegwitSigHashCache;
+
 /**
  *  \brief Transaction class.<br>
  *         Can be segwit or not. For legacy tx serializes as `<ver><inputsNumber><inputs><outputsNumber><outputs><locktime>`<br>
@@ -663,6 +687,10 @@ protected:
     virtual size_t from_stream(ParseStream *s);
     virtual size_t to_stream(SerializeStream *s, size_t offset = 0) const;
     uint8_t segwit_flag;
+    uint8_t countLen; // length of the inputs / outputs number varint while parsing
+    uint64_t countValue; // inputs / outputs number while its varint is parsed
+    size_t inputsCapacity;
+    size_t outputsCapacity;
     void clear();
     void init();
 public:
@@ -700,17 +728,21 @@ public:
 #endif
 
     /** \brief adds another input to the transaction */
-    uint8_t addInput(const TxIn txIn);
+    size_t addInput(const TxIn &txIn);
     /** \brief adds another output to the transaction */
-    uint8_t addOutput(const TxOut txOut);
+    size_t addOutput(const TxOut &txOut);
 
     /** \brief calculates a hash to sign for certain input */
-    int sigHash(uint8_t h[32], uint8_t inputIndex, const Script scriptPubkey, SigHashType sighash = SIGHASH_ALL) const;
+    int sigHash(uint8_t h[32], size_t inputIndex, const Script &scriptPubkey, SigHashType sighash = SIGHASH_ALL) const;
 
     int hashPrevouts(uint8_t h[32]) const;
     int hashSequence(uint8_t h[32]) const;
     int hashOutputs(uint8_t h[32]) const;
-    int sigHashSegwit(uint8_t h[32], uint8_t inputIndex, const Script scriptPubKey, uint64_t amount, SigHashType sighash = SIGHASH_ALL) const;
+    int sigHashSegwit(uint8_t h[32], size_t inputIndex, const Script scriptPubKey, uint64_t amount, SigHashType sighash = SIGHASH_ALL) const;
+    /** \brief fills hashPrevouts, hashSequence and hashOutputs for sigHashSegwit */
+    int sigHashSegwitCache(SegwitSigHashCache * cache) const;
+    /** \brief same as sigHashSegwit, but reuses precomputed hashes instead of rehashing all inputs and outputs */
+    int sigHashSegwit(uint8_t h[32], size_t inputIndex, const Script &scriptPubKey, uint64_t amount, SigHashType sighash, const SegwitSigHashCache * cache) const;
 
 #if 0
     /** \brief sorts inputs and outputs in alphabetical order */
@@ -721,9 +753,9 @@ public:
      *         Don't forget to construct txIns[i].scriptSig correctly if you are using P2SH.
      *         For P2WPKH, P2WSH and P2SH-P2WPKH use signSegwitInput method.
      */
-    Signature signInput(uint8_t inputIndex, const PrivateKey pk, const Script redeemScript, SigHashType sighash = SIGHASH_ALL);
+    Signature signInput(size_t inputIndex, const PrivateKey pk, const Script redeemScript, SigHashType sighash = SIGHASH_ALL);
     /** \brief signs legacy input and returns a signature */
-    Signature signInput(uint8_t inputIndex, const PrivateKey pk){
+    Signature signInput(size_t inputIndex, const PrivateKey pk){
         return signInput(inputIndex, pk, Script(pk.publicKey(), P2PKH));
     };
 
@@ -731,11 +763,11 @@ public:
      *         Don't forget to construct txIns[i].witness correctly if you are using P2WSH or P2SH-P2WSH.
      *         For P2PKH and P2SH use signInput method.
      */
-    Signature signSegwitInput(uint8_t inputIndex, const PrivateKey pk, const Script redeemScript, uint64_t amount, ScriptType type = P2WSH, SigHashType sighash = SIGHASH_ALL);
+    Signature signSegwitInput(size_t inputIndex, const PrivateKey pk, const Script redeemScript, uint64_t amount, ScriptType type = P2WSH, SigHashType sighash = SIGHASH_ALL);
     /** \brief signs segwit input and returns a signature. Uses native segwit (P2WPKH) by default, 
      *         you can also specify the type to be P2SH-P2WPKH to sign nested segwit transaction.
      */
-    Signature signSegwitInput(uint8_t inputIndex, const PrivateKey pk, uint64_t amount, ScriptType type = P2WPKH){
+    Signature signSegwitInput(size_t inputIndex, const PrivateKey pk, uint64_t amount, ScriptType type = P2WPKH){
         return signSegwitInput(inputIndex, pk, Script(pk.publicKey(), P2WPKH), amount, type); // FIXME: are you sure?
     };
 
@@ -745,4 +777,13 @@ public:
     explicit operator bool() const{ return isValid(); };
 };
 
+/** \brief Checks that serialized transaction hashes to `hash` (reverse of txid)
+ *         and finds its output without parsing the transaction into Tx.<br>
+ *         Single hashing pass and no allocations, scriptPubkey points into rawTx.<br>
+ *         Returns false if the transaction is malformed, the hash doesn't match
+ *         or there is no such output.
+ */
+bool rawTxOutput(const uint8_t * rawTx, size_t rawTxLen, const uint8_t hash[32], uint32_t outputIndex,
+                 uint64_t * amount, const uint8_t ** scriptPubkey, size_t * scriptPubkeyLen);
+
 #endif // __BITCOIN_H__
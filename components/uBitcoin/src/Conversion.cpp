@@ -11,6 +11,23 @@ using std::string;
 #endif
 
 static const char BASE58_CHARS[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+// digit values of the base58 characters, -1 if not in the alphabet
+static const int8_t BASE58_REV[128] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8, -1, -1, -1, -1, -1, -1,
+    -1,  9, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, 19, 20, 21, -1,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, -1, -1, -1, -1, -1,
+    -1, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, -1, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, -1, -1, -1, -1, -1
+};
+// base58 is converted in chunks of 5 digits that fit in 32-bit limbs
+#define BASE58_CHUNK        656356768UL // 58^5
+#define BASE58_CHUNK_DIGITS 5
+// numbers up to this size are converted without heap allocation
+#define BASE58_STACK_LIMBS  32
+
 static const char BASE43_CHARS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ$*+-./:";
 static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
@@ -260,60 +277,63 @@ size_t toBase58(const uint8_t * array, size_t arraySize, char * output, size_t o
         zeroCount++;
     }
 
-    // TODO: refactor with real sizes
     // size estimation. 56/41 ≈ log(58)/log(256)
     size_t size = (arraySize - zeroCount) * 183 / 134 + 1;
-    // size_t size = (arraySize - zeroCount) * 137 / 100 + 1;
     if(outputSize < size+zeroCount){
         return 0;
     }
 
     memzero(output, outputSize);
 
-    // array copy for manipulations
+    // number as big-endian 32-bit limbs
     size_t bufferSize = arraySize - zeroCount;
-    uint8_t * buffer = (uint8_t *)calloc(bufferSize, sizeof(uint8_t));
-    if(buffer == NULL){ return 0; }
-    for(size_t i = zeroCount; i < arraySize; i++){
-        buffer[i - zeroCount] = array[i];
-    }
-
-    for(size_t j = 0; j < size; j++){
-        uint16_t reminder = 0;
-        uint16_t temp = 0;
-        for(size_t i = 0; i < bufferSize; i++){
-            temp = (reminder * 256 + buffer[i]);
-            reminder = temp % 58;
-            buffer[i] = temp/58;
-        }
-        output[size+zeroCount-j-1] = BASE58_CHARS[reminder];
-    }
-    free(buffer);
-    for (size_t i = 0; i < zeroCount; i++){
+    size_t limbsLen = (bufferSize + 3) / 4;
+    uint32_t stackLimbs[BASE58_STACK_LIMBS];
+    uint32_t * limbs = stackLimbs;
+    if(limbsLen > BASE58_STACK_LIMBS){
+        limbs = (uint32_t *)calloc(limbsLen, sizeof(uint32_t));
+        if(limbs == NULL){ return 0; }
+    }
+    memzero(limbs, limbsLen * sizeof(uint32_t));
+    for(size_t i = 0; i < bufferSize; i++){ // i - byte index from the end
+        limbs[limbsLen - 1 - i/4] |= ((uint32_t)array[arraySize - 1 - i]) << (8*(i%4));
+    }
+
+    // dividing by 58^5 gives 5 digits at once, least significant first
+    size_t l = zeroCount;
+    size_t start = 0;
+    while(start < limbsLen){
+        uint64_t rem = 0;
+        for(size_t i = start; i < limbsLen; i++){
+            uint64_t cur = (rem << 32) | limbs[i];
+            uint64_t q = cur / BASE58_CHUNK;
+            limbs[i] = (uint32_t)q;
+            rem = cur - q * BASE58_CHUNK;
+        }
+        while(start < limbsLen && limbs[start] == 0){
+            start++;
+        }
+        uint32_t r = (uint32_t)rem;
+        // the last chunk has no leading zero digits
+        for(int k = 0; k < BASE58_CHUNK_DIGITS && (start < limbsLen || r > 0) && l < outputSize; k++){
+            output[l] = BASE58_CHARS[r % 58];
+            r /= 58;
+            l++;
+        }
+    }
+    memzero(limbs, limbsLen * sizeof(uint32_t)); // secret should not stay in RAM
+    if(limbs != stackLimbs){
+        free(limbs);
+    }
+    // digits are in reverse order
+    for(size_t i = zeroCount, j = l; i + 1 < j; i++, j--){
+        char c = output[i];
+        output[i] = output[j-1];
+        output[j-1] = c;
+    }
+    for(size_t i = 0; i < zeroCount; i++){
         output[i] = BASE58_CHARS[0];
     }
-    if(outputSize > size+zeroCount){
-        output[size+zeroCount] = '\0';
-    }
-
-    // removing leading zeroes
-    // TODO: refactor
-    int shift = 0;
-    for(size_t i=zeroCount; i < size+zeroCount; i++){
-        if(output[i]==BASE58_CHARS[0]){
-            shift++;
-        }else{
-            break;
-        }
-    }
-    if(shift>0){
-        for(size_t i=zeroCount+shift; i < size+zeroCount; i++){
-            output[i-shift] = output[i];
-            output[i] = 0;
-        }
-    }
-    size_t l = size+zeroCount-shift;
-    memzero(output + l, outputSize-l);
     return l;
 }
 #if USE_ARDUINO_STRING || USE_STD_STRING
@@ -331,8 +351,12 @@ String toBase58(const uint8_t * array, size_t arraySize){
 
 size_t toBase58Check(const uint8_t * array, size_t arraySize, char * output, size_t outputSize){
     if(array == NULL || output == NULL){ return 0; }
-    uint8_t * arr = (uint8_t *) malloc(arraySize+4);
-    if(arr == NULL){ return 0; }
+    uint8_t stackArr[BASE58_STACK_LIMBS*4];
+    uint8_t * arr = stackArr;
+    if(arraySize+4 > sizeof(stackArr)){
+        arr = (uint8_t *) malloc(arraySize+4);
+        if(arr == NULL){ return 0; }
+    }
     memcpy(arr, array, arraySize);
 
     uint8_t hash[32];
@@ -341,7 +365,9 @@ size_t toBase58Check(const uint8_t * array, size_t arraySize, char * output, siz
 
     size_t l = toBase58(arr, arraySize+4, output, outputSize);
     memzero(arr, arraySize+4); // secret should not stay in RAM
-    free(arr);
+    if(arr != stackArr){
+        free(arr);
+    }
     return l;
 }
 #if USE_ARDUINO_STRING || USE_STD_STRING
@@ -365,6 +391,10 @@ size_t fromBase58Length(const char * array, size_t arraySize){
     return size;
 }
 
+static int base58Digit(char c){
+    return (c & 0x80) ? -1 : BASE58_REV[(int)c];
+}
+
 size_t fromBase58(const char * encoded, size_t encodedSize, uint8_t * output, size_t outputSize){
     if(encoded == NULL || output == NULL){ return 0; }
     memzero(output, outputSize);
@@ -372,81 +402,101 @@ size_t fromBase58(const char * encoded, size_t encodedSize, uint8_t * output, si
     size_t l;
     // looking for the end of char array
     for(l=0; l<encodedSize; l++){
-        const char * pch = strchr(BASE58_CHARS, encoded[l]);
-        if(pch==NULL){ // char not in the alphabet
+        if(base58Digit(encoded[l]) < 0){ // char not in the alphabet
             break;
         }
     }
     encodedSize = l;
-    size_t size = fromBase58Length(encoded, encodedSize);
-    uint8_t * tmp = (uint8_t *) calloc(size, sizeof(uint8_t));
-    if(tmp == NULL){ return 0; }
 
-    uint8_t zeroCount = 0;
-    for(size_t i = 0; i<encodedSize; i++){
-        if(encoded[i] == BASE58_CHARS[0]){
-            zeroCount++;
-        }else{
-            break;
-        }
+    size_t zeroCount = 0;
+    while(zeroCount < encodedSize && encoded[zeroCount] == BASE58_CHARS[0]){
+        zeroCount++;
     }
 
-    uint16_t val = 0;
-    for(size_t i = 0; i < encodedSize; i++){
-        const char * pch = strchr(BASE58_CHARS, encoded[i]);
-        if(pch!=NULL){
-            val = pch - BASE58_CHARS;
-            for(size_t j = 0; j < size; j++){
-                uint16_t cur = tmp[size-j-1]*58;
-                cur += val;
-                val = cur/256;
-                tmp[size-j-1] = cur%256;
+    // number as little-endian 32-bit limbs
+    size_t limbsLen = fromBase58Length(encoded, encodedSize) / 4 + 2;
+    uint32_t stackLimbs[BASE58_STACK_LIMBS];
+    uint32_t * limbs = stackLimbs;
+    if(limbsLen > BASE58_STACK_LIMBS){
+        limbs = (uint32_t *)calloc(limbsLen, sizeof(uint32_t));
+        if(limbs == NULL){ return 0; }
+    }
+    size_t used = 0;
+    // multiplying by 58^5 and adding 5 digits at once, the first chunk can be shorter
+    size_t i = zeroCount;
+    size_t chunk = (encodedSize - zeroCount) % BASE58_CHUNK_DIGITS;
+    if(chunk == 0){
+        chunk = BASE58_CHUNK_DIGITS;
+    }
+    while(i < encodedSize){
+        uint32_t mult = 1;
+        uint32_t val = 0;
+        for(size_t k = 0; k < chunk; k++){
+            mult *= 58;
+            val = val * 58 + base58Digit(encoded[i+k]);
+        }
+        i += chunk;
+        chunk = BASE58_CHUNK_DIGITS;
+        uint64_t carry = val;
+        for(size_t j = 0; j < used; j++){
+            uint64_t cur = (uint64_t)limbs[j] * mult + carry;
+            limbs[j] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        if(carry > 0){
+            if(used == limbsLen){ // can't happen with correct length estimate
+                break;
             }
-        }else{
-            free(tmp);
-            return 0;
+            limbs[used] = (uint32_t)carry;
+            used++;
         }
     }
-    // shifting array
-    uint8_t shift = 0;
-    for(size_t i = zeroCount; i < size; i++){
-        if(tmp[i] == 0){
-            shift++;
-        }else{
-            break;
-        }
+    // significant bytes of the number
+    size_t size = used * 4;
+    while(size > 0 && ((limbs[(size-1)/4] >> (8*((size-1)%4))) & 0xFF) == 0){
+        size--;
     }
-    if(size-shift > outputSize){
-        free(tmp);
+    if(zeroCount + size > outputSize){
+        memzero(limbs, used * sizeof(uint32_t));
+        if(limbs != stackLimbs){
+            free(limbs);
+        }
         return 0;
     }
-    memcpy(output, tmp+shift, size-shift);
-    free(tmp);
-    return size-shift;
+    for(size_t j = 0; j < size; j++){
+        output[zeroCount + size - 1 - j] = (limbs[j/4] >> (8*(j%4))) & 0xFF;
+    }
+    memzero(limbs, used * sizeof(uint32_t)); // secret should not stay in RAM
+    if(limbs != stackLimbs){
+        free(limbs);
+    }
+    return zeroCount + size;
 }
 
 size_t fromBase58Check(const char * encoded, size_t encodedSize, uint8_t * output, size_t outputSize){
     if(encoded == NULL || output == NULL){ return 0; }
-    uint8_t * arr = (uint8_t *) malloc(outputSize+4);
-    if(arr == NULL){ return 0; }
-    size_t l = fromBase58(encoded, encodedSize, arr, outputSize+4);
-    if(l<4){
-        free(arr);
-        return 0;
+    uint8_t stackArr[BASE58_STACK_LIMBS*4];
+    uint8_t * arr = stackArr;
+    if(outputSize+4 > sizeof(stackArr)){
+        arr = (uint8_t *) malloc(outputSize+4);
+        if(arr == NULL){ return 0; }
     }
-
+    size_t l = fromBase58(encoded, encodedSize, arr, outputSize+4);
     uint8_t hash[32];
-    doubleSha(arr, l-4, hash);
-    if(memcmp(arr+l-4, hash, 4)!=0){
-        free(arr);
-        return 0;
+    if(l >= 4){
+        doubleSha(arr, l-4, hash);
+    }
+    if(l < 4 || memcmp(arr+l-4, hash, 4) != 0){
+        l = 0;
+    }else{
+        memcpy(output, arr, l-4);
+        l -= 4;
     }
-
-    memcpy(output, arr, l-4);
-
     memzero(arr, outputSize+4); // secret should not stay in RAM
-    free(arr);
-    return l-4;
+    if(arr != stackArr){
+        free(arr);
+    }
+    return l;
 }
 
 #if USE_STD_STRING || USE_ARDUINO_STRING
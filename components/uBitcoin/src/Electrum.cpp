@@ -3,7 +3,7 @@
 ElectrumTx::ElectrumTx(ElectrumTx const &other){
     tx = other.tx;
     is_segwit = false;
-    txInsMeta = new ElectrumInputMetadata[tx.inputsNumber];
+    txInsMeta = ubtc_new_array<ElectrumInputMetadata>(tx.inputsNumber);
     for(unsigned int i=0; i<tx.inputsNumber; i++){
         txInsMeta[i] = other.txInsMeta[i];
     }
@@ -13,10 +13,10 @@ ElectrumTx::ElectrumTx(ElectrumTx const &other){
 ElectrumTx& ElectrumTx::operator=(ElectrumTx const &other){
     if (this == &other){ return *this; } // self-assignment
     if(tx.inputsNumber > 0){
-        delete [] txInsMeta;
+        ubtc_delete_array(txInsMeta);
     }
     tx = other.tx;
-    txInsMeta = new ElectrumInputMetadata[tx.inputsNumber];
+    txInsMeta = ubtc_new_array<ElectrumInputMetadata>(tx.inputsNumber);
     for(unsigned int i=0; i<tx.inputsNumber; i++){
         txInsMeta[i] = other.txInsMeta[i];
     }
@@ -31,7 +31,7 @@ size_t ElectrumTx::from_stream(ParseStream *s){
     }
     if(status == PARSING_DONE){
         if(tx.inputsNumber > 0){
-            delete [] txInsMeta;
+            ubtc_delete_array(txInsMeta);
         }
         txInsMeta = NULL;
         tx = Tx();
@@ -55,7 +55,7 @@ size_t ElectrumTx::from_stream(ParseStream *s){
         if(tx.getStatus() == PARSING_DONE){
             status = PARSING_DONE;
             is_segwit = false;
-            txInsMeta = new ElectrumInputMetadata[tx.inputsNumber];
+            txInsMeta = ubtc_new_array<ElectrumInputMetadata>(tx.inputsNumber);
             for(unsigned i=0; i<tx.inputsNumber; i++){
                 if(tx.txIns[i].scriptSig.length() != 88){ // no idea how to parse other things
                     status = PARSING_FAILED;
@@ -85,7 +85,7 @@ size_t ElectrumTx::from_stream(ParseStream *s){
             tx.setStatus(PARSING_DONE);
             tx.locktime = 0;
             is_segwit = true;
-            txInsMeta = new ElectrumInputMetadata[tx.inputsNumber];
+            txInsMeta = ubtc_new_array<ElectrumInputMetadata>(tx.inputsNumber);
             for(unsigned int i=0; i<tx.inputsNumber; i++){
                 txInsMeta[i].amount = 0;
                 txInsMeta[i].derivation[0] = 0;
@@ -142,7 +142,7 @@ size_t ElectrumTx::from_stream(ParseStream *s){
     return bytes_read;
 }
 ElectrumTx::~ElectrumTx(){
-    delete [] txInsMeta;
+    ubtc_delete_array(txInsMeta);
 }
 uint8_t ElectrumTx::sign(const HDPrivateKey account){
     uint8_t res = 0; // number of signed inputs
@@ -1,17 +1,50 @@
 #include "PSBT.h"
 #include "Conversion.h"
+#if PSBT_SIGN_DUAL_CORE
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#endif
 #if USE_STD_STRING
 using std::string;
 #define String string
 #endif
 
-#define UBTC_ERR_PSBT_MAGIC 1
-#define UBTC_ERR_PSBT_SCOPE 2
-#define UBTC_ERR_PSBT_KEY 	3
-#define UBTC_ERR_PSBT_VALUE 4
-#define UBTC_ERR_PSBT_TX    5
-#define UBTC_ERR_PSBT_IN    6
-#define UBTC_ERR_PSBT_OUT   7
+// keys and values up to this length are copied to the stack in PSBT::add
+#define PSBT_RECORD_INLINE_SIZE 100
+
+// number of signatures PSBT::sign calculates at once
+#define PSBT_SIGN_BATCH      8
+// derived parent keys (accounts, branches) cached by PSBT::sign
+#define PSBT_KEY_CACHE_SIZE  6
+#define PSBT_KEY_CACHE_DEPTH 10
+
+#define PSBT_SIGN_TASK_STACK 6144
+
+// derived key node for PSBT::sign
+typedef struct{
+    uint32_t path[PSBT_KEY_CACHE_DEPTH];
+    uint8_t depth;
+    HDPrivateKey key;
+} PSBTKeyNode;
+
+typedef struct PSBTKeyCache{
+    uint8_t chainCode[32]; // root the nodes are derived from
+    PSBTKeyNode nodes[PSBT_KEY_CACHE_SIZE];
+    size_t len;
+    size_t next;
+} PSBTKeyCache;
+
+// signature PSBT::sign has to calculate
+typedef struct{
+    size_t input;
+    PrivateKey pk;
+    PublicKey pubkey;
+    uint64_t amount;
+    const Script * script; // NULL for P2WPKH and P2SH_P2WPKH
+    bool segwit;
+    Signature signature;
+} PSBTSignJob;
 
 // descriptor checksum from https://github.com/bitcoin/bitcoin/blob/master/src/script/descriptor.cpp
 uint64_t PolyMod(uint64_t c, int val){
@@ -86,6 +119,7 @@ String descriptorChecksum(String descriptor){
 #endif
 
 size_t PSBT::from_stream(ParseStream *s){
+    ArenaScope scope(arena);
     if(status == PARSING_FAILED){
         return 0;
     }
@@ -96,29 +130,29 @@ size_t PSBT::from_stream(ParseStream *s){
                 if(txInsMeta[i].derivationsLen > 0){
                     for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
                         if(txInsMeta[i].derivations[j].derivationLen > 0){
-                            free(txInsMeta[i].derivations[j].derivation);
+                            ubtc_free(txInsMeta[i].derivations[j].derivation);
                         }
                     }
-                    delete [] txInsMeta[i].derivations;
+                    ubtc_delete_array(txInsMeta[i].derivations);
                 }
-                if(txInsMeta[i].signaturesLen > 0){
-                    delete [] txInsMeta[i].signatures;
+                if(txInsMeta[i].signaturesCapacity > 0){
+                    ubtc_delete_array(txInsMeta[i].signatures);
                 }
             }
-            delete [] txInsMeta;
+            ubtc_delete_array(txInsMeta);
         }
         if(tx.outputsNumber > 0){
             for(size_t i=0; i<tx.outputsNumber; i++){
                 if(txOutsMeta[i].derivationsLen > 0){
                     for(size_t j=0; j<txOutsMeta[i].derivationsLen; j++){
                         if(txOutsMeta[i].derivations[j].derivationLen > 0){
-                            free(txOutsMeta[i].derivations[j].derivation);
+                            ubtc_free(txOutsMeta[i].derivations[j].derivation);
                         }
                     }
-                    delete [] txOutsMeta[i].derivations;
+                    ubtc_delete_array(txOutsMeta[i].derivations);
                 }
             }
-            delete [] txOutsMeta;
+            ubtc_delete_array(txOutsMeta);
         }
         tx.reset();
         bytes_parsed = 0;
@@ -162,19 +196,19 @@ size_t PSBT::from_stream(ParseStream *s){
         return bytes_read;
     }
     if(last_key_pos == 5 && value.getStatus() == PARSING_DONE && key.getStatus() == PARSING_DONE){
-        uint8_t * arr = (uint8_t *)calloc(key.length(), sizeof(uint8_t));
+        uint8_t * arr = (uint8_t *)ubtc_calloc(key.length(), sizeof(uint8_t));
         if(arr == NULL){ status = PARSING_FAILED; return 0; }
         key.serialize(arr, key.length());
         if(key.length() != 2 || arr[0] != 1 || arr[1] != 0){
             status = PARSING_FAILED;
             ubtc_errno = UBTC_ERR_PSBT_SCOPE;
         }
-        free(arr);
+        ubtc_free(arr);
         if(status == PARSING_FAILED){
             bytes_parsed += bytes_read;
             return bytes_read;
         }
-        arr = (uint8_t *)calloc(value.length(), sizeof(uint8_t));
+        arr = (uint8_t *)ubtc_calloc(value.length(), sizeof(uint8_t));
         if(arr == NULL){ status = PARSING_FAILED; return 0; }
         value.serialize(arr, value.length());
         size_t l = lenVarInt(value.length());
@@ -182,23 +216,24 @@ size_t PSBT::from_stream(ParseStream *s){
         if(tx.getStatus() != PARSING_DONE){
             status = PARSING_FAILED;
         }
-        free(arr);
+        ubtc_free(arr);
         if(status == PARSING_FAILED){
             bytes_parsed += bytes_read;
             return bytes_read;
         }
-        txInsMeta = new PSBTInputMetadata[tx.inputsNumber];
+        txInsMeta = ubtc_new_array<PSBTInputMetadata>(tx.inputsNumber);
         for(size_t i=0; i<tx.inputsNumber; i++){
             txInsMeta[i].derivationsLen = 0;
             txInsMeta[i].signaturesLen = 0;
+            txInsMeta[i].signaturesCapacity = 0;
         }
-        txOutsMeta = new PSBTOutputMetadata[tx.outputsNumber];
+        txOutsMeta = ubtc_new_array<PSBTOutputMetadata>(tx.outputsNumber);
         for(size_t i=0; i<tx.outputsNumber; i++){
             txOutsMeta[i].derivationsLen = 0;
         }
         last_key_pos += key.length()+value.length();
     }
-    uint8_t sections_number = 0;
+    size_t sections_number = 0;
     if(last_key_pos > 5){ // tx is already parsed
         sections_number = 1+tx.inputsNumber+tx.outputsNumber;
     }
@@ -248,21 +283,31 @@ size_t PSBT::from_stream(ParseStream *s){
     return bytes_read;
 }
 
-int PSBT::add(uint8_t section, const Script * k, const Script * v){
+int PSBT::add(size_t section, const Script * k, const Script * v){
+    ArenaScope scope(arena);
     if(section == 0 || section > 1+tx.inputsNumber+tx.outputsNumber){
         return 0;
     }
-    uint8_t * key_arr = (uint8_t *)calloc(k->length(), sizeof(uint8_t));
-    if(key_arr == NULL){ return 0; }
+    // keys and most of the values are short, only utxos and scripts need the heap
+    uint8_t key_buf[PSBT_RECORD_INLINE_SIZE];
+    uint8_t val_buf[PSBT_RECORD_INLINE_SIZE];
+    uint8_t * key_arr = key_buf;
+    if(k->length() > sizeof(key_buf)){
+        key_arr = (uint8_t *)ubtc_calloc(k->length(), sizeof(uint8_t));
+        if(key_arr == NULL){ return 0; }
+    }
     k->serialize(key_arr, k->length());
-    uint8_t * val_arr = (uint8_t *)calloc(v->length(), sizeof(uint8_t));
-    if(val_arr == NULL){ free(key_arr); return 0; }
+    uint8_t * val_arr = val_buf;
+    if(v->length() > sizeof(val_buf)){
+        val_arr = (uint8_t *)ubtc_calloc(v->length(), sizeof(uint8_t));
+        if(val_arr == NULL){ if(key_arr != key_buf){ ubtc_free(key_arr); } return 0; }
+    }
     v->serialize(val_arr, v->length());
     uint8_t key_code = key_arr[lenVarInt(k->length())];
     int res = 0;
 
     if(section < 1+tx.inputsNumber){ // input section
-        uint8_t input = section-1;
+        size_t input = section-1;
         switch(key_code){
             case 0: { // PSBT_IN_NON_WITNESS_UTXO
                 // we need to verify that tx hashes to prevtx_hash
@@ -271,23 +316,17 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                     res = -1;
                     break;
                 }
-                Tx tempTx;
-                tempTx.parse(val_arr+lenVarInt(v->length()), v->length()-lenVarInt(v->length()));
-                if(tempTx.getStatus() != PARSING_DONE){
-                    res = -2;
-                    break;
-                }
-                uint8_t hash[32];
-                tempTx.hash(hash);
-                if(memcmp(hash, tx.txIns[input].hash, 32) != 0){
+                uint64_t amount;
+                const uint8_t * script;
+                size_t script_len;
+                if(!rawTxOutput(val_arr+lenVarInt(v->length()), v->length()-lenVarInt(v->length()),
+                                tx.txIns[input].hash, tx.txIns[input].outputIndex,
+                                &amount, &script, &script_len)){
                     res = -3;
                     break;
                 }
-                if(tempTx.outputsNumber <= tx.txIns[input].outputIndex){
-                    res = -3;
-                    break;
-                }
-                txInsMeta[input].txOut = tempTx.txOuts[tx.txIns[input].outputIndex];
+                txInsMeta[input].txOut.amount = amount;
+                txInsMeta[input].txOut.scriptPubkey = Script(script, script_len);
                 res = 1;
                 break;
             }
@@ -320,20 +359,7 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                     res = -2;
                     break;
                 }
-                if(txInsMeta[input].signaturesLen == 0){
-                    txInsMeta[input].signaturesLen = 1;
-                    txInsMeta[input].signatures = new PSBTPartialSignature[txInsMeta[input].signaturesLen];
-                }else{
-                    PSBTPartialSignature * p = txInsMeta[input].signatures;
-                    txInsMeta[input].signatures = new PSBTPartialSignature[txInsMeta[input].signaturesLen+1];
-                    for(size_t i=0; i<txInsMeta[input].signaturesLen; i++){
-                        txInsMeta[input].signatures[i] = p[i];
-                    }
-                    txInsMeta[input].signaturesLen++;
-                    delete [] p;
-                }
-                txInsMeta[input].signatures[txInsMeta[input].signaturesLen-1] = psig;
-                res = 1;
+                res = addSignature(input, psig);
                 break;
             }
             case 3: { // PSBT_IN_SIGHASH_TYPE
@@ -366,15 +392,15 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                 }
                 if(txInsMeta[input].derivationsLen == 0){
                     txInsMeta[input].derivationsLen = 1;
-                    txInsMeta[input].derivations = new PSBTDerivation[txInsMeta[input].derivationsLen];
+                    txInsMeta[input].derivations = ubtc_new_array<PSBTDerivation>(txInsMeta[input].derivationsLen);
                 }else{
                     PSBTDerivation * p = txInsMeta[input].derivations;
-                    txInsMeta[input].derivations = new PSBTDerivation[txInsMeta[input].derivationsLen+1];
+                    txInsMeta[input].derivations = ubtc_new_array<PSBTDerivation>(txInsMeta[input].derivationsLen+1);
                     for(size_t i=0; i<txInsMeta[input].derivationsLen; i++){
                         txInsMeta[input].derivations[i] = p[i];
                     }
                     txInsMeta[input].derivationsLen++;
-                    delete [] p;
+                    ubtc_delete_array(p);
                 }
                 PSBTDerivation * der = &txInsMeta[input].derivations[txInsMeta[input].derivationsLen-1];
                 der->pubkey.parse(key_arr+2, k->length()-2);
@@ -384,7 +410,7 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                 }
                 memcpy(der->fingerprint, val_arr+lenVarInt(v->length()), 4);
                 der->derivationLen = (v->length()-lenVarInt(v->length())-4)/sizeof(uint32_t);
-                der->derivation = (uint32_t *)calloc(der->derivationLen, sizeof(uint32_t));
+                der->derivation = (uint32_t *)ubtc_calloc(der->derivationLen, sizeof(uint32_t));
                 if(der->derivation == NULL){ der->derivationLen = 0; res = -1; break; }
                 for(size_t i=0; i<der->derivationLen; i++){
                     der->derivation[i] = littleEndianToInt(val_arr+lenVarInt(v->length())+4*(i+1),4);
@@ -402,7 +428,7 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
             }
         }
     }else{ // output section
-        uint8_t output = section-1-tx.inputsNumber;
+        size_t output = section-1-tx.inputsNumber;
         switch(key_code){
             case 0: { // PSBT_OUT_REDEEM_SCRIPT
                 if(k->length() != 2){
@@ -428,15 +454,15 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                 }
                 if(txOutsMeta[output].derivationsLen == 0){
                     txOutsMeta[output].derivationsLen = 1;
-                    txOutsMeta[output].derivations = new PSBTDerivation[txOutsMeta[output].derivationsLen];
+                    txOutsMeta[output].derivations = ubtc_new_array<PSBTDerivation>(txOutsMeta[output].derivationsLen);
                 }else{
                     PSBTDerivation * p = txOutsMeta[output].derivations;
-                    txOutsMeta[output].derivations = new PSBTDerivation[txOutsMeta[output].derivationsLen+1];
+                    txOutsMeta[output].derivations = ubtc_new_array<PSBTDerivation>(txOutsMeta[output].derivationsLen+1);
                     for(int i=0; i<txOutsMeta[output].derivationsLen; i++){
                         txOutsMeta[output].derivations[i] = p[i];
                     }
                     txOutsMeta[output].derivationsLen++;
-                    delete [] p;
+                    ubtc_delete_array(p);
                 }
                 PSBTDerivation * der = &txOutsMeta[output].derivations[txOutsMeta[output].derivationsLen-1];
                 der->pubkey.parse(key_arr+2, k->length()-2);
@@ -446,7 +472,7 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
                 }
                 memcpy(der->fingerprint, val_arr+lenVarInt(v->length()), 4);
                 der->derivationLen = (v->length()-lenVarInt(v->length())-4)/sizeof(uint32_t);
-                der->derivation = (uint32_t *)calloc(der->derivationLen, sizeof(uint32_t));
+                der->derivation = (uint32_t *)ubtc_calloc(der->derivationLen, sizeof(uint32_t));
                 if(der->derivation == NULL){ der->derivationLen = 0; res = -1; break; }
                 for(size_t i=0; i<der->derivationLen; i++){
                     der->derivation[i] = littleEndianToInt(val_arr+lenVarInt(v->length())+4*(i+1),4);
@@ -456,11 +482,45 @@ int PSBT::add(uint8_t section, const Script * k, const Script * v){
             }
         }
     }
-    free(key_arr);
-    free(val_arr);
+    if(key_arr != key_buf){
+        ubtc_free(key_arr);
+    }
+    if(val_arr != val_buf){
+        ubtc_free(val_arr);
+    }
     return res; // by default - ignore the key-value pair
 }
 
+int PSBT::addSignature(size_t inputIndex, const PSBTPartialSignature &psig){
+    ArenaScope scope(arena);
+    if(inputIndex >= tx.inputsNumber){
+        return 0;
+    }
+    PSBTInputMetadata * meta = &txInsMeta[inputIndex];
+    if(meta->signaturesLen == 0xFF){
+        return -1;
+    }
+    if(meta->signaturesLen == meta->signaturesCapacity){
+        // grow geometrically, multisig inputs collect signatures one by one
+        size_t capacity = (meta->signaturesCapacity > 0) ? 2*meta->signaturesCapacity : 2;
+        if(capacity > 0xFF){
+            capacity = 0xFF;
+        }
+        PSBTPartialSignature * p = ubtc_new_array<PSBTPartialSignature>(capacity);
+        for(size_t i=0; i<meta->signaturesLen; i++){
+            p[i] = meta->signatures[i];
+        }
+        if(meta->signaturesCapacity > 0){
+            ubtc_delete_array(meta->signatures);
+        }
+        meta->signatures = p;
+        meta->signaturesCapacity = capacity;
+    }
+    meta->signatures[meta->signaturesLen] = psig;
+    meta->signaturesLen++;
+    return 1;
+}
+
 size_t PSBT::to_stream(SerializeStream *s, size_t offset) const{
     // PSBT prefix + raw transaction key
     uint8_t prefix[] = {0x70, 0x73, 0x62, 0x74, 0xff, 0x01, 0x00};
@@ -481,11 +541,11 @@ size_t PSBT::to_stream(SerializeStream *s, size_t offset) const{
         bytes_written += s->serialize(&tx, offset+bytes_written-cur);
     }
     cur+=tx.length();
-    uint8_t sections_number = 1 + tx.inputsNumber + tx.outputsNumber;
-    uint8_t section = 0;
+    size_t sections_number = 1 + tx.inputsNumber + tx.outputsNumber;
+    size_t section = 0;
     while(s->available() && section < sections_number){
         if(section > 0 && section < tx.inputsNumber+1){
-            uint8_t input = section-1;
+            size_t input = section-1;
             for(size_t i=0; i<txInsMeta[input].signaturesLen; i++){
                 uint8_t key_arr[67];
                 key_arr[1] = 0x02; // PSBT_IN_PARTIAL_SIG
@@ -516,7 +576,7 @@ size_t PSBT::to_stream(SerializeStream *s, size_t offset) const{
 }
 
 size_t PSBT::length() const{
-    uint8_t sections_number = 1 + tx.inputsNumber + tx.outputsNumber;
+    size_t sections_number = 1 + tx.inputsNumber + tx.outputsNumber;
     size_t len = 7 + lenVarInt(tx.length()) + tx.length() + sections_number;
     for(size_t input=0; input<tx.inputsNumber; input++){
         for(size_t i=0; i<txInsMeta[input].signaturesLen; i++){
@@ -529,34 +589,39 @@ size_t PSBT::length() const{
 
 PSBT::PSBT(PSBT const &other){
     reset();
-    txInsMeta = NULL; txOutsMeta = NULL; status = PARSING_DONE; current_section = 0; last_key_pos = 0;
+    txInsMeta = NULL; txOutsMeta = NULL; status = PARSING_DONE; current_section = 0; last_key_pos = 0; keyCache = NULL;
+    arena = other.arena;
+    ArenaScope scope(arena);
     tx = other.tx;
     status = other.status;
-    txInsMeta = new PSBTInputMetadata[tx.inputsNumber];
-    txOutsMeta = new PSBTOutputMetadata[tx.outputsNumber];
+    txInsMeta = ubtc_new_array<PSBTInputMetadata>(tx.inputsNumber);
+    txOutsMeta = ubtc_new_array<PSBTOutputMetadata>(tx.outputsNumber);
     for(size_t i=0; i<tx.inputsNumber; i++){
         txInsMeta[i] = other.txInsMeta[i];
-        txInsMeta[i].derivations = new PSBTDerivation[txInsMeta[i].derivationsLen];
+        txInsMeta[i].derivations = ubtc_new_array<PSBTDerivation>(txInsMeta[i].derivationsLen);
         for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
             txInsMeta[i].derivations[j] = other.txInsMeta[i].derivations[j];
-            txInsMeta[i].derivations[j].derivation = (uint32_t *)calloc(txInsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
+            txInsMeta[i].derivations[j].derivation = (uint32_t *)ubtc_calloc(txInsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
             if(txInsMeta[i].derivations[j].derivation == NULL){
                 txInsMeta[i].derivations[j].derivationLen = 0;
             }else{
                 memcpy(txInsMeta[i].derivations[j].derivation, other.txInsMeta[i].derivations[j].derivation, txInsMeta[i].derivations[j].derivationLen*sizeof(uint32_t));
             }
         }
-        txInsMeta[i].signatures = new PSBTPartialSignature[txInsMeta[i].signaturesLen];
-        for(size_t j=0; j<txInsMeta[i].signaturesLen; j++){
-            txInsMeta[i].signatures[j] = other.txInsMeta[i].signatures[j];
+        txInsMeta[i].signaturesCapacity = txInsMeta[i].signaturesLen;
+        if(txInsMeta[i].signaturesLen > 0){
+            txInsMeta[i].signatures = ubtc_new_array<PSBTPartialSignature>(txInsMeta[i].signaturesLen);
+            for(size_t j=0; j<txInsMeta[i].signaturesLen; j++){
+                txInsMeta[i].signatures[j] = other.txInsMeta[i].signatures[j];
+            }
         }
     }
     for(size_t i=0; i<tx.outputsNumber; i++){
         txOutsMeta[i] = other.txOutsMeta[i];
-        txOutsMeta[i].derivations = new PSBTDerivation[txOutsMeta[i].derivationsLen];
+        txOutsMeta[i].derivations = ubtc_new_array<PSBTDerivation>(txOutsMeta[i].derivationsLen);
         for(size_t j=0; j<txOutsMeta[i].derivationsLen; j++){
             txOutsMeta[i].derivations[j] = other.txOutsMeta[i].derivations[j];
-            txOutsMeta[i].derivations[j].derivation = (uint32_t *)calloc(txOutsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
+            txOutsMeta[i].derivations[j].derivation = (uint32_t *)ubtc_calloc(txOutsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
             if(txOutsMeta[i].derivations[j].derivation == NULL){
                 txOutsMeta[i].derivations[j].derivationLen = 0;
             }else{
@@ -573,112 +638,328 @@ PSBT::~PSBT(){
             if(txInsMeta[i].derivationsLen > 0){
                 for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
                     if(txInsMeta[i].derivations[j].derivationLen > 0){
-                        free(txInsMeta[i].derivations[j].derivation);
+                        ubtc_free(txInsMeta[i].derivations[j].derivation);
                     }
                 }
-                delete [] txInsMeta[i].derivations;
+                ubtc_delete_array(txInsMeta[i].derivations);
             }
-            if(txInsMeta[i].signaturesLen > 0){
-                delete [] txInsMeta[i].signatures;
+            if(txInsMeta[i].signaturesCapacity > 0){
+                ubtc_delete_array(txInsMeta[i].signatures);
             }
         }
-        delete [] txInsMeta;
+        ubtc_delete_array(txInsMeta);
     }
     if(tx.outputsNumber > 0){
         for(size_t i=0; i<tx.outputsNumber; i++){
             if(txOutsMeta[i].derivationsLen > 0){
                 for(size_t j=0; j<txOutsMeta[i].derivationsLen; j++){
                     if(txOutsMeta[i].derivations[j].derivationLen > 0){
-                        free(txOutsMeta[i].derivations[j].derivation);
+                        ubtc_free(txOutsMeta[i].derivations[j].derivation);
                     }
                 }
-                delete [] txOutsMeta[i].derivations;
+                ubtc_delete_array(txOutsMeta[i].derivations);
             }
         }
-        delete [] txOutsMeta;
+        ubtc_delete_array(txOutsMeta);
+    }
+    psbtKeyCacheFree(&keyCache);
+}
+
+// derived nodes reused by PSBT::sign - account and branch keys of the inputs
+static PSBTKeyCache * psbtKeyCacheFor(PSBTKeyCache ** cache, const HDPrivateKey &root){
+    if(*cache == NULL){
+        *cache = ubtc_new<PSBTKeyCache>();
+        if(*cache == NULL){
+            return NULL;
+        }
+        (*cache)->len = 0;
+        (*cache)->next = 0;
+        memcpy((*cache)->chainCode, root.chainCode, 32);
+    }
+    if(memcmp((*cache)->chainCode, root.chainCode, 32) != 0){ // other root
+        (*cache)->len = 0;
+        (*cache)->next = 0;
+        memcpy((*cache)->chainCode, root.chainCode, 32);
     }
+    return *cache;
 }
 
-uint8_t PSBT::sign(const HDPrivateKey root){
+static void psbtKeyCacheInsert(PSBTKeyCache * cache, const uint32_t * path, uint8_t depth, const HDPrivateKey &key){
+    PSBTKeyNode * node;
+    if(cache->len < PSBT_KEY_CACHE_SIZE){
+        node = &cache->nodes[cache->len];
+        cache->len++;
+    }else{ // round robin
+        node = &cache->nodes[cache->next];
+        cache->next = (cache->next+1) % PSBT_KEY_CACHE_SIZE;
+    }
+    memcpy(node->path, path, depth*sizeof(uint32_t));
+    node->depth = depth;
+    node->key = key;
+}
+
+static HDPrivateKey psbtKeyCacheDerive(PSBTKeyCache * cache, const HDPrivateKey &root, const uint32_t * path, size_t len){
+    if(len == 0 || len > PSBT_KEY_CACHE_DEPTH){
+        return root.derive((uint32_t *)path, len);
+    }
+    size_t hardened = 0;
+    while(hardened < len && path[hardened] >= 0x80000000){
+        hardened++;
+    }
+    // deepest cached parent
+    const HDPrivateKey * parent = &root;
+    size_t depth = 0;
+    for(size_t i=0; i<cache->len; i++){
+        PSBTKeyNode * node = &cache->nodes[i];
+        if(node->depth < len && node->depth > depth && memcmp(node->path, path, node->depth*sizeof(uint32_t)) == 0){
+            parent = &node->key;
+            depth = node->depth;
+        }
+    }
+    HDPrivateKey key = *parent;
+    while(depth < len-1){
+        key = key.derive((uint32_t *)path+depth, 1);
+        depth++;
+        if(depth == hardened || depth == len-1){
+            psbtKeyCacheInsert(cache, path, depth, key);
+        }
+    }
+    return key.derive((uint32_t *)path+len-1, 1);
+}
+
+void psbtKeyCacheFree(PSBTKeyCache ** cache){
+    ubtc_delete(*cache); // HDPrivateKey destructor wipes the keys
+    *cache = NULL;
+}
+
+bool psbtSigningKey(PSBTKeyCache ** cache, const HDPrivateKey &root, const uint8_t fingerprint[4], const PSBTDerivation &der, PrivateKey * pk){
+    if(memcmp(fingerprint, der.fingerprint, 4) != 0){
+        return false;
+    }
+    PSBTKeyCache * keys = psbtKeyCacheFor(cache, root);
+    PrivateKey key;
+    if(keys != NULL){
+        key = psbtKeyCacheDerive(keys, root, der.derivation, der.derivationLen);
+    }else{ // out of memory, derive from the root
+        key = root.derive(der.derivation, der.derivationLen);
+    }
+    if(!(der.pubkey == key.publicKey())){
+        return false;
+    }
+    *pk = key;
+    return true;
+}
+
+PSBTSignMode psbtSignMode(bool witnessScript, bool redeemScript, bool redeemP2WPKH, bool scriptPubkeyP2WPKH){
+    if(witnessScript){
+        return PSBT_SIGN_WITNESS_SCRIPT;
+    }
+    if(redeemScript){
+        return redeemP2WPKH ? PSBT_SIGN_WITNESS_KEY : PSBT_SIGN_REDEEM_SCRIPT;
+    }
+    return scriptPubkeyP2WPKH ? PSBT_SIGN_WITNESS_KEY : PSBT_SIGN_SCRIPT_PUBKEY;
+}
+
+static void psbtSignJobs(const Tx * tx, PSBTSignJob * jobs, size_t len, size_t start, size_t step, const SegwitSigHashCache * cache){
+    for(size_t i=start; i<len; i+=step){
+        PSBTSignJob * job = &jobs[i];
+        uint8_t h[32];
+        if(!job->segwit){ // P2SH / P2PKH / DIRECT_SCRIPT
+            tx->sigHash(h, job->input, *job->script);
+        }else if(job->script != NULL){ // P2WSH / P2SH_P2WSH
+            tx->sigHashSegwit(h, job->input, *job->script, job->amount, SIGHASH_ALL, cache);
+        }else{ // P2WPKH / P2SH_P2WPKH
+            tx->sigHashSegwit(h, job->input, Script(job->pubkey, P2PKH), job->amount, SIGHASH_ALL, cache);
+        }
+        job->signature = job->pk.sign(h);
+    }
+}
+
+#if PSBT_SIGN_DUAL_CORE
+typedef struct{
+    const Tx * tx;
+    PSBTSignJob * jobs;
+    size_t len;
+    const SegwitSigHashCache * cache;
+    SemaphoreHandle_t done;
+} PSBTSignBatch;
+
+static void psbtSignTask(void * parameters){
+    PSBTSignBatch * batch = (PSBTSignBatch *)parameters;
+    psbtSignJobs(batch->tx, batch->jobs, batch->len, 1, 2, batch->cache);
+    xSemaphoreGive(batch->done);
+    vTaskDelete(NULL);
+}
+#endif
+
+// signs the batch, odd jobs go to the other core if we have one
+static void psbtSignBatch(const Tx * tx, PSBTSignJob * jobs, size_t len, const SegwitSigHashCache * cache){
+#if PSBT_SIGN_DUAL_CORE
+    if(len > 1){
+        PSBTSignBatch batch = { tx, jobs, len, cache, xSemaphoreCreateBinary() };
+        if(batch.done != NULL){
+            if(xTaskCreatePinnedToCore(psbtSignTask, "psbtSignTask", PSBT_SIGN_TASK_STACK, &batch,
+                                       uxTaskPriorityGet(NULL), NULL, (xPortGetCoreID()+1) % portNUM_PROCESSORS) == pdPASS){
+                psbtSignJobs(tx, jobs, len, 0, 2, cache);
+                xSemaphoreTake(batch.done, portMAX_DELAY);
+                vSemaphoreDelete(batch.done);
+                return;
+            }
+            vSemaphoreDelete(batch.done);
+        }
+    }
+#endif
+    psbtSignJobs(tx, jobs, len, 0, 1, cache);
+}
+
+static size_t psbtAddSignatures(PSBT * psbt, const PSBTSignJob * jobs, size_t len){
+    for(size_t i=0; i<len; i++){
+        PSBTPartialSignature psig;
+        psig.pubkey = jobs[i].pubkey;
+        psig.signature = jobs[i].signature;
+        psbt->addSignature(jobs[i].input, psig);
+    }
+    return len;
+}
+
+size_t PSBT::sign(const HDPrivateKey root){
+    ArenaScope scope(arena);
     uint8_t fingerprint[4];
     root.fingerprint(fingerprint);
-    uint8_t counter = 0;
-    // in most cases only one account key is required, so we can cache it
-    uint32_t * first_derivation = NULL;
-    uint8_t first_derivation_len = 0;
-    HDPrivateKey account;
+    size_t counter = 0;
+    PSBTSignJob single;
+    size_t batch = PSBT_SIGN_BATCH;
+    PSBTSignJob * jobs = ubtc_new_array<PSBTSignJob>(batch);
+    if(jobs == NULL){ // out of memory, sign one input at a time on this core
+        jobs = &single;
+        batch = 1;
+    }
+    size_t jobs_len = 0;
+    // BIP143 hashes are shared by all segwit inputs, computed on first use
+    SegwitSigHashCache segwit_cache;
+    bool segwit_cache_ready = false;
     for(size_t i=0; i<tx.inputsNumber; i++){
-        if(txInsMeta[i].derivationsLen > 0){
-            for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
-                if(memcmp(fingerprint, txInsMeta[i].derivations[j].fingerprint, 4) == 0){
-                    // caching account key here
-                    if(first_derivation == NULL){
-                        first_derivation = txInsMeta[i].derivations[j].derivation;
-                        first_derivation_len = 0;
-                        for(size_t k=0; k < txInsMeta[i].derivations[j].derivationLen; k++){
-                            if(txInsMeta[i].derivations[j].derivation[k] >= 0x80000000){
-                                first_derivation_len++;
-                            }else{
-                                break;
-                            }
-                        }
-                        account = root.derive(first_derivation, first_derivation_len);
-                    }
-                    PrivateKey pk;
-                    // checking if cached key is ok
-                    if(memcmp(first_derivation, txInsMeta[i].derivations[j].derivation, first_derivation_len*sizeof(uint32_t))==0){
-                        pk = account.derive(txInsMeta[i].derivations[j].derivation+first_derivation_len, txInsMeta[i].derivations[j].derivationLen - first_derivation_len);
-                    }else{
-                        pk = root.derive(txInsMeta[i].derivations[j].derivation, txInsMeta[i].derivations[j].derivationLen);
-                    }
-                    if(txInsMeta[i].derivations[j].pubkey == pk.publicKey()){
-                        // can sign - let's sign
-                        uint8_t h[32];
-                        if(txInsMeta[i].witnessScript.length() > 1){ // P2WSH / P2SH_P2WSH
-                            tx.sigHashSegwit(h, i, txInsMeta[i].witnessScript, txInsMeta[i].txOut.amount);
-                        }else{
-                            if(txInsMeta[i].redeemScript.length() > 1){
-                                if(txInsMeta[i].redeemScript.type() == P2WPKH){ // P2SH_P2WPKH
-                                    // tx.sigHashSegwit(h, i, txInsMeta[i].redeemScript, txInsMeta[i].txOut.amount);
-                                    tx.sigHashSegwit(h, i, pk.publicKey().script(), txInsMeta[i].txOut.amount);
-                                }else{ // P2SH
-                                    tx.sigHash(h, i, txInsMeta[i].redeemScript);
-                                }
-                            }else{ // P2WPKH / P2PKH / DIRECT_SCRIPT
-                                if(txInsMeta[i].txOut.scriptPubkey.type() == P2WPKH){
-                                    // tx.sigHashSegwit(h, i, txInsMeta[i].txOut.scriptPubkey, txInsMeta[i].txOut.amount);
-                                    tx.sigHashSegwit(h, i, pk.publicKey().script(), txInsMeta[i].txOut.amount);
-                                }else{ // P2PKH / DIRECT_SCRIPT
-                                    tx.sigHash(h, i, txInsMeta[i].txOut.scriptPubkey);
-                                }
-                            }
-                        }
-                        Signature sig = pk.sign(h);
-
-                        // adding partial signature to the PSBT
-                        uint8_t arr[67];
-                        arr[1] = 0x02; // PSBT_IN_PARTIAL_SIG
-                        uint8_t len = 1 + pk.publicKey().serialize(arr+2, 65);
-                        arr[0] = len;
-                        Script k;
-                        k.parse(arr, len+1);
-
-                        uint8_t varr[100];
-                        len = 1+sig.serialize(varr+1, 99);
-                        varr[0] = len;
-                        varr[len] = SIGHASH_ALL;
-                        Script val;
-                        val.parse(varr, len+1);
-                        add(i+1, &k, &val);
-                        counter++; // can sign
-                    }
-                }
+        PSBTInputMetadata * meta = &txInsMeta[i];
+        for(size_t j=0; j<meta->derivationsLen; j++){
+            PSBTDerivation * der = &meta->derivations[j];
+            // inputs with change on other branches or from other accounts reuse derived parents
+            PrivateKey pk;
+            if(!psbtSigningKey(&keyCache, root, fingerprint, *der, &pk)){
+                continue;
+            }
+            // can sign - let's sign
+            PSBTSignJob * job = &jobs[jobs_len];
+            job->input = i;
+            job->pk = pk;
+            job->pubkey = der->pubkey;
+            job->amount = meta->txOut.amount;
+            switch(psbtSignMode(meta->witnessScript.length() > 1, meta->redeemScript.length() > 1,
+                                meta->redeemScript.type() == P2WPKH, meta->txOut.scriptPubkey.type() == P2WPKH)){
+                case PSBT_SIGN_WITNESS_SCRIPT:
+                    job->segwit = true;
+                    job->script = &meta->witnessScript;
+                    break;
+                case PSBT_SIGN_WITNESS_KEY:
+                    job->segwit = true;
+                    job->script = NULL;
+                    break;
+                case PSBT_SIGN_REDEEM_SCRIPT:
+                    job->segwit = false;
+                    job->script = &meta->redeemScript;
+                    break;
+                default:
+                    job->segwit = false;
+                    job->script = &meta->txOut.scriptPubkey;
+                    break;
+            }
+            if(job->segwit && !segwit_cache_ready){
+                tx.sigHashSegwitCache(&segwit_cache);
+                segwit_cache_ready = true;
+            }
+            jobs_len++;
+            if(jobs_len == batch){
+                psbtSignBatch(&tx, jobs, jobs_len, &segwit_cache);
+                counter += psbtAddSignatures(this, jobs, jobs_len);
+                jobs_len = 0;
             }
         }
     }
+    if(jobs_len > 0){
+        psbtSignBatch(&tx, jobs, jobs_len, &segwit_cache);
+        counter += psbtAddSignatures(this, jobs, jobs_len);
+    }
+    if(jobs != &single){
+        ubtc_delete_array(jobs);
+    }
     return counter;
 }
 
+// change has to pay to a single-key script of our key, multisig outputs are shown as spending
+static bool psbtIsOwnScript(const Script &scriptPubkey, const PublicKey &pubkey){
+    switch(scriptPubkey.type()){
+        case P2WPKH:
+            return scriptPubkey == Script(pubkey, P2WPKH);
+        case P2PKH:
+            return scriptPubkey == Script(pubkey, P2PKH);
+        case P2SH: // nested segwit
+            return scriptPubkey == Script(Script(pubkey, P2WPKH), P2SH);
+        default:
+            return false;
+    }
+}
+
+size_t PSBT::review(const HDPrivateKey root, PSBTReview * summary, PSBTReviewOutput * outputs, size_t outputsLen, const Network * network){
+    ArenaScope scope(arena);
+    memset(summary, 0, sizeof(PSBTReview));
+    summary->inputsNumber = tx.inputsNumber;
+    summary->outputsNumber = tx.outputsNumber;
+    summary->amountsKnown = true;
+    uint8_t fingerprint[4];
+    root.fingerprint(fingerprint);
+    for(size_t i=0; i<tx.inputsNumber; i++){
+        if(txInsMeta[i].txOut.amount == 0){
+            summary->amountsKnown = false;
+        }
+        summary->inputsAmount += txInsMeta[i].txOut.amount;
+        for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
+            if(memcmp(fingerprint, txInsMeta[i].derivations[j].fingerprint, 4) == 0){
+                summary->ownInputs++;
+                break;
+            }
+        }
+    }
+    size_t written = 0;
+    for(size_t i=0; i<tx.outputsNumber; i++){
+        uint64_t amount = tx.txOuts[i].amount;
+        bool change = false;
+        for(size_t j=0; j<txOutsMeta[i].derivationsLen && !change; j++){
+            PSBTDerivation * der = &txOutsMeta[i].derivations[j];
+            PrivateKey pk;
+            change = psbtSigningKey(&keyCache, root, fingerprint, *der, &pk) && psbtIsOwnScript(tx.txOuts[i].scriptPubkey, der->pubkey);
+        }
+        summary->outputsAmount += amount;
+        if(change){
+            summary->changeNumber++;
+            summary->changeAmount += amount;
+        }else{
+            summary->spendingAmount += amount;
+        }
+        if(outputs != NULL && i < outputsLen){
+            outputs[i].amount = amount;
+            outputs[i].change = change;
+            tx.txOuts[i].scriptPubkey.address(outputs[i].address, PSBT_REVIEW_ADDRESS_LEN, network);
+            written++;
+        }
+    }
+    if(summary->outputsAmount > summary->inputsAmount){
+        summary->amountsKnown = false;
+    }
+    if(summary->amountsKnown){
+        summary->fee = summary->inputsAmount - summary->outputsAmount;
+    }
+    return written;
+}
+
 // TODO: refactor, super unefficient
 #if USE_ARDUINO_STRING || USE_STD_STRING
 size_t PSBT::parseBase64(String b64){
@@ -709,7 +990,7 @@ uint64_t PSBT::fee() const{
     return input_amount-output_amount;
 }
 
-bool PSBT::isMine(uint8_t outputNumber, const HDPublicKey xpub) const{
+bool PSBT::isMine(size_t outputNumber, const HDPublicKey xpub) const{
     bool mine = false;
     if(txOutsMeta[outputNumber].derivationsLen > 0){
         for(unsigned int j=0; j<txOutsMeta[outputNumber].derivationsLen; j++){
@@ -723,7 +1004,7 @@ bool PSBT::isMine(uint8_t outputNumber, const HDPublicKey xpub) const{
     return mine;
 }
 
-bool PSBT::isMine(uint8_t outputNumber, const HDPrivateKey xprv) const{
+bool PSBT::isMine(size_t outputNumber, const HDPrivateKey xprv) const{
     bool mine = false;
     if(txOutsMeta[outputNumber].derivationsLen > 0){
         for(unsigned int j=0; j<txOutsMeta[outputNumber].derivationsLen; j++){
@@ -739,48 +1020,49 @@ bool PSBT::isMine(uint8_t outputNumber, const HDPrivateKey xprv) const{
 
 PSBT& PSBT::operator=(PSBT const &other){
     if (this == &other){ return *this; } // self-assignment
+    ArenaScope scope(arena);
     // free memory
     if(tx.inputsNumber > 0){
         for(size_t i=0; i<tx.inputsNumber; i++){
             if(txInsMeta[i].derivationsLen > 0){
                 for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
                     if(txInsMeta[i].derivations[j].derivationLen > 0){
-                        free(txInsMeta[i].derivations[j].derivation);
+                        ubtc_free(txInsMeta[i].derivations[j].derivation);
                     }
                 }
-                delete [] txInsMeta[i].derivations;
+                ubtc_delete_array(txInsMeta[i].derivations);
             }
-            if(txInsMeta[i].signaturesLen > 0){
-                delete [] txInsMeta[i].signatures;
+            if(txInsMeta[i].signaturesCapacity > 0){
+                ubtc_delete_array(txInsMeta[i].signatures);
             }
         }
-        delete [] txInsMeta;
+        ubtc_delete_array(txInsMeta);
     }
     if(tx.outputsNumber > 0){
         for(size_t i=0; i<tx.outputsNumber; i++){
             if(txOutsMeta[i].derivationsLen > 0){
                 for(size_t j=0; j<txOutsMeta[i].derivationsLen; j++){
                     if(txOutsMeta[i].derivations[j].derivationLen > 0){
-                        free(txOutsMeta[i].derivations[j].derivation);
+                        ubtc_free(txOutsMeta[i].derivations[j].derivation);
                     }
                 }
-                delete [] txOutsMeta[i].derivations;
+                ubtc_delete_array(txOutsMeta[i].derivations);
             }
         }
-        delete [] txOutsMeta;
+        ubtc_delete_array(txOutsMeta);
     }
     // copy
     tx = other.tx;
     status = other.status;
     if(tx.inputsNumber > 0){
-        txInsMeta = new PSBTInputMetadata[tx.inputsNumber];
+        txInsMeta = ubtc_new_array<PSBTInputMetadata>(tx.inputsNumber);
         for(size_t i=0; i<tx.inputsNumber; i++){
             txInsMeta[i] = other.txInsMeta[i];
             if(txInsMeta[i].derivationsLen > 0){
-                txInsMeta[i].derivations = new PSBTDerivation[txInsMeta[i].derivationsLen];
+                txInsMeta[i].derivations = ubtc_new_array<PSBTDerivation>(txInsMeta[i].derivationsLen);
                 for(size_t j=0; j<txInsMeta[i].derivationsLen; j++){
                     txInsMeta[i].derivations[j] = other.txInsMeta[i].derivations[j];
-                    txInsMeta[i].derivations[j].derivation = (uint32_t*)calloc(txInsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
+                    txInsMeta[i].derivations[j].derivation = (uint32_t*)ubtc_calloc(txInsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
                     if(txInsMeta[i].derivations[j].derivation == NULL){
                         txInsMeta[i].derivations[j].derivationLen = 0;
                     }else{
@@ -788,8 +1070,9 @@ PSBT& PSBT::operator=(PSBT const &other){
                     }
                 }
             }
+            txInsMeta[i].signaturesCapacity = txInsMeta[i].signaturesLen;
             if(txInsMeta[i].signaturesLen > 0){
-                txInsMeta[i].signatures = new PSBTPartialSignature[txInsMeta[i].signaturesLen];
+                txInsMeta[i].signatures = ubtc_new_array<PSBTPartialSignature>(txInsMeta[i].signaturesLen);
                 for(size_t j=0; j<txInsMeta[i].signaturesLen; j++){
                     txInsMeta[i].signatures[j] = other.txInsMeta[i].signatures[j];
                 }
@@ -797,13 +1080,13 @@ PSBT& PSBT::operator=(PSBT const &other){
         }
     }
     if(tx.outputsNumber > 0){
-        txOutsMeta = new PSBTOutputMetadata[tx.outputsNumber];
+        txOutsMeta = ubtc_new_array<PSBTOutputMetadata>(tx.outputsNumber);
         for(size_t i=0; i<tx.outputsNumber; i++){
             txOutsMeta[i] = other.txOutsMeta[i];
-            txOutsMeta[i].derivations = new PSBTDerivation[txOutsMeta[i].derivationsLen];
+            txOutsMeta[i].derivations = ubtc_new_array<PSBTDerivation>(txOutsMeta[i].derivationsLen);
             for(size_t j=0; j<txOutsMeta[i].derivationsLen; j++){
                 txOutsMeta[i].derivations[j] = other.txOutsMeta[i].derivations[j];
-                txOutsMeta[i].derivations[j].derivation = (uint32_t *)calloc(txOutsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
+                txOutsMeta[i].derivations[j].derivation = (uint32_t *)ubtc_calloc(txOutsMeta[i].derivations[j].derivationLen, sizeof(uint32_t));
                 if(txOutsMeta[i].derivations[j].derivation == NULL){
                     txOutsMeta[i].derivations[j].derivationLen = 0;
                 }else{
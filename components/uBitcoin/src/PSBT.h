@@ -3,6 +3,15 @@
 
 #include "Bitcoin.h"
 
+#define UBTC_ERR_PSBT_MAGIC 1
+#define UBTC_ERR_PSBT_SCOPE 2
+#define UBTC_ERR_PSBT_KEY 	3
+#define UBTC_ERR_PSBT_VALUE 4
+#define UBTC_ERR_PSBT_TX    5
+#define UBTC_ERR_PSBT_IN    6
+#define UBTC_ERR_PSBT_OUT   7
+#define UBTC_ERR_PSBT_SPACE 8
+
 // TODO: 
 // - SIGHASH types, and other key-value pairs that are still not implemented
 // - finalize()
@@ -42,6 +51,7 @@ typedef struct{
     /** \brief Signatures we will generate. In most cases will be just one. */
     PSBTPartialSignature * signatures;
     uint8_t signaturesLen;
+    uint8_t signaturesCapacity;
 } PSBTInputMetadata;
 
 /** \brief Data required to confirm ownership of the output */
@@ -57,6 +67,61 @@ typedef struct{
     Script witnessScript;
 } PSBTOutputMetadata;
 
+/** \brief Maximum length of the address string in PSBTReviewOutput, including the null terminator */
+#define PSBT_REVIEW_ADDRESS_LEN 76
+
+/** \brief Output as shown on the review screen */
+typedef struct{
+    uint64_t amount;
+    /** \brief Output pays to a single-key script of our root, verified by derivation */
+    bool change;
+    /** \brief Empty for non-standard scripts */
+    char address[PSBT_REVIEW_ADDRESS_LEN];
+} PSBTReviewOutput;
+
+/** \brief Transaction summary filled by PSBT::review() */
+typedef struct{
+    size_t inputsNumber;
+    size_t outputsNumber;
+    /** \brief Inputs with a derivation from our root fingerprint */
+    size_t ownInputs;
+    size_t changeNumber;
+    /** \brief Sum of the input amounts, valid only if amountsKnown is set */
+    uint64_t inputsAmount;
+    uint64_t outputsAmount;
+    /** \brief Sum of the outputs that are not change */
+    uint64_t spendingAmount;
+    uint64_t changeAmount;
+    /** \brief Valid only if amountsKnown is set */
+    uint64_t fee;
+    /** \brief All input amounts are known and they cover the outputs */
+    bool amountsKnown;
+} PSBTReview;
+
+struct PSBTKeyCache;
+
+/** \brief Script an input signature commits to */
+typedef enum{
+    /** \brief P2WSH / P2SH_P2WSH - witness script */
+    PSBT_SIGN_WITNESS_SCRIPT,
+    /** \brief P2WPKH / P2SH_P2WPKH - P2PKH script of the key */
+    PSBT_SIGN_WITNESS_KEY,
+    /** \brief P2SH - redeem script */
+    PSBT_SIGN_REDEEM_SCRIPT,
+    /** \brief P2PKH / DIRECT_SCRIPT - scriptPubkey */
+    PSBT_SIGN_SCRIPT_PUBKEY
+} PSBTSignMode;
+
+/** \brief Picks the script to sign from the scripts present in the input section.
+ *         Shared by PSBT::sign() and PSBTStream::sign().
+ */
+PSBTSignMode psbtSignMode(bool witnessScript, bool redeemScript, bool redeemP2WPKH, bool scriptPubkeyP2WPKH);
+/** \brief Derives the private key of the derivation if it belongs to root and matches the public key.
+ *         Parent keys are kept in the cache, allocated on first use and freed with psbtKeyCacheFree().
+ */
+bool psbtSigningKey(PSBTKeyCache ** cache, const HDPrivateKey &root, const uint8_t fingerprint[4], const PSBTDerivation &der, PrivateKey * pk);
+void psbtKeyCacheFree(PSBTKeyCache ** cache);
+
 /** \brief Calculates descriptor checksum for Bitcoin Core. */
 size_t descriptorChecksum(const char * span, size_t spanLen, char * output, size_t outputSize);
 #if USE_ARDUINO_STRING
@@ -72,11 +137,17 @@ protected:
     virtual size_t to_stream(SerializeStream *s, size_t offset = 0) const;
     Script key; // key for parsing
     Script value; // value for parsing
-    uint8_t current_section;
+    size_t current_section;
     size_t last_key_pos;
+    PSBTKeyCache * keyCache; // derived parents shared by review() and sign()
+    Arena * arena; // session arena for parsing and signing, NULL - heap
 public:
     virtual size_t length() const;
-    PSBT(){ txInsMeta = NULL; txOutsMeta = NULL; status = PARSING_DONE; current_section = 0; last_key_pos = 0; };
+    PSBT(){ txInsMeta = NULL; txOutsMeta = NULL; status = PARSING_DONE; current_section = 0; last_key_pos = 0; keyCache = NULL; arena = NULL; };
+    /** \brief PSBT that allocates from the arena while it is parsed, signed, copied or modified.
+     *         The arena can't be reset() before the PSBT is destroyed.
+     */
+    explicit PSBT(Arena * sessionArena){ txInsMeta = NULL; txOutsMeta = NULL; status = PARSING_DONE; current_section = 0; last_key_pos = 0; keyCache = NULL; arena = sessionArena; };
     PSBT(PSBT const &other);
     ~PSBT();
     Tx tx;
@@ -84,9 +155,18 @@ public:
     PSBTOutputMetadata * txOutsMeta;
 
     /** \brief adds key-value pair to section */
-    int add(uint8_t section, const Script * k, const Script * v);
+    int add(size_t section, const Script * k, const Script * v);
+    /** \brief adds partial signature to the input */
+    int addSignature(size_t inputIndex, const PSBTPartialSignature &psig);
     /** \brief Signes everything it can with keys derived from root HD private key */
-    uint8_t sign(const HDPrivateKey root);
+    size_t sign(const HDPrivateKey root);
+    /** \brief Fills the summary for the review screen in one pass over inputs and outputs:
+     *         totals, fee and change outputs verified with keys derived from root HD private key.
+     *         Details of the first outputsLen outputs are written to outputs array.
+     *         Derived parent keys are kept for the following sign() call.
+     *         Returns number of outputs written.
+     */
+    size_t review(const HDPrivateKey root, PSBTReview * summary, PSBTReviewOutput * outputs = NULL, size_t outputsLen = 0, const Network * network = &DEFAULT_NETWORK);
     /** \brief parses psbt transaction from base64 encoded string */
 #if USE_ARDUINO_STRING
     size_t parseBase64(String b64);
@@ -99,8 +179,8 @@ public:
     /** \brief Calculates fee if input amounts are known */
     uint64_t fee() const;
     /** \brief Verifies if output is mine */
-    bool isMine(uint8_t outputNumber, const HDPublicKey xpub) const;
-    bool isMine(uint8_t outputNumber, const HDPrivateKey xprv) const;
+    bool isMine(size_t outputNumber, const HDPublicKey xpub) const;
+    bool isMine(size_t outputNumber, const HDPrivateKey xprv) const;
     // TODO: add verify() function that checks all the fields (scripts, pubkeys etc)
     // TODO: add isChange() function that would verify the output with respect the inputs
     PSBT &operator=(PSBT const &other);
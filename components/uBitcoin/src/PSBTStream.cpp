@@ -0,0 +1,462 @@
+#include "PSBTStream.h"
+#include "Hash.h"
+
+// every input of the unsigned tx is <prev_hash:32><prev_index:4><00><sequence:4>
+#define PSBT_STREAM_TXIN_LEN 41
+
+/** \brief Key-value pair, both point into the serialized PSBT */
+typedef struct{
+    const uint8_t * key;
+    size_t keyLen;
+    const uint8_t * value;
+    size_t valueLen;
+} PSBTPair;
+
+static size_t varIntLen(uint8_t first){
+    return (first < 0xfd) ? 1 : 1+(1 << (first - 0xfc));
+}
+
+static bool readVarIntAt(const uint8_t * buf, size_t len, size_t * pos, uint64_t * value){
+    if(*pos >= len){
+        return false;
+    }
+    size_t l = varIntLen(buf[*pos]);
+    if(l > len-*pos){
+        return false;
+    }
+    *value = readVarInt(buf+*pos, l);
+    *pos += l;
+    return true;
+}
+
+// reads <len><bytes>
+static bool readSlice(const uint8_t * buf, size_t len, size_t * pos, const uint8_t ** slice, size_t * sliceLen){
+    uint64_t l;
+    if(!readVarIntAt(buf, len, pos, &l) || l > len-*pos){
+        return false;
+    }
+    *slice = buf+*pos;
+    *sliceLen = l;
+    *pos += l;
+    return true;
+}
+
+// reads next pair of the map, keyLen == 0 is the section separator
+static bool readPair(const uint8_t * buf, size_t len, size_t * pos, PSBTPair * pair){
+    if(!readSlice(buf, len, pos, &pair->key, &pair->keyLen)){
+        return false;
+    }
+    if(pair->keyLen == 0){
+        pair->value = NULL;
+        pair->valueLen = 0;
+        return true;
+    }
+    return readSlice(buf, len, pos, &pair->value, &pair->valueLen);
+}
+
+// reads <amount:8><scriptPubkey>
+static bool readTxOut(const uint8_t * buf, size_t len, size_t * pos, uint64_t * amount, const uint8_t ** script, size_t * scriptLen){
+    if(8 > len-*pos){
+        return false;
+    }
+    *amount = littleEndianToInt(buf+*pos, 8);
+    *pos += 8;
+    return readSlice(buf, len, pos, script, scriptLen);
+}
+
+// output spent by txIn, from non_witness_utxo
+static bool prevOutput(const uint8_t * prevTx, size_t prevTxLen, const uint8_t * txIn, uint64_t * amount, const uint8_t ** script, size_t * scriptLen){
+    return rawTxOutput(prevTx, prevTxLen, txIn, littleEndianToInt(txIn+32, 4), amount, script, scriptLen);
+}
+
+static bool isP2WPKH(const uint8_t * script, size_t scriptLen){
+    return (scriptLen == 22) && (script[0] == 0x00) && (script[1] == 20);
+}
+
+PSBTStream::PSBTStream(const uint8_t * psbt, size_t psbtLen){
+    buf = psbt;
+    len = psbtLen;
+    globals_end = 0;
+    tx_start = 0;
+    tx_inputs = 0;
+    tx_outputs = 0;
+    tx_end = 0;
+    psbt_end = 0;
+    verified = false;
+    memset(&summary, 0, sizeof(summary));
+}
+
+bool PSBTStream::verify(){
+    verified = false;
+    memset(&summary, 0, sizeof(summary));
+    uint8_t prefix[] = {0x70, 0x73, 0x62, 0x74, 0xFF};
+    if(len < 5 || memcmp(buf, prefix, 5) != 0){
+        ubtc_errno = UBTC_ERR_PSBT_MAGIC;
+        return false;
+    }
+    // global scope, only the unsigned transaction is used
+    size_t pos = 5;
+    PSBTPair pair;
+    const uint8_t * tx = NULL;
+    size_t txLen = 0;
+    while(true){
+        if(!readPair(buf, len, &pos, &pair)){
+            ubtc_errno = UBTC_ERR_PSBT_KEY;
+            return false;
+        }
+        if(pair.keyLen == 0){
+            break;
+        }
+        if(pair.keyLen == 1 && pair.key[0] == 0x00){
+            if(tx != NULL){ // duplicated key
+                ubtc_errno = UBTC_ERR_PSBT_SCOPE;
+                return false;
+            }
+            tx = pair.value;
+            txLen = pair.valueLen;
+        }
+    }
+    if(tx == NULL){
+        ubtc_errno = UBTC_ERR_PSBT_SCOPE;
+        return false;
+    }
+    globals_end = pos;
+    // unsigned transaction: no witness, empty scriptSigs
+    tx_start = tx-buf;
+    size_t tx_len = tx_start+txLen;
+    size_t p = tx_start;
+    uint64_t n = 0;
+    if(txLen < 10){
+        ubtc_errno = UBTC_ERR_PSBT_TX;
+        return false;
+    }
+    summary.version = littleEndianToInt(buf+p, 4);
+    p += 4;
+    if(!readVarIntAt(buf, tx_len, &p, &n) || n == 0 || n > (tx_len-p)/PSBT_STREAM_TXIN_LEN){
+        ubtc_errno = UBTC_ERR_PSBT_TX;
+        return false;
+    }
+    summary.inputsNumber = n;
+    tx_inputs = p;
+    for(size_t i=0; i<summary.inputsNumber; i++){
+        if(buf[p+36] != 0){
+            ubtc_errno = UBTC_ERR_PSBT_TX;
+            return false;
+        }
+        p += PSBT_STREAM_TXIN_LEN;
+    }
+    tx_outputs = p;
+    if(!readVarIntAt(buf, tx_len, &p, &n) || n > (tx_len-p)/9){
+        ubtc_errno = UBTC_ERR_PSBT_TX;
+        return false;
+    }
+    summary.outputsNumber = n;
+    for(size_t i=0; i<summary.outputsNumber; i++){
+        uint64_t amount;
+        const uint8_t * script;
+        size_t scriptLen;
+        if(!readTxOut(buf, tx_len, &p, &amount, &script, &scriptLen)){
+            ubtc_errno = UBTC_ERR_PSBT_TX;
+            return false;
+        }
+        summary.outputsAmount += amount;
+    }
+    if(tx_len-p != 4){
+        ubtc_errno = UBTC_ERR_PSBT_TX;
+        return false;
+    }
+    tx_end = p;
+    summary.locktime = littleEndianToInt(buf+p, 4);
+    // inputs
+    summary.amountsKnown = true;
+    for(size_t i=0; i<summary.inputsNumber; i++){
+        const uint8_t * txIn = buf+tx_inputs+PSBT_STREAM_TXIN_LEN*i;
+        bool known = false;
+        uint64_t amount = 0;
+        while(true){
+            if(!readPair(buf, len, &pos, &pair)){
+                ubtc_errno = UBTC_ERR_PSBT_IN;
+                return false;
+            }
+            if(pair.keyLen == 0){
+                break;
+            }
+            switch(pair.key[0]){
+                case 0: { // PSBT_IN_NON_WITNESS_UTXO
+                    uint64_t a;
+                    const uint8_t * script;
+                    size_t scriptLen;
+                    if(pair.keyLen != 1 || !prevOutput(pair.value, pair.valueLen, txIn, &a, &script, &scriptLen)){
+                        ubtc_errno = UBTC_ERR_PSBT_IN;
+                        return false;
+                    }
+                    if(!known){
+                        amount = a;
+                        known = true;
+                    }
+                    break;
+                }
+                case 1: { // PSBT_IN_WITNESS_UTXO
+                    size_t p = 0;
+                    uint64_t a;
+                    const uint8_t * script;
+                    size_t scriptLen;
+                    if(pair.keyLen != 1 || !readTxOut(pair.value, pair.valueLen, &p, &a, &script, &scriptLen) || p != pair.valueLen){
+                        ubtc_errno = UBTC_ERR_PSBT_IN;
+                        return false;
+                    }
+                    if(!known){
+                        amount = a;
+                        known = true;
+                    }
+                    break;
+                }
+                case 6: { // PSBT_IN_BIP32_DERIVATION
+                    if((pair.keyLen != 34 && pair.keyLen != 66) || pair.valueLen < 4 || (pair.valueLen % 4) != 0){
+                        ubtc_errno = UBTC_ERR_PSBT_IN;
+                        return false;
+                    }
+                    summary.derivationsNumber++;
+                    break;
+                }
+            }
+        }
+        if(known){
+            summary.inputsAmount += amount;
+        }else{
+            summary.amountsKnown = false;
+        }
+    }
+    // outputs are only checked for structure
+    for(size_t i=0; i<summary.outputsNumber; i++){
+        do{
+            if(!readPair(buf, len, &pos, &pair)){
+                ubtc_errno = UBTC_ERR_PSBT_OUT;
+                return false;
+            }
+        }while(pair.keyLen > 0);
+    }
+    psbt_end = pos;
+    verified = true;
+    return true;
+}
+
+bool PSBTStream::output(size_t outputNumber, TxOut * txOut) const{
+    if(!verified || outputNumber >= summary.outputsNumber){
+        return false;
+    }
+    size_t p = tx_outputs + varIntLen(buf[tx_outputs]);
+    uint64_t amount;
+    const uint8_t * script;
+    size_t scriptLen;
+    for(size_t i=0; i<outputNumber; i++){
+        readTxOut(buf, tx_end, &p, &amount, &script, &scriptLen);
+    }
+    size_t start = p;
+    readTxOut(buf, tx_end, &p, &amount, &script, &scriptLen);
+    return txOut->parse(buf+start, p-start) == p-start;
+}
+
+uint64_t PSBTStream::fee() const{
+    if(!verified || !summary.amountsKnown || summary.outputsAmount > summary.inputsAmount){
+        return 0;
+    }
+    return summary.inputsAmount - summary.outputsAmount;
+}
+
+void PSBTStream::segwitCache(SegwitSigHashCache * cache) const{
+    DoubleSha s;
+    s.begin();
+    for(size_t i=0; i<summary.inputsNumber; i++){
+        s.write(buf+tx_inputs+PSBT_STREAM_TXIN_LEN*i, 36);
+    }
+    s.end(cache->hashPrevouts);
+    s.begin();
+    for(size_t i=0; i<summary.inputsNumber; i++){
+        s.write(buf+tx_inputs+PSBT_STREAM_TXIN_LEN*i+37, 4);
+    }
+    s.end(cache->hashSequence);
+    s.begin();
+    size_t p = tx_outputs + varIntLen(buf[tx_outputs]);
+    s.write(buf+p, tx_end-p);
+    s.end(cache->hashOutputs);
+}
+
+int PSBTStream::sigHash(uint8_t h[32], size_t inputIndex, const uint8_t * script, size_t scriptLen) const{
+    // scriptSigs of the unsigned tx are empty, so it is enough to insert the script
+    size_t p = tx_inputs+PSBT_STREAM_TXIN_LEN*inputIndex+36;
+    uint8_t arr[9];
+    DoubleSha s;
+    s.begin();
+    s.write(buf+tx_start, p-tx_start);
+    size_t l = writeVarInt(scriptLen, arr, sizeof(arr));
+    s.write(arr, l);
+    s.write(script, scriptLen);
+    s.write(buf+p+1, tx_end+4-(p+1));
+    intToLittleEndian(SIGHASH_ALL, arr, 4);
+    s.write(arr, 4);
+    s.end(h);
+    return 32;
+}
+
+int PSBTStream::sigHashSegwit(uint8_t h[32], const uint8_t * txIn, const uint8_t * script, size_t scriptLen, uint64_t amount, const SegwitSigHashCache * cache) const{
+    uint8_t arr[9];
+    DoubleSha s;
+    s.begin();
+    s.write(buf+tx_start, 4); // version
+    s.write(cache->hashPrevouts, 32);
+    s.write(cache->hashSequence, 32);
+    s.write(txIn, 36);
+    size_t l = writeVarInt(scriptLen, arr, sizeof(arr));
+    s.write(arr, l);
+    s.write(script, scriptLen);
+    intToLittleEndian(amount, arr, 8);
+    s.write(arr, 8);
+    s.write(txIn+37, 4); // sequence
+    s.write(cache->hashOutputs, 32);
+    s.write(buf+tx_end, 4); // locktime
+    intToLittleEndian(SIGHASH_ALL, arr, 4);
+    s.write(arr, 4);
+    s.end(h);
+    return 32;
+}
+
+// writes everything or reports the stream is full
+static bool writeAll(SerializeStream * s, const uint8_t * arr, size_t len){
+    return s->write(arr, len) == len;
+}
+
+size_t PSBTStream::sign(const HDPrivateKey root, SerializeStream * s){
+    if(!verified && !verify()){
+        return 0;
+    }
+    uint8_t fingerprint[4];
+    root.fingerprint(fingerprint);
+    size_t counter = 0;
+    // parents of the keys are derived once for all inputs
+    PSBTKeyCache * keys = NULL;
+    SegwitSigHashCache segwit_cache;
+    bool segwit_cache_ready = false;
+    bool complete = writeAll(s, buf, globals_end);
+    size_t pos = globals_end;
+    PSBTPair pair;
+    for(size_t i=0; i<summary.inputsNumber && complete; i++){
+        const uint8_t * txIn = buf+tx_inputs+PSBT_STREAM_TXIN_LEN*i;
+        size_t section = pos;
+        // first walk over the section: everything required to sign
+        uint64_t amount = 0;
+        const uint8_t * scriptPubkey = NULL;
+        size_t scriptPubkeyLen = 0;
+        bool utxo_known = false;
+        bool sighash_all = true;
+        const uint8_t * redeemScript = NULL;
+        size_t redeemScriptLen = 0;
+        const uint8_t * witnessScript = NULL;
+        size_t witnessScriptLen = 0;
+        while(readPair(buf, psbt_end, &pos, &pair) && pair.keyLen > 0){
+            switch(pair.key[0]){
+                case 0: // PSBT_IN_NON_WITNESS_UTXO
+                    if(!utxo_known){
+                        utxo_known = prevOutput(pair.value, pair.valueLen, txIn, &amount, &scriptPubkey, &scriptPubkeyLen);
+                    }
+                    break;
+                case 1: // PSBT_IN_WITNESS_UTXO
+                    if(!utxo_known){
+                        size_t q = 0;
+                        utxo_known = readTxOut(pair.value, pair.valueLen, &q, &amount, &scriptPubkey, &scriptPubkeyLen);
+                    }
+                    break;
+                case 3: // PSBT_IN_SIGHASH_TYPE
+                    sighash_all = (pair.valueLen == 4) && (littleEndianToInt(pair.value, 4) == SIGHASH_ALL);
+                    break;
+                case 4: // PSBT_IN_REDEEM_SCRIPT
+                    redeemScript = pair.value;
+                    redeemScriptLen = pair.valueLen;
+                    break;
+                case 5: // PSBT_IN_WITNESS_SCRIPT
+                    witnessScript = pair.value;
+                    witnessScriptLen = pair.valueLen;
+                    break;
+            }
+        }
+        size_t separator = pos-1;
+        complete = writeAll(s, buf+section, separator-section);
+        PSBTSignMode mode = psbtSignMode(witnessScriptLen > 0, redeemScriptLen > 0,
+                                         isP2WPKH(redeemScript, redeemScriptLen), isP2WPKH(scriptPubkey, scriptPubkeyLen));
+        // second walk: derivations we can sign with
+        size_t p = section;
+        while(complete && utxo_known && sighash_all && p < separator && readPair(buf, separator, &p, &pair)){
+            if(pair.key[0] != 6 || memcmp(pair.value, fingerprint, 4) != 0){
+                continue;
+            }
+            size_t derivationLen = (pair.valueLen-4)/4;
+            if(derivationLen > PSBT_STREAM_MAX_DERIVATION_LEN){
+                continue;
+            }
+            uint32_t derivation[PSBT_STREAM_MAX_DERIVATION_LEN];
+            for(size_t j=0; j<derivationLen; j++){
+                derivation[j] = littleEndianToInt(pair.value+4+4*j, 4);
+            }
+            PSBTDerivation der;
+            memcpy(der.fingerprint, pair.value, 4);
+            der.derivation = derivation;
+            der.derivationLen = derivationLen;
+            der.pubkey.parse(pair.key+1, pair.keyLen-1);
+            PrivateKey pk;
+            if(!psbtSigningKey(&keys, root, fingerprint, der, &pk)){
+                continue;
+            }
+            // partial signature for this key is already there
+            uint8_t sig_key[67];
+            sig_key[1] = 0x02; // PSBT_IN_PARTIAL_SIG
+            uint8_t key_len = 1+der.pubkey.serialize(sig_key+2, 65);
+            sig_key[0] = key_len;
+            bool signed_already = false;
+            size_t q = section;
+            PSBTPair other;
+            while(q < separator && readPair(buf, separator, &q, &other)){
+                if(other.keyLen == key_len && memcmp(other.key, sig_key+1, key_len) == 0){
+                    signed_already = true;
+                }
+            }
+            if(signed_already){
+                continue;
+            }
+
+            uint8_t h[32];
+            if((mode == PSBT_SIGN_WITNESS_SCRIPT || mode == PSBT_SIGN_WITNESS_KEY) && !segwit_cache_ready){
+                segwitCache(&segwit_cache);
+                segwit_cache_ready = true;
+            }
+            if(mode == PSBT_SIGN_WITNESS_SCRIPT){
+                sigHashSegwit(h, txIn, witnessScript, witnessScriptLen, amount, &segwit_cache);
+            }else if(mode == PSBT_SIGN_WITNESS_KEY){ // script code is P2PKH
+                uint8_t code[25] = { 0x76, 0xa9, 0x14 };
+                hash160(sig_key+2, key_len-1, code+3);
+                code[23] = 0x88;
+                code[24] = 0xac;
+                sigHashSegwit(h, txIn, code, sizeof(code), amount, &segwit_cache);
+            }else if(mode == PSBT_SIGN_REDEEM_SCRIPT){
+                sigHash(h, i, redeemScript, redeemScriptLen);
+            }else{
+                sigHash(h, i, scriptPubkey, scriptPubkeyLen);
+            }
+            Signature sig = pk.sign(h);
+
+            uint8_t sig_value[75];
+            uint8_t value_len = 1+sig.serialize(sig_value+1, 72);
+            sig_value[0] = value_len;
+            sig_value[value_len] = SIGHASH_ALL;
+            complete = writeAll(s, sig_key, key_len+1) && writeAll(s, sig_value, value_len+1);
+            counter++;
+        }
+        complete = complete && (s->write(0) == 1);
+    }
+    complete = complete && writeAll(s, buf+pos, psbt_end-pos);
+    psbtKeyCacheFree(&keys);
+    if(!complete){ // the signed PSBT doesn't fit, partial result is useless
+        ubtc_errno = UBTC_ERR_PSBT_SPACE;
+        return 0;
+    }
+    return counter;
+}
@@ -0,0 +1,71 @@
+#ifndef __PSBT_STREAM_H__
+#define __PSBT_STREAM_H__
+
+#include "PSBT.h"
+
+/** \brief Maximum derivation path length PSBTStream can sign with */
+#define PSBT_STREAM_MAX_DERIVATION_LEN 10
+/** \brief Upper bound on the bytes added by one partial signature */
+#define PSBT_STREAM_MAX_SIGNATURE_LEN  141
+
+/** \brief Transaction summary collected by the first pass */
+typedef struct{
+    uint32_t version;
+    uint32_t locktime;
+    size_t inputsNumber;
+    size_t outputsNumber;
+    /** \brief Sum of the input amounts, valid only if amountsKnown is set */
+    uint64_t inputsAmount;
+    uint64_t outputsAmount;
+    /** \brief All inputs have witness_utxo or verified non_witness_utxo */
+    bool amountsKnown;
+    /** \brief Total number of bip32 derivations in the input sections */
+    size_t derivationsNumber;
+} PSBTSummary;
+
+/**
+ *  \brief Two-pass PSBT signer working on the serialized PSBT in place.<br>
+ *         verify() walks the whole PSBT once, checks the structure and fills the summary.<br>
+ *         sign() walks it again, signs input by input and writes the PSBT
+ *         with partial signatures to the stream.<br>
+ *         Only the input that is being signed is kept in RAM,
+ *         so the buffer can be hundreds of kilobytes large (e.g. in PSRAM).
+ */
+class PSBTStream{
+protected:
+    const uint8_t * buf;
+    size_t len;
+    // offsets in buf
+    size_t globals_end; // first byte after the global section
+    size_t tx_start;    // version of the unsigned tx
+    size_t tx_inputs;   // first input of the unsigned tx
+    size_t tx_outputs;  // outputs number of the unsigned tx
+    size_t tx_end;      // locktime of the unsigned tx
+    size_t psbt_end;    // first byte after the last output section
+    bool verified;
+    void segwitCache(SegwitSigHashCache * cache) const;
+    int sigHash(uint8_t h[32], size_t inputIndex, const uint8_t * script, size_t scriptLen) const;
+    int sigHashSegwit(uint8_t h[32], const uint8_t * txIn, const uint8_t * script, size_t scriptLen, uint64_t amount, const SegwitSigHashCache * cache) const;
+public:
+    PSBTStream(const uint8_t * psbt, size_t psbtLen);
+    PSBTSummary summary;
+
+    /** \brief first pass: checks the structure and fills the summary */
+    bool verify();
+    /** \brief reads an output of the unsigned transaction */
+    bool output(size_t outputNumber, TxOut * txOut) const;
+    /** \brief calculates fee if input amounts are known */
+    uint64_t fee() const;
+    /** \brief maximum length of the signed PSBT, use it to allocate the output buffer */
+    size_t signedLengthMax() const{ return len + summary.derivationsNumber*PSBT_STREAM_MAX_SIGNATURE_LEN; };
+    /** \brief second pass: signs everything it can with keys derived from root HD private key
+     *         and serializes the signed PSBT to the stream. Returns number of signatures added.
+     *         Returns 0 and sets ubtc_errno to UBTC_ERR_PSBT_SPACE if the stream is too small.
+     */
+    size_t sign(const HDPrivateKey root, SerializeStream * s);
+
+    bool isValid() const{ return verified; };
+    explicit operator bool() const{ return isValid(); };
+};
+
+#endif // __PSBT_STREAM_H__
@@ -127,9 +127,40 @@ Script sh(Script script){
 void Script::init(){
     reset();
     scriptLen = 0;
-    scriptArray = NULL;
+    scriptArray = scriptBuffer;
+    scriptCapacity = SCRIPT_INLINE_SIZE;
     lenLen = 0;
 }
+// makes sure scriptArray can hold len bytes, keeps the content
+bool Script::reserve(size_t len){
+    if(len <= scriptCapacity){
+        return true;
+    }
+    uint8_t * ptr;
+    if(scriptArray == scriptBuffer){
+        ptr = (uint8_t *) ubtc_calloc( len, sizeof(uint8_t));
+        if(ptr != NULL){ memcpy(ptr, scriptBuffer, scriptLen); }
+    }else{
+        ptr = (uint8_t *) ubtc_realloc( scriptArray, len * sizeof(uint8_t));
+    }
+    if(ptr == NULL){ clear(); return false; } // check if allocation failed
+    scriptArray = ptr;
+    scriptCapacity = len;
+    return true;
+}
+// moves the content of the other script here, other becomes empty
+void Script::take(Script &other){
+    if(other.scriptArray != other.scriptBuffer){
+        scriptArray = other.scriptArray;
+        scriptCapacity = other.scriptCapacity;
+    }else{
+        memcpy(scriptBuffer, other.scriptBuffer, other.scriptLen);
+    }
+    scriptLen = other.scriptLen;
+    other.scriptArray = other.scriptBuffer;
+    other.scriptCapacity = SCRIPT_INLINE_SIZE;
+    other.scriptLen = 0;
+}
 Script::Script(void){
     init();
 }
@@ -156,16 +187,15 @@ void Script::fromAddress(const char * address){
     // segwit
     if(type == P2WPKH){
         int ver = 0;
-        uint8_t prog[32];
+        uint8_t prog[40];
         size_t prog_len = 0;
         int r = segwit_addr_decode(&ver, prog, &prog_len, network->bech32, address);
         if(r != 1){ // decoding failed
             return;
         }
+        if(!reserve(prog_len + 2)){ return; }
         scriptLen = prog_len + 2;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
-        scriptArray[0] = ver;
+        scriptArray[0] = (ver == 0) ? 0 : (0x50 + ver); // OP_0 or OP_1..OP_16
         scriptArray[1] = prog_len; // varint?
         memcpy(scriptArray+2, prog, prog_len);
     }else{ // legacy or nested segwit
@@ -186,9 +216,8 @@ void Script::fromAddress(const char * address){
             }
         }
         if(type == P2PKH){
+            if(!reserve(25)){ return; }
             scriptLen = 25;
-            scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-            if(scriptArray == NULL){ scriptLen = 0; return; }
             scriptArray[0] = OP_DUP;
             scriptArray[1] = OP_HASH160;
             scriptArray[2] = 20;
@@ -197,9 +226,8 @@ void Script::fromAddress(const char * address){
             scriptArray[24] = OP_CHECKSIG;
         }
         if(type == P2SH){
+            if(!reserve(23)){ return; }
             scriptLen = 23;
-            scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-            if(scriptArray == NULL){ scriptLen = 0; return; }
             scriptArray[0] = OP_HASH160;
             scriptArray[1] = 20;
             memcpy(scriptArray+2, addr+1, 20);
@@ -210,9 +238,8 @@ void Script::fromAddress(const char * address){
 Script::Script(const PublicKey pubkey, ScriptType type){
     init();
     if(type == P2PKH){
+        if(!reserve(25)){ return; }
         scriptLen = 25;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
         scriptArray[0] = OP_DUP;
         scriptArray[1] = OP_HASH160;
         scriptArray[2] = 20;
@@ -223,9 +250,8 @@ Script::Script(const PublicKey pubkey, ScriptType type){
         scriptArray[24] = OP_CHECKSIG;
     }
     if(type == P2WPKH){
+        if(!reserve(22)){ return; }
         scriptLen = 22;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
         scriptArray[0] = 0x00;
         scriptArray[1] = 20;
         uint8_t sec_arr[65] = { 0 };
@@ -236,30 +262,29 @@ Script::Script(const PublicKey pubkey, ScriptType type){
 Script::Script(const Script &other, ScriptType type){
     init();
     if(type == P2SH){
+        if(!reserve(23)){ return; }
         scriptLen = 23;
-        scriptArray = (uint8_t *) calloc(scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
         hash160(other.scriptArray, other.scriptLen, scriptArray+2);
         scriptArray[0] = OP_HASH160;
         scriptArray[1] = 20;
         scriptArray[scriptLen-1] = OP_EQUAL;
     }
     if(type == P2WSH){
+        if(!reserve(34)){ return; }
         scriptLen = 34;
-        scriptArray = (uint8_t *) calloc(scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
         sha256(other.scriptArray, other.scriptLen, scriptArray+2);
         scriptArray[0] = 0x00;
         scriptArray[1] = 32;
     }
 }
 void Script::clear(){
-    if(scriptLen > 0 && scriptArray != NULL){
-        free(scriptArray);
-        scriptArray = NULL;
-        scriptLen = 0;
-        lenLen = 0;
+    if(scriptArray != scriptBuffer){
+        ubtc_free(scriptArray);
     }
+    scriptArray = scriptBuffer;
+    scriptCapacity = SCRIPT_INLINE_SIZE;
+    scriptLen = 0;
+    lenLen = 0;
 }
 size_t Script::from_stream(ParseStream *s){
     if(status == PARSING_FAILED){
@@ -276,26 +301,23 @@ size_t Script::from_stream(ParseStream *s){
         lenLen = s->read();
         bytes_read++;
         if(lenLen < 0xfd){
+            if(!reserve(lenLen)){ status = PARSING_FAILED; return 0; }
             scriptLen = lenLen;
-            if(scriptLen > 0){
-                scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-            }
             lenLen = 1;
         }else{
             scriptLen = 0;
             lenLen = 1+(1 << (lenLen - 0xfc));
-            scriptArray = (uint8_t *) calloc( 255, sizeof(uint8_t));
         }
-        if(scriptArray == NULL && scriptLen > 0){ status = PARSING_FAILED; scriptLen = 0; return 0; }
     }
     while(s->available() > 0 && bytes_parsed+bytes_read < lenLen){
         scriptLen += (s->read() << (8*(bytes_parsed+bytes_read-1)));
         bytes_read++;
-    }
-    if(bytes_parsed+bytes_read == lenLen && scriptLen > 0){
-        free(scriptArray);
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ status = PARSING_FAILED; scriptLen = 0; return 0; }
+        if(bytes_parsed+bytes_read == lenLen){ // varint is complete
+            size_t len = scriptLen;
+            scriptLen = 0;
+            if(!reserve(len)){ status = PARSING_FAILED; return 0; }
+            scriptLen = len;
+        }
     }
     if(bytes_parsed+bytes_read == lenLen && lenVarInt(scriptLen) != lenLen){
         status = PARSING_FAILED;
@@ -422,32 +444,21 @@ size_t Script::push(uint8_t code){
         clear();
         return 0;
     }
-    if(scriptLen == 0){
-        scriptLen = 1;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return 0; } // check if allocation failed
-    }else{
-        scriptLen ++;
-        uint8_t * ptr = (uint8_t *) realloc( scriptArray, scriptLen * sizeof(uint8_t));
-        if(ptr == NULL){ free(scriptArray); scriptArray = NULL; scriptLen = 0; return 0; } // check if realloc failed
-        scriptArray = ptr;
-    }
-    scriptArray[scriptLen-1] = code;
-    return scriptLen;
+    return push(&code, 1);
 }
 size_t Script::push(const uint8_t * data, size_t len){
     if(scriptLen+len > MAX_SCRIPT_SIZE){
         clear();
         return 0;
     }
-    if(scriptLen == 0){
-        scriptArray = (uint8_t *) calloc( len, sizeof(uint8_t));
-    }else{
-        uint8_t * ptr = (uint8_t *) realloc( scriptArray, (scriptLen + len) * sizeof(uint8_t));
-        if(ptr == NULL){ free(scriptArray); scriptArray = NULL; scriptLen = 0; return 0; }
-        scriptArray = ptr;
+    if(scriptLen+len > scriptCapacity){
+        // grow geometrically, scripts are often built with many small pushes
+        size_t capacity = 2*scriptCapacity;
+        if(capacity < scriptLen+len){
+            capacity = scriptLen+len;
+        }
+        if(!reserve(capacity)){ return 0; }
     }
-    if(scriptArray == NULL){ scriptLen = 0; return 0; }
     memcpy(scriptArray + scriptLen, data, len);
     scriptLen += len;
     return scriptLen;
@@ -467,13 +478,15 @@ size_t Script::push(const Signature sig, SigHashType sigType){
     push(sigType);
     return scriptLen;
 }
-size_t Script::push(const Script sc){
-    size_t len = sc.length();
-    uint8_t * tmp;
-    tmp = (uint8_t *)calloc(len, sizeof(uint8_t));
-    if(tmp == NULL){ return 0; }
-    sc.serialize(tmp, len);
-    push(tmp, len);
+size_t Script::push(const Script &sc){
+    if(&sc == this){ // pushing itself, push() can move our array
+        Script copy(sc);
+        return push(copy);
+    }
+    uint8_t arr[9];
+    size_t l = writeVarInt(sc.scriptLen, arr, sizeof(arr));
+    if(push(arr, l) == 0){ return 0; }
+    push(sc.scriptArray, sc.scriptLen);
     return scriptLen;
 }
 Script Script::scriptPubkey(ScriptType type) const{
@@ -483,23 +496,32 @@ Script Script::scriptPubkey(ScriptType type) const{
 Script &Script::operator=(const Script &other){
     if (this == &other){ return *this; } // self-assignment
     reset();
-    clear();
-    if(other.scriptLen > 0){
-        scriptLen = other.scriptLen;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return *this; }
-        memcpy(scriptArray, other.scriptArray, scriptLen);
+    // reuse the heap buffer only if the other script doesn't fit inline
+    if(other.scriptLen <= SCRIPT_INLINE_SIZE || other.scriptLen > scriptCapacity){
+        clear();
     }
+    scriptLen = 0;
+    if(!reserve(other.scriptLen)){ return *this; }
+    memcpy(scriptArray, other.scriptArray, other.scriptLen);
+    scriptLen = other.scriptLen;
+    return *this;
+};
+Script &Script::operator=(Script &&other){
+    if (this == &other){ return *this; } // self-assignment
+    reset();
+    clear();
+    take(other);
     return *this;
 };
 Script::Script(const Script &other){
     init();
-    if(other.scriptLen > 0){
-        scriptLen = other.scriptLen;
-        scriptArray = (uint8_t *) calloc( scriptLen, sizeof(uint8_t));
-        if(scriptArray == NULL){ scriptLen = 0; return; }
-        memcpy(scriptArray, other.scriptArray, scriptLen);
-    }
+    if(!reserve(other.scriptLen)){ return; }
+    memcpy(scriptArray, other.scriptArray, other.scriptLen);
+    scriptLen = other.scriptLen;
+};
+Script::Script(Script &&other){
+    init();
+    take(other);
 };
 
 //------------------------------------------------------------ Witness
@@ -507,7 +529,7 @@ Script::Script(const Script &other){
 void Witness::clear(){
     numElements = 0;
     if(witnessLen > 0){
-        free(witnessArray);
+        ubtc_free(witnessArray);
         witnessLen = 0;
     }
 }
@@ -597,12 +619,12 @@ size_t Witness::from_stream(ParseStream *s){
         if(cur_bytes_parsed+cur_bytes_read == curLen && cur_bytes_read>0){
             if(witnessLen==0){
                 witnessLen = cur_element_len+lenVarInt(cur_element_len);
-                witnessArray = (uint8_t *)calloc(witnessLen, sizeof(uint8_t));
+                witnessArray = (uint8_t *)ubtc_calloc(witnessLen, sizeof(uint8_t));
                 if(witnessArray == NULL){ witnessLen = 0; status=PARSING_FAILED; return 0;}
                 writeVarInt(cur_element_len, witnessArray, lenVarInt(cur_element_len));
             }else{
-                uint8_t * ptr = (uint8_t *)realloc( witnessArray, (witnessLen + cur_element_len + lenVarInt(cur_element_len)) * sizeof(uint8_t));
-                if(ptr == NULL){ free(witnessArray); witnessLen = 0; status=PARSING_FAILED; return 0;}
+                uint8_t * ptr = (uint8_t *)ubtc_realloc( witnessArray, (witnessLen + cur_element_len + lenVarInt(cur_element_len)) * sizeof(uint8_t));
+                if(ptr == NULL){ ubtc_free(witnessArray); witnessLen = 0; status=PARSING_FAILED; return 0;}
                 witnessArray = ptr;
                 witnessLen += cur_element_len+lenVarInt(cur_element_len);
                 writeVarInt(cur_element_len, witnessArray+offset, lenVarInt(cur_element_len));
@@ -654,11 +676,11 @@ size_t Witness::push(const uint8_t * data, size_t len){
         return 0;
     }
     if(witnessLen == 0){
-        witnessArray = (uint8_t *) calloc( len + lenVarInt(len), sizeof(uint8_t));
+        witnessArray = (uint8_t *) ubtc_calloc( len + lenVarInt(len), sizeof(uint8_t));
         if(witnessArray == NULL){ witnessLen = 0; return 0; }
     }else{
-        uint8_t * ptr = (uint8_t *) realloc( witnessArray, (witnessLen + len + lenVarInt(len)) * sizeof(uint8_t));
-        if(ptr == NULL){ free(witnessArray); witnessLen = 0; return 0; }
+        uint8_t * ptr = (uint8_t *) ubtc_realloc( witnessArray, (witnessLen + len + lenVarInt(len)) * sizeof(uint8_t));
+        if(ptr == NULL){ ubtc_free(witnessArray); witnessLen = 0; return 0; }
         witnessArray = ptr;
     }
     writeVarInt(len, witnessArray+witnessLen, lenVarInt(len));
@@ -683,12 +705,12 @@ size_t Witness::push(const Signature sig, SigHashType sigType){
 size_t Witness::push(const Script sc){
     size_t len = sc.length();
     uint8_t * tmp;
-    tmp = (uint8_t *)calloc(len, sizeof(uint8_t));
+    tmp = (uint8_t *)ubtc_calloc(len, sizeof(uint8_t));
     if(tmp == NULL){ return 0; }
     size_t l = sc.serialize(tmp, len);
     size_t dl = readVarInt(tmp, len);
     push(tmp+l-dl, dl);
-    free(tmp);
+    ubtc_free(tmp);
     return witnessLen;
 }
 Witness::Witness(const Witness &other){
@@ -696,7 +718,7 @@ Witness::Witness(const Witness &other){
     numElements = other.numElements;
     if(other.witnessLen > 0){
         witnessLen = other.witnessLen;
-        witnessArray = (uint8_t *) calloc( witnessLen, sizeof(uint8_t));
+        witnessArray = (uint8_t *) ubtc_calloc( witnessLen, sizeof(uint8_t));
         if(witnessArray == NULL){ witnessLen = 0; return;}
         memcpy(witnessArray, other.witnessArray, witnessLen);
     }
@@ -707,7 +729,7 @@ Witness &Witness::operator=(Witness const &other){
     numElements = other.numElements;
     if(other.witnessLen > 0){
         witnessLen = other.witnessLen;
-        witnessArray = (uint8_t *) calloc( witnessLen, sizeof(uint8_t));
+        witnessArray = (uint8_t *) ubtc_calloc( witnessLen, sizeof(uint8_t));
         if(witnessArray == NULL){ witnessLen = 0; return *this;}
         memcpy(witnessArray, other.witnessArray, witnessLen);
     }
@@ -15,6 +15,29 @@ using std::string;
 #define UBTC_ERR_TX_OUTPUT 3
 #define UBTC_ERR_TX_SCRIPT 4
 
+// standardness limit, no valid transaction has more inputs or outputs than fit into it
+#define TX_MAX_SIZE        400000
+#define TX_MIN_INPUT_SIZE  41
+#define TX_MIN_OUTPUT_SIZE 9
+
+// reads the first byte of the inputs / outputs number varint,
+// counts that need 8 bytes can't fit into a standard transaction
+static bool startCount(uint8_t c, uint64_t * value, uint8_t * len){
+    if(c == 0xff){
+        return false;
+    }
+    *value = (c < 0xfd) ? c : 0;
+    *len = (c < 0xfd) ? 1 : 1+(1 << (c - 0xfc));
+    return true;
+}
+// checks that count items of at least itemSize bytes fit into what is left of a standard transaction
+static bool countFits(uint64_t count, size_t consumed, size_t itemSize){
+    if(consumed >= TX_MAX_SIZE){
+        return false;
+    }
+    return count <= (TX_MAX_SIZE - consumed) / itemSize;
+}
+
 //-------------------------------------------------------------------------------------- Transaction Input
 void TxIn::init(){
     outputIndex = 0;
@@ -201,6 +224,10 @@ void Tx::init(){
     outputsNumber = 0;
     txIns = NULL;
     txOuts = NULL;
+    inputsCapacity = 0;
+    outputsCapacity = 0;
+    countLen = 0;
+    countValue = 0;
     locktime = 0;
     segwit_flag = 1;
     status = PARSING_DONE;
@@ -214,8 +241,10 @@ Tx::Tx(const Tx & other){
     version = other.version;
     inputsNumber = other.inputsNumber;
     outputsNumber = other.outputsNumber;
-    txIns = new TxIn[inputsNumber];
-    txOuts = new TxOut[outputsNumber];
+    txIns = ubtc_new_array<TxIn>(inputsNumber);
+    txOuts = ubtc_new_array<TxOut>(outputsNumber);
+    inputsCapacity = inputsNumber;
+    outputsCapacity = outputsNumber;
     for(unsigned int i=0;i<inputsNumber;i++){
         txIns[i] = other.txIns[i];
     }
@@ -230,16 +259,13 @@ Tx::Tx(const Tx & other){
 Tx& Tx::operator=(Tx const &other){ // copy-paste =(
     if (this == &other){ return *this; } // self-assignment
     version = other.version;
-    if(inputsNumber > 0){
-        delete [] txIns;
-    }
-    if(outputsNumber > 0){
-        delete [] txOuts;
-    }
+    clear();
     inputsNumber = other.inputsNumber;
     outputsNumber = other.outputsNumber;
-    txIns = new TxIn[inputsNumber];
-    txOuts = new TxOut[outputsNumber];
+    txIns = ubtc_new_array<TxIn>(inputsNumber);
+    txOuts = ubtc_new_array<TxOut>(outputsNumber);
+    inputsCapacity = inputsNumber;
+    outputsCapacity = outputsNumber;
     for(unsigned int i=0;i<inputsNumber;i++){
         txIns[i] = other.txIns[i];
     }
@@ -256,16 +282,18 @@ Tx::~Tx(){
     clear();
 }
 void Tx::clear(){
-    if(inputsNumber > 0){
-        inputsNumber = 0;
-        delete [] txIns;
+    if(txIns != NULL){
+        ubtc_delete_array(txIns);
         txIns = NULL;
     }
-    if(outputsNumber > 0){
-        outputsNumber = 0;
-        delete [] txOuts;
+    if(txOuts != NULL){
+        ubtc_delete_array(txOuts);
         txOuts = NULL;
     }
+    inputsNumber = 0;
+    outputsNumber = 0;
+    inputsCapacity = 0;
+    outputsCapacity = 0;
 }
 size_t Tx::length() const{
     bool is_segwit = isSegwit();
@@ -308,7 +336,7 @@ size_t Tx::to_stream(SerializeStream *s, size_t offset) const{
     }
     size_t cur_offset = 4+2*is_segwit;
     size_t l = writeVarInt(inputsNumber, arr, 10);
-    if(s->available() && bytes_written+offset < cur_offset+l){
+    while(s->available() && bytes_written+offset < cur_offset+l){
         s->write(arr[bytes_written+offset-cur_offset]);
         bytes_written++;
     }
@@ -321,7 +349,7 @@ size_t Tx::to_stream(SerializeStream *s, size_t offset) const{
         cur_offset+=l;
     }
     l = writeVarInt(outputsNumber, arr, 10);
-    if(s->available() && bytes_written+offset < cur_offset+l){
+    while(s->available() && bytes_written+offset < cur_offset+l){
         s->write(arr[bytes_written+offset-cur_offset]);
         bytes_written++;
     }
@@ -372,12 +400,11 @@ size_t Tx::from_stream(ParseStream *s){
         bytes_read++;
         if(c == 0x00){ // segwit!
             segwit_flag = 1;
-        }else{
-            inputsNumber = c; // FIXME: should be varint, but 255 inputs will kill the MCU...
-            txIns = new TxIn[inputsNumber];
-            for(unsigned int i=0; i<inputsNumber; i++){ // this will at least set all txins to PARSING_INCOMPLETE
-                bytes_read += s->parse(&txIns[i]);
-            }
+        }else if(!startCount(c, &countValue, &countLen)){
+            status = PARSING_FAILED;
+            ubtc_errno = UBTC_ERR_TX_GLOBAL | UBTC_ERR_TX_INPUT;
+            bytes_parsed+=bytes_read;
+            return bytes_read;
         }
     }
     if(s->available() && segwit_flag > 0 && bytes_read+bytes_parsed == 5){
@@ -390,13 +417,39 @@ size_t Tx::from_stream(ParseStream *s){
         }
     }
     if(s->available() && segwit_flag > 0 && bytes_read+bytes_parsed == 6){
-        inputsNumber = s->read();
+        uint8_t c = s->read();
+        bytes_read++;
+        if(!startCount(c, &countValue, &countLen)){
+            status = PARSING_FAILED;
+            ubtc_errno = UBTC_ERR_TX_GLOBAL | UBTC_ERR_TX_INPUT;
+            bytes_parsed+=bytes_read;
+            return bytes_read;
+        }
+    }
+    // inputs number varint
+    size_t current_offset = 4+2*segwit_flag;
+    while(s->available() && txIns == NULL && bytes_read+bytes_parsed > current_offset && bytes_read+bytes_parsed < current_offset+countLen){
+        countValue |= ((uint64_t)s->read() << (8*(bytes_read+bytes_parsed-current_offset-1)));
         bytes_read++;
-        txIns = new TxIn[inputsNumber];
+    }
+    if(txIns == NULL && bytes_read+bytes_parsed > current_offset && bytes_read+bytes_parsed == current_offset+countLen){
+        if(lenVarInt(countValue) != countLen || !countFits(countValue, current_offset+countLen, TX_MIN_INPUT_SIZE)){
+            status = PARSING_FAILED;
+            ubtc_errno = UBTC_ERR_TX_GLOBAL | UBTC_ERR_TX_INPUT;
+            bytes_parsed+=bytes_read;
+            return bytes_read;
+        }
+        inputsNumber = (size_t)countValue;
+        txIns = ubtc_new_array<TxIn>(inputsNumber);
+        inputsCapacity = inputsNumber;
         for(unsigned int i=0; i<inputsNumber; i++){ // this will at least set all txins to PARSING_INCOMPLETE
             bytes_read += s->parse(&txIns[i]);
         }
     }
+    if(txIns == NULL){ // inputs number is not complete yet
+        bytes_parsed+=bytes_read;
+        return bytes_read;
+    }
     for(unsigned int i=0; i<inputsNumber; i++){
         if(s->available() && txIns[i].getStatus() == PARSING_INCOMPLETE){
             bytes_read += s->parse(&txIns[i]);
@@ -407,18 +460,43 @@ size_t Tx::from_stream(ParseStream *s){
             return bytes_read;
         }
     }
-    size_t current_offset = 5+2*segwit_flag;
+    current_offset += lenVarInt(inputsNumber);
     for(unsigned int i=0; i<inputsNumber; i++){
         current_offset += txIns[i].length();
     }
-    if(s->available() && bytes_read+bytes_parsed == current_offset){
-        outputsNumber = s->read();
+    // outputs number varint
+    if(s->available() && txOuts == NULL && bytes_read+bytes_parsed == current_offset){
+        uint8_t c = s->read();
         bytes_read++;
-        txOuts = new TxOut[outputsNumber];
+        if(!startCount(c, &countValue, &countLen)){
+            status = PARSING_FAILED;
+            ubtc_errno = UBTC_ERR_TX_GLOBAL | UBTC_ERR_TX_OUTPUT;
+            bytes_parsed+=bytes_read;
+            return bytes_read;
+        }
+    }
+    while(s->available() && txOuts == NULL && bytes_read+bytes_parsed > current_offset && bytes_read+bytes_parsed < current_offset+countLen){
+        countValue |= ((uint64_t)s->read() << (8*(bytes_read+bytes_parsed-current_offset-1)));
+        bytes_read++;
+    }
+    if(txOuts == NULL && bytes_read+bytes_parsed > current_offset && bytes_read+bytes_parsed == current_offset+countLen){
+        if(lenVarInt(countValue) != countLen || !countFits(countValue, current_offset+countLen, TX_MIN_OUTPUT_SIZE)){
+            status = PARSING_FAILED;
+            ubtc_errno = UBTC_ERR_TX_GLOBAL | UBTC_ERR_TX_OUTPUT;
+            bytes_parsed+=bytes_read;
+            return bytes_read;
+        }
+        outputsNumber = (size_t)countValue;
+        txOuts = ubtc_new_array<TxOut>(outputsNumber);
+        outputsCapacity = outputsNumber;
         for(unsigned int i=0; i<outputsNumber; i++){ // this will at least set all txouts to PARSING_INCOMPLETE
             bytes_read += s->parse(&txOuts[i]);
         }
     }
+    if(txOuts == NULL){ // outputs number is not complete yet
+        bytes_parsed+=bytes_read;
+        return bytes_read;
+    }
     for(unsigned int i=0; i<outputsNumber; i++){
         if(s->available() && txOuts[i].getStatus() == PARSING_INCOMPLETE){
             bytes_read += s->parse(&txOuts[i]);
@@ -429,7 +507,7 @@ size_t Tx::from_stream(ParseStream *s){
             return bytes_read;
         }
     }
-    current_offset++;
+    current_offset += lenVarInt(outputsNumber);
     for(unsigned int i=0; i<outputsNumber; i++){
         current_offset += txOuts[i].length();
     }
@@ -484,8 +562,7 @@ size_t Tx::from_stream(ParseStream *s){
     bytes_parsed+=bytes_read;
     return bytes_read;
 }
-int Tx::sigHash(uint8_t h[32], uint8_t inputIndex, const Script scriptPubkey, SigHashType sighash) const{
-    Script empty;
+int Tx::sigHash(uint8_t h[32], size_t inputIndex, const Script &scriptPubkey, SigHashType sighash) const{
     DoubleSha s;
     s.begin();
 
@@ -495,14 +572,18 @@ int Tx::sigHash(uint8_t h[32], uint8_t inputIndex, const Script scriptPubkey, Si
     s.write(arr, 4);
     size_t l = writeVarInt(inputsNumber, arr, 10);
     s.write(arr, l);
+    // inputs are written field by field, scriptSig is replaced on the fly
     for(size_t i=0; i<inputsNumber; i++){
-        TxIn t = txIns[i];
+        s.write(txIns[i].hash, 32);
+        intToLittleEndian(txIns[i].outputIndex, arr, 4);
+        s.write(arr, 4);
         if(i == inputIndex){
-            t.scriptSig = scriptPubkey;
+            s.serialize(&scriptPubkey, 0);
         }else{
-            t.scriptSig = empty;
+            s.write(0); // empty script
         }
-        s.serialize(&t, 0);
+        intToLittleEndian(txIns[i].sequence, arr, 4);
+        s.write(arr, 4);
     }
     l = writeVarInt(outputsNumber, arr, 10);
     s.write(arr, l);
@@ -598,29 +679,38 @@ String Tx::wtxid() const{
 }
 #endif
 
-uint8_t Tx::addInput(const TxIn txIn){
-    TxIn * arr = new TxIn[inputsNumber+1];
-    for(unsigned int i=0; i<inputsNumber; i++){
-        arr[i] = txIns[i];
-    }
-    arr[inputsNumber] = txIn;
-    if(inputsNumber > 0){
-        delete [] txIns;
+// arrays grow geometrically, so adding n inputs or outputs costs O(n) copies
+size_t Tx::addInput(const TxIn &txIn){
+    if(inputsNumber == inputsCapacity){
+        size_t capacity = (inputsCapacity > 0) ? 2*inputsCapacity : 4;
+        TxIn * arr = ubtc_new_array<TxIn>(capacity);
+        for(size_t i=0; i<inputsNumber; i++){
+            arr[i] = txIns[i];
+        }
+        if(txIns != NULL){
+            ubtc_delete_array(txIns);
+        }
+        txIns = arr;
+        inputsCapacity = capacity;
     }
-    txIns = arr;
+    txIns[inputsNumber] = txIn;
     inputsNumber++;
     return inputsNumber;
 }
-uint8_t Tx::addOutput(const TxOut txOut){
-    TxOut * arr = new TxOut[outputsNumber+1];
-    for(unsigned int i=0; i<outputsNumber; i++){
-        arr[i] = txOuts[i];
-    }
-    arr[outputsNumber] = txOut;
-    if(outputsNumber > 0){
-        delete [] txOuts;
+size_t Tx::addOutput(const TxOut &txOut){
+    if(outputsNumber == outputsCapacity){
+        size_t capacity = (outputsCapacity > 0) ? 2*outputsCapacity : 4;
+        TxOut * arr = ubtc_new_array<TxOut>(capacity);
+        for(size_t i=0; i<outputsNumber; i++){
+            arr[i] = txOuts[i];
+        }
+        if(txOuts != NULL){
+            ubtc_delete_array(txOuts);
+        }
+        txOuts = arr;
+        outputsCapacity = capacity;
     }
-    txOuts = arr;
+    txOuts[outputsNumber] = txOut;
     outputsNumber++;
     return outputsNumber;
 }
@@ -660,18 +750,28 @@ int Tx::hashOutputs(uint8_t h[32]) const{
     return 32;
 }
 
-int Tx::sigHashSegwit(uint8_t h[32], uint8_t inputIndex, const Script scriptPubKey, uint64_t amount, SigHashType sighash) const{
+int Tx::sigHashSegwitCache(SegwitSigHashCache * cache) const{
+    hashPrevouts(cache->hashPrevouts);
+    hashSequence(cache->hashSequence);
+    hashOutputs(cache->hashOutputs);
+    return 96;
+}
+
+int Tx::sigHashSegwit(uint8_t h[32], size_t inputIndex, const Script scriptPubKey, uint64_t amount, SigHashType sighash) const{
+    SegwitSigHashCache cache;
+    sigHashSegwitCache(&cache);
+    return sigHashSegwit(h, inputIndex, scriptPubKey, amount, sighash, &cache);
+}
+
+int Tx::sigHashSegwit(uint8_t h[32], size_t inputIndex, const Script &scriptPubKey, uint64_t amount, SigHashType sighash, const SegwitSigHashCache * cache) const{
     DoubleSha s;
     s.begin();
     uint8_t arr[8];
     intToLittleEndian(version, arr, 4);
     s.write(arr, 4);
 
-    hashPrevouts(h);
-    s.write(h, 32);
-
-    hashSequence(h);
-    s.write(h, 32);
+    s.write(cache->hashPrevouts, 32);
+    s.write(cache->hashSequence, 32);
 
     s.write(txIns[inputIndex].hash, 32);
     intToLittleEndian(txIns[inputIndex].outputIndex, arr, 4);
@@ -683,8 +783,7 @@ int Tx::sigHashSegwit(uint8_t h[32], uint8_t inputIndex, const Script scriptPubK
     intToLittleEndian(txIns[inputIndex].sequence, arr, 4);
     s.write(arr, 4);
 
-    hashOutputs(h);
-    s.write(h, 32);
+    s.write(cache->hashOutputs, 32);
 
     intToLittleEndian(locktime, arr, 4);
     s.write(arr, 4);
@@ -695,7 +794,101 @@ int Tx::sigHashSegwit(uint8_t h[32], uint8_t inputIndex, const Script scriptPubK
     return 32;
 }
 
-Signature Tx::signInput(uint8_t inputIndex, const PrivateKey pk, const Script redeemScript, SigHashType sighash){
+static bool rawVarInt(const uint8_t * buf, size_t len, size_t * pos, uint64_t * value){
+    if(*pos >= len){
+        return false;
+    }
+    size_t l = (buf[*pos] < 0xfd) ? 1 : 1+(1 << (buf[*pos] - 0xfc));
+    if(l > len-*pos){
+        return false;
+    }
+    *value = readVarInt(buf+*pos, l);
+    *pos += l;
+    return true;
+}
+
+bool rawTxOutput(const uint8_t * rawTx, size_t rawTxLen, const uint8_t hash[32], uint32_t outputIndex,
+                 uint64_t * amount, const uint8_t ** scriptPubkey, size_t * scriptPubkeyLen){
+    if(rawTxLen < 10){
+        return false;
+    }
+    size_t pos = 4;
+    bool segwit = (rawTx[4] == 0x00);
+    if(segwit){
+        if(rawTx[5] != 0x01){
+            return false;
+        }
+        pos += 2;
+    }
+    // txid covers version, inputs, outputs and locktime - marker and witness are skipped
+    size_t start = pos;
+    uint64_t inputs, outputs, n;
+    if(!rawVarInt(rawTx, rawTxLen, &pos, &inputs)){
+        return false;
+    }
+    for(uint64_t i=0; i<inputs; i++){
+        if(36 > rawTxLen-pos){
+            return false;
+        }
+        pos += 36;
+        if(!rawVarInt(rawTx, rawTxLen, &pos, &n) || n > rawTxLen-pos){
+            return false;
+        }
+        pos += n;
+        if(4 > rawTxLen-pos){
+            return false;
+        }
+        pos += 4;
+    }
+    if(!rawVarInt(rawTx, rawTxLen, &pos, &outputs) || outputIndex >= outputs){
+        return false;
+    }
+    for(uint64_t i=0; i<outputs; i++){
+        if(8 > rawTxLen-pos){
+            return false;
+        }
+        if(i == outputIndex){
+            *amount = littleEndianToInt(rawTx+pos, 8);
+        }
+        pos += 8;
+        if(!rawVarInt(rawTx, rawTxLen, &pos, &n) || n > rawTxLen-pos){
+            return false;
+        }
+        if(i == outputIndex){
+            *scriptPubkey = rawTx+pos;
+            *scriptPubkeyLen = n;
+        }
+        pos += n;
+    }
+    size_t end = pos;
+    if(segwit){
+        for(uint64_t i=0; i<inputs; i++){
+            uint64_t items;
+            if(!rawVarInt(rawTx, rawTxLen, &pos, &items)){
+                return false;
+            }
+            for(uint64_t j=0; j<items; j++){
+                if(!rawVarInt(rawTx, rawTxLen, &pos, &n) || n > rawTxLen-pos){
+                    return false;
+                }
+                pos += n;
+            }
+        }
+    }
+    if(rawTxLen-pos != 4){
+        return false;
+    }
+    uint8_t h[32];
+    DoubleSha s;
+    s.begin();
+    s.write(rawTx, 4);
+    s.write(rawTx+start, end-start);
+    s.write(rawTx+pos, 4);
+    s.end(h);
+    return memcmp(h, hash, 32) == 0;
+}
+
+Signature Tx::signInput(size_t inputIndex, const PrivateKey pk, const Script redeemScript, SigHashType sighash){
     uint8_t h[32];
     sigHash(h, inputIndex, redeemScript, sighash);
 
@@ -714,7 +907,7 @@ Signature Tx::signInput(uint8_t inputIndex, const PrivateKey pk, const Script re
 
     return sig;
 }
-Signature Tx::signSegwitInput(uint8_t inputIndex, const PrivateKey pk, const Script redeemScript, uint64_t amount, ScriptType type, SigHashType sighash){
+Signature Tx::signSegwitInput(size_t inputIndex, const PrivateKey pk, const Script redeemScript, uint64_t amount, ScriptType type, SigHashType sighash){
     uint8_t h[32];
 
     ScriptType redeem_type = redeemScript.type();
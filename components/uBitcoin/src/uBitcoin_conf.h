@@ -51,6 +51,17 @@
  #endif
 #endif
 
+/* PSBT::sign splits signing between the cores of ESP32 */
+#if defined(ESP_PLATFORM)
+  #include "sdkconfig.h"
+  #if !CONFIG_FREERTOS_UNICORE
+    #define PSBT_SIGN_DUAL_CORE 1
+  #endif
+#endif
+#ifndef PSBT_SIGN_DUAL_CORE
+  #define PSBT_SIGN_DUAL_CORE 0
+#endif
+
 #if USE_STD_STRING
 #include <string>
 // using std::string;
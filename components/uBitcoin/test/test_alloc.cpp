@@ -0,0 +1,31 @@
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "test_alloc.h"
+
+#ifndef CONFIG_HEAP_USE_HOOKS
+#error "Allocation counting needs CONFIG_HEAP_USE_HOOKS"
+#endif
+
+// every allocation while counting is on, the test cases run in a single task
+static volatile bool counting = false;
+static volatile size_t allocations = 0;
+
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void * ptr, size_t size, uint32_t caps){
+    if(counting){
+        allocations = allocations + 1;
+    }
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void * ptr){
+}
+
+void testAllocStart(){
+    allocations = 0;
+    counting = true;
+}
+
+size_t testAllocStop(){
+    counting = false;
+    return allocations;
+}
@@ -0,0 +1,11 @@
+#ifndef __TEST_ALLOC_H__
+#define __TEST_ALLOC_H__
+
+#include <stddef.h>
+
+/** \brief Starts counting heap allocations, needs CONFIG_HEAP_USE_HOOKS */
+void testAllocStart();
+/** \brief Stops counting and returns the number of allocations since testAllocStart() */
+size_t testAllocStop();
+
+#endif // __TEST_ALLOC_H__
@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "unity.h"
+#include "Bitcoin.h"
+#include "Conversion.h"
+#include "utility/segwit_addr.h"
+
+typedef struct{
+    const char * hex;
+    const char * base58;
+} base58_vector_t;
+
+// vectors from Bitcoin Core base58_encode_decode.json
+static const base58_vector_t base58Vectors[] = {
+    { "", "" },
+    { "61", "2g" },
+    { "626262", "a3gV" },
+    { "636363", "aPEr" },
+    { "73696d706c792061206c6f6e6720737472696e67", "2cFupjhnEsSn59qHXstmK2ffpLv2" },
+    { "00eb15231dfceb60925886b67d065299925915aeb172c06647", "1NS17iag9jJgTHD1VXjvLCEnZuQ3rJDE9L" },
+    { "516b6fcd0f", "ABnLTmg" },
+    { "bf4f89001e670274dd", "3SEo3LWLoPntC" },
+    { "572e4794", "3EFU7m" },
+    { "ecac89cad93923c02321", "EJDM8drfXA6uyA" },
+    { "10c8511e", "Rt5zm" },
+    { "00000000000000000000", "1111111111" },
+};
+
+TEST_CASE("base58 known answers", "[uBitcoin]")
+{
+    for(size_t i = 0; i < sizeof(base58Vectors)/sizeof(base58Vectors[0]); i++){
+        const base58_vector_t * v = &base58Vectors[i];
+        uint8_t bin[32];
+        size_t binLen = fromHex(v->hex, strlen(v->hex), bin, sizeof(bin));
+
+        char encoded[64] = "";
+        size_t len = toBase58(bin, binLen, encoded, sizeof(encoded));
+        TEST_ASSERT_EQUAL_size_t(strlen(v->base58), len);
+        TEST_ASSERT_EQUAL_STRING(v->base58, encoded);
+
+        uint8_t decoded[32];
+        len = fromBase58(v->base58, strlen(v->base58), decoded, sizeof(decoded));
+        TEST_ASSERT_EQUAL_size_t(binLen, len);
+        TEST_ASSERT_EQUAL_MEMORY(bin, decoded, binLen);
+    }
+}
+
+TEST_CASE("base58 check and invalid input", "[uBitcoin]")
+{
+    // genesis block coinbase address
+    const char * address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+    uint8_t expected[21];
+    fromHex("0062e907b15cbf27d5425399ebf6f0fb50ebb88f18", 42, expected, sizeof(expected));
+
+    uint8_t decoded[32];
+    TEST_ASSERT_EQUAL_size_t(21, fromBase58Check(address, strlen(address), decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_MEMORY(expected, decoded, sizeof(expected));
+
+    char encoded[64];
+    TEST_ASSERT_EQUAL_size_t(strlen(address), toBase58Check(expected, sizeof(expected), encoded, sizeof(encoded)));
+    TEST_ASSERT_EQUAL_STRING(address, encoded);
+
+    // wrong checksum, invalid character, output too small
+    TEST_ASSERT_EQUAL_size_t(0, fromBase58Check("1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNb", 34, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_size_t(0, fromBase58Check("1A1zP1eP5QGefi2DMPTfTL5SLmv7Div0Na", 34, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_size_t(0, fromBase58("3SEo3LWLoPntC", 13, decoded, 4));
+
+    // decoding stops at the first character outside the alphabet
+    TEST_ASSERT_EQUAL_size_t(1, fromBase58("2g0", 3, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_INT(0x61, decoded[0]);
+}
+
+TEST_CASE("base58 roundtrip of a long input", "[uBitcoin]")
+{
+    // longer than the stack buffers, with leading zeros
+    uint8_t bin[200] = { 0 };
+    for(size_t i = 3; i < sizeof(bin); i++){
+        bin[i] = (uint8_t)(i * 37 + 11);
+    }
+    char encoded[300];
+    size_t len = toBase58(bin, sizeof(bin), encoded, sizeof(encoded));
+    TEST_ASSERT_NOT_EQUAL(0, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(encoded, "111", 3));
+    TEST_ASSERT_TRUE(encoded[3] != '1');
+
+    uint8_t decoded[sizeof(bin)];
+    TEST_ASSERT_EQUAL_size_t(sizeof(bin), fromBase58(encoded, len, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_MEMORY(bin, decoded, sizeof(bin));
+}
+
+// std::chrono works on the host and on the device, so the numbers are comparable
+TEST_CASE("base58 xprv benchmark", "[uBitcoin][benchmark]")
+{
+    // BIP32 test vector 1 master key
+    const char * xprv = "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi";
+    const int rounds = 1000;
+    uint8_t bin[82];
+    char encoded[120] = "";
+    size_t binLen = 0;
+    size_t len = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < rounds; i++){
+        binLen = fromBase58Check(xprv, strlen(xprv), bin, sizeof(bin));
+    }
+    auto decoded = std::chrono::steady_clock::now();
+    for(int i = 0; i < rounds; i++){
+        len = toBase58Check(bin, binLen, encoded, sizeof(encoded));
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double decodeUs = std::chrono::duration<double, std::micro>(decoded - start).count() / rounds;
+    double encodeUs = std::chrono::duration<double, std::micro>(end - decoded).count() / rounds;
+    printf("base58check xprv: decode %.1f us, encode %.1f us\n", decodeUs, encodeUs);
+    TEST_ASSERT_EQUAL_size_t(78, binLen);
+    TEST_ASSERT_EQUAL_size_t(strlen(xprv), len);
+    TEST_ASSERT_EQUAL_STRING(xprv, encoded);
+}
+
+TEST_CASE("bech32m known answers", "[uBitcoin]")
+{
+    // BIP350 vectors
+    char hrp[16];
+    uint8_t data[64];
+    size_t dataLen = 0;
+    TEST_ASSERT_EQUAL_INT(BECH32_ENCODING_BECH32M, bech32_decode(hrp, data, &dataLen, "A1LQFN3A"));
+    TEST_ASSERT_EQUAL_STRING("a", hrp);
+    TEST_ASSERT_EQUAL_size_t(0, dataLen);
+
+    char out[128];
+    TEST_ASSERT_EQUAL_INT(1, bech32_encode(out, "a", data, 0, BECH32_ENCODING_BECH32M));
+    TEST_ASSERT_EQUAL_STRING("a1lqfn3a", out);
+
+    const char * taproot = "bc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqzk5jj0";
+    uint8_t expected[40];
+    uint8_t prog[40];
+    size_t progLen = 0;
+    int ver = -1;
+    fromHex("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 64, expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_INT(1, segwit_addr_decode(&ver, prog, &progLen, "bc", taproot));
+    TEST_ASSERT_EQUAL_INT(1, ver);
+    TEST_ASSERT_EQUAL_size_t(32, progLen);
+    TEST_ASSERT_EQUAL_MEMORY(expected, prog, 32);
+    TEST_ASSERT_EQUAL_INT(1, segwit_addr_encode(out, "bc", 1, expected, 32));
+    TEST_ASSERT_EQUAL_STRING(taproot, out);
+
+    const char * segwit = "BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4";
+    fromHex("751e76e8199196d454941c45d1b3a323f1433bd6", 40, expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_INT(1, segwit_addr_decode(&ver, prog, &progLen, "bc", segwit));
+    TEST_ASSERT_EQUAL_INT(0, ver);
+    TEST_ASSERT_EQUAL_size_t(20, progLen);
+    TEST_ASSERT_EQUAL_MEMORY(expected, prog, 20);
+    TEST_ASSERT_EQUAL_INT(1, segwit_addr_encode(out, "bc", 0, expected, 20));
+    TEST_ASSERT_EQUAL_STRING("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4", out);
+
+    // scriptPubKey from the address
+    Script sc(taproot);
+    uint8_t scriptPubKey[34];
+    fromHex("512079be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 68, scriptPubKey, sizeof(scriptPubKey));
+    TEST_ASSERT_EQUAL_size_t(sizeof(scriptPubKey), sc.scriptLen);
+    TEST_ASSERT_EQUAL_MEMORY(scriptPubKey, sc.scriptArray, sizeof(scriptPubKey));
+}
+
+TEST_CASE("segwit address with the wrong checksum variant", "[uBitcoin]")
+{
+    uint8_t prog[40];
+    size_t progLen = 0;
+    int ver = -1;
+    // v1 program with a bech32 checksum, v0 program with a bech32m checksum
+    TEST_ASSERT_EQUAL_INT(0, segwit_addr_decode(&ver, prog, &progLen, "bc", "bc1p0xlxvlhemja6c4dqv22uapctqupfhlxm9h8z3k2e72q4k9hcz7vqh2y7hd"));
+    TEST_ASSERT_EQUAL_INT(0, segwit_addr_decode(&ver, prog, &progLen, "bc", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kemeawh"));
+    // wrong hrp
+    TEST_ASSERT_EQUAL_INT(0, segwit_addr_decode(&ver, prog, &progLen, "tb", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"));
+}
@@ -0,0 +1,217 @@
+#include <string.h>
+#include <vector>
+#include "unity.h"
+#include "Bitcoin.h"
+#include "PSBT.h"
+#include "PSBTStream.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+enum InputType{ INPUT_P2WPKH, INPUT_P2SH_P2WPKH, INPUT_P2PKH };
+
+static const char * mnemonic = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+
+static void putVarInt(Bytes &b, size_t n){
+    uint8_t arr[9];
+    size_t l = writeVarInt(n, arr, sizeof(arr));
+    b.insert(b.end(), arr, arr+l);
+}
+
+static void putPair(Bytes &b, const Bytes &key, const Bytes &value){
+    putVarInt(b, key.size());
+    b.insert(b.end(), key.begin(), key.end());
+    putVarInt(b, value.size());
+    b.insert(b.end(), value.begin(), value.end());
+}
+
+static Bytes serialized(const Streamable &obj){
+    Bytes b(obj.length());
+    obj.serialize(b.data(), b.size());
+    return b;
+}
+
+// unsigned PSBT spending one input of every type in types[],
+// each input carries a bip32 derivation from the test root key
+static Bytes buildPSBT(const HDPrivateKey &root, const InputType * types, size_t n){
+    std::vector<HDPrivateKey> keys;
+    std::vector<Bytes> derivations;
+    Tx prev;
+    uint8_t zero[32] = { 1 };
+    prev.addInput(TxIn(zero, 0));
+    for(size_t i=0; i<n; i++){
+        uint32_t path[5] = { 0x80000054, 0x80000000, 0x80000000, 0, (uint32_t)i };
+        ScriptType st = P2WPKH;
+        if(types[i] == INPUT_P2SH_P2WPKH){
+            path[0] = 0x80000031;
+            st = P2SH_P2WPKH;
+        }else if(types[i] == INPUT_P2PKH){
+            path[0] = 0x8000002C;
+            st = P2PKH;
+        }
+        keys.push_back(root.derive(path, 5));
+        Bytes der(4);
+        root.fingerprint(der.data());
+        for(size_t j=0; j<5; j++){
+            for(size_t k=0; k<4; k++){
+                der.push_back((path[j] >> (8*k)) & 0xFF);
+            }
+        }
+        derivations.push_back(der);
+        prev.addOutput(TxOut(100000+i, Script(keys[i].publicKey(), st)));
+    }
+    uint8_t prevHash[32];
+    prev.txid(prevHash);
+    Tx tx;
+    for(size_t i=0; i<n; i++){
+        tx.addInput(TxIn(prevHash, i, 0xFFFFFFFD));
+    }
+    tx.addOutput(TxOut(50000, Script(keys[0].publicKey(), P2WPKH)));
+    tx.addOutput(TxOut(40000, Script(keys[0].publicKey(), P2PKH)));
+
+    Bytes b = { 0x70, 0x73, 0x62, 0x74, 0xFF };
+    putPair(b, Bytes{ 0x00 }, serialized(tx));
+    b.push_back(0);
+    for(size_t i=0; i<n; i++){
+        if(types[i] == INPUT_P2PKH){
+            putPair(b, Bytes{ 0x00 }, serialized(prev));
+        }else{
+            putPair(b, Bytes{ 0x01 }, serialized(prev.txOuts[i]));
+        }
+        if(types[i] == INPUT_P2SH_P2WPKH){
+            Bytes redeem = serialized(Script(keys[i].publicKey(), P2WPKH));
+            redeem.erase(redeem.begin()); // length prefix
+            putPair(b, Bytes{ 0x04 }, redeem);
+        }
+        Bytes key = { 0x06 };
+        Bytes pub = serialized(keys[i].publicKey());
+        key.insert(key.end(), pub.begin(), pub.end());
+        putPair(b, key, derivations[i]);
+        b.push_back(0);
+    }
+    b.push_back(0);
+    b.push_back(0);
+    return b;
+}
+
+// signs with PSBTStream, returns the signed PSBT (empty on failure)
+static Bytes streamSign(const HDPrivateKey &root, const Bytes &psbt, size_t * count){
+    PSBTStream stream(psbt.data(), psbt.size());
+    stream.verify();
+    Bytes out(stream.signedLengthMax());
+    SerializeByteStream s(out.data(), out.size());
+    *count = stream.sign(root, &s);
+    out.resize(out.size() - s.available());
+    return out;
+}
+
+static void assertSameAsPSBT(const InputType * types, size_t n){
+    HDPrivateKey root(mnemonic, "");
+    Bytes unsignedPSBT = buildPSBT(root, types, n);
+
+    PSBT psbt;
+    psbt.parse(unsignedPSBT.data(), unsignedPSBT.size());
+    TEST_ASSERT_TRUE(psbt.isValid());
+    TEST_ASSERT_EQUAL_size_t(n, psbt.sign(root));
+    Bytes expected = serialized(psbt);
+
+    size_t count = 0;
+    Bytes signedPSBT = streamSign(root, unsignedPSBT, &count);
+    TEST_ASSERT_EQUAL_size_t(n, count);
+    // the stream keeps every original pair, PSBT keeps only the partial signatures
+    PSBT reparsed;
+    reparsed.parse(signedPSBT.data(), signedPSBT.size());
+    TEST_ASSERT_TRUE(reparsed.isValid());
+    Bytes actual = serialized(reparsed);
+    TEST_ASSERT_EQUAL_size_t(expected.size(), actual.size());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), actual.data(), expected.size());
+    // and adds nothing else
+    size_t added = signedPSBT.size() - unsignedPSBT.size();
+    size_t sigs = 0;
+    for(size_t i=0; i<n; i++){
+        for(size_t j=0; j<psbt.txInsMeta[i].signaturesLen; j++){
+            sigs += 2 + 1+33 + psbt.txInsMeta[i].signatures[j].signature.length()+1;
+        }
+    }
+    TEST_ASSERT_EQUAL_size_t(sigs, added);
+}
+
+TEST_CASE("psbt stream signs p2wpkh like PSBT", "[uBitcoin]")
+{
+    InputType types[] = { INPUT_P2WPKH, INPUT_P2WPKH };
+    assertSameAsPSBT(types, 2);
+}
+
+TEST_CASE("psbt stream signs p2sh-p2wpkh like PSBT", "[uBitcoin]")
+{
+    InputType types[] = { INPUT_P2SH_P2WPKH, INPUT_P2SH_P2WPKH };
+    assertSameAsPSBT(types, 2);
+}
+
+TEST_CASE("psbt stream signs legacy inputs like PSBT", "[uBitcoin]")
+{
+    InputType types[] = { INPUT_P2PKH, INPUT_P2PKH };
+    assertSameAsPSBT(types, 2);
+}
+
+TEST_CASE("psbt stream signs mixed inputs like PSBT", "[uBitcoin]")
+{
+    InputType types[] = { INPUT_P2WPKH, INPUT_P2PKH, INPUT_P2SH_P2WPKH };
+    assertSameAsPSBT(types, 3);
+}
+
+TEST_CASE("psbt stream rejects truncated maps", "[uBitcoin]")
+{
+    HDPrivateKey root(mnemonic, "");
+    InputType types[] = { INPUT_P2WPKH, INPUT_P2PKH };
+    Bytes psbt = buildPSBT(root, types, 2);
+    uint8_t out[16];
+    for(size_t len=0; len<psbt.size(); len++){
+        PSBTStream stream(psbt.data(), len);
+        TEST_ASSERT_FALSE(stream.verify());
+        SerializeByteStream s(out, sizeof(out));
+        TEST_ASSERT_EQUAL_size_t(0, stream.sign(root, &s));
+        TEST_ASSERT_EQUAL_size_t(sizeof(out), s.available());
+    }
+}
+
+TEST_CASE("psbt stream reports a short output buffer", "[uBitcoin]")
+{
+    HDPrivateKey root(mnemonic, "");
+    InputType types[] = { INPUT_P2WPKH, INPUT_P2SH_P2WPKH };
+    Bytes psbt = buildPSBT(root, types, 2);
+    size_t count = 0;
+    Bytes signedPSBT = streamSign(root, psbt, &count);
+    TEST_ASSERT_EQUAL_size_t(2, count);
+
+    PSBTStream stream(psbt.data(), psbt.size());
+    TEST_ASSERT_TRUE(stream.verify());
+    // one byte short, an unsigned copy and nothing at all
+    size_t lengths[] = { signedPSBT.size()-1, psbt.size(), 0 };
+    for(size_t i=0; i<sizeof(lengths)/sizeof(lengths[0]); i++){
+        Bytes out(lengths[i]+1);
+        SerializeByteStream s(out.data(), lengths[i]);
+        ubtc_errno = 0;
+        TEST_ASSERT_EQUAL_size_t(0, stream.sign(root, &s));
+        TEST_ASSERT_EQUAL_INT(UBTC_ERR_PSBT_SPACE, ubtc_errno);
+    }
+    // exact fit is enough
+    Bytes out(signedPSBT.size());
+    SerializeByteStream s(out.data(), out.size());
+    TEST_ASSERT_EQUAL_size_t(2, stream.sign(root, &s));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(signedPSBT.data(), out.data(), out.size());
+}
+
+TEST_CASE("psbt stream skips existing partial signatures", "[uBitcoin]")
+{
+    HDPrivateKey root(mnemonic, "");
+    InputType types[] = { INPUT_P2WPKH, INPUT_P2PKH, INPUT_P2SH_P2WPKH };
+    Bytes psbt = buildPSBT(root, types, 3);
+    size_t count = 0;
+    Bytes signedPSBT = streamSign(root, psbt, &count);
+    TEST_ASSERT_EQUAL_size_t(3, count);
+
+    Bytes again = streamSign(root, signedPSBT, &count);
+    TEST_ASSERT_EQUAL_size_t(0, count);
+    TEST_ASSERT_EQUAL_size_t(signedPSBT.size(), again.size());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(signedPSBT.data(), again.data(), again.size());
+}
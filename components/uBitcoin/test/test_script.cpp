@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "Bitcoin.h"
+#include "PSBT.h"
+#include "test_alloc.h"
+
+// longer than SCRIPT_INLINE_SIZE, lives on the heap
+#define LONG_SCRIPT_LEN (SCRIPT_INLINE_SIZE + 30)
+
+// reference PSBT: P2WPKH, P2PKH (non_witness_utxo) and P2SH-P2WPKH inputs,
+// all derived from the "abandon ... about" mnemonic
+static const char * referencePSBT = "70736274ff0100c60100000003c7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20000000000fdffffffc7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20100000000fdffffffc7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20200000000fdffffff0250c3000000000000160014c0cebcd6c3d3ca8c75dc5ec62ebe55330ef910e2409c0000000000001976a9146ae1301cf44ca525751d1763ac4fef12d115398688ac000000000001011fa086010000000000160014c0cebcd6c3d3ca8c75dc5ec62ebe55330ef910e222060330d54fd0dd420a6e5f8d3624f5f3482cae350f79d5f0753bf5beef9c2d91af3c1873c5da0a54000080000000800000008000000000000000000001007d010000000100000000000000000000000000000000000000000000000000000000000000010000000000ffffffff03a086010000000000160014c0cebcd6c3d3ca8c75dc5ec62ebe55330ef910e2a1860100000000001976a9146ae1301cf44ca525751d1763ac4fef12d115398688aca2860100000000000000000000220602dfcaec532010d704860e20ad6aff8cf3477164ffb02f93d45c552dadc70ed24f1873c5da0a2c0000800000008000000080000000000100000000010109a286010000000000000104160014a3c6a985b0894aaf922c26d49b4f96eb14ce7b0b220602fdbd244eebd701270478af75ebb8894b963d61f2f686e366a626cb200ba13e451873c5da0a3100008000000080000000800000000002000000000000";
+// PSBT::serialize() after signing: unsigned tx and partial signatures
+static const char * referenceSigned = "70736274ff0100c60100000003c7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20000000000fdffffffc7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20100000000fdffffffc7c35bf3e7ce57a73491f61e58e1081c6a44a390df9402470fbe57b16d762be20200000000fdffffff0250c3000000000000160014c0cebcd6c3d3ca8c75dc5ec62ebe55330ef910e2409c0000000000001976a9146ae1301cf44ca525751d1763ac4fef12d115398688ac000000000022020330d54fd0dd420a6e5f8d3624f5f3482cae350f79d5f0753bf5beef9c2d91af3c483045022100e36e58b8b767f99f1b99ad9af94f6bf62f52806f8085234e39ab3855586643ed02205565e28a32057e0d9313455b0d6d138fd1acfbcc3bd6bae294304aa1628e77f80100220202dfcaec532010d704860e20ad6aff8cf3477164ffb02f93d45c552dadc70ed24f4830450221008c3b642e3fd0958c92c4b2bf4f794f3153a7a0f26e3cb9d21a34665d043a2303022012202d4ddd0485e5621571a41463b549185cb803b5ee520f9234e603b0727e8a0100220202fdbd244eebd701270478af75ebb8894b963d61f2f686e366a626cb200ba13e45483045022100ac467ee965edbe66240272ad9a96566dbdf9e87122e1846a2338ed886f9b60f102202280001a98f15b3df290a80b0619efbf0d146f58ad6e9951f9fc1d04a610470701000000";
+#define REFERENCE_SIGNATURES 3
+// allocations measured after scripts moved inline, the benchmark fails if they grow
+#define REFERENCE_PARSE_ALLOCATIONS 15
+#define REFERENCE_SIGN_ALLOCATIONS  5
+
+static bool isInline(const Script &sc){
+    const uint8_t * start = (const uint8_t *)&sc;
+    return sc.scriptArray >= start && sc.scriptArray < start + sizeof(Script);
+}
+
+static Script shortScript(){
+    // P2WPKH, 22 bytes
+    uint8_t buf[22] = { 0x00, 0x14 };
+    for(int i = 2; i < (int)sizeof(buf); i++){
+        buf[i] = i;
+    }
+    return Script(buf, sizeof(buf));
+}
+
+static Script longScript(){
+    uint8_t buf[LONG_SCRIPT_LEN];
+    for(int i = 0; i < (int)sizeof(buf); i++){
+        buf[i] = 0xA0 + i;
+    }
+    return Script(buf, sizeof(buf));
+}
+
+TEST_CASE("script storage inline and on the heap", "[uBitcoin]")
+{
+    Script empty;
+    TEST_ASSERT_FALSE(bool(empty));
+    TEST_ASSERT_TRUE(isInline(empty));
+
+    Script a = shortScript();
+    TEST_ASSERT_EQUAL_size_t(22, a.scriptLen);
+    TEST_ASSERT_TRUE(isInline(a));
+    TEST_ASSERT_EQUAL_INT(P2WPKH, a.type());
+
+    Script b = longScript();
+    TEST_ASSERT_EQUAL_size_t(LONG_SCRIPT_LEN, b.scriptLen);
+    TEST_ASSERT_FALSE(isInline(b));
+
+    // growing past the inline buffer keeps the content
+    Script c = shortScript();
+    uint8_t extra[SCRIPT_INLINE_SIZE] = { 0 };
+    c.push(extra, sizeof(extra));
+    TEST_ASSERT_FALSE(isInline(c));
+    TEST_ASSERT_EQUAL_size_t(22 + SCRIPT_INLINE_SIZE, c.scriptLen);
+    TEST_ASSERT_EQUAL_MEMORY(a.scriptArray, c.scriptArray, a.scriptLen);
+}
+
+TEST_CASE("script copy and move", "[uBitcoin]")
+{
+    Script a = shortScript();
+    Script b = longScript();
+
+    Script copyA(a);
+    Script copyB(b);
+    TEST_ASSERT_TRUE(copyA == a);
+    TEST_ASSERT_TRUE(copyB == b);
+    TEST_ASSERT_TRUE(isInline(copyA));
+    TEST_ASSERT_TRUE(copyB.scriptArray != b.scriptArray);
+
+    Script moveA(static_cast<Script &&>(copyA));
+    TEST_ASSERT_TRUE(moveA == a);
+    TEST_ASSERT_TRUE(isInline(moveA));
+    TEST_ASSERT_EQUAL_size_t(0, copyA.scriptLen);
+
+    uint8_t * heap = copyB.scriptArray;
+    Script moveB(static_cast<Script &&>(copyB));
+    TEST_ASSERT_TRUE(moveB == b);
+    TEST_ASSERT_TRUE(moveB.scriptArray == heap); // buffer is taken, not copied
+    TEST_ASSERT_EQUAL_size_t(0, copyB.scriptLen);
+    TEST_ASSERT_TRUE(isInline(copyB));
+}
+
+TEST_CASE("script assignment", "[uBitcoin]")
+{
+    Script a = shortScript();
+    Script b = longScript();
+    Script sc;
+
+    sc = b; // empty <- long
+    TEST_ASSERT_TRUE(sc == b);
+    TEST_ASSERT_FALSE(isInline(sc));
+    sc = a; // long <- short goes back inline
+    TEST_ASSERT_TRUE(sc == a);
+    TEST_ASSERT_TRUE(isInline(sc));
+    sc = b; // short <- long
+    TEST_ASSERT_TRUE(sc == b);
+    sc = sc; // self-assignment
+    TEST_ASSERT_TRUE(sc == b);
+
+    Script moved;
+    moved = static_cast<Script &&>(sc);
+    TEST_ASSERT_TRUE(moved == b);
+    TEST_ASSERT_EQUAL_size_t(0, sc.scriptLen);
+    moved = Script(a);
+    TEST_ASSERT_TRUE(moved == a);
+    TEST_ASSERT_TRUE(isInline(moved));
+
+    TEST_ASSERT_TRUE(a != b);
+    TEST_ASSERT_FALSE(a == Script());
+}
+
+TEST_CASE("script serialize and parse", "[uBitcoin]")
+{
+    Script scripts[] = { shortScript(), longScript() };
+    for(size_t i = 0; i < sizeof(scripts)/sizeof(scripts[0]); i++){
+        uint8_t buf[LONG_SCRIPT_LEN + 9];
+        size_t len = scripts[i].serialize(buf, sizeof(buf));
+        TEST_ASSERT_EQUAL_size_t(scripts[i].length(), len);
+        TEST_ASSERT_EQUAL_size_t(scripts[i].scriptLen, buf[0]); // varint length prefix
+        TEST_ASSERT_EQUAL_MEMORY(scripts[i].scriptArray, buf + 1, scripts[i].scriptLen);
+
+        Script parsed;
+        TEST_ASSERT_EQUAL_size_t(len, parsed.parse(buf, len));
+        TEST_ASSERT_EQUAL_INT(PARSING_DONE, parsed.getStatus());
+        TEST_ASSERT_TRUE(parsed == scripts[i]);
+        TEST_ASSERT_EQUAL_INT(scripts[i].scriptLen <= SCRIPT_INLINE_SIZE, isInline(parsed));
+
+        // byte by byte
+        Script streamed;
+        size_t parsedLen = 0;
+        for(size_t j = 0; j < len; j++){
+            parsedLen += streamed.parse(buf + j, 1);
+        }
+        TEST_ASSERT_EQUAL_size_t(len, parsedLen);
+        TEST_ASSERT_TRUE(streamed == scripts[i]);
+    }
+}
+
+TEST_CASE("psbt parse and sign allocations", "[uBitcoin][benchmark]")
+{
+    HDPrivateKey root("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", "");
+    size_t len = strlen(referencePSBT)/2;
+    uint8_t * raw = (uint8_t *)malloc(len);
+    TEST_ASSERT_NOT_NULL(raw);
+    TEST_ASSERT_EQUAL_size_t(len, fromHex(referencePSBT, strlen(referencePSBT), raw, len));
+
+    PSBT psbt;
+    testAllocStart();
+    psbt.parse(raw, len);
+    size_t parseAllocations = testAllocStop();
+    TEST_ASSERT_TRUE(psbt.isValid());
+
+    testAllocStart();
+    size_t signatures = psbt.sign(root);
+    size_t signAllocations = testAllocStop();
+    free(raw);
+    printf("psbt with %d inputs: parse %u allocations, sign %u allocations\n",
+           REFERENCE_SIGNATURES, (unsigned)parseAllocations, (unsigned)signAllocations);
+    TEST_ASSERT_EQUAL_size_t(REFERENCE_SIGNATURES, signatures);
+    TEST_ASSERT_TRUE(parseAllocations <= REFERENCE_PARSE_ALLOCATIONS);
+    TEST_ASSERT_TRUE(signAllocations <= REFERENCE_SIGN_ALLOCATIONS);
+
+    TEST_ASSERT_EQUAL_STRING(referenceSigned, psbt.serialize().c_str());
+}
@@ -0,0 +1,113 @@
+#include <string.h>
+#include "unity.h"
+#include "Bitcoin.h"
+#include "Conversion.h"
+#include "test_alloc.h"
+
+// native P2WPKH example from BIP143
+static const char * unsignedTx = "0100000002fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f0000000000eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac11000000";
+// scriptCode of the second input, without the length prefix
+static const char * scriptCode = "76a9141d0f172a0ecb48aee1be1f2687d2963ae33f71a188ac";
+static const uint64_t amount = 600000000;
+static const char * hashPrevouts = "96b827c8483d4e9b96712b6713a7b68d6e8003a781feba36c31143470b4efd37";
+static const char * hashSequence = "52b0a642eea2fb7ae638c36f6252b6750293dbe574a806984b8e4d8548339a3b";
+static const char * hashOutputs = "863ef3e1a92afbfdb97f31ad0fc7683ee943e9abcf2501590ff8f6551f47e5e5";
+static const char * sigHash = "c37af31116d1b27caf68aae9e3ac82f1477929014d5b917657d0eb49478cb670";
+// first input is P2PK, its signature in the signed BIP143 tx verifies against this hash
+static const char * legacyScript = "2103c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432ac";
+static const char * legacySigHash = "63cec688ee06a91e913875356dd4dea2f8e0f2a2659885372da2a37e32c7532e";
+// P2PKH scriptPubkey spent by every input of the sweep
+static const char * sweepScript = "76a9141d0f172a0ecb48aee1be1f2687d2963ae33f71a188ac";
+#define SWEEP_INPUTS 200
+
+static Script scriptFromHex(const char * hex){
+    uint8_t buf[64];
+    size_t len = fromHex(hex, strlen(hex), buf, sizeof(buf));
+    return Script(buf, len);
+}
+
+static void parseTx(Tx * tx){
+    tx->parse(unsignedTx, strlen(unsignedTx), HEX_ENCODING);
+}
+
+TEST_CASE("bip143 p2wpkh sighash", "[uBitcoin]")
+{
+    Tx tx;
+    parseTx(&tx);
+    TEST_ASSERT_EQUAL_INT(PARSING_DONE, tx.getStatus());
+    TEST_ASSERT_EQUAL_size_t(2, tx.inputsNumber);
+
+    uint8_t expected[32];
+    uint8_t h[32];
+    fromHex(sigHash, strlen(sigHash), expected, sizeof(expected));
+    tx.sigHashSegwit(h, 1, scriptFromHex(scriptCode), amount, SIGHASH_ALL);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, h, sizeof(h));
+}
+
+TEST_CASE("bip143 cached sighash matches uncached", "[uBitcoin]")
+{
+    Tx tx;
+    parseTx(&tx);
+    Script script = scriptFromHex(scriptCode);
+
+    SegwitSigHashCache cache;
+    uint8_t expected[32];
+    TEST_ASSERT_EQUAL_INT(96, tx.sigHashSegwitCache(&cache));
+    fromHex(hashPrevouts, strlen(hashPrevouts), expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, cache.hashPrevouts, 32);
+    fromHex(hashSequence, strlen(hashSequence), expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, cache.hashSequence, 32);
+    fromHex(hashOutputs, strlen(hashOutputs), expected, sizeof(expected));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, cache.hashOutputs, 32);
+
+    uint8_t h[32];
+    uint8_t cached[32];
+    for(size_t i = 0; i < tx.inputsNumber; i++){
+        tx.sigHashSegwit(h, i, script, amount, SIGHASH_ALL);
+        tx.sigHashSegwit(cached, i, script, amount, SIGHASH_ALL, &cache);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(h, cached, sizeof(h));
+    }
+}
+
+TEST_CASE("legacy sighash", "[uBitcoin]")
+{
+    Tx tx;
+    parseTx(&tx);
+
+    uint8_t expected[32];
+    uint8_t h[32];
+    fromHex(legacySigHash, strlen(legacySigHash), expected, sizeof(expected));
+    tx.sigHash(h, 0, scriptFromHex(legacyScript), SIGHASH_ALL);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, h, sizeof(h));
+}
+
+TEST_CASE("legacy sighash of a p2pkh sweep does not allocate", "[uBitcoin]")
+{
+    // the counter sees a plain allocation
+    testAllocStart();
+    void * volatile p = malloc(16);
+    free(p);
+    TEST_ASSERT_EQUAL_size_t(1, testAllocStop());
+
+    Tx tx;
+    uint8_t prevHash[32] = { 0 };
+    for(size_t i = 0; i < SWEEP_INPUTS; i++){
+        prevHash[0] = i & 0xFF;
+        prevHash[1] = i >> 8;
+        tx.addInput(TxIn(prevHash, 0));
+    }
+    Script script = scriptFromHex(sweepScript);
+    tx.addOutput(TxOut(1000000, script));
+    TEST_ASSERT_EQUAL_size_t(SWEEP_INPUTS, tx.inputsNumber);
+
+    uint8_t first[32];
+    uint8_t h[32];
+    testAllocStart();
+    tx.sigHash(first, 0, script, SIGHASH_ALL);
+    for(size_t i = 1; i < SWEEP_INPUTS; i++){
+        tx.sigHash(h, i, script, SIGHASH_ALL);
+    }
+    TEST_ASSERT_EQUAL_size_t(0, testAllocStop());
+    // inputs commit to their own index
+    TEST_ASSERT_NOT_EQUAL(0, memcmp(first, h, sizeof(h)));
+}
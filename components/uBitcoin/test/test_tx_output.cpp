@@ -0,0 +1,159 @@
+#include <string.h>
+#include "unity.h"
+#include "Bitcoin.h"
+#include "Conversion.h"
+
+// genesis coinbase, legacy serialization
+static const char * genesisTx = "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000";
+static const char * genesisTxid = "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b";
+static const char * genesisScript = "4104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac";
+// signed native P2WPKH example from BIP143, segwit serialization
+static const char * segwitTx = "01000000000102fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f00000000494830450221008b9d1dc26ba6a9cb62127b02742fa9d754cd3bebf337f7a55d114c8e5cdd30be022040529b194ba3f9281a99f2b1c0a19c0489bc22ede944ccf4ecbab4cc618ef3ed01eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac000247304402203609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a0220573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee0121025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee635711000000";
+static const char * segwitTxid = "e8151a2af31c368a35053ddd4bdb285a8595c769a3ad83e0fa02314a602d4609";
+static const char * segwitWtxid = "c36c38370907df2324d9ce9d149d191192f338b37665a82e78e76a12c909b762";
+static const char * segwitScript = "76a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac";
+// offsets in segwitTx: first scriptSig length, first scriptPubkey length, last byte of the outputs
+#define SEGWIT_SCRIPTSIG_LEN_POS    43
+#define SEGWIT_SCRIPTPUBKEY_LEN_POS 171
+#define SEGWIT_OUTPUTS_LAST_POS     230
+
+static size_t rawTx(const char * hex, uint8_t * out, size_t outLen){
+    return fromHex(hex, strlen(hex), out, outLen);
+}
+
+// rawTxOutput expects the hash in the internal byte order, txids are displayed reversed
+static void txHash(const char * txid, uint8_t hash[32]){
+    uint8_t buf[32];
+    fromHex(txid, 64, buf, 32);
+    for(size_t i=0; i<32; i++){
+        hash[i] = buf[31-i];
+    }
+}
+
+TEST_CASE("raw tx output of a legacy tx", "[uBitcoin]")
+{
+    uint8_t tx[256];
+    size_t len = rawTx(genesisTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    txHash(genesisTxid, hash);
+    uint8_t script[67];
+    fromHex(genesisScript, strlen(genesisScript), script, sizeof(script));
+
+    uint64_t amount = 0;
+    const uint8_t * scriptPubkey = NULL;
+    size_t scriptPubkeyLen = 0;
+    TEST_ASSERT_TRUE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_EQUAL_UINT64(5000000000ULL, amount);
+    TEST_ASSERT_EQUAL_size_t(sizeof(script), scriptPubkeyLen);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(script, scriptPubkey, sizeof(script));
+    // the script points into the raw tx
+    TEST_ASSERT_TRUE(scriptPubkey > tx && scriptPubkey+scriptPubkeyLen <= tx+len);
+}
+
+TEST_CASE("raw tx output of a segwit tx", "[uBitcoin]")
+{
+    uint8_t tx[512];
+    size_t len = rawTx(segwitTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    txHash(segwitTxid, hash);
+    uint8_t script[25];
+    fromHex(segwitScript, strlen(segwitScript), script, sizeof(script));
+
+    uint64_t amount = 0;
+    const uint8_t * scriptPubkey = NULL;
+    size_t scriptPubkeyLen = 0;
+    TEST_ASSERT_TRUE(rawTxOutput(tx, len, hash, 1, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_EQUAL_UINT64(223450000ULL, amount);
+    TEST_ASSERT_EQUAL_size_t(sizeof(script), scriptPubkeyLen);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(script, scriptPubkey, sizeof(script));
+
+    TEST_ASSERT_TRUE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_EQUAL_UINT64(112340000ULL, amount);
+}
+
+TEST_CASE("raw tx output rejects a wrong txid", "[uBitcoin]")
+{
+    uint8_t tx[512];
+    size_t len = rawTx(segwitTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    uint64_t amount;
+    const uint8_t * scriptPubkey;
+    size_t scriptPubkeyLen;
+
+    // a txid with one bit flipped, the wtxid and a txid of another tx
+    txHash(segwitTxid, hash);
+    hash[31] ^= 0x01;
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    txHash(segwitWtxid, hash);
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    txHash(genesisTxid, hash);
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    // a change anywhere in the signed part changes the txid
+    txHash(segwitTxid, hash);
+    tx[SEGWIT_OUTPUTS_LAST_POS] ^= 0x01;
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 1, &amount, &scriptPubkey, &scriptPubkeyLen));
+}
+
+TEST_CASE("raw tx output rejects an output index out of range", "[uBitcoin]")
+{
+    uint8_t tx[512];
+    size_t len = rawTx(segwitTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    txHash(segwitTxid, hash);
+    uint64_t amount = 0;
+    const uint8_t * scriptPubkey = NULL;
+    size_t scriptPubkeyLen = 0;
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 2, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 0xFFFFFFFF, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_NULL(scriptPubkey);
+}
+
+TEST_CASE("raw tx output rejects truncated scripts", "[uBitcoin]")
+{
+    uint8_t tx[512];
+    size_t len = rawTx(segwitTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    txHash(segwitTxid, hash);
+    uint64_t amount;
+    const uint8_t * scriptPubkey;
+    size_t scriptPubkeyLen;
+
+    // every prefix of the tx is rejected
+    for(size_t l=0; l<len; l++){
+        TEST_ASSERT_FALSE(rawTxOutput(tx, l, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    }
+    // script lengths pointing past the end of the tx
+    uint8_t lengths[] = { 0xFC, 0xFD, 0xFE, 0xFF };
+    size_t positions[] = { SEGWIT_SCRIPTSIG_LEN_POS, SEGWIT_SCRIPTPUBKEY_LEN_POS };
+    TEST_ASSERT_EQUAL_HEX8(0x49, tx[SEGWIT_SCRIPTSIG_LEN_POS]);
+    TEST_ASSERT_EQUAL_HEX8(0x19, tx[SEGWIT_SCRIPTPUBKEY_LEN_POS]);
+    for(size_t i=0; i<sizeof(positions)/sizeof(positions[0]); i++){
+        uint8_t original = tx[positions[i]];
+        for(size_t j=0; j<sizeof(lengths); j++){
+            tx[positions[i]] = lengths[j];
+            TEST_ASSERT_FALSE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+        }
+        tx[positions[i]] = original;
+    }
+    TEST_ASSERT_TRUE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+}
+
+TEST_CASE("raw tx output rejects trailing bytes", "[uBitcoin]")
+{
+    uint8_t tx[512];
+    size_t len = rawTx(genesisTx, tx, sizeof(tx));
+    uint8_t hash[32];
+    txHash(genesisTxid, hash);
+    uint64_t amount;
+    const uint8_t * scriptPubkey;
+    size_t scriptPubkeyLen;
+
+    tx[len] = 0x00;
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len+1, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+
+    len = rawTx(segwitTx, tx, sizeof(tx));
+    txHash(segwitTxid, hash);
+    tx[len] = 0x00;
+    TEST_ASSERT_FALSE(rawTxOutput(tx, len+1, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+    TEST_ASSERT_TRUE(rawTxOutput(tx, len, hash, 0, &amount, &scriptPubkey, &scriptPubkeyLen));
+}
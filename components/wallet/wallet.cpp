@@ -8,12 +8,14 @@
 #include <string>
 #include <Bitcoin.h>
 #include <Hash.h>
-#include <utility/trezor/sha3.h>
+#include <keccak.h>
+#include <utility/segwit_addr.h>
 #include <utility/trezor/secp256k1.h>
 #include <utility/trezor/ecdsa.h>
 #include <transaction_factory.h>
 #include <memory>
 #include <unordered_map>
+#include <mutex>
 #include <esp_log.h>
 /*********************
  *      DEFINES
@@ -29,10 +31,26 @@
 #define _debug_print_map_size() \
     ESP_LOGI(TAG, "shared_ptr_map size: %zu", shared_ptr_map.size());
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct wallet_entry_t
+{
+    explicit wallet_entry_t(const HDPrivateKey &k) : key(k) {}
+    HDPrivateKey key;
+    /* filled once on first use, the ui task and the workers on the other core may ask at the same time */
+    std::once_flag metadata_once;
+    wallet_metadata_t metadata = {};
+    std::once_flag eth_account_once;
+    publickey_fingerprint_t eth_account = {};
+} wallet_entry_t;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
-static std::unordered_map<uintptr_t, std::shared_ptr<HDPrivateKey>> shared_ptr_map;
+static std::unordered_map<uintptr_t, std::shared_ptr<wallet_entry_t>> shared_ptr_map;
+/* handles are created from the ui task and from background workers */
+static std::mutex shared_ptr_map_mutex;
 
 extern "C"
 {
@@ -40,9 +58,12 @@ extern "C"
     /**********************
      *  STATIC PROTOTYPES
      **********************/
-    static uintptr_t make_shared_ptr(std::shared_ptr<HDPrivateKey> ptr);
+    static uintptr_t make_shared_ptr(const HDPrivateKey &key);
     static void free_shared_ptr(uintptr_t ptr);
-    static HDPrivateKey *get_shared_ptr(uintptr_t ptr);
+    static std::shared_ptr<wallet_entry_t> get_entry(uintptr_t ptr);
+    static std::shared_ptr<wallet_entry_t> get_entry_with_metadata(uintptr_t ptr);
+    static void fill_eth_account(wallet_entry_t *entry);
+    static void fill_metadata(wallet_entry_t *entry);
 
     /**********************
      * GLOBAL PROTOTYPES
@@ -59,30 +80,83 @@ extern "C"
     void wallet_get_btc_address_segwit(Wallet wallet, char address[43]);
     void wallet_get_btc_address_legacy(Wallet wallet, char address[43]);
     void wallet_get_eth_address(Wallet wallet, char address[43]);
+    bool wallet_metadata(Wallet wallet, wallet_metadata_t *metadata);
     void wallet_eth_sign(Wallet wallet, const uint8_t hash[32], uint8_t signature[65]);
     void wallet_bin_to_hex_string(const uint8_t *bin, size_t bin_len, char **hex_string);
 
     /**********************
      *   STATIC FUNCTIONS
      **********************/
-    static uintptr_t make_shared_ptr(std::shared_ptr<HDPrivateKey> ptr)
+    static uintptr_t make_shared_ptr(const HDPrivateKey &key)
     {
         //_debug_print_map_size();
 
+        auto ptr = std::make_shared<wallet_entry_t>(key);
         uintptr_t _ptr = (uintptr_t)ptr.get();
+        std::lock_guard<std::mutex> lock(shared_ptr_map_mutex);
         shared_ptr_map[_ptr] = ptr;
         return _ptr;
     }
     static void free_shared_ptr(uintptr_t ptr)
     {
+        std::lock_guard<std::mutex> lock(shared_ptr_map_mutex);
         if (shared_ptr_map.find(ptr) != shared_ptr_map.end())
         {
             shared_ptr_map.erase(ptr);
         }
     }
-    static HDPrivateKey *get_shared_ptr(uintptr_t ptr)
+    /* keeps the entry alive while it is used, NULL for an unknown or freed handle */
+    static std::shared_ptr<wallet_entry_t> get_entry(uintptr_t ptr)
+    {
+        std::lock_guard<std::mutex> lock(shared_ptr_map_mutex);
+        auto it = shared_ptr_map.find(ptr);
+        if (it == shared_ptr_map.end())
+        {
+            ESP_LOGE(TAG, "Unknown wallet handle");
+            return nullptr;
+        }
+        return it->second;
+    }
+    /* get_entry() with the metadata filled, the metadata is only valid while the entry is held */
+    static std::shared_ptr<wallet_entry_t> get_entry_with_metadata(uintptr_t ptr)
     {
-        return shared_ptr_map[ptr].get();
+        auto entry = get_entry(ptr);
+        if (entry != nullptr)
+        {
+            std::call_once(entry->metadata_once, fill_metadata, entry.get());
+        }
+        return entry;
+    }
+    static void fill_eth_account(wallet_entry_t *entry)
+    {
+        HDPublicKey account = entry->key.derive(ETH_DERIVATION_PATH).xpub();
+        account.sec(entry->eth_account.public_key, 33);
+        memcpy(entry->eth_account.chain_code, account.chainCode, 32);
+        account.fingerprint(entry->eth_account.fingerprint);
+    }
+    static void fill_metadata(wallet_entry_t *entry)
+    {
+        wallet_metadata_t *metadata = &entry->metadata;
+        PublicKey pubkey = entry->key.publicKey();
+        pubkey.sec(metadata->public_key, sizeof(metadata->public_key));
+        metadata->public_key_uncompressed[0] = 0x04;
+        memcpy(metadata->public_key_uncompressed + 1, pubkey.point, 64);
+        hash160(metadata->public_key, sizeof(metadata->public_key), metadata->hash160);
+        memcpy(metadata->fingerprint, metadata->hash160, 4);
+
+        uint8_t digest[32];
+        keccak256(pubkey.point, 64, digest);
+        memcpy(metadata->eth_address, digest + 12, 20);
+        metadata->eth_address_str[0] = '0';
+        metadata->eth_address_str[1] = 'x';
+        toHex(metadata->eth_address, 20, metadata->eth_address_str + 2, sizeof(metadata->eth_address_str) - 2);
+
+        // both addresses reuse hash160 instead of re-serializing the key
+        segwit_addr_encode(metadata->btc_address_segwit, entry->key.network->bech32, 0, metadata->hash160, 20);
+        uint8_t legacy[21];
+        legacy[0] = entry->key.network->p2pkh;
+        memcpy(legacy + 1, metadata->hash160, 20);
+        toBase58Check(legacy, sizeof(legacy), metadata->btc_address_legacy, sizeof(metadata->btc_address_legacy));
     }
 
     /**********************
@@ -91,12 +165,12 @@ extern "C"
     Wallet wallet_init_from_mnemonic(const char *mnemonic)
     {
         auto wallet = HDPrivateKey{mnemonic, ""};
-        return make_shared_ptr(std::make_shared<HDPrivateKey>(wallet));
+        return make_shared_ptr(wallet);
     }
     Wallet wallet_init_from_xprv(const char *xprv)
     {
         auto wallet = HDPrivateKey{xprv};
-        return make_shared_ptr(std::make_shared<HDPrivateKey>(wallet));
+        return make_shared_ptr(wallet);
     }
     void wallet_free(Wallet wallet)
     {
@@ -105,70 +179,98 @@ extern "C"
 
     char *wallet_root_private_key(Wallet wallet)
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        auto str = _wallet->xprv();
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            return NULL;
+        }
+        auto str = entry->key.xprv();
         char *cstr = (char *)malloc(str.length() + 1);
         strcpy(cstr, str.c_str());
         return cstr;
     }
     void wallet_eth_key_fingerprint(Wallet wallet, publickey_fingerprint_t *fingerprint)
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        HDPrivateKey account = _wallet->derive(ETH_DERIVATION_PATH);
-        account.xpub().sec(fingerprint->public_key, 33);
-        memcpy(fingerprint->chain_code, account.xpub().chainCode, 32);
-        account.xpub().fingerprint(fingerprint->fingerprint);
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            memset(fingerprint, 0, sizeof(publickey_fingerprint_t));
+            return;
+        }
+        std::call_once(entry->eth_account_once, fill_eth_account, entry.get());
+        memcpy(fingerprint, &entry->eth_account, sizeof(publickey_fingerprint_t));
     }
     Wallet wallet_derive(Wallet wallet, const char *path)
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        auto derived = _wallet->derive(path);
-        return make_shared_ptr(std::make_shared<HDPrivateKey>(derived));
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            return 0;
+        }
+        auto derived = entry->key.derive(path);
+        return make_shared_ptr(derived);
     }
     Wallet wallet_derive_btc(Wallet wallet, unsigned int index)
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            return 0;
+        }
         char *derive_path = new char[64];
         snprintf(derive_path, 64, "%s%d/%d/", BTC_DERIVATION_PATH, 0, index);
-        HDPrivateKey account = _wallet->derive(derive_path);
+        HDPrivateKey account = entry->key.derive(derive_path);
         delete[] derive_path;
-        return make_shared_ptr(std::make_shared<HDPrivateKey>(account));
+        return make_shared_ptr(account);
     }
     void wallet_get_btc_address_legacy(Wallet wallet, char address[43])
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        auto str = _wallet->legacyAddress();
-        strcpy(address, str.c_str());
+        auto entry = get_entry_with_metadata(wallet);
+        strcpy(address, entry != nullptr ? entry->metadata.btc_address_legacy : "");
     }
     void wallet_get_btc_address_segwit(Wallet wallet, char address[43])
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        auto str = _wallet->segwitAddress();
-        strcpy(address, str.c_str());
+        auto entry = get_entry_with_metadata(wallet);
+        strcpy(address, entry != nullptr ? entry->metadata.btc_address_segwit : "");
     }
     Wallet wallet_derive_eth(Wallet wallet, unsigned int index)
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            return 0;
+        }
         char *derive_path = new char[64];
         snprintf(derive_path, 64, "%s%d/%d/", ETH_DERIVATION_PATH, 0, index);
-        auto derived = _wallet->derive(derive_path);
+        auto derived = entry->key.derive(derive_path);
         delete[] derive_path;
-        return make_shared_ptr(std::make_shared<HDPrivateKey>(derived));
+        return make_shared_ptr(derived);
     }
     void wallet_get_eth_address(Wallet wallet, char address[43])
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        uint8_t xy[64] = {0};
-        uint8_t eth_address[64] = {0};
-        memcpy(xy, _wallet->publicKey().point, 64);
-        keccak_256(xy, 64, eth_address);
-        auto str = "0x" + toHex(eth_address + 12, 20);
-        strcpy(address, str.c_str());
+        auto entry = get_entry_with_metadata(wallet);
+        strcpy(address, entry != nullptr ? entry->metadata.eth_address_str : "");
+    }
+    bool wallet_metadata(Wallet wallet, wallet_metadata_t *metadata)
+    {
+        auto entry = get_entry_with_metadata(wallet);
+        if (entry == nullptr)
+        {
+            memset(metadata, 0, sizeof(wallet_metadata_t));
+            return false;
+        }
+        *metadata = entry->metadata;
+        return true;
     }
     void wallet_eth_sign(Wallet wallet, const uint8_t hash[32], uint8_t signature[65])
     {
-        HDPrivateKey *_wallet = get_shared_ptr(wallet);
-        Signature sig = _wallet->sign(hash);
+        auto entry = get_entry(wallet);
+        if (entry == nullptr)
+        {
+            memset(signature, 0, 65);
+            return;
+        }
+        Signature sig = entry->key.sign(hash);
         // sig.index += 27;
         sig.bin((uint8_t *)signature, 65);
     }
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 
 #ifdef __cplusplus
@@ -27,6 +28,18 @@ extern "C"
         uint8_t chain_code[32];
         uint8_t fingerprint[4];
     } publickey_fingerprint_t;
+    /* computed once per handle on first use, never changes afterwards */
+    typedef struct __attribute__((aligned(4)))
+    {
+        uint8_t public_key[33];
+        uint8_t public_key_uncompressed[65];
+        uint8_t hash160[20];
+        uint8_t fingerprint[4];
+        uint8_t eth_address[20];
+        char eth_address_str[43];
+        char btc_address_segwit[43];
+        char btc_address_legacy[43];
+    } wallet_metadata_t;
 
     /**********************
      * GLOBAL PROTOTYPES
@@ -43,6 +56,8 @@ extern "C"
     void wallet_get_btc_address_segwit(Wallet wallet, char address[43]);
     void wallet_get_btc_address_legacy(Wallet wallet, char address[43]);
     void wallet_get_eth_address(Wallet wallet, char address[43]);
+    /* copies the metadata of the handle, false for an unknown handle */
+    bool wallet_metadata(Wallet wallet, wallet_metadata_t *metadata);
     void wallet_eth_sign(Wallet wallet, const uint8_t hash[32], uint8_t signature[65]);
     void wallet_bin_to_hex_string(const uint8_t *bin, size_t bin_len, char **hex_string);
 
@@ -15,6 +15,7 @@ typedef enum
 {
     CTRL_HOME_NETWORK_TYPE_ETH = 0,
     CTRL_HOME_NETWORK_TYPE_BTC_SEGWIT = 1,
+    CTRL_HOME_NETWORK_TYPE_BTC_LEGACY = 2,
 } ctrl_home_network_type;
 
 typedef enum
@@ -26,11 +27,11 @@ typedef enum
 typedef struct __attribute__((aligned(4))) _ctrl_home_3rd_wallet_info_t
 {
     /* 3rd wallet icon */
-    lv_image_dsc_t *icon;
+    const lv_image_dsc_t *icon;
     /* 3rd wallet name */
     char name[32];
     /* next */
-    struct _ctrl_home_3rd_wallet_info_t *next;
+    const struct _ctrl_home_3rd_wallet_info_t *next;
 } ctrl_home_3rd_wallet_info_t;
 
 typedef struct __attribute__((aligned(4))) _ctrl_home_compatible_wallet_group_t
@@ -38,9 +39,9 @@ typedef struct __attribute__((aligned(4))) _ctrl_home_compatible_wallet_group_t
     /* qr type */
     ctrl_home_connect_qr_type qr_type;
     /* 3rd wallet list */
-    ctrl_home_3rd_wallet_info_t *wallet_info_3rd;
+    const ctrl_home_3rd_wallet_info_t *wallet_info_3rd;
     /* next group */
-    struct _ctrl_home_compatible_wallet_group_t *next;
+    const struct _ctrl_home_compatible_wallet_group_t *next;
 } ctrl_home_compatible_wallet_group_t;
 
 typedef struct __attribute__((aligned(4))) _ctrl_home_network_data_t
@@ -58,7 +59,7 @@ typedef struct __attribute__((aligned(4))) _ctrl_home_network_data_t
     /* current wallet */
     Wallet wallet_current;
     /* compatible wallet group */
-    ctrl_home_compatible_wallet_group_t *compatible_wallet_group;
+    const ctrl_home_compatible_wallet_group_t *compatible_wallet_group;
     /* next network */
     struct _ctrl_home_network_data_t *next;
 } ctrl_home_network_data_t;
@@ -75,7 +76,7 @@ extern "C"
     void ctrl_home_destroy(void);
     void ctrl_home_lock_screen(void);
 
-    /* wallet page */
+    /* wallet page, NULL until the unlock-time worker has filled the table */
     ctrl_home_network_data_t *ctrl_home_list_networks(void);
     char *ctrl_home_get_connect_qrcode(ctrl_home_network_data_t *network, ctrl_home_connect_qr_type qr_type);
 
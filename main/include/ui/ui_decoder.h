@@ -4,8 +4,8 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdbool.h>
 #include "esp_lvgl_port.h"
-#include "qrcode_protocol.h"
 #include "wallet.h"
 
 #ifdef __cplusplus
@@ -16,7 +16,11 @@ extern "C"
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
-    void ui_decoder_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_protocol_bc_ur_data, lv_obj_t *event_target);
+    /*
+        Reviews the queued requests, one description per request, NULL for a request that can't be signed.
+        Sends UI_EVENT_DECODER_CONFIRM once for the whole list, UI_EVENT_DECODER_SCAN_MORE if scan_more is set and tapped.
+     */
+    void ui_decoder_init(Wallet _wallet, char **requests, size_t requests_len, bool scan_more, lv_obj_t *event_target);
     void ui_decoder_destroy(void);
 
 #ifdef __cplusplus
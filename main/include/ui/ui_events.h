@@ -24,6 +24,7 @@ extern "C"
     extern uint32_t UI_EVENT_MASTER_PAGE_CLOSE_BUTTON_CLICKED;
     extern uint32_t UI_EVENT_DECODER_CANCEL;
     extern uint32_t UI_EVENT_DECODER_CONFIRM;
+    extern uint32_t UI_EVENT_DECODER_SCAN_MORE;
 
     /**********************
      * GLOBAL PROTOTYPES
@@ -20,6 +20,7 @@ extern "C"
     void ui_home_stop_qr_scan(void);
     void ui_home_update_camera_preview(void *src);
     void ui_home_set_qr_scan_progress(size_t progress);
+    void ui_home_update_networks(void);
 
 #ifdef __cplusplus
     extern "C"
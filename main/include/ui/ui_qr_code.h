@@ -15,6 +15,11 @@ extern "C"
      * GLOBAL PROTOTYPES
      **********************/
     void ui_qr_code_init(char *title, char *text_pre, char *qr_code, char *text_post);
+    /*
+        Shows the qr codes one per page with previous/next buttons, e.g. one UR per signature.
+        Each code is a complete UR that is scanned on its own, a single code is shown like ui_qr_code_init().
+     */
+    void ui_qr_code_init_pages(char *title, char *text_pre, char **qr_codes, size_t qr_codes_len, char *text_post);
     void ui_qr_code_destroy(void);
 
 #ifdef __cplusplus
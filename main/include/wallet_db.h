@@ -28,6 +28,22 @@ typedef struct __attribute__((aligned(4)))
     uint32_t checksum;
 } wallet_data_version_1_t;
 
+/* version 2: privateKey is sealed with AES-256-GCM instead of AES-256-ECB */
+typedef struct __attribute__((aligned(4)))
+{
+    int version;
+    bool initialized;
+    uint8_t incorrectPinCount;
+    uint8_t incorrectPinCountMax;
+    uint32_t lockScreenTimeout;
+    bool signPinRequired;
+    uint8_t pinPadding[32];
+    char privateKey[PRIVATE_KEY_SIZE];
+    uint8_t privateKeyIv[AES_GCM_IV_SIZE];
+    uint8_t privateKeyTag[AES_GCM_TAG_SIZE];
+    uint32_t checksum;
+} wallet_data_version_2_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -36,8 +52,8 @@ extern "C"
     /**********************
      * GLOBAL PROTOTYPES
      **********************/
-    bool wallet_db_load_wallet_data(wallet_data_version_1_t *walletData);
-    void wallet_db_save_wallet_data(wallet_data_version_1_t *walletData);
+    bool wallet_db_load_wallet_data(wallet_data_version_2_t *walletData);
+    void wallet_db_save_wallet_data(wallet_data_version_2_t *walletData);
     bool wallet_db_init_wallet_data(char *phrase_str, char *pin_str, char **private_key_str);
     void wallet_db_clear_cache();
     char *wallet_db_verify_pin(char *pin_str);
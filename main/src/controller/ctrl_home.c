@@ -34,6 +34,12 @@ LV_IMG_DECLARE(wallet_imtoken)
 LV_IMG_DECLARE(wallet_metamask)
 LV_IMG_DECLARE(wallet_rabby)
 
+#define CTRL_HOME_NETWORK_COUNT 3
+/* distinct derivation paths used by the network table */
+#define CTRL_HOME_NETWORK_PATH_ETH 0
+#define CTRL_HOME_NETWORK_PATH_BTC 1
+#define CTRL_HOME_NETWORK_PATH_COUNT 2
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,7 +54,21 @@ typedef struct
  **********************/
 static const char *TAG = "ctrl_home";
 static Wallet wallet = 0;
-static ctrl_home_network_data_t *network_data = NULL;
+static const ctrl_home_3rd_wallet_info_t wallet_info_3rd_eth[] = {
+    {&wallet_metamask, "MetaMask", &wallet_info_3rd_eth[1]},
+    {&wallet_imtoken, "imToken", &wallet_info_3rd_eth[2]},
+    {&wallet_rabby, "Rabby", NULL},
+};
+static const ctrl_home_compatible_wallet_group_t compatible_wallet_group_eth = {
+    CTRL_HOME_CONNECT_QR_TYPE_METAMASK,
+    &wallet_info_3rd_eth[0],
+    NULL,
+};
+/* addresses are only known after unlock, filled once by networkListTask */
+static ctrl_home_network_data_t network_table[CTRL_HOME_NETWORK_COUNT];
+static Wallet network_wallets[CTRL_HOME_NETWORK_PATH_COUNT] = {0};
+static volatile bool network_table_ready = false;
+static volatile bool network_task_status = false;
 static bool scan_task_status_request = false;
 static bool scan_task_status = false;
 static TimerHandle_t lock_screen_timer;
@@ -57,6 +77,9 @@ static TimerHandle_t lock_screen_timer;
  *  STATIC PROTOTYPES
  **********************/
 static void qrScannerTask(void *parameters);
+static void networkListTask(void *parameters);
+static void network_table_set(int index, ctrl_home_network_type type, const lv_image_dsc_t *icon, const char *name,
+                              const char *address, Wallet wallet_current, const ctrl_home_compatible_wallet_group_t *compatible_wallet_group);
 static void global_touch_event_handler(lv_event_t *e);
 static void lock_screen_timeout_callback(TimerHandle_t xTimer);
 
@@ -146,7 +169,7 @@ static void qrScannerTask(void *parameters)
 
     bool scan_success = false;
 
-    wallet_data_version_1_t walletData;
+    wallet_data_version_2_t walletData;
     wallet_db_load_wallet_data(&walletData);
     uint32_t LOCK_SCREEN_TIMEOUT_MS = walletData.lockScreenTimeout;
 
@@ -312,6 +335,45 @@ static void qrScannerTask(void *parameters)
     scan_task_status = false;
     vTaskDelete(NULL);
 }
+static void network_table_set(int index, ctrl_home_network_type type, const lv_image_dsc_t *icon, const char *name,
+                              const char *address, Wallet wallet_current, const ctrl_home_compatible_wallet_group_t *compatible_wallet_group)
+{
+    ctrl_home_network_data_t *network = &network_table[index];
+    network->type = type;
+    network->icon = (lv_image_dsc_t *)icon;
+    strncpy(network->name, name, sizeof(network->name) - 1);
+    strncpy(network->address, address, sizeof(network->address) - 1);
+    network->wallet_main = wallet;
+    network->wallet_current = wallet_current;
+    network->compatible_wallet_group = compatible_wallet_group;
+    network->next = (index + 1 < CTRL_HOME_NETWORK_COUNT) ? &network_table[index + 1] : NULL;
+}
+static void networkListTask(void *parameters)
+{
+    /* every distinct path is derived once, the btc entries share m/84'/0'/0'/0/0 */
+    network_wallets[CTRL_HOME_NETWORK_PATH_ETH] = wallet_derive_eth(wallet, 0);
+    network_wallets[CTRL_HOME_NETWORK_PATH_BTC] = wallet_derive_btc(wallet, 0);
+    wallet_metadata_t metadata;
+    /* warm up the account xpub used by the connect qrcode */
+    publickey_fingerprint_t fingerprint;
+    wallet_eth_key_fingerprint(wallet, &fingerprint);
+
+    memset(network_table, 0, sizeof(network_table));
+    /* network_table_set() copies the address, one metadata buffer is enough */
+    wallet_metadata(network_wallets[CTRL_HOME_NETWORK_PATH_ETH], &metadata);
+    network_table_set(0, CTRL_HOME_NETWORK_TYPE_ETH, &logo_ethereum, "Ethereum",
+                      metadata.eth_address_str, network_wallets[CTRL_HOME_NETWORK_PATH_ETH], &compatible_wallet_group_eth);
+    wallet_metadata(network_wallets[CTRL_HOME_NETWORK_PATH_BTC], &metadata);
+    network_table_set(1, CTRL_HOME_NETWORK_TYPE_BTC_SEGWIT, &logo_bitcoin, "Bitcoin segwit",
+                      metadata.btc_address_segwit, network_wallets[CTRL_HOME_NETWORK_PATH_BTC], NULL);
+    network_table_set(2, CTRL_HOME_NETWORK_TYPE_BTC_LEGACY, &logo_bitcoin, "Bitcoin legacy",
+                      metadata.btc_address_legacy, network_wallets[CTRL_HOME_NETWORK_PATH_BTC], NULL);
+    network_table_ready = true;
+
+    ui_home_update_networks();
+    network_task_status = false;
+    vTaskDelete(NULL);
+}
 static void global_touch_event_handler(lv_event_t *e)
 {
     if (scan_task_status)
@@ -347,9 +409,12 @@ void ctrl_home_init(char *privateKeyStr)
     scan_task_status_request = false;
     scan_task_status = false;
     wallet = wallet_init_from_xprv(privateKeyStr);
+    network_table_ready = false;
+    network_task_status = true;
+    xTaskCreatePinnedToCore(networkListTask, "networkListTask", 6 * 1024, NULL, 5, NULL, MCU_CORE1);
     ui_home_init();
 
-    wallet_data_version_1_t walletData;
+    wallet_data_version_2_t walletData;
     wallet_db_load_wallet_data(&walletData);
     uint32_t LOCK_SCREEN_TIMEOUT_MS = walletData.lockScreenTimeout;
     lock_screen_timer = xTimerCreate("LockScreenTimer", pdMS_TO_TICKS(LOCK_SCREEN_TIMEOUT_MS), pdFALSE, NULL, lock_screen_timeout_callback);
@@ -369,6 +434,10 @@ void ctrl_home_destroy(void)
     {
         vTaskDelay(pdMS_TO_TICKS(5));
     }
+    while (network_task_status)
+    {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
     ctrl_sign_destroy();
     ui_home_destroy();
     if (wallet != NULL)
@@ -376,39 +445,16 @@ void ctrl_home_destroy(void)
         wallet_free(wallet);
         wallet = NULL;
     }
-    if (network_data != NULL)
+    network_table_ready = false;
+    for (int i = 0; i < CTRL_HOME_NETWORK_PATH_COUNT; i++)
     {
-        ctrl_home_network_data_t *network_current = network_data;
-        ctrl_home_network_data_t *network_next;
-        while (network_current != NULL)
+        if (network_wallets[i] != 0)
         {
-            network_next = network_current->next;
-            // free current
-            wallet_free(network_current->wallet_current);
-            // free compatible_wallet_group
-            {
-                ctrl_home_compatible_wallet_group_t *compatible_wallet_group = network_current->compatible_wallet_group;
-                // free wallet_info_3rd
-                if (compatible_wallet_group != NULL)
-                {
-                    ctrl_home_3rd_wallet_info_t *wallet_info_3rd_current = compatible_wallet_group->wallet_info_3rd;
-                    ctrl_home_3rd_wallet_info_t *wallet_info_3rd_next;
-                    while (wallet_info_3rd_current != NULL)
-                    {
-                        wallet_info_3rd_next = wallet_info_3rd_current->next;
-                        // ESP_LOG_BUFFER_HEXDUMP(TAG, wallet_info_3rd_current, sizeof(ctrl_home_3rd_wallet_info_t), ESP_LOG_INFO);
-                        free(wallet_info_3rd_current);
-                        wallet_info_3rd_current = wallet_info_3rd_next;
-                    }
-                }
-                free(compatible_wallet_group);
-            }
-            free(network_current);
-            network_current = network_next;
+            wallet_free(network_wallets[i]);
+            network_wallets[i] = 0;
         }
-
-        network_data = NULL;
     }
+    memset(network_table, 0, sizeof(network_table));
     if (lock_screen_timer != NULL)
     {
         lv_obj_remove_event_cb(lv_scr_act(), global_touch_event_handler); // remove LV_EVENT_GET_SELF_SIZE
@@ -422,114 +468,11 @@ void ctrl_home_destroy(void)
 /* wallet page */
 ctrl_home_network_data_t *ctrl_home_list_networks(void)
 {
-    if (network_data == NULL)
+    if (!network_table_ready)
     {
-        ctrl_home_network_data_t *network_data_ethereum = NULL;
-        {
-            ctrl_home_network_data_t *network_data_temp = (ctrl_home_network_data_t *)malloc(sizeof(ctrl_home_network_data_t));
-            memset(network_data_temp, 0, sizeof(ctrl_home_network_data_t));
-            {
-                network_data_temp->type = CTRL_HOME_NETWORK_TYPE_ETH;
-                network_data_temp->icon = &logo_ethereum;
-                strcpy(network_data_temp->name, "Ethereum");
-                Wallet _wallet = wallet_derive_eth(wallet, 0);
-                char walletAddress[43];
-                wallet_get_eth_address(_wallet, walletAddress);
-                strcpy(network_data_temp->address, walletAddress);
-                network_data_temp->wallet_main = wallet;
-                network_data_temp->wallet_current = _wallet;
-                ctrl_home_compatible_wallet_group_t *compatible_wallet_group = (ctrl_home_compatible_wallet_group_t *)malloc(sizeof(ctrl_home_compatible_wallet_group_t));
-                {
-                    memset(compatible_wallet_group, 0, sizeof(ctrl_home_compatible_wallet_group_t));
-                    compatible_wallet_group->qr_type = CTRL_HOME_CONNECT_QR_TYPE_METAMASK;
-                    {
-                        // MetaMask
-                        ctrl_home_3rd_wallet_info_t *wallet_info_3rd_metamask = NULL;
-                        {
-                            ctrl_home_3rd_wallet_info_t *wallet_info_3rd_tmp = (ctrl_home_3rd_wallet_info_t *)malloc(sizeof(ctrl_home_3rd_wallet_info_t));
-                            memset(wallet_info_3rd_tmp, 0, sizeof(ctrl_home_3rd_wallet_info_t));
-                            strcpy(wallet_info_3rd_tmp->name, "MetaMask");
-                            wallet_info_3rd_tmp->icon = &wallet_metamask;
-                            wallet_info_3rd_tmp->next = NULL;
-                            wallet_info_3rd_metamask = wallet_info_3rd_tmp;
-                        }
-                        // imToken
-                        ctrl_home_3rd_wallet_info_t *wallet_info_3rd_imtoken = NULL;
-                        {
-                            ctrl_home_3rd_wallet_info_t *wallet_info_3rd_tmp = (ctrl_home_3rd_wallet_info_t *)malloc(sizeof(ctrl_home_3rd_wallet_info_t));
-                            memset(wallet_info_3rd_tmp, 0, sizeof(ctrl_home_3rd_wallet_info_t));
-                            strcpy(wallet_info_3rd_tmp->name, "imToken");
-                            wallet_info_3rd_tmp->icon = &wallet_imtoken;
-                            wallet_info_3rd_tmp->next = NULL;
-                            wallet_info_3rd_imtoken = wallet_info_3rd_tmp;
-                        }
-                        // Rabby
-                        ctrl_home_3rd_wallet_info_t *wallet_info_3rd_rabby = NULL;
-                        {
-                            ctrl_home_3rd_wallet_info_t *wallet_info_3rd_tmp = (ctrl_home_3rd_wallet_info_t *)malloc(sizeof(ctrl_home_3rd_wallet_info_t));
-                            memset(wallet_info_3rd_tmp, 0, sizeof(ctrl_home_3rd_wallet_info_t));
-                            strcpy(wallet_info_3rd_tmp->name, "Rabby");
-                            wallet_info_3rd_tmp->icon = &wallet_rabby;
-                            wallet_info_3rd_tmp->next = NULL;
-                            wallet_info_3rd_rabby = wallet_info_3rd_tmp;
-                        }
-                        compatible_wallet_group->wallet_info_3rd = wallet_info_3rd_metamask;
-                        wallet_info_3rd_metamask->next = wallet_info_3rd_imtoken;
-                        wallet_info_3rd_imtoken->next = wallet_info_3rd_rabby;
-                    }
-                    compatible_wallet_group->next = NULL;
-                }
-                network_data_temp->compatible_wallet_group = compatible_wallet_group;
-                network_data_temp->next = NULL;
-            }
-            network_data_ethereum = network_data_temp;
-        }
-
-        ctrl_home_network_data_t *network_data_bitcoin_segwit = NULL;
-        {
-            ctrl_home_network_data_t *network_data_temp = (ctrl_home_network_data_t *)malloc(sizeof(ctrl_home_network_data_t));
-            memset(network_data_temp, 0, sizeof(ctrl_home_network_data_t));
-            {
-                network_data_temp->type = CTRL_HOME_NETWORK_TYPE_ETH;
-                network_data_temp->icon = &logo_bitcoin;
-                strcpy(network_data_temp->name, "Bitcoin segwit");
-                Wallet _wallet = wallet_derive_btc(wallet, 0);
-                char walletAddress[43];
-                wallet_get_btc_address_segwit(_wallet, walletAddress);
-                strcpy(network_data_temp->address, walletAddress);
-                network_data_temp->wallet_main = wallet;
-                network_data_temp->wallet_current = _wallet;
-                network_data_temp->compatible_wallet_group = NULL;
-                network_data_temp->next = NULL;
-            }
-            network_data_bitcoin_segwit = network_data_temp;
-        }
-
-        ctrl_home_network_data_t *network_data_bitcoin_legacy = NULL;
-        {
-            ctrl_home_network_data_t *network_data_temp = (ctrl_home_network_data_t *)malloc(sizeof(ctrl_home_network_data_t));
-            memset(network_data_temp, 0, sizeof(ctrl_home_network_data_t));
-            {
-                network_data_temp->type = CTRL_HOME_NETWORK_TYPE_ETH;
-                network_data_temp->icon = &logo_bitcoin;
-                strcpy(network_data_temp->name, "Bitcoin legacy");
-                Wallet _wallet = wallet_derive_btc(wallet, 0);
-                char walletAddress[43];
-                wallet_get_btc_address_legacy(_wallet, walletAddress);
-                strcpy(network_data_temp->address, walletAddress);
-                network_data_temp->wallet_main = wallet;
-                network_data_temp->wallet_current = _wallet;
-                network_data_temp->compatible_wallet_group = NULL;
-                network_data_temp->next = NULL;
-            }
-            network_data_bitcoin_legacy = network_data_temp;
-        }
-
-        network_data_ethereum->next = network_data_bitcoin_segwit;
-        network_data_bitcoin_segwit->next = network_data_bitcoin_legacy;
-        network_data = network_data_ethereum;
+        return NULL;
     }
-    return network_data;
+    return &network_table[0];
 }
 char *ctrl_home_get_connect_qrcode(ctrl_home_network_data_t *network, ctrl_home_connect_qr_type qr_type)
 {
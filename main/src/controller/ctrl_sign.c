@@ -3,38 +3,75 @@
  *********************/
 #include "controller/ctrl_sign.h"
 #include <esp_log.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "app_peripherals.h"
 #include "base64url.h"
 #include "transaction_factory.h"
 #include "ui/ui_decoder.h"
 #include "ui/ui_events.h"
+#include "ui/ui_home.h"
 #include "ui/ui_qr_code.h"
 #include "ui/ui_loading.h"
+#include "ui/ui_toast.h"
 #include "ethereum.h"
-#include "cJSON.h"
 #include "evm_chains.h"
-#include <math.h>
 
 /*********************
  *      DEFINES
  *********************/
 #define TAG "ctrl_sign"
+/* requests reviewed and signed together in one session */
+#define CTRL_SIGN_QUEUE_MAX 8
+/* typed data is hashed on this stack, as deep as it was on the LVGL task */
+#define CTRL_SIGN_TASK_STACK (12 * 1024)
+/* typed data review: the size line, primaryType and the domain fields */
+#define CTRL_SIGN_TYPED_DATA_TEXT_LEN 512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+    /* scanned UR, decoded and released on the LVGL task */
+    qrcode_protocol_bc_ur_data_t *qrcode_protocol_bc_ur_data;
+    /* NULL if the request can't be signed, it is listed but skipped */
+    metamask_sign_request_t *request;
+    char *description;
+    /* transactions are hashed while they are parsed for the review */
+    uint8_t digest[32];
+} ctrl_sign_request_t;
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static Wallet wallet = 0;
-static qrcode_protocol_bc_ur_data_t *qrcode_protocol_bc_ur_data;
+static ctrl_sign_request_t queue[CTRL_SIGN_QUEUE_MAX];
+static size_t queue_len = 0;
 static lv_obj_t *event_target = NULL;
+/* made by signTask, handed to show_qr_signature() */
+static char *signatures[CTRL_SIGN_QUEUE_MAX];
+static size_t signatures_len = 0;
+static size_t signed_requests_len = 0;
+static volatile bool sign_task_status = false;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void ui_event_handler(lv_event_t *e);
-static char *ctrl_sign_get_signature(void);
+static metamask_sign_request_t *ctrl_sign_decode_request(qrcode_protocol_bc_ur_data_t *qrcode_protocol_bc_ur_data);
+static uint8_t *ctrl_sign_decode_sign_data(const metamask_sign_request_t *request, size_t *sign_data_len);
+static char *ctrl_sign_describe(ctrl_sign_request_t *item);
+static char *ctrl_sign_get_signature(const ctrl_sign_request_t *item, Wallet account);
 static char *ctrl_sign_decode_transaction(void);
+static void show_review(char *arg);
+static void signTask(void *parameters);
 static void show_qr_signature(char *arg);
+static void scan_more(char *arg);
+static void ctrl_sign_release_ui(void);
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -55,17 +92,240 @@ static void ui_event_handler(lv_event_t *e)
     else if (code == UI_EVENT_DECODER_CONFIRM)
     {
         ui_loading_show();
+        sign_task_status = true;
+        if (xTaskCreatePinnedToCore(signTask, "signTask", CTRL_SIGN_TASK_STACK, NULL, 5, NULL, MCU_CORE1) != pdPASS)
+        {
+            // nothing to wait for in ctrl_sign_destroy(), the review stays open
+            ESP_LOGE(TAG, "xTaskCreatePinnedToCore failed");
+            sign_task_status = false;
+            ui_loading_hide();
+            ui_toast_show("Not enough memory to sign, try again", 2000);
+        }
+    }
+    else if (code == UI_EVENT_DECODER_SCAN_MORE)
+    {
+        lv_async_call(scan_more, NULL);
+    }
+}
+static void show_review(char *arg)
+{
+    // decoding runs here rather than on the small scanner task stack
+    for (size_t i = 0; i < queue_len; i++)
+    {
+        ctrl_sign_request_t *item = &queue[i];
+        if (item->qrcode_protocol_bc_ur_data == NULL)
+        {
+            continue;
+        }
+        item->request = ctrl_sign_decode_request(item->qrcode_protocol_bc_ur_data);
+        item->description = (item->request != NULL) ? ctrl_sign_describe(item) : NULL;
+        if (item->request != NULL && item->description == NULL)
+        {
+            free_metamask_sign_request(item->request);
+            item->request = NULL;
+        }
+        qrcode_protocol_bc_ur_free(item->qrcode_protocol_bc_ur_data);
+        free(item->qrcode_protocol_bc_ur_data);
+        item->qrcode_protocol_bc_ur_data = NULL;
+    }
+
+    if (event_target == NULL)
+    {
+        if (lvgl_port_lock(0))
+        {
+            event_target = lv_obj_create(lv_scr_act());
+            lv_obj_add_flag(event_target, LV_OBJ_FLAG_HIDDEN);
+            lvgl_port_unlock();
+        }
+
+        lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_DECODER_CANCEL, NULL);
+        lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_DECODER_CONFIRM, NULL);
+        lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_DECODER_SCAN_MORE, NULL);
+    }
+
+    char *descriptions[CTRL_SIGN_QUEUE_MAX];
+    for (size_t i = 0; i < queue_len; i++)
+    {
+        descriptions[i] = queue[i].description;
+    }
+    ui_decoder_init(wallet, descriptions, queue_len, queue_len < CTRL_SIGN_QUEUE_MAX, event_target);
+}
+static void signTask(void *parameters)
+{
+    // key derivation and hashing run here, the LVGL task keeps drawing the loading screen
+    Wallet account = 0;
+    const char *account_path = NULL;
+    for (size_t i = 0; i < queue_len; i++)
+    {
+        const ctrl_sign_request_t *item = &queue[i];
+        const metamask_sign_request_t *request = item->request;
+        if (request == NULL)
+        {
+            continue;
+        }
+        // requests of one session nearly always come from the same account, derive it once per distinct path
+        if (account == 0 || strcmp(account_path, request->derivation_path) != 0)
+        {
+            if (account != 0)
+            {
+                wallet_free(account);
+            }
+            account = wallet_derive(wallet, request->derivation_path);
+            account_path = request->derivation_path;
+        }
+        char *signature = ctrl_sign_get_signature(item, account);
+        if (signature != NULL)
+        {
+            signatures[signatures_len++] = signature;
+        }
+    }
+    if (account != 0)
+    {
+        wallet_free(account);
+    }
+    signed_requests_len = queue_len;
+
+    sign_task_status = false;
+    if (lvgl_port_lock(0))
+    {
         lv_async_call(show_qr_signature, NULL);
+        lvgl_port_unlock();
     }
+    vTaskDelete(NULL);
 }
 static void show_qr_signature(char *arg)
 {
-    char *signature = ctrl_sign_get_signature();
+    if (signed_requests_len == 0)
+    {
+        // the session was closed while signing
+        return;
+    }
+    char *shown[CTRL_SIGN_QUEUE_MAX];
+    size_t shown_len = signatures_len;
+    size_t requests_len = signed_requests_len;
+    memcpy(shown, signatures, sizeof(shown));
+    signatures_len = 0;
+    signed_requests_len = 0;
     ctrl_sign_destroy();
-    ui_qr_code_init("Signature", "Scan the QR code to send transaction", signature, NULL);
-    free(signature);
+
+    char text[80];
+    if (requests_len > 1)
+    {
+        snprintf(text, sizeof(text), "%u of %u requests signed, scan each QR code, the arrows switch between them",
+                 (unsigned int)shown_len, (unsigned int)requests_len);
+    }
+    else
+    {
+        snprintf(text, sizeof(text), "Scan the QR code to send transaction");
+    }
+    ui_qr_code_init_pages("Signature", text, shown, shown_len, NULL);
+    for (size_t i = 0; i < shown_len; i++)
+    {
+        free(shown[i]);
+    }
     ui_loading_hide();
 }
+static void scan_more(char *arg)
+{
+    // the queue stays, the next scan lands in ctrl_sign_init() again
+    ctrl_sign_release_ui();
+    ui_home_start_qr_scan();
+}
+static void ctrl_sign_release_ui(void)
+{
+    if (event_target != NULL)
+    {
+        if (lvgl_port_lock(0))
+        {
+            lv_obj_del(event_target);
+            lvgl_port_unlock();
+            event_target = NULL;
+        }
+    }
+}
+static metamask_sign_request_t *ctrl_sign_decode_request(qrcode_protocol_bc_ur_data_t *qrcode_protocol_bc_ur_data)
+{
+    const char *type = qrcode_protocol_bc_ur_type(qrcode_protocol_bc_ur_data);
+    ESP_LOGI(TAG, "type: %s", type);
+    if (type == NULL || strcmp(type, METAMASK_ETH_SIGN_REQUEST) != 0)
+    {
+        ESP_LOGI(TAG, "Unsupported type: %s", type);
+        return NULL;
+    }
+    metamask_sign_request_t *request = (metamask_sign_request_t *)calloc(1, sizeof(metamask_sign_request_t));
+    if (request == NULL)
+    {
+        return NULL;
+    }
+    int err = decode_metamask_sign_request(qrcode_protocol_bc_ur_data->ur, request);
+    if (err != 0)
+    {
+        ESP_LOGE(TAG, "decode_metamask_sign_typed_transaction_request error: %d", err);
+        free_metamask_sign_request(request);
+        return NULL;
+    }
+    return request;
+}
+static uint8_t *ctrl_sign_decode_sign_data(const metamask_sign_request_t *request, size_t *sign_data_len)
+{
+    size_t sign_data_max_len = strlen(request->sign_data_base64url);
+    uint8_t *sign_data = (uint8_t *)malloc(sign_data_max_len + 1);
+    if (sign_data == NULL)
+    {
+        return NULL;
+    }
+    *sign_data_len = decode_base64url(request->sign_data_base64url, sign_data, sign_data_max_len);
+    sign_data[*sign_data_len] = '\0';
+    return sign_data;
+}
+static char *ctrl_sign_describe(ctrl_sign_request_t *item)
+{
+    const metamask_sign_request_t *request = item->request;
+    size_t sign_data_len = 0;
+    uint8_t *sign_data = ctrl_sign_decode_sign_data(request, &sign_data_len);
+    if (sign_data == NULL)
+    {
+        return NULL;
+    }
+
+    char *description = NULL;
+    if (request->data_type == KEY_DATA_TYPE_SIGN_TYPED_TRANSACTION)
+    {
+        transaction_data_t transaction_data;
+        transaction_factory_init_digest(&transaction_data, sign_data, sign_data_len, item->digest);
+        if (transaction_data.error == 0)
+        {
+            description = transaction_factory_to_string(&transaction_data);
+        }
+        transaction_factory_free(&transaction_data);
+    }
+    else if (request->data_type == KEY_DATA_TYPE_SIGN_PERSONAL_MESSAGE)
+    {
+        size_t len = strlen((const char *)sign_data) + 32;
+        description = (char *)malloc(len);
+        if (description != NULL)
+        {
+            snprintf(description, len, "Sign message:\n%s", (const char *)sign_data);
+        }
+    }
+    else if (request->data_type == KEY_DATA_TYPE_SIGN_TYPED_DATA)
+    {
+        size_t len = CTRL_SIGN_TYPED_DATA_TEXT_LEN;
+        description = (char *)malloc(len);
+        if (description != NULL)
+        {
+            // sign_data is a copy, it may be parsed in place, ctrl_sign_get_signature() decodes it again
+            int written = snprintf(description, len, "Sign typed data (%u bytes)", (unsigned int)sign_data_len);
+            if (!ethereum_typed_data_describe((char *)sign_data, sign_data_len, description + written, len - written))
+            {
+                free(description);
+                description = NULL;
+            }
+        }
+    }
+    free(sign_data);
+    return description;
+}
 
 static char *ctrl_sign_decode_transaction(void)
 {
@@ -147,8 +407,8 @@ static char *ctrl_sign_decode_transaction(void)
     //                     strcat(decoded_str, (char *)transaction_data->chainId);
     //                     strcat(decoded_str, "\n");
     //                     strcat(decoded_str, "Chain name: ");
-    //                     evm_chain_info_t *chain_info = evm_chain_name_from_str((char *)transaction_data->chainId);
-    //                     strcat(decoded_str, chain_info->chain_name);
+    //                     evm_chain_info_t chain_info;
+    //                     strcat(decoded_str, evm_chain_name_from_str((char *)transaction_data->chainId, &chain_info) ? chain_info.chain_name : "Unknown Chain");
     //                     strcat(decoded_str, "\n");
     //                 }
     //                 else
@@ -173,119 +433,17 @@ static char *ctrl_sign_decode_transaction(void)
     //             }
     //             else if (request.data_type == KEY_DATA_TYPE_SIGN_TYPED_DATA)
     //             {
-    //                 ESP_LOGE(TAG, "sign typed data");
-    //                 cJSON *json = cJSON_Parse((char *)sign_data);
-    //                 // get domain
-    //                 char *chainId_str = NULL;
-    //                 char *name_str = NULL;
-    //                 char *verifyingContract_str = NULL;
-
-    //                 char *primaryType_str = NULL;
-    //                 char *message_str = NULL;
-    //                 char *types_str = NULL;
-    //                 char *domain_str = NULL;
-
-    //                 cJSON *primaryType = cJSON_GetObjectItemCaseSensitive(json, "primaryType");
-    //                 cJSON *types = cJSON_GetObjectItemCaseSensitive(json, "types");
-    //                 cJSON *domain = cJSON_GetObjectItemCaseSensitive(json, "domain");
-    //                 cJSON *message = cJSON_GetObjectItemCaseSensitive(json, "message");
-    //                 if (primaryType != NULL && types != NULL && domain != NULL && message != NULL)
-    //                 {
-    //                     // get chainid
-    //                     cJSON *chainId = cJSON_GetObjectItemCaseSensitive(domain, "chainId");
-    //                     cJSON *name = cJSON_GetObjectItemCaseSensitive(domain, "name");
-    //                     cJSON *verifyingContract = cJSON_GetObjectItemCaseSensitive(domain, "verifyingContract");
-    //                     if (
-    //                         (cJSON_GetStringValue(chainId) != NULL || !isnan(cJSON_GetNumberValue(chainId))) &&
-    //                         cJSON_GetStringValue(name) != NULL && cJSON_GetStringValue(verifyingContract) != NULL)
-    //                     {
-    //                         if (cJSON_GetStringValue(chainId) != NULL)
-    //                         {
-    //                             chainId_str = malloc(strlen(chainId->valuestring) + 1);
-    //                             strcpy(chainId_str, chainId->valuestring);
-    //                         }
-    //                         else
-    //                         {
-    //                             chainId_str = malloc(33);
-    //                             sprintf(chainId_str, "%f", cJSON_GetNumberValue(chainId));
-    //                         }
-
-    //                         char *_name = cJSON_GetStringValue(name);
-    //                         name_str = malloc(strlen(_name) + 1);
-    //                         strcpy(name_str, _name);
-
-    //                         char *_verifyingContract = cJSON_GetStringValue(verifyingContract);
-    //                         verifyingContract_str = malloc(strlen(_verifyingContract) + 1);
-    //                         strcpy(verifyingContract_str, _verifyingContract);
-
-    //                         cJSON *primaryTypeObject = cJSON_CreateObject();
-    //                         cJSON_AddItemToObject(primaryTypeObject, "primaryType", cJSON_Duplicate(primaryType, 1));
-    //                         primaryType_str = cJSON_Print(primaryTypeObject);
-    //                         cJSON_Delete(primaryTypeObject);
-
-    //                         cJSON *typesObject = cJSON_CreateObject();
-    //                         cJSON_AddItemToObject(typesObject, "types", cJSON_Duplicate(types, 1));
-    //                         types_str = cJSON_Print(typesObject);
-    //                         cJSON_Delete(typesObject);
-
-    //                         cJSON *domainObject = cJSON_CreateObject();
-    //                         cJSON_AddItemToObject(domainObject, "domain", cJSON_Duplicate(domain, 1));
-    //                         // if domainObject.chainId is not a string, change it to string
-    //                         if (cJSON_GetStringValue(chainId) == NULL)
-    //                         {
-    //                             cJSON_DeleteItemFromObject(domainObject, "chainId");
-    //                             cJSON_AddStringToObject(domainObject, "chainId", chainId_str);
-    //                         }
-    //                         domain_str = cJSON_Print(domainObject);
-    //                         cJSON_Delete(domainObject);
-
-    //                         cJSON *messageObject = cJSON_CreateObject();
-    //                         cJSON_AddItemToObject(messageObject, "message", cJSON_Duplicate(message, 1));
-    //                         message_str = cJSON_Print(messageObject);
-    //                         cJSON_Delete(messageObject);
-    //                     }
-    //                     else
-    //                     {
-    //                         ESP_LOGE(TAG, "Failed to get chainId, name, verifyingContract");
-    //                     }
-    //                 }
-    //                 else
-    //                 {
-    //                     ESP_LOGE(TAG, "Failed to get primaryType, types, domain, message");
-    //                 }
-
-    //                 if (chainId_str)
+    //                 ESP_LOGI(TAG, "sign typed data");
+    //                 uint8_t typed_data_hash[32];
+    //                 if (ethereum_typed_data_hash_v4((char *)sign_data, sign_data_len, typed_data_hash))
     //                 {
-    //                     uint8_t typed_data_hash[32];
-    //                     ethereum_typed_data_hash_v4(primaryType_str, types_str, domain_str, message_str, typed_data_hash);
-    //                     // ESP_LOG_BUFFER_HEXDUMP(TAG, typed_data_hash, 32, ESP_LOG_INFO);
     //                     uint8_t signature[65];
     //                     wallet_eth_sign(account, typed_data_hash, signature);
     //                     size_t uuid_max_len = strlen(request.uuid_base64url);
     //                     uint8_t *uuid = (uint8_t *)malloc(uuid_max_len);
     //                     decode_base64url(request.uuid_base64url, uuid, uuid_max_len);
-    //                     generate_metamask_eth_signature(uuid, signature, &qr_code_str);
     //                     free(uuid);
     //                 }
-
-    //                 free(chainId_str);
-    //                 free(name_str);
-    //                 free(verifyingContract_str);
-    //                 free(primaryType_str);
-    //                 free(message_str);
-    //                 free(types_str);
-    //                 free(domain_str);
-
-    //                 chainId_str = NULL;
-    //                 name_str = NULL;
-    //                 verifyingContract_str = NULL;
-    //                 primaryType_str = NULL;
-    //                 message_str = NULL;
-    //                 types_str = NULL;
-    //                 domain_str = NULL;
-
-    //                 cJSON_Delete(json);
-    //                 json = NULL;
     //             }
     //             else
     //             {
@@ -308,202 +466,67 @@ static char *ctrl_sign_decode_transaction(void)
     // }
     return decoded_str;
 }
-static char *ctrl_sign_get_signature()
+static char *ctrl_sign_get_signature(const ctrl_sign_request_t *item, Wallet account)
 {
-    char *qr_code_str = NULL;
-    const char *type = qrcode_protocol_bc_ur_type(qrcode_protocol_bc_ur_data);
-    ESP_LOGI(TAG, "type: %s", type);
-    if (strcmp(type, METAMASK_ETH_SIGN_REQUEST) == 0)
+    const metamask_sign_request_t *request = item->request;
+    wallet_metadata_t metadata;
+    if (!wallet_metadata(account, &metadata) || memcmp(metadata.eth_address, request->address_bin, 20) != 0)
+    {
+        ESP_LOGE(TAG, "Invalid address");
+        return NULL;
+    }
+
+    bool hashed = false;
+    uint8_t digest[32];
+    if (request->data_type == KEY_DATA_TYPE_SIGN_TYPED_TRANSACTION)
+    {
+        // parsed and hashed in one pass by ctrl_sign_describe(), only listed requests get here
+        ESP_LOGI(TAG, "Signing transaction...");
+        memcpy(digest, item->digest, sizeof(digest));
+        hashed = true;
+    }
+    else
     {
-        metamask_sign_request_t request;
-        int err = decode_metamask_sign_request(qrcode_protocol_bc_ur_data->ur, &request);
-        if (err == 0)
+        size_t sign_data_len = 0;
+        uint8_t *sign_data = ctrl_sign_decode_sign_data(request, &sign_data_len);
+        if (sign_data == NULL)
         {
-            size_t sign_data_max_len = strlen(request.sign_data_base64url);
-            uint8_t *sign_data = (uint8_t *)malloc(sign_data_max_len + 1);
-            size_t sign_data_len = decode_base64url(request.sign_data_base64url, sign_data, sign_data_max_len);
-            sign_data[sign_data_len] = '\0';
-            Wallet account = wallet_derive(wallet, request.derivation_path);
-            char account_address[43];
-            wallet_get_eth_address(account, account_address);
-            if (strcmp(account_address, request.address) != 0)
-            {
-                ESP_LOGE(TAG, "Invalid address");
-            }
-            else
+            return NULL;
+        }
+        if (request->data_type == KEY_DATA_TYPE_SIGN_PERSONAL_MESSAGE)
+        {
+            ESP_LOGI(TAG, "sign personal message");
+            const char *sign_data_str = (const char *)sign_data;
+            ethereum_keccak256_eip191(sign_data_str, strlen(sign_data_str), digest);
+            hashed = true;
+        }
+        else if (request->data_type == KEY_DATA_TYPE_SIGN_TYPED_DATA)
+        {
+            ESP_LOGI(TAG, "sign typed data");
+            // hashed in place from the decoded payload, sign_data is only freed afterwards
+            hashed = ethereum_typed_data_hash_v4((char *)sign_data, sign_data_len, digest);
+            if (!hashed)
             {
-                if (request.data_type == KEY_DATA_TYPE_SIGN_TYPED_TRANSACTION)
-                {
-                    ESP_LOGI(TAG, "sign typed transaction");
-                    transaction_data_t *transaction_data = (transaction_data_t *)malloc(sizeof(transaction_data_t));
-                    transaction_factory_init(transaction_data, sign_data, sign_data_len);
-
-                    if (transaction_data->error == 0)
-                    {
-                        ESP_LOGI(TAG, "Signing transaction...");
-                        uint8_t signature[65];
-                        uint8_t digest[32];
-                        ethereum_keccak256(sign_data, sign_data_len, digest);
-                        wallet_eth_sign(account, digest, signature);
-                        size_t uuid_max_len = strlen(request.uuid_base64url);
-                        uint8_t *uuid = (uint8_t *)malloc(uuid_max_len);
-                        decode_base64url(request.uuid_base64url, uuid, uuid_max_len);
-                        generate_metamask_eth_signature(uuid, signature, &qr_code_str);
-                        free(uuid);
-                    }
-                    else
-                    {
-                        ESP_LOGE(TAG, "Failed to create transaction factory");
-                    }
-                    transaction_factory_free(transaction_data);
-                    free(transaction_data);
-                }
-                else if (request.data_type == KEY_DATA_TYPE_SIGN_PERSONAL_MESSAGE)
-                {
-                    ESP_LOGI(TAG, "sign personal message");
-                    uint8_t signature[65];
-                    uint8_t digest[32];
-                    const char *sign_data_str = (const char *)sign_data;
-                    ethereum_keccak256_eip191(sign_data_str, strlen(sign_data_str), digest);
-                    wallet_eth_sign(account, digest, signature);
-                    size_t uuid_max_len = strlen(request.uuid_base64url);
-                    uint8_t *uuid = (uint8_t *)malloc(uuid_max_len);
-                    decode_base64url(request.uuid_base64url, uuid, uuid_max_len);
-                    generate_metamask_eth_signature(uuid, signature, &qr_code_str);
-                    free(uuid);
-                }
-                else if (request.data_type == KEY_DATA_TYPE_SIGN_TYPED_DATA)
-                {
-                    ESP_LOGE(TAG, "sign typed data");
-                    cJSON *json = cJSON_Parse((char *)sign_data);
-                    // get domain
-                    char *chainId_str = NULL;
-                    char *name_str = NULL;
-                    char *verifyingContract_str = NULL;
-
-                    char *primaryType_str = NULL;
-                    char *message_str = NULL;
-                    char *types_str = NULL;
-                    char *domain_str = NULL;
-
-                    cJSON *primaryType = cJSON_GetObjectItemCaseSensitive(json, "primaryType");
-                    cJSON *types = cJSON_GetObjectItemCaseSensitive(json, "types");
-                    cJSON *domain = cJSON_GetObjectItemCaseSensitive(json, "domain");
-                    cJSON *message = cJSON_GetObjectItemCaseSensitive(json, "message");
-                    if (primaryType != NULL && types != NULL && domain != NULL && message != NULL)
-                    {
-                        // get chainid
-                        cJSON *chainId = cJSON_GetObjectItemCaseSensitive(domain, "chainId");
-                        cJSON *name = cJSON_GetObjectItemCaseSensitive(domain, "name");
-                        cJSON *verifyingContract = cJSON_GetObjectItemCaseSensitive(domain, "verifyingContract");
-                        if (
-                            (cJSON_GetStringValue(chainId) != NULL || !isnan(cJSON_GetNumberValue(chainId))) &&
-                            cJSON_GetStringValue(name) != NULL && cJSON_GetStringValue(verifyingContract) != NULL)
-                        {
-                            if (cJSON_GetStringValue(chainId) != NULL)
-                            {
-                                chainId_str = malloc(strlen(chainId->valuestring) + 1);
-                                strcpy(chainId_str, chainId->valuestring);
-                            }
-                            else
-                            {
-                                chainId_str = malloc(33);
-                                sprintf(chainId_str, "%f", cJSON_GetNumberValue(chainId));
-                            }
-
-                            char *_name = cJSON_GetStringValue(name);
-                            name_str = malloc(strlen(_name) + 1);
-                            strcpy(name_str, _name);
-
-                            char *_verifyingContract = cJSON_GetStringValue(verifyingContract);
-                            verifyingContract_str = malloc(strlen(_verifyingContract) + 1);
-                            strcpy(verifyingContract_str, _verifyingContract);
-
-                            cJSON *primaryTypeObject = cJSON_CreateObject();
-                            cJSON_AddItemToObject(primaryTypeObject, "primaryType", cJSON_Duplicate(primaryType, 1));
-                            primaryType_str = cJSON_Print(primaryTypeObject);
-                            cJSON_Delete(primaryTypeObject);
-
-                            cJSON *typesObject = cJSON_CreateObject();
-                            cJSON_AddItemToObject(typesObject, "types", cJSON_Duplicate(types, 1));
-                            types_str = cJSON_Print(typesObject);
-                            cJSON_Delete(typesObject);
-
-                            cJSON *domainObject = cJSON_CreateObject();
-                            cJSON_AddItemToObject(domainObject, "domain", cJSON_Duplicate(domain, 1));
-                            // if domainObject.chainId is not a string, change it to string
-                            if (cJSON_GetStringValue(chainId) == NULL)
-                            {
-                                cJSON_DeleteItemFromObject(domainObject, "chainId");
-                                cJSON_AddStringToObject(domainObject, "chainId", chainId_str);
-                            }
-                            domain_str = cJSON_Print(domainObject);
-                            cJSON_Delete(domainObject);
-
-                            cJSON *messageObject = cJSON_CreateObject();
-                            cJSON_AddItemToObject(messageObject, "message", cJSON_Duplicate(message, 1));
-                            message_str = cJSON_Print(messageObject);
-                            cJSON_Delete(messageObject);
-                        }
-                        else
-                        {
-                            ESP_LOGE(TAG, "Failed to get chainId, name, verifyingContract");
-                        }
-                    }
-                    else
-                    {
-                        ESP_LOGE(TAG, "Failed to get primaryType, types, domain, message");
-                    }
-
-                    if (chainId_str)
-                    {
-                        uint8_t typed_data_hash[32];
-                        ethereum_typed_data_hash_v4(primaryType_str, types_str, domain_str, message_str, typed_data_hash);
-                        // ESP_LOG_BUFFER_HEXDUMP(TAG, typed_data_hash, 32, ESP_LOG_INFO);
-                        uint8_t signature[65];
-                        wallet_eth_sign(account, typed_data_hash, signature);
-                        size_t uuid_max_len = strlen(request.uuid_base64url);
-                        uint8_t *uuid = (uint8_t *)malloc(uuid_max_len);
-                        decode_base64url(request.uuid_base64url, uuid, uuid_max_len);
-                        generate_metamask_eth_signature(uuid, signature, &qr_code_str);
-                        free(uuid);
-                    }
-
-                    free(chainId_str);
-                    free(name_str);
-                    free(verifyingContract_str);
-                    free(primaryType_str);
-                    free(message_str);
-                    free(types_str);
-                    free(domain_str);
-
-                    chainId_str = NULL;
-                    name_str = NULL;
-                    verifyingContract_str = NULL;
-                    primaryType_str = NULL;
-                    message_str = NULL;
-                    types_str = NULL;
-                    domain_str = NULL;
-
-                    cJSON_Delete(json);
-                    json = NULL;
-                }
-                else
-                {
-                    ESP_LOGE(TAG, "Invalid data type: %ld", request.data_type);
-                }
+                ESP_LOGE(TAG, "Failed to hash typed data");
             }
-            wallet_free(account);
-            free(sign_data);
         }
         else
         {
-            ESP_LOGE(TAG, "decode_metamask_sign_typed_transaction_request error: %d", err);
+            ESP_LOGE(TAG, "Invalid data type: %ld", request->data_type);
         }
+        free(sign_data);
     }
-    else
+
+    char *qr_code_str = NULL;
+    if (hashed)
     {
-        ESP_LOGI(TAG, "Unsupported type: %s", type);
+        uint8_t signature[65];
+        wallet_eth_sign(account, digest, signature);
+        size_t uuid_max_len = strlen(request->uuid_base64url);
+        uint8_t *uuid = (uint8_t *)malloc(uuid_max_len);
+        decode_base64url(request->uuid_base64url, uuid, uuid_max_len);
+        generate_metamask_eth_signature(uuid, signature, &qr_code_str);
+        free(uuid);
     }
     return qr_code_str;
 }
@@ -516,37 +539,47 @@ void ctrl_sign_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_protoc
     ui_init_events();
 
     wallet = _wallet;
-    qrcode_protocol_bc_ur_data = _qrcode_protocol_bc_ur_data;
 
-    if (lvgl_port_lock(0))
+    if (queue_len < CTRL_SIGN_QUEUE_MAX)
     {
-        event_target = lv_obj_create(lv_scr_act());
-        lv_obj_add_flag(event_target, LV_OBJ_FLAG_HIDDEN);
-        lvgl_port_unlock();
+        queue[queue_len++].qrcode_protocol_bc_ur_data = _qrcode_protocol_bc_ur_data;
     }
-
-    lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_DECODER_CANCEL, NULL);
-    lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_DECODER_CONFIRM, NULL);
-
-    ui_decoder_init(wallet, qrcode_protocol_bc_ur_data, event_target);
+    else
+    {
+        ESP_LOGE(TAG, "Sign queue is full");
+        qrcode_protocol_bc_ur_free(_qrcode_protocol_bc_ur_data);
+        free(_qrcode_protocol_bc_ur_data);
+    }
+    lv_async_call(show_review, NULL);
 }
 void ctrl_sign_destroy()
 {
-    if (qrcode_protocol_bc_ur_data != NULL)
+    while (sign_task_status)
     {
-        qrcode_protocol_bc_ur_free(qrcode_protocol_bc_ur_data);
-        free(qrcode_protocol_bc_ur_data);
-        qrcode_protocol_bc_ur_data = NULL;
+        vTaskDelay(pdMS_TO_TICKS(5));
     }
-    if (event_target != NULL)
+    for (size_t i = 0; i < signatures_len; i++)
     {
-        if (lvgl_port_lock(0))
+        free(signatures[i]);
+    }
+    signatures_len = 0;
+    signed_requests_len = 0;
+    for (size_t i = 0; i < queue_len; i++)
+    {
+        if (queue[i].qrcode_protocol_bc_ur_data != NULL)
         {
-            lv_obj_del(event_target);
-            lvgl_port_unlock();
-            event_target = NULL;
+            qrcode_protocol_bc_ur_free(queue[i].qrcode_protocol_bc_ur_data);
+            free(queue[i].qrcode_protocol_bc_ur_data);
         }
+        if (queue[i].request != NULL)
+        {
+            free_metamask_sign_request(queue[i].request);
+        }
+        free(queue[i].description);
     }
+    memset(queue, 0, sizeof(queue));
+    queue_len = 0;
+    ctrl_sign_release_ui();
     ui_qr_code_destroy();
     ui_loading_hide();
-}
\ No newline at end of file
+}
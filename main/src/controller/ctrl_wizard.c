@@ -31,7 +31,7 @@ typedef enum
  **********************/
 static const char *TAG = "CTRL_WIZARD";
 static char **_privateKeyStr = NULL;
-static wallet_data_version_1_t *walletData_cache = NULL;
+static wallet_data_version_2_t *walletData_cache = NULL;
 static UI_STEP current_step;
 
 /**********************
@@ -44,7 +44,7 @@ static char *verify_pin(char *pin);
  **********************/
 void ctrl_wizard_init(char **privateKeyStr);
 void ctrl_wizard_destroy();
-void save_wallet_data(wallet_data_version_1_t *walletData);
+void save_wallet_data(wallet_data_version_2_t *walletData);
 void ctrl_wizard_set_private_key(char *privateKeyStr);
 
 /**********************
@@ -81,8 +81,8 @@ void ctrl_wizard_init(char **privateKeyStr)
     // kv_delete(KV_FS_KEY_WALLET);
     _privateKeyStr = privateKeyStr;
     // ui_loading_show();
-    walletData_cache = malloc(sizeof(wallet_data_version_1_t));
-    memset(walletData_cache, 0, sizeof(wallet_data_version_1_t));
+    walletData_cache = malloc(sizeof(wallet_data_version_2_t));
+    memset(walletData_cache, 0, sizeof(wallet_data_version_2_t));
     lv_obj_t *screen = lv_scr_act();
     ui_init_events();
 
@@ -19,7 +19,7 @@ typedef struct __attribute__((aligned(4)))
 {
     ctrl_home_network_data_t *network_data;
     ctrl_home_connect_qr_type qr_type;
-    ctrl_home_3rd_wallet_info_t *wallet_info_3rd;
+    const ctrl_home_3rd_wallet_info_t *wallet_info_3rd;
 
 } ui_connect_qrcode_t;
 
@@ -125,7 +125,7 @@ static void show_qrcode(ui_connect_qrcode_t *ui_connect_qrcode_data)
         lvgl_port_unlock();
     }
     ui_master_page_set_back_button_visibility(true, master_page);
-    ui_master_page_set_title(ui_connect_qrcode_data->wallet_info_3rd->name, master_page);
+    ui_master_page_set_title((char *)ui_connect_qrcode_data->wallet_info_3rd->name, master_page);
 }
 static void hide_qrcode()
 {
@@ -201,7 +201,7 @@ void ui_connect_qrcode_init(ctrl_home_network_data_t *network_data)
 
         lv_obj_t *obj = NULL;
         lv_obj_t *label = NULL;
-        ctrl_home_3rd_wallet_info_t *wallet_info_3rd = network_data->compatible_wallet_group->wallet_info_3rd;
+        const ctrl_home_3rd_wallet_info_t *wallet_info_3rd = network_data->compatible_wallet_group->wallet_info_3rd;
         while (wallet_info_3rd)
         {
             {
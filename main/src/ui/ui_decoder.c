@@ -4,6 +4,7 @@
 #include "ui/ui_decoder.h"
 #include "ui/ui_style.h"
 #include "esp_log.h"
+#include "stdio.h"
 #include "ui/ui_master_page.h"
 #include "alloc_utils.h"
 #include "ui/ui_events.h"
@@ -27,6 +28,7 @@ static lv_obj_t *container = NULL;
 static int32_t container_width = 0;
 static int32_t container_height = 0;
 static lv_obj_t *sign_btn = NULL;
+static lv_obj_t *scan_more_btn = NULL;
 static lv_obj_t *transaction_detail_container = NULL;
 
 /**********************
@@ -34,12 +36,12 @@ static lv_obj_t *transaction_detail_container = NULL;
  **********************/
 static void ui_event_handler(lv_event_t *e);
 static char *verify_pin(char *pin_str);
-static void transaction_decoder(qrcode_protocol_bc_ur_data_t *_qrcode_protocol_bc_ur_data);
+static size_t transaction_decoder(char **requests, size_t requests_len);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-void ui_decoder_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_protocol_bc_ur_data, lv_obj_t *event_target);
+void ui_decoder_init(Wallet _wallet, char **requests, size_t requests_len, bool scan_more, lv_obj_t *event_target);
 void ui_decoder_destroy(void);
 
 /**********************
@@ -48,11 +50,17 @@ void ui_decoder_destroy(void);
 static void ui_event_handler(lv_event_t *e)
 {
     lv_event_code_t code = lv_event_get_code(e);
-    if (code == LV_EVENT_CLICKED)
+    if (code == LV_EVENT_CLICKED && lv_event_get_target(e) == scan_more_btn)
     {
-        // sign transaction
+        // keep the reviewed requests, the next scan is appended to them
+        lv_async_call(ui_decoder_destroy, NULL);
+        lv_obj_send_event(event_target, UI_EVENT_DECODER_SCAN_MORE, NULL);
+    }
+    else if (code == LV_EVENT_CLICKED)
+    {
+        // sign all requests, one pin for the whole list
 
-        wallet_data_version_1_t walletData;
+        wallet_data_version_2_t walletData;
         if (wallet_db_load_wallet_data(&walletData) == false)
         {
             ui_panic("Can't load wallet data", PANIC_REBOOT);
@@ -86,21 +94,32 @@ static char *verify_pin(char *pin_str)
     }
     return ret;
 }
-static void transaction_decoder(qrcode_protocol_bc_ur_data_t *_qrcode_protocol_bc_ur_data)
+/* lists the requests, returns how many of them can be signed */
+static size_t transaction_decoder(char **requests, size_t requests_len)
 {
-    lv_obj_t *label = lv_label_create(transaction_detail_container);
-    lv_label_set_text(label, "Transaction decode not implemented yet");
-    lv_obj_align(label, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_size(label, LV_PCT(100), LV_SIZE_CONTENT);
-
-    lv_obj_clear_state(sign_btn, LV_STATE_DISABLED);
+    size_t valid = 0;
+    for (size_t i = 0; i < requests_len; i++)
+    {
+        lv_obj_t *label = lv_label_create(transaction_detail_container);
+        if (requests[i] != NULL)
+        {
+            lv_label_set_text_fmt(label, "#%u\n%s", (unsigned int)(i + 1), requests[i]);
+            valid++;
+        }
+        else
+        {
+            lv_label_set_text_fmt(label, "#%u\nUnsupported request, it will be skipped", (unsigned int)(i + 1));
+        }
+        lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+        lv_obj_set_size(label, LV_PCT(100), LV_SIZE_CONTENT);
+    }
+    return valid;
 }
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-void ui_decoder_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_protocol_bc_ur_data, lv_obj_t *_event_target)
+void ui_decoder_init(Wallet _wallet, char **requests, size_t requests_len, bool scan_more, lv_obj_t *_event_target)
 {
     ui_init_events();
     event_target = _event_target;
@@ -112,7 +131,16 @@ void ui_decoder_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_proto
     {
         lv_obj_add_event_cb(event_target, ui_event_handler, UI_EVENT_MASTER_PAGE_CLOSE_BUTTON_CLICKED, NULL);
         ALLOC_UTILS_MALLOC_MEMORY(alloc_utils_memory_struct_pointer, master_page, sizeof(ui_master_page_t));
-        ui_master_page_init(NULL, event_target, false, true, "Transaction", master_page);
+        char title[32];
+        if (requests_len > 1)
+        {
+            snprintf(title, sizeof(title), "%u Requests", (unsigned int)requests_len);
+        }
+        else
+        {
+            snprintf(title, sizeof(title), "Transaction");
+        }
+        ui_master_page_init(NULL, event_target, false, true, title, master_page);
         lv_obj_t *_container = ui_master_page_get_container(master_page);
         ui_master_page_get_container_size(master_page, &container_width, &container_height);
 
@@ -131,15 +159,46 @@ void ui_decoder_init(Wallet _wallet, qrcode_protocol_bc_ur_data_t *_qrcode_proto
         transaction_detail_container = lv_obj_create(cont_col);
         NO_BODER_PADDING_STYLE(transaction_detail_container);
         lv_obj_set_size(transaction_detail_container, LV_PCT(100), container_height - footer_height);
+        lv_obj_set_flex_flow(transaction_detail_container, LV_FLEX_FLOW_COLUMN);
+
+        lv_obj_t *footer = lv_obj_create(cont_col);
+        NO_BODER_PADDING_STYLE(footer);
+        lv_obj_set_size(footer, LV_PCT(100), footer_height * 0.8);
+        lv_obj_set_flex_flow(footer, LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(footer, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+        size_t signable = transaction_decoder(requests, requests_len);
+
+        lv_obj_t *label = NULL;
+        scan_more_btn = NULL;
+        if (scan_more)
+        {
+            scan_more_btn = lv_button_create(footer);
+            lv_obj_set_size(scan_more_btn, LV_PCT(48), LV_PCT(100));
+            label = lv_label_create(scan_more_btn);
+            lv_label_set_text(label, "Scan more");
+            lv_obj_center(label);
+            lv_obj_add_event_cb(scan_more_btn, ui_event_handler, LV_EVENT_CLICKED, NULL);
+        }
 
-        sign_btn = lv_button_create(cont_col);
-        lv_obj_set_size(sign_btn, LV_PCT(100), footer_height * 0.8);
-        lv_obj_t *label = lv_label_create(sign_btn);
-        lv_label_set_text(label, "Sign");
+        sign_btn = lv_button_create(footer);
+        lv_obj_set_size(sign_btn, scan_more ? LV_PCT(48) : LV_PCT(100), LV_PCT(100));
+        label = lv_label_create(sign_btn);
+        // skipped requests don't count
+        if (signable > 1)
+        {
+            lv_label_set_text_fmt(label, "Sign %u", (unsigned int)signable);
+        }
+        else
+        {
+            lv_label_set_text(label, "Sign");
+        }
         lv_obj_center(label);
-        lv_obj_add_state(sign_btn, LV_STATE_DISABLED);
+        if (signable == 0)
+        {
+            lv_obj_add_state(sign_btn, LV_STATE_DISABLED);
+        }
         lv_obj_add_event_cb(sign_btn, ui_event_handler, LV_EVENT_CLICKED, NULL);
-        transaction_decoder(_qrcode_protocol_bc_ur_data);
     }
     lvgl_port_unlock();
 }
@@ -156,6 +215,8 @@ void ui_decoder_destroy()
             lv_obj_del(container);
             container = NULL;
         }
+        sign_btn = NULL;
+        scan_more_btn = NULL;
         lvgl_port_unlock();
     }
 
@@ -62,6 +62,7 @@ typedef struct
  *  STATIC VARIABLES
  **********************/
 static lv_obj_t *tv = NULL;
+static lv_obj_t *wallet_list = NULL;
 static lv_obj_t *preview_image = NULL;
 static lv_obj_t *progress_bar = NULL;
 static lv_obj_t *incorrect_pin_count_max_dd = NULL;
@@ -78,6 +79,7 @@ static lv_obj_t *erase_msgbox = NULL;
  **********************/
 static void wallet_list_item_event_handler(lv_event_t *e);
 static void create_tab_wallet(lv_obj_t *parent);
+static void fill_wallet_list(lv_obj_t *list);
 static void create_tab_scanner(lv_obj_t *parent);
 static void create_tab_settings(lv_obj_t *parent);
 static void lv_tabview_event_handler(lv_event_t *e);
@@ -93,6 +95,7 @@ void ui_home_start_qr_scan(void);
 void ui_home_stop_qr_scan(void);
 void ui_home_update_camera_preview(void *src);
 void ui_home_set_qr_scan_progress(size_t progress);
+void ui_home_update_networks(void);
 
 /**********************
  *   STATIC FUNCTIONS
@@ -137,7 +140,14 @@ static void create_tab_wallet(lv_obj_t *parent)
     // lv_obj_set_style_bg_color(list, lv_color_hex(0xff0000), 0);
     lv_obj_set_size(list, parent_width, lv_pct(100));
     lv_obj_center(list);
+    wallet_list = list;
 
+    fill_wallet_list(list);
+}
+static void fill_wallet_list(lv_obj_t *list)
+{
+    lv_obj_clean(list);
+    int parent_width = lv_obj_get_width(lv_obj_get_parent(list));
     ctrl_home_network_data_t *network_data = ctrl_home_list_networks();
     size_t index = 0;
     int padding = ITEM_ICON_PADDING + 2;
@@ -302,7 +312,7 @@ static void create_tab_settings(lv_obj_t *parent)
     lv_obj_set_flex_grow(incorrect_pin_count_max_dd, 1);
 
     // select current value
-    wallet_data_version_1_t walletData;
+    wallet_data_version_2_t walletData;
     wallet_db_load_wallet_data(&walletData);
     lv_dropdown_set_selected(incorrect_pin_count_max_dd, walletData.incorrectPinCountMax - 2);
 
@@ -441,7 +451,7 @@ static void ui_event_handler(lv_event_t *e)
         }
         if (ui_action->action == SETTINGS_ACTION_INCORRECT_PIN_COUNT_MAX_CHANGED)
         {
-            wallet_data_version_1_t walletData;
+            wallet_data_version_2_t walletData;
             wallet_db_load_wallet_data(&walletData);
             int idx = 0;
             if (lvgl_port_lock(0))
@@ -487,7 +497,7 @@ static void ui_event_handler(lv_event_t *e)
         // reset UI
         if (pin_verify_post_action == PIN_VERIFY_POST_ACTION_CHANGE_INCORRECT_PIN_COUNT_MAX)
         {
-            wallet_data_version_1_t walletData;
+            wallet_data_version_2_t walletData;
             wallet_db_load_wallet_data(&walletData);
             if (lvgl_port_lock(0))
             {
@@ -515,7 +525,7 @@ static char *verify_pin(char *pin_str)
         }
         else if (pin_verify_post_action == PIN_VERIFY_POST_ACTION_CHANGE_INCORRECT_PIN_COUNT_MAX)
         {
-            wallet_data_version_1_t walletData;
+            wallet_data_version_2_t walletData;
             wallet_db_load_wallet_data(&walletData);
             uint32_t idx = 0;
             if (lvgl_port_lock(0))
@@ -598,6 +608,7 @@ void ui_home_destroy(void)
         {
             lv_obj_del(tv);
             tv = NULL;
+            wallet_list = NULL;
         }
         lvgl_port_unlock();
     }
@@ -636,6 +647,8 @@ void ui_home_start_qr_scan(void)
             if (lv_tabview_get_tab_active(tv) != 1)
             {
                 lv_tabview_set_active(tv, 1, LV_ANIM_OFF);
+                // set_active doesn't notify, start the camera like a tap on the tab does
+                lv_obj_send_event(tv, LV_EVENT_VALUE_CHANGED, NULL);
             }
             lvgl_port_unlock();
         }
@@ -678,4 +691,15 @@ void ui_home_set_qr_scan_progress(size_t progress)
         lv_bar_set_value(progress_bar, progress, LV_ANIM_ON);
         lvgl_port_unlock();
     }
-}
\ No newline at end of file
+}
+void ui_home_update_networks(void)
+{
+    if (wallet_list != NULL && lvgl_port_lock(0))
+    {
+        if (wallet_list != NULL)
+        {
+            fill_wallet_list(wallet_list);
+        }
+        lvgl_port_unlock();
+    }
+}
@@ -6,6 +6,7 @@
 #include "esp_log.h"
 #include "ui/ui_master_page.h"
 #include "string.h"
+#include "stdlib.h"
 
 /*********************
  *      DEFINES
@@ -18,16 +19,26 @@
 static lv_obj_t *container = NULL;
 static lv_obj_t *event_target = NULL;
 static ui_master_page_t *master_page = NULL;
+static lv_obj_t *qr = NULL;
+static lv_obj_t *page_label = NULL;
+static lv_obj_t *prev_btn = NULL;
+static lv_obj_t *next_btn = NULL;
+/* pointers and strings of the pages share one allocation */
+static char **pages = NULL;
+static size_t pages_len = 0;
+static size_t page_index = 0;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void ui_event_handler(lv_event_t *e);
+static void page_show(size_t index);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void ui_qr_code_init(char *title, char *text_pre, char *qr_code, char *text_post);
+void ui_qr_code_init_pages(char *title, char *text_pre, char **qr_codes, size_t qr_codes_len, char *text_post);
 void ui_qr_code_destroy(void);
 
 /**********************
@@ -41,6 +52,41 @@ static void ui_event_handler(lv_event_t *e)
         ui_master_page_set_close_button_visibility(false, master_page);
         lv_async_call(ui_qr_code_destroy, NULL);
     }
+    else if (code == LV_EVENT_CLICKED && lv_event_get_target(e) == prev_btn && page_index > 0)
+    {
+        page_show(page_index - 1);
+    }
+    else if (code == LV_EVENT_CLICKED && lv_event_get_target(e) == next_btn && page_index + 1 < pages_len)
+    {
+        page_show(page_index + 1);
+    }
+}
+/* called with the lvgl lock held */
+static void page_show(size_t index)
+{
+    if (qr == NULL || index >= pages_len)
+    {
+        return;
+    }
+    page_index = index;
+    lv_qrcode_update(qr, pages[page_index], strlen(pages[page_index]));
+    lv_label_set_text_fmt(page_label, "%u of %u", (unsigned int)(page_index + 1), (unsigned int)pages_len);
+    if (page_index == 0)
+    {
+        lv_obj_add_state(prev_btn, LV_STATE_DISABLED);
+    }
+    else
+    {
+        lv_obj_clear_state(prev_btn, LV_STATE_DISABLED);
+    }
+    if (page_index + 1 == pages_len)
+    {
+        lv_obj_add_state(next_btn, LV_STATE_DISABLED);
+    }
+    else
+    {
+        lv_obj_clear_state(next_btn, LV_STATE_DISABLED);
+    }
 }
 
 /**********************
@@ -48,6 +94,39 @@ static void ui_event_handler(lv_event_t *e)
  **********************/
 void ui_qr_code_init(char *title, char *text_pre, char *qr_code, char *text_post)
 {
+    ui_qr_code_init_pages(title, text_pre, &qr_code, qr_code != NULL ? 1 : 0, text_post);
+}
+void ui_qr_code_init_pages(char *title, char *text_pre, char **qr_codes, size_t qr_codes_len, char *text_post)
+{
+    if (qr_codes_len > 1)
+    {
+        // the caller frees its strings, keep a copy for paging
+        size_t size = qr_codes_len * sizeof(char *);
+        for (size_t i = 0; i < qr_codes_len; i++)
+        {
+            size += strlen(qr_codes[i]) + 1;
+        }
+        pages = (char **)malloc(size);
+        if (pages == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to allocate %u pages", (unsigned int)qr_codes_len);
+            qr_codes_len = 1;
+        }
+        else
+        {
+            char *p = (char *)(pages + qr_codes_len);
+            for (size_t i = 0; i < qr_codes_len; i++)
+            {
+                size_t len = strlen(qr_codes[i]) + 1;
+                memcpy(p, qr_codes[i], len);
+                pages[i] = p;
+                p += len;
+            }
+            pages_len = qr_codes_len;
+            page_index = 0;
+        }
+    }
+
     if (lvgl_port_lock(0))
     {
         event_target = lv_obj_create(lv_scr_act());
@@ -84,15 +163,44 @@ void ui_qr_code_init(char *title, char *text_pre, char *qr_code, char *text_post
             lv_obj_center(label);
         }
 
-        if (qr_code != NULL)
+        if (qr_codes_len > 0)
         {
-            lv_obj_t *qr = lv_qrcode_create(obj);
+            qr = lv_qrcode_create(obj);
             lv_qrcode_set_size(qr, obj_width);
             lv_qrcode_set_dark_color(qr, lv_color_hex(0x000000));
             lv_qrcode_set_light_color(qr, lv_color_hex(0xffffff));
-            lv_qrcode_update(qr, qr_code, strlen(qr_code));
+            lv_qrcode_update(qr, qr_codes[0], strlen(qr_codes[0]));
             lv_obj_center(qr);
         }
+        if (pages_len > 1)
+        {
+            // one code per page, each one is scanned on its own
+            lv_obj_t *footer = lv_obj_create(obj);
+            NO_BODER_PADDING_STYLE(footer);
+            lv_obj_set_size(footer, LV_PCT(100), LV_SIZE_CONTENT);
+            lv_obj_set_flex_flow(footer, LV_FLEX_FLOW_ROW);
+            lv_obj_set_flex_align(footer, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+            prev_btn = lv_button_create(footer);
+            lv_obj_set_size(prev_btn, LV_PCT(30), LV_SIZE_CONTENT);
+            label = lv_label_create(prev_btn);
+            lv_label_set_text(label, LV_SYMBOL_LEFT);
+            lv_obj_center(label);
+            lv_obj_add_event_cb(prev_btn, ui_event_handler, LV_EVENT_CLICKED, NULL);
+
+            page_label = lv_label_create(footer);
+            lv_obj_set_style_text_align(page_label, LV_TEXT_ALIGN_CENTER, 0);
+            lv_obj_set_width(page_label, LV_PCT(40));
+
+            next_btn = lv_button_create(footer);
+            lv_obj_set_size(next_btn, LV_PCT(30), LV_SIZE_CONTENT);
+            label = lv_label_create(next_btn);
+            lv_label_set_text(label, LV_SYMBOL_RIGHT);
+            lv_obj_center(label);
+            lv_obj_add_event_cb(next_btn, ui_event_handler, LV_EVENT_CLICKED, NULL);
+
+            page_show(0);
+        }
 
         if (text_post != NULL)
         {
@@ -109,6 +217,10 @@ void ui_qr_code_destroy()
 {
     if (lvgl_port_lock(0))
     {
+        qr = NULL;
+        page_label = NULL;
+        prev_btn = NULL;
+        next_btn = NULL;
         if (container != NULL)
         {
             lv_obj_del(container);
@@ -127,4 +239,11 @@ void ui_qr_code_destroy()
         free(master_page);
         master_page = NULL;
     }
+    if (pages != NULL)
+    {
+        free(pages);
+        pages = NULL;
+    }
+    pages_len = 0;
+    page_index = 0;
 }
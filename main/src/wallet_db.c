@@ -19,13 +19,14 @@
 #define DEFAULT_INCORRECT_PIN_COUNT 5
 #define LOCK_SCREEN_TIMEOUT_MS 1000 * 60 * 5 // 5m
 #define SIGN_PIN_REQUIRED true
-#define VERSION 1
+#define VERSION 2
+#define VERSION_AES_ECB 1
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static const char *TAG = "wallet_db";
-static wallet_data_version_1_t *walletData_cache = NULL;
+static wallet_data_version_2_t *walletData_cache = NULL;
 static char rootPrivateKey_cache[PRIVATE_KEY_SIZE + 1] = {0};
 static char temp[64];
 
@@ -33,16 +34,18 @@ static char temp[64];
  *  STATIC PROTOTYPES
  **********************/
 static void pin_avoid_rainbow_table(const char *pinStr, const uint8_t padding[32], uint8_t key[32]);
-static uint32_t checksum(wallet_data_version_1_t *walletData);
+static uint32_t checksum(const void *walletData, size_t size);
+static void seal_private_key(wallet_data_version_2_t *walletData, const uint8_t key[32], const char *privateKey);
+static bool unseal_private_key(const wallet_data_version_2_t *walletData, const uint8_t key[32], uint8_t privateKey[PRIVATE_KEY_SIZE]);
 static void reset_task(void *parameters);
-size_t wallet_data_to_bin(wallet_data_version_1_t *walletData, char **hex);
-void wallet_data_from_bin(wallet_data_version_1_t *walletData, const char *hex, size_t len);
+size_t wallet_data_to_bin(wallet_data_version_2_t *walletData, char **hex);
+void wallet_data_from_bin(wallet_data_version_2_t *walletData, const char *hex, size_t len);
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
-bool wallet_db_load_wallet_data(wallet_data_version_1_t *walletData);
-void wallet_db_save_wallet_data(wallet_data_version_1_t *walletData);
+bool wallet_db_load_wallet_data(wallet_data_version_2_t *walletData);
+void wallet_db_save_wallet_data(wallet_data_version_2_t *walletData);
 bool wallet_db_init_wallet_data(char *phrase_str, char *pin_str, char **private_key_str);
 void wallet_db_clear_cache();
 char *wallet_db_verify_pin(char *pin_str);
@@ -70,15 +73,42 @@ static void pin_avoid_rainbow_table(const char *pinStr, const uint8_t padding[32
     free(str);
     str = NULL;
 }
-static uint32_t checksum(wallet_data_version_1_t *walletData)
+static uint32_t checksum(const void *walletData, size_t size)
 {
-    // copy walletData to m,except `uint32_t checksum`
-    size_t size = sizeof(wallet_data_version_1_t) - sizeof(uint32_t);
-    uint8_t *m = (uint8_t *)malloc(size);
-    memcpy(m, walletData, size);
-    uint32_t c = crc32(0, m, size);
-    free(m);
-    return c;
+    // crc of everything except the trailing `uint32_t checksum`
+    return crc32(0, (const uint8_t *)walletData, size - sizeof(uint32_t));
+}
+static void seal_private_key(wallet_data_version_2_t *walletData, const uint8_t key[32], const char *privateKey)
+{
+    uint8_t plaintext[PRIVATE_KEY_SIZE] = {0};
+    strncpy((char *)plaintext, privateKey, PRIVATE_KEY_SIZE);
+    esp_fill_random(walletData->privateKeyIv, AES_GCM_IV_SIZE);
+    int ret = aes_gcm_encrypt(key, walletData->privateKeyIv,
+                              walletData->pinPadding, sizeof(walletData->pinPadding),
+                              plaintext, PRIVATE_KEY_SIZE,
+                              (uint8_t *)(walletData->privateKey), walletData->privateKeyTag);
+    memset(plaintext, 0, sizeof(plaintext));
+    if (ret != 0)
+    {
+        ESP_LOGE(TAG, "aes_gcm_encrypt failed: %d", ret);
+        ui_panic("encrypt failed", PANIC_REBOOT);
+        return;
+    }
+    walletData->version = VERSION;
+}
+static bool unseal_private_key(const wallet_data_version_2_t *walletData, const uint8_t key[32], uint8_t privateKey[PRIVATE_KEY_SIZE])
+{
+    if (walletData->version == VERSION_AES_ECB)
+    {
+        /* v1 record has no tag, the caller still checks the "xprv" prefix */
+        return aes_decrypt(key,
+                           (const uint8_t *)(walletData->privateKey), PRIVATE_KEY_SIZE,
+                           privateKey) == 0;
+    }
+    return aes_gcm_decrypt(key, walletData->privateKeyIv,
+                           walletData->pinPadding, sizeof(walletData->pinPadding),
+                           (const uint8_t *)(walletData->privateKey), PRIVATE_KEY_SIZE,
+                           walletData->privateKeyTag, privateKey) == 0;
 }
 static void reset_task(void *parameters)
 {
@@ -88,9 +118,9 @@ static void reset_task(void *parameters)
     vTaskDelete(NULL);
 }
 
-size_t wallet_data_to_bin(wallet_data_version_1_t *walletData, char **hex)
+size_t wallet_data_to_bin(wallet_data_version_2_t *walletData, char **hex)
 {
-    size_t size = sizeof(wallet_data_version_1_t);
+    size_t size = sizeof(wallet_data_version_2_t);
     *hex = (char *)malloc(size);
     if (*hex == NULL)
     {
@@ -100,28 +130,50 @@ size_t wallet_data_to_bin(wallet_data_version_1_t *walletData, char **hex)
     memcpy(*hex, walletData, size);
     return size;
 }
-void wallet_data_from_bin(wallet_data_version_1_t *walletData, const char *hex, size_t len)
+void wallet_data_from_bin(wallet_data_version_2_t *walletData, const char *hex, size_t len)
 {
-    size_t size = sizeof(wallet_data_version_1_t);
-    if (len < size)
+    size_t size = sizeof(wallet_data_version_2_t);
+    if (len >= size)
     {
-        ESP_LOGI(TAG, "len < sizeof(wallet_data_version_1_t)");
+        memcpy(walletData, hex, size);
+    }
+    else if (len >= sizeof(wallet_data_version_1_t))
+    {
+        /* v1 record: upgrade the layout, the key is re-sealed on the next successful pin check */
+        wallet_data_version_1_t walletData_v1;
+        memcpy(&walletData_v1, hex, sizeof(wallet_data_version_1_t));
         memset(walletData, 0, size);
+        walletData->version = walletData_v1.version;
+        walletData->initialized = walletData_v1.initialized;
+        walletData->incorrectPinCount = walletData_v1.incorrectPinCount;
+        walletData->incorrectPinCountMax = walletData_v1.incorrectPinCountMax;
+        walletData->lockScreenTimeout = walletData_v1.lockScreenTimeout;
+        walletData->signPinRequired = walletData_v1.signPinRequired;
+        memcpy(walletData->pinPadding, walletData_v1.pinPadding, sizeof(walletData->pinPadding));
+        memcpy(walletData->privateKey, walletData_v1.privateKey, PRIVATE_KEY_SIZE);
+        walletData->checksum = checksum(walletData, size);
+        if (walletData_v1.checksum != checksum(&walletData_v1, sizeof(wallet_data_version_1_t)))
+        {
+            // keep the checksum error visible to the caller
+            walletData->checksum = ~walletData->checksum;
+        }
+        memset(&walletData_v1, 0, sizeof(wallet_data_version_1_t));
     }
     else
     {
-        memcpy(walletData, hex, size);
+        ESP_LOGI(TAG, "len < sizeof(wallet_data_version_1_t)");
+        memset(walletData, 0, size);
     }
 }
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
-bool wallet_db_load_wallet_data(wallet_data_version_1_t *walletData)
+bool wallet_db_load_wallet_data(wallet_data_version_2_t *walletData)
 {
     if (walletData_cache != NULL)
     {
-        memcpy(walletData, walletData_cache, sizeof(wallet_data_version_1_t));
+        memcpy(walletData, walletData_cache, sizeof(wallet_data_version_2_t));
         return true;
     }
 
@@ -142,7 +194,7 @@ bool wallet_db_load_wallet_data(wallet_data_version_1_t *walletData)
     if (walletData->initialized == true)
     {
         // checksum
-        int checksum_value = checksum(walletData);
+        uint32_t checksum_value = checksum(walletData, sizeof(wallet_data_version_2_t));
         if (walletData->checksum != checksum_value)
         {
             wallet_db_reset_device();
@@ -152,22 +204,22 @@ bool wallet_db_load_wallet_data(wallet_data_version_1_t *walletData)
         {
             if (walletData_cache == NULL)
             {
-                walletData_cache = (wallet_data_version_1_t *)malloc(sizeof(wallet_data_version_1_t));
+                walletData_cache = (wallet_data_version_2_t *)malloc(sizeof(wallet_data_version_2_t));
             }
-            memcpy(walletData_cache, walletData, sizeof(wallet_data_version_1_t));
+            memcpy(walletData_cache, walletData, sizeof(wallet_data_version_2_t));
             return true;
         }
     }
     return false;
 }
-void wallet_db_save_wallet_data(wallet_data_version_1_t *walletData)
+void wallet_db_save_wallet_data(wallet_data_version_2_t *walletData)
 {
     if (walletData->initialized == false)
     {
         ui_panic("walletData is not initialized", PANIC_REBOOT);
         return;
     }
-    walletData->checksum = checksum(walletData);
+    walletData->checksum = checksum(walletData, sizeof(wallet_data_version_2_t));
     char *walletDataStr = NULL;
     size_t len = wallet_data_to_bin(walletData, &walletDataStr);
     if (kv_save(KV_FS_KEY_WALLET, walletDataStr, len) != ESP_OK)
@@ -179,30 +231,26 @@ void wallet_db_save_wallet_data(wallet_data_version_1_t *walletData)
     walletDataStr = NULL;
     if (walletData_cache == NULL)
     {
-        walletData_cache = (wallet_data_version_1_t *)malloc(sizeof(wallet_data_version_1_t));
+        walletData_cache = (wallet_data_version_2_t *)malloc(sizeof(wallet_data_version_2_t));
     }
-    memcpy(walletData_cache, walletData, sizeof(wallet_data_version_1_t));
+    memcpy(walletData_cache, walletData, sizeof(wallet_data_version_2_t));
 }
 bool wallet_db_init_wallet_data(char *phrase_str, char *pin_str, char **private_key_str)
 {
     Wallet wallet = wallet_init_from_mnemonic(phrase_str);
     char *root_private_key = wallet_root_private_key(wallet);
-    wallet_data_version_1_t *walletData = malloc(sizeof(wallet_data_version_1_t));
-    memset(walletData, 0, sizeof(wallet_data_version_1_t));
+    wallet_data_version_2_t *walletData = malloc(sizeof(wallet_data_version_2_t));
+    memset(walletData, 0, sizeof(wallet_data_version_2_t));
     walletData->signPinRequired = SIGN_PIN_REQUIRED;
     esp_fill_random(walletData->pinPadding, 32);
     uint8_t *key = malloc(32);
     pin_avoid_rainbow_table(pin_str, walletData->pinPadding, key);
-    aes_encrypt(key,
-                (uint8_t *)root_private_key,
-                PRIVATE_KEY_SIZE, (uint8_t *)(walletData->privateKey));
+    seal_private_key(walletData, key, root_private_key);
     // test decrypt
     {
-        uint8_t rootPrivateKey[PRIVATE_KEY_SIZE + 1];
-        aes_decrypt(key,
-                    (uint8_t *)(walletData->privateKey), PRIVATE_KEY_SIZE,
-                    rootPrivateKey);
-        if (strcmp(root_private_key, (char *)rootPrivateKey) != 0)
+        uint8_t rootPrivateKey[PRIVATE_KEY_SIZE + 1] = {0};
+        if (!unseal_private_key(walletData, key, rootPrivateKey) ||
+            strcmp(root_private_key, (char *)rootPrivateKey) != 0)
         {
             free(root_private_key);
             root_private_key = NULL;
@@ -221,13 +269,12 @@ bool wallet_db_init_wallet_data(char *phrase_str, char *pin_str, char **private_
     key = NULL;
 
     walletData->initialized = true;
-    walletData->version = VERSION;
     walletData->incorrectPinCount = 0;
     walletData->incorrectPinCountMax = DEFAULT_INCORRECT_PIN_COUNT;
     walletData->lockScreenTimeout = LOCK_SCREEN_TIMEOUT_MS;
     wallet_db_save_wallet_data(walletData);
     // read from storage test
-    wallet_data_version_1_t *walletData_read = malloc(sizeof(wallet_data_version_1_t));
+    wallet_data_version_2_t *walletData_read = malloc(sizeof(wallet_data_version_2_t));
     if (wallet_db_load_wallet_data(walletData_read) == false)
     {
         ui_panic("load_wallet_data failed", PANIC_REBOOT);
@@ -278,21 +325,30 @@ char *wallet_db_verify_pin(char *pin_str)
     // check pin
     uint8_t *key = malloc(32);
     pin_avoid_rainbow_table(pin_str, walletData_cache->pinPadding, key);
-    uint8_t rootPrivateKey[PRIVATE_KEY_SIZE + 1];
-    aes_decrypt(key,
-                (uint8_t *)(walletData_cache->privateKey), PRIVATE_KEY_SIZE,
-                rootPrivateKey);
+    uint8_t rootPrivateKey[PRIVATE_KEY_SIZE + 1] = {0};
+    bool unsealed = unseal_private_key(walletData_cache, key, rootPrivateKey);
     rootPrivateKey[PRIVATE_KEY_SIZE] = '\0';
-    free(key);
-    key = NULL;
     char *_root_private_key_str = (char *)rootPrivateKey;
-    if (strncmp(_root_private_key_str, "xprv", 4) == 0 && strlen(_root_private_key_str) < PRIVATE_KEY_SIZE + 1)
+    if (unsealed && strncmp(_root_private_key_str, "xprv", 4) == 0 && strlen(_root_private_key_str) < PRIVATE_KEY_SIZE + 1)
     {
+        bool dirty = false;
+        if (walletData_cache->version != VERSION)
+        {
+            // migrate v1 (ECB) vault to the authenticated format
+            seal_private_key(walletData_cache, key, _root_private_key_str);
+            dirty = true;
+        }
         if (walletData_cache->incorrectPinCount > 0)
         {
             walletData_cache->incorrectPinCount = 0;
+            dirty = true;
+        }
+        if (dirty)
+        {
             wallet_db_save_wallet_data(walletData_cache);
         }
+        free(key);
+        key = NULL;
 
         strcpy(rootPrivateKey_cache, _root_private_key_str);
         /* verify pin success */
@@ -300,6 +356,8 @@ char *wallet_db_verify_pin(char *pin_str)
     }
     else
     {
+        free(key);
+        key = NULL;
         if (strncmp(_root_private_key_str, "xprv", 4) == 0)
         {
             // DEBUG
@@ -332,7 +390,7 @@ void wallet_db_reset_device()
 }
 char *wallet_db_passcode_static_error_msg()
 {
-    wallet_data_version_1_t walletData;
+    wallet_data_version_2_t walletData;
     if (wallet_db_load_wallet_data(&walletData) == false)
     {
         return "Can't load wallet data";
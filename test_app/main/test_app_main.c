@@ -0,0 +1,17 @@
+/*********************
+ *      INCLUDES
+ *********************/
+#include "unity.h"
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void app_main(void)
+{
+    /* run everything once for CI, then leave the menu for picking single cases or tags */
+    UNITY_BEGIN();
+    unity_run_all_tests();
+    UNITY_END();
+
+    unity_run_menu();
+}